@@ -56,6 +56,13 @@ public:
      */
     virtual void onMessageRequestTimeout() = 0;
 
+    /**
+     * Notification that AVS throttled or refused a @c MessageRequest, indicating that fewer requests should be sent
+     * concurrently. The default implementation ignores the notification.
+     */
+    virtual void onMessageRequestThrottled() {
+    }
+
     /**
      * Notification that sending a @c MessageRequest has failed or been acknowledged by AVS
      * (this is used to indicate it is okay to send the next message).
@@ -69,6 +69,21 @@ public:
 
         /// The elapsed time without any activity before sending out a ping.
         std::chrono::seconds inactivityTimeout;
+
+        /**
+         * The maximum number of @c MessageRequests sent concurrently. The downchannel and ping use two more streams.
+         * The actual limit adapts below this value while AVS throttles requests. Values outside of 1 to 8 are clamped
+         * into that range.
+         */
+        int maxConcurrentMessageRequests;
+
+        /**
+         * The number of concurrent @c MessageRequests reserved for @c MessageRequest::Priority::INTERACTIVE ones.
+         * Requests of other priorities may only use the remaining streams, so the default of 1 leaves 7 of the 8
+         * streams to them. Values below 0 are clamped to 0, and values of @c maxConcurrentMessageRequests or more are
+         * clamped to one less than it.
+         */
+        int reservedInteractiveMessageRequests;
     };
 
     /**
@@ -161,6 +176,7 @@ public:
     void onDownchannelFinished() override;
     void onMessageRequestSent(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) override;
     void onMessageRequestTimeout() override;
+    void onMessageRequestThrottled() override;
     void onMessageRequestAcknowledged(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) override;
     void onMessageRequestFinished() override;
     void onPingRequestAcknowledged(bool success) override;
@@ -321,6 +337,18 @@ private:
      */
     State sendMessagesAndPings(State whileState, MessageRequestQueueInterface& requestQueue);
 
+    /**
+     * Get the lowest priority of the @c MessageRequests which may be sent given the requests already in flight.
+     * Once the number of requests in flight reaches the non-reserved part of the limit, only
+     * @c MessageRequest::Priority::INTERACTIVE requests may be sent.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param[out] lowestPriority The lowest priority which may be sent.
+     * @return Whether any request may be sent.
+     */
+    bool getLowestSendablePriorityLocked(avsCommon::avs::MessageRequest::Priority* lowestPriority) const;
+
     /**
      * Set the state to a new state.
      *
@@ -428,6 +456,12 @@ private:
     /// The number of message handlers that are not finished with their request.
     int m_countOfUnfinishedMessageHandlers;
 
+    /// The current limit of concurrent message requests. Halved when AVS throttles, grown back as requests finish.
+    int m_messageRequestLimit;
+
+    /// The number of message requests finished since @c m_messageRequestLimit last changed.
+    int m_messageRequestsFinishedSinceLimitChange;
+
     /// The current ping handler (if any).
     std::shared_ptr<PingHandler> m_pingHandler;
 
@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MESSAGEREQUESTQUEUE_H_
 #define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_MESSAGEREQUESTQUEUE_H_
 
+#include <array>
 #include <deque>
 #include <memory>
 #include <unordered_map>
@@ -32,6 +33,13 @@ namespace acl {
 /**
  * Class to manage @c MessageRequest send queues in HTTP2Transport.
  *
+ * Requests are kept in one FIFO lane per @c MessageRequest::Priority. Sendable requests are taken from the highest
+ * priority lane first, so a burst of low priority requests does not delay interactive ones. Serialized requests are
+ * blocked in every lane while waiting for a send acknowledgement.
+ *
+ * Ordering is only kept within a lane: a request may be sent before an older request of a lower priority. Messages
+ * which AVS must receive in order have to be given the same priority.
+ *
  * Note: This class is not thread safe. The user should ensure thread safety.
  */
 class MessageRequestQueue : public MessageRequestQueueInterface {
@@ -47,7 +55,11 @@ public:
     avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> peekRequestTime() override;
     std::shared_ptr<avsCommon::avs::MessageRequest> dequeueOldestRequest() override;
     std::shared_ptr<avsCommon::avs::MessageRequest> dequeueSendableRequest() override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueSendableRequest(
+        avsCommon::avs::MessageRequest::Priority lowestPriority,
+        std::chrono::steady_clock::duration* queuedDuration) override;
     bool isMessageRequestAvailable() const override;
+    bool isMessageRequestAvailable(avsCommon::avs::MessageRequest::Priority lowestPriority) const override;
     void setWaitingForSendAcknowledgement() override;
     void clearWaitingForSendAcknowledgement() override;
     bool empty() const override;
@@ -55,13 +67,34 @@ public:
     /// @}
 
 private:
+    /// A queue of @c MessageRequests to be sent, paired with the time that each request was added to the queue.
+    using Lane = std::deque<
+        std::pair<std::chrono::time_point<std::chrono::steady_clock>, std::shared_ptr<avsCommon::avs::MessageRequest>>>;
+
+    /// The number of send lanes, one per @c MessageRequest::Priority.
+    static constexpr size_t NUMBER_OF_LANES =
+        static_cast<size_t>(avsCommon::avs::MessageRequest::Priority::BACKGROUND) + 1;
+
+    /**
+     * Find the lane holding the oldest queued request.
+     *
+     * @return The oldest lane, or @c nullptr if all lanes are empty.
+     */
+    Lane* findOldestLane();
+
+    /**
+     * Check whether a request may be sent given the current acknowledgement state.
+     *
+     * @param messageRequest The request to check.
+     * @return Whether the request may be sent.
+     */
+    bool isSendable(const std::shared_ptr<avsCommon::avs::MessageRequest>& messageRequest) const;
+
     /// Flag indicating whether to block sending serialized messages.
     bool m_isWaitingForAcknowledgement;
 
-    /// The queue of @c MessageRequests to be sent, paired with the time that each request was added to the queue.
-    std::deque<
-        std::pair<std::chrono::time_point<std::chrono::steady_clock>, std::shared_ptr<avsCommon::avs::MessageRequest>>>
-        m_queue;
+    /// The send lanes, indexed by @c MessageRequest::Priority.
+    std::array<Lane, NUMBER_OF_LANES> m_lanes;
 };
 
 }  // namespace acl
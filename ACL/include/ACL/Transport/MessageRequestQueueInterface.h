@@ -66,6 +66,19 @@ public:
      */
     virtual std::shared_ptr<avsCommon::avs::MessageRequest> dequeueSendableRequest() = 0;
 
+    /**
+     * Dequeues the next available @c MessageRequest like @c dequeueSendableRequest(), considering only the send lanes
+     * with a @c MessageRequest::Priority at or above @c lowestPriority. Higher priority lanes are drained first, and
+     * each lane is drained in the order requests were queued.
+     *
+     * @param lowestPriority The lowest priority lane to dequeue from.
+     * @param[out] queuedDuration If not @c nullptr, receives the time the returned request spent in the queue.
+     * @return @c MessageRequest if available, else return nullptr.
+     */
+    virtual std::shared_ptr<avsCommon::avs::MessageRequest> dequeueSendableRequest(
+        avsCommon::avs::MessageRequest::Priority lowestPriority,
+        std::chrono::steady_clock::duration* queuedDuration) = 0;
+
     /**
      * This method checks if there is a @c MessageRequest available to be sent.
      *
@@ -73,6 +86,15 @@ public:
      */
     virtual bool isMessageRequestAvailable() const = 0;
 
+    /**
+     * This method checks if there is a @c MessageRequest available to be sent in the send lanes with a
+     * @c MessageRequest::Priority at or above @c lowestPriority.
+     *
+     * @param lowestPriority The lowest priority lane to consider.
+     * @return true if @c MessageRequest is available to be sent, else false.
+     */
+    virtual bool isMessageRequestAvailable(avsCommon::avs::MessageRequest::Priority lowestPriority) const = 0;
+
     /**
      * Sets the flag indicating that the queue is waiting for a send to be acknowledged.
      */
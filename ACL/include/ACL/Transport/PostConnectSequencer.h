@@ -16,13 +16,18 @@
 #ifndef ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_POSTCONNECTSEQUENCER_H_
 #define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_POSTCONNECTSEQUENCER_H_
 
+#include <chrono>
+#include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <thread>
+#include <vector>
 
 #include <AVSCommon/SDKInterfaces/PostConnectOperationInterface.h>
 #include <AVSCommon/SDKInterfaces/MessageRequestObserverInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Power/PowerResource.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 
@@ -44,7 +49,12 @@ struct PostConnectOperationPriorityCompare {
 };
 
 /**
- * Class that runs a @c PostConnectOperationInterface list in sequence.
+ * Class that runs a @c PostConnectOperationInterface list ordered by priority.
+ *
+ * An operation is started as soon as every operation it depends on (see
+ * @c PostConnectOperationInterface::dependsOn()) has completed successfully. Operations which do not depend on each
+ * other run concurrently. If any operation fails, the ones still running are aborted and the observer is notified of
+ * an unrecoverable failure. The time from the start of the post connect to its completion is reported as a metric.
  */
 class PostConnectSequencer : public PostConnectInterface {
 public:
@@ -56,9 +66,12 @@ public:
      * Creates a @c PostConnectSequencer instance.
      *
      * @param postConnectOperations The ordered list of @c PostConnectOperationInterfaces.
+     * @param metricRecorder The object used to record the time taken by the post connect. May be @c nullptr.
      * @return a new instance of the @c PostConnectSequencer.
      */
-    static std::shared_ptr<PostConnectSequencer> create(const PostConnectOperationsSet& postConnectOperations);
+    static std::shared_ptr<PostConnectSequencer> create(
+        const PostConnectOperationsSet& postConnectOperations,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
 
     /**
      * Destructor.
@@ -73,15 +86,30 @@ public:
     void onDisconnect() override;
     ///@}
 private:
+    /// The execution state of an operation.
+    enum class OperationState {
+        /// The operation is waiting for its dependencies.
+        PENDING,
+        /// The operation is being performed.
+        RUNNING,
+        /// The operation completed successfully.
+        SUCCEEDED,
+        /// The operation failed.
+        FAILED
+    };
+
     /**
      * Constructor.
      *
      * @param postConnectOperations The ordered list of @c PostConnectOperationInterfaces.
+     * @param metricRecorder The object used to record the time taken by the post connect.
      */
-    PostConnectSequencer(const PostConnectOperationsSet& postConnectOperations);
+    PostConnectSequencer(
+        const PostConnectOperationsSet& postConnectOperations,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
 
     /**
-     * Loop to iterate through the @c PostConnectOperationsSet and execute them in sequence.
+     * Loop to schedule the operations of the @c PostConnectOperationsSet as their dependencies complete.
      *
      * @param postConnectSender The @c MessageSenderInterface to send post connect messages.
      * @param postConnectObserver The @c PostConnectObserverInterface to get notified on successful completion of the
@@ -91,6 +119,26 @@ private:
         std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> postConnectSender,
         std::shared_ptr<PostConnectObserverInterface> postConnectObserver);
 
+    /**
+     * Perform a single operation and record its outcome. This is the body of the threads started by @c mainLoop().
+     *
+     * @param index The index of the operation in @c m_operations.
+     * @param postConnectSender The @c MessageSenderInterface to send post connect messages.
+     */
+    void runOperation(
+        size_t index,
+        std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> postConnectSender);
+
+    /**
+     * Check whether every dependency of an operation completed successfully.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param index The index of the operation in @c m_operations.
+     * @return Whether the operation may be started.
+     */
+    bool isReadyLocked(size_t index) const;
+
     /**
      * Stop mainLoop().  This method blocks until mainLoop() exits or the operation fails.
      *
@@ -99,27 +147,40 @@ private:
     void stop();
 
     /**
-     * A Thread safe method to reset the current post connect operation.
+     * Abort every running operation.
+     *
+     * @note This must be called with @c m_mutex held.
      */
-    void resetCurrentOperation();
+    void abortRunningOperationsLocked();
 
     /**
-     * Thread safe method to check if the @c PostConnectSequencer is stopping.
-     * @return
+     * Report the time taken by a post connect.
+     *
+     * @param elapsed The time from the start of the post connect to its completion.
+     * @param succeeded Whether the post connect completed successfully.
      */
-    bool isStopping();
+    void submitMetric(std::chrono::milliseconds elapsed, bool succeeded);
+
+    /// The object used to record the time taken by the post connect.
+    const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 
     /// Serializes access to members.
     std::mutex m_mutex;
 
-    /// Current PostConnectOperation being processed.
-    std::shared_ptr<avsCommon::sdkInterfaces::PostConnectOperationInterface> m_currentPostConnectOperation;
+    /// Notified whenever an operation completes or a shutdown is initiated.
+    std::condition_variable m_wakeTrigger;
 
     /// Flag indicating a shutdown is initiated.
     bool m_isStopping;
 
-    /// The ordered @c PostConnectOperationInterface list that will be executed in sequence.
-    PostConnectOperationsSet m_postConnectOperations;
+    /// The operations, ordered by ascending priority.
+    std::vector<std::shared_ptr<avsCommon::sdkInterfaces::PostConnectOperationInterface>> m_operations;
+
+    /// For each operation in @c m_operations, the indices of the operations it depends on.
+    std::vector<std::vector<size_t>> m_dependencies;
+
+    /// For each operation in @c m_operations, its execution state.
+    std::vector<OperationState> m_states;
 
     /// Mutex to synchronize access to the mainloop thread.
     std::mutex m_mainLoopThreadMutex;
@@ -22,6 +22,7 @@
 #include "ACL/Transport/PostConnectFactoryInterface.h"
 #include <acsdkPostConnectOperationProviderRegistrarInterfaces/PostConnectOperationProviderRegistrarInterface.h>
 #include <AVSCommon/SDKInterfaces/PostConnectOperationProviderInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 
 namespace alexaClientSDK {
 namespace acl {
@@ -38,22 +39,26 @@ public:
      * Creates a new instance of the @c PostConnectSequencer.
      *
      * @param providerRegistrar Registrar from which to get @c PostConnectOperationProviders.
+     * @param metricRecorder The object used to record the time taken by each post connect. May be @c nullptr.
      * @return A new instance of the @c PostConnectSequencer.
      */
     static std::shared_ptr<PostConnectFactoryInterface> createPostConnectFactoryInterface(
         const std::shared_ptr<
             acsdkPostConnectOperationProviderRegistrarInterfaces::PostConnectOperationProviderRegistrarInterface>&
-            providerRegistrar);
+            providerRegistrar,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder = nullptr);
 
     /**
      * Creates a new instance of the @c PostConnectSequencer.
      *
      * @deprecated
      * @param postConnectOperationProviders The vector of @c PostConnectOperationProviders.
+     * @param metricRecorder The object used to record the time taken by each post connect. May be @c nullptr.
      * @return a new instance of the @c PostConnectSequencer.
      */
     static std::shared_ptr<PostConnectSequencerFactory> create(
-        const std::vector<std::shared_ptr<PostConnectOperationProviderInterface>>& postConnectOperationProviders);
+        const std::vector<std::shared_ptr<PostConnectOperationProviderInterface>>& postConnectOperationProviders,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder = nullptr);
 
     /// @name PostConnectFactoryInterface methods
     /// @{
@@ -65,16 +70,21 @@ private:
      * Constructor.
      *
      * @param postConnectOperationProviders The source of post connect providers.
+     * @param metricRecorder The object used to record the time taken by each post connect.
      */
     PostConnectSequencerFactory(
         const std::shared_ptr<
             acsdkPostConnectOperationProviderRegistrarInterfaces::PostConnectOperationProviderRegistrarInterface>&
-            providerRegistrar);
+            providerRegistrar,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder);
 
     /// Source of post connect providers
     std::shared_ptr<
         acsdkPostConnectOperationProviderRegistrarInterfaces::PostConnectOperationProviderRegistrarInterface>
         m_registrar;
+
+    /// The object used to record the time taken by each post connect.
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 };
 
 }  // namespace acl
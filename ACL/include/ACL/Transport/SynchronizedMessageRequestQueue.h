@@ -49,7 +49,11 @@ public:
     avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> peekRequestTime() override;
     std::shared_ptr<avsCommon::avs::MessageRequest> dequeueOldestRequest() override;
     std::shared_ptr<avsCommon::avs::MessageRequest> dequeueSendableRequest() override;
+    std::shared_ptr<avsCommon::avs::MessageRequest> dequeueSendableRequest(
+        avsCommon::avs::MessageRequest::Priority lowestPriority,
+        std::chrono::steady_clock::duration* queuedDuration) override;
     bool isMessageRequestAvailable() const override;
+    bool isMessageRequestAvailable(avsCommon::avs::MessageRequest::Priority lowestPriority) const override;
     void setWaitingForSendAcknowledgement() override;
     void clearWaitingForSendAcknowledgement() override;
     bool empty() const override;
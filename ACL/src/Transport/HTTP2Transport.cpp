@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 
@@ -21,6 +22,7 @@
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 #include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
 #include <AVSCommon/Utils/Power/PowerMonitor.h>
 #include <ACL/Transport/PostConnectInterface.h>
 
@@ -67,6 +69,13 @@ static const int MAX_STREAMS = 10;
 /// Max number of message requests MAX_STREAMS - 2 (for the downchannel stream and the ping stream)
 static const int MAX_MESSAGE_HANDLERS = MAX_STREAMS - 2;
 
+/**
+ * Default number of concurrent message requests reserved for interactive requests. Requests of other priorities are
+ * limited to MAX_MESSAGE_HANDLERS - RESERVED_INTERACTIVE_MESSAGE_HANDLERS (7) concurrent requests, one less than
+ * before priorities were introduced.
+ */
+static const int RESERVED_INTERACTIVE_MESSAGE_HANDLERS = 1;
+
 /// Timeout to send a ping to AVS if there has not been any other acitivity on the connection.
 static std::chrono::minutes INACTIVITY_TIMEOUT{5};
 
@@ -82,6 +91,12 @@ static const std::string MESSAGE_SEND_ERROR = "ERROR.MESSAGE_SEND_FAILED";
 /// Metric identifier for disconnect reason.
 static const std::string DISCONNECT_REASON = "DISCONNECT_REASON";
 
+/// Metric identifier for the time a message request spent queued, suffixed with the priority of its lane.
+static const std::string MESSAGE_QUEUE_WAIT = "MESSAGE_QUEUE_WAIT_";
+
+/// Name of the data point holding the time a message request spent queued.
+static const std::string QUEUE_WAIT_TIME = "QUEUE_WAIT_TIME";
+
 /**
  * Capture metric for Disconnects along with Disconnect reason.
  *
@@ -152,6 +167,40 @@ static void submitMessageSendErrorMetric(
     recordMetric(metricRecorder, metricEvent);
 }
 
+/**
+ * Capture metric for the time a message request spent queued before being sent.
+ *
+ * @param metricRecorder The metric recorder object.
+ * @param priority The priority of the lane the message was queued in.
+ * @param queuedDuration The time the message spent queued.
+ */
+static void submitMessageQueueWaitMetric(
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder,
+    MessageRequest::Priority priority,
+    std::chrono::steady_clock::duration queuedDuration) {
+    if (!metricRecorder) {
+        return;
+    }
+
+    std::stringstream ss;
+    ss << priority;
+
+    auto metricEvent =
+        MetricEventBuilder{}
+            .setActivityName(HTTP2TRANSPORT_METRIC_SOURCE_PREFIX + MESSAGE_QUEUE_WAIT + ss.str())
+            .addDataPoint(DataPointDurationBuilder{std::chrono::duration_cast<std::chrono::milliseconds>(queuedDuration)}
+                              .setName(QUEUE_WAIT_TIME)
+                              .build())
+            .build();
+
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("submitMessageQueueWaitMetricFailed").d("reason", "invalid metric event"));
+        return;
+    }
+
+    recordMetric(metricRecorder, metricEvent);
+}
+
 /**
  * Write a @c HTTP2Transport::State value to an @c ostream as a string.
  *
@@ -183,7 +232,10 @@ std::ostream& operator<<(std::ostream& stream, HTTP2Transport::State state) {
     return stream << "";
 }
 
-HTTP2Transport::Configuration::Configuration() : inactivityTimeout{INACTIVITY_TIMEOUT} {
+HTTP2Transport::Configuration::Configuration() :
+        inactivityTimeout{INACTIVITY_TIMEOUT},
+        maxConcurrentMessageRequests{MAX_MESSAGE_HANDLERS},
+        reservedInteractiveMessageRequests{RESERVED_INTERACTIVE_MESSAGE_HANDLERS} {
 }
 
 std::shared_ptr<HTTP2Transport> HTTP2Transport::create(
@@ -243,6 +295,27 @@ std::shared_ptr<HTTP2Transport> HTTP2Transport::create(
         return nullptr;
     }
 
+    auto maxConcurrentMessageRequests =
+        std::min(std::max(configuration.maxConcurrentMessageRequests, 1), MAX_MESSAGE_HANDLERS);
+    if (maxConcurrentMessageRequests != configuration.maxConcurrentMessageRequests) {
+        ACSDK_WARN(LX("createClampedConfiguration")
+                       .d("reason", "maxConcurrentMessageRequestsOutOfRange")
+                       .d("from", configuration.maxConcurrentMessageRequests)
+                       .d("to", maxConcurrentMessageRequests));
+        configuration.maxConcurrentMessageRequests = maxConcurrentMessageRequests;
+    }
+
+    // At least one request which is not interactive must be able to be sent.
+    auto reservedInteractiveMessageRequests = std::min(
+        std::max(configuration.reservedInteractiveMessageRequests, 0), configuration.maxConcurrentMessageRequests - 1);
+    if (reservedInteractiveMessageRequests != configuration.reservedInteractiveMessageRequests) {
+        ACSDK_WARN(LX("createClampedConfiguration")
+                       .d("reason", "reservedInteractiveMessageRequestsOutOfRange")
+                       .d("from", configuration.reservedInteractiveMessageRequests)
+                       .d("to", reservedInteractiveMessageRequests));
+        configuration.reservedInteractiveMessageRequests = reservedInteractiveMessageRequests;
+    }
+
     auto transport = std::shared_ptr<HTTP2Transport>(new HTTP2Transport(
         std::move(authDelegate),
         avsGateway,
@@ -283,6 +356,8 @@ HTTP2Transport::HTTP2Transport(
         m_eventTracer{std::move(eventTracer)},
         m_connectRetryCount{0},
         m_countOfUnfinishedMessageHandlers{0},
+        m_messageRequestLimit{configuration.maxConcurrentMessageRequests},
+        m_messageRequestsFinishedSinceLimitChange{0},
         m_postConnected{false},
         m_configuration{configuration},
         m_disconnectReason{ConnectionStatusObserverInterface::ChangedReason::NONE} {
@@ -578,6 +653,16 @@ void HTTP2Transport::onMessageRequestTimeout() {
     onWakeVerifyConnectivity();
 }
 
+void HTTP2Transport::onMessageRequestThrottled() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto newLimit = std::max(m_configuration.reservedInteractiveMessageRequests + 1, m_messageRequestLimit / 2);
+    if (newLimit != m_messageRequestLimit) {
+        ACSDK_WARN(LX_P("onMessageRequestThrottled").d("from", m_messageRequestLimit).d("to", newLimit));
+        m_messageRequestLimit = newLimit;
+    }
+    m_messageRequestsFinishedSinceLimitChange = 0;
+}
+
 void HTTP2Transport::onMessageRequestAcknowledged(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) {
     ACSDK_DEBUG7(LX_P("onMessageRequestAcknowledged"));
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -592,6 +677,12 @@ void HTTP2Transport::onMessageRequestFinished() {
     --m_countOfUnfinishedMessageHandlers;
     ACSDK_DEBUG7(
         LX_P("onMessageRequestFinished").d("countOfUnfinishedMessageHandlers", m_countOfUnfinishedMessageHandlers));
+    // Grow the limit back by one request for every limit's worth of requests finished without throttling.
+    if (m_messageRequestLimit < m_configuration.maxConcurrentMessageRequests &&
+        ++m_messageRequestsFinishedSinceLimitChange >= m_messageRequestLimit) {
+        ++m_messageRequestLimit;
+        m_messageRequestsFinishedSinceLimitChange = 0;
+    }
     m_wakeEvent.notifyAll();
 }
 
@@ -874,8 +965,9 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(
     ACSDK_DEBUG5(LX_P("sendMessagesAndPings").d("whileState", whileState));
 
     auto canSendMessage = [this, &requestQueue] {
-        return (
-            requestQueue.isMessageRequestAvailable() && (m_countOfUnfinishedMessageHandlers < MAX_MESSAGE_HANDLERS));
+        MessageRequest::Priority lowestPriority;
+        return getLowestSendablePriorityLocked(&lowestPriority) &&
+               requestQueue.isMessageRequestAvailable(lowestPriority);
     };
 
     auto wakePredicate = [this, whileState, canSendMessage] {
@@ -899,9 +991,14 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(
         }
 
         if (canSendMessage()) {
-            auto messageRequest = requestQueue.dequeueSendableRequest();
+            MessageRequest::Priority lowestPriority;
+            getLowestSendablePriorityLocked(&lowestPriority);
+            std::chrono::steady_clock::duration queuedDuration;
+            auto messageRequest = requestQueue.dequeueSendableRequest(lowestPriority, &queuedDuration);
             lock.unlock();
 
+            submitMessageQueueWaitMetric(m_metricRecorder, messageRequest->getPriority(), queuedDuration);
+
             auto authToken = m_authDelegate->getAuthToken();
             if (!authToken.empty()) {
                 auto handler = MessageRequestHandler::create(
@@ -952,6 +1049,18 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(
     return m_state;
 }
 
+bool HTTP2Transport::getLowestSendablePriorityLocked(MessageRequest::Priority* lowestPriority) const {
+    if (m_countOfUnfinishedMessageHandlers >= m_messageRequestLimit) {
+        return false;
+    }
+    if (m_countOfUnfinishedMessageHandlers < m_messageRequestLimit - m_configuration.reservedInteractiveMessageRequests) {
+        *lowestPriority = MessageRequest::Priority::BACKGROUND;
+    } else {
+        *lowestPriority = MessageRequest::Priority::INTERACTIVE;
+    }
+    return true;
+}
+
 bool HTTP2Transport::setState(State newState, ConnectionStatusObserverInterface::ChangedReason changedReason) {
     std::lock_guard<std::mutex> lock(m_mutex);
     return setStateLocked(newState, changedReason);
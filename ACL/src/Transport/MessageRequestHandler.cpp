@@ -457,6 +457,11 @@ bool MessageRequestHandler::onReceiveResponseCode(long responseCode) {
 
     ACSDK_DEBUG7(LX("responseCodeTranslated").d("responseStatus", m_resultStatus));
 
+    if (MessageRequestObserverInterface::Status::THROTTLED == m_resultStatus ||
+        MessageRequestObserverInterface::Status::REFUSED == m_resultStatus) {
+        m_context->onMessageRequestThrottled();
+    }
+
     m_messageRequest->responseStatusReceived(m_resultStatus);
 
     return true;
@@ -33,50 +33,75 @@ static const std::string TAG("MessageRequestQueue");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+constexpr size_t MessageRequestQueue::NUMBER_OF_LANES;
+
 MessageRequestQueue::MessageRequestQueue() : m_isWaitingForAcknowledgement{false} {
 }
 
 void MessageRequestQueue::enqueueRequest(std::shared_ptr<MessageRequest> messageRequest) {
     if (messageRequest != nullptr) {
-        m_queue.push_back({std::chrono::steady_clock::now(), messageRequest});
+        auto lane = static_cast<size_t>(messageRequest->getPriority());
+        if (lane >= NUMBER_OF_LANES) {
+            lane = static_cast<size_t>(MessageRequest::Priority::NORMAL);
+        }
+        m_lanes[lane].push_back({std::chrono::steady_clock::now(), messageRequest});
     } else {
         ACSDK_ERROR(LX("enqueueRequest").d("reason", "nullMessageRequest"));
     }
 }
 
 avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>> MessageRequestQueue::peekRequestTime() {
-    if (!m_queue.empty()) {
-        return m_queue.front().first;
+    auto lane = findOldestLane();
+    if (lane) {
+        return lane->front().first;
     }
 
     return avsCommon::utils::Optional<std::chrono::time_point<std::chrono::steady_clock>>();
 }
 
 std::shared_ptr<MessageRequest> MessageRequestQueue::dequeueOldestRequest() {
-    if (m_queue.empty()) {
+    auto lane = findOldestLane();
+    if (!lane) {
         return nullptr;
     }
 
-    auto result = m_queue.front().second;
-    m_queue.pop_front();
+    auto result = lane->front().second;
+    lane->pop_front();
     return result;
 }
 
 std::shared_ptr<avsCommon::avs::MessageRequest> MessageRequestQueue::dequeueSendableRequest() {
-    for (auto it = m_queue.begin(); it != m_queue.end(); it++) {
-        if (!m_isWaitingForAcknowledgement || !it->second->getIsSerialized()) {
-            auto result = it->second;
-            m_queue.erase(it);
-            return result;
+    return dequeueSendableRequest(MessageRequest::Priority::BACKGROUND, nullptr);
+}
+
+std::shared_ptr<avsCommon::avs::MessageRequest> MessageRequestQueue::dequeueSendableRequest(
+    MessageRequest::Priority lowestPriority,
+    std::chrono::steady_clock::duration* queuedDuration) {
+    for (size_t lane = 0; lane < NUMBER_OF_LANES && lane <= static_cast<size_t>(lowestPriority); ++lane) {
+        for (auto it = m_lanes[lane].begin(); it != m_lanes[lane].end(); it++) {
+            if (isSendable(it->second)) {
+                auto result = it->second;
+                if (queuedDuration) {
+                    *queuedDuration = std::chrono::steady_clock::now() - it->first;
+                }
+                m_lanes[lane].erase(it);
+                return result;
+            }
         }
     }
     return nullptr;
 }
 
 bool MessageRequestQueue::isMessageRequestAvailable() const {
-    for (auto it = m_queue.begin(); it != m_queue.end(); it++) {
-        if (!m_isWaitingForAcknowledgement || !it->second->getIsSerialized()) {
-            return true;
+    return isMessageRequestAvailable(MessageRequest::Priority::BACKGROUND);
+}
+
+bool MessageRequestQueue::isMessageRequestAvailable(MessageRequest::Priority lowestPriority) const {
+    for (size_t lane = 0; lane < NUMBER_OF_LANES && lane <= static_cast<size_t>(lowestPriority); ++lane) {
+        for (auto it = m_lanes[lane].begin(); it != m_lanes[lane].end(); it++) {
+            if (isSendable(it->second)) {
+                return true;
+            }
         }
     }
     return false;
@@ -91,11 +116,32 @@ void MessageRequestQueue::clearWaitingForSendAcknowledgement() {
 }
 
 bool MessageRequestQueue::empty() const {
-    return m_queue.empty();
+    for (auto& lane : m_lanes) {
+        if (!lane.empty()) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void MessageRequestQueue::clear() {
-    m_queue.clear();
+    for (auto& lane : m_lanes) {
+        lane.clear();
+    }
+}
+
+MessageRequestQueue::Lane* MessageRequestQueue::findOldestLane() {
+    Lane* oldest = nullptr;
+    for (auto& lane : m_lanes) {
+        if (!lane.empty() && (!oldest || lane.front().first < oldest->front().first)) {
+            oldest = &lane;
+        }
+    }
+    return oldest;
+}
+
+bool MessageRequestQueue::isSendable(const std::shared_ptr<avsCommon::avs::MessageRequest>& messageRequest) const {
+    return !m_isWaitingForAcknowledgement || !messageRequest->getIsSerialized();
 }
 
 }  // namespace acl
@@ -15,6 +15,10 @@
 
 #include <AVSCommon/Utils/Error/FinallyGuard.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics.h>
+#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 #include <AVSCommon/Utils/Power/PowerMonitor.h>
 
 #include "ACL/Transport/PostConnectSequencer.h"
@@ -24,6 +28,7 @@ namespace acl {
 
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils::error;
+using namespace avsCommon::utils::metrics;
 using namespace avsCommon::utils::power;
 
 /// String to identify log entries originating form this file.
@@ -36,22 +41,48 @@ static const std::string TAG("PostConnectSequencer");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// Metric Activity Name Prefix for PostConnectSequencer metric source.
+static const std::string METRIC_ACTIVITY_NAME_PREFIX = "POST_CONNECT_SEQUENCER-";
+
+/// Activity name of the metric recorded when all post connect operations completed.
+static const std::string POST_CONNECT_SUCCEEDED_ACTIVITY_NAME = "postConnectSucceeded";
+
+/// Activity name of the metric recorded when a post connect operation failed.
+static const std::string POST_CONNECT_FAILED_ACTIVITY_NAME = "postConnectFailed";
+
+/// Name of the data point holding the time taken by the post connect.
+static const std::string TIME_TO_CONNECTED_KEY = "TIME_TO_CONNECTED";
+
 std::shared_ptr<PostConnectSequencer> PostConnectSequencer::create(
-    const PostConnectOperationsSet& postConnectOperations) {
+    const PostConnectOperationsSet& postConnectOperations,
+    std::shared_ptr<MetricRecorderInterface> metricRecorder) {
     for (auto& postConnectOperation : postConnectOperations) {
         if (!postConnectOperation) {
             ACSDK_ERROR(LX("createFailed").d("reason", "invalid PostConnectOperation found"));
             return nullptr;
         }
     }
-    return std::shared_ptr<PostConnectSequencer>(new PostConnectSequencer(postConnectOperations));
+    return std::shared_ptr<PostConnectSequencer>(new PostConnectSequencer(postConnectOperations, metricRecorder));
 }
 
-PostConnectSequencer::PostConnectSequencer(const PostConnectOperationsSet& postConnectOperations) :
+PostConnectSequencer::PostConnectSequencer(
+    const PostConnectOperationsSet& postConnectOperations,
+    std::shared_ptr<MetricRecorderInterface> metricRecorder) :
+        m_metricRecorder{metricRecorder},
         m_isStopping{false},
-        m_postConnectOperations{postConnectOperations} {
+        m_operations{postConnectOperations.begin(), postConnectOperations.end()},
+        m_dependencies(m_operations.size()),
+        m_states(m_operations.size(), OperationState::PENDING) {
     ACSDK_DEBUG5(LX("init"));
 
+    for (size_t i = 0; i < m_operations.size(); ++i) {
+        for (size_t j = 0; j < m_operations.size(); ++j) {
+            if (i != j && m_operations[i]->dependsOn(m_operations[j]->getOperationPriority())) {
+                m_dependencies[i].push_back(j);
+            }
+        }
+    }
+
     m_mainLoopPowerResource = PowerMonitor::getInstance()->createLocalPowerResource(TAG + "_mainLoop");
 
     if (m_mainLoopPowerResource) {
@@ -115,51 +146,147 @@ void PostConnectSequencer::mainLoop(
         return;
     }
 
-    for (auto postConnectOperation : m_postConnectOperations) {
-        {
-            /// Set the current post connect operation.
-            std::lock_guard<std::mutex> lock{m_mutex};
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<std::thread> operationThreads;
+    bool succeeded = false;
+    bool stopped = false;
+
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (true) {
             if (m_isStopping) {
                 ACSDK_DEBUG5(LX("mainLoop").m("stop called, exiting mainloop"));
-                return;
+                stopped = true;
+                break;
             }
-            m_currentPostConnectOperation = postConnectOperation;
-        }
 
-        if (!m_currentPostConnectOperation->performOperation(postConnectSender)) {
-            /// Trigger post connect failure only when the perform operation failed.
-            if (!isStopping() && postConnectObserver) {
-                postConnectObserver->onUnRecoverablePostConnectFailure();
+            size_t succeededCount = 0;
+            size_t runningCount = 0;
+            bool failed = false;
+            for (size_t i = 0; i < m_states.size(); ++i) {
+                switch (m_states[i]) {
+                    case OperationState::SUCCEEDED:
+                        ++succeededCount;
+                        break;
+                    case OperationState::FAILED:
+                        failed = true;
+                        break;
+                    case OperationState::RUNNING:
+                        ++runningCount;
+                        break;
+                    case OperationState::PENDING:
+                        if (isReadyLocked(i)) {
+                            /// Mark the operation as running first so that stop() aborts it.
+                            m_states[i] = OperationState::RUNNING;
+                            ++runningCount;
+                            operationThreads.emplace_back(
+                                &PostConnectSequencer::runOperation, this, i, postConnectSender);
+                        }
+                        break;
+                }
             }
-            resetCurrentOperation();
-            ACSDK_ERROR(LX("mainLoop").m("performOperation failed, exiting mainloop"));
-            return;
+
+            if (failed) {
+                ACSDK_ERROR(LX("mainLoop").m("performOperation failed, exiting mainloop"));
+                abortRunningOperationsLocked();
+                break;
+            }
+            if (succeededCount == m_states.size()) {
+                succeeded = true;
+                break;
+            }
+            if (0 == runningCount) {
+                ACSDK_ERROR(LX("mainLoopError").d("reason", "cyclicDependencies"));
+                break;
+            }
+
+            m_wakeTrigger.wait(lock);
         }
     }
 
-    resetCurrentOperation();
+    for (auto& operationThread : operationThreads) {
+        operationThread.join();
+    }
 
-    /// All post connect operations completed execution, notify the observer.
-    if (postConnectObserver) {
+    if (stopped) {
+        return;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+    submitMetric(elapsed, succeeded);
+
+    if (succeeded) {
+        ACSDK_DEBUG0(LX("mainLoop").d("operations", m_operations.size()).d("timeToConnectedMs", elapsed.count()));
+        /// All post connect operations completed execution, notify the observer.
         postConnectObserver->onPostConnected();
+    } else {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        /// Trigger post connect failure only when the operations were not aborted by stop().
+        if (!m_isStopping) {
+            lock.unlock();
+            postConnectObserver->onUnRecoverablePostConnectFailure();
+        }
     }
 
     ACSDK_DEBUG5(LX("mainLoopReturning"));
 }
 
-void PostConnectSequencer::onDisconnect() {
-    ACSDK_DEBUG5(LX("onDisconnect"));
-    stop();
-}
+void PostConnectSequencer::runOperation(
+    size_t index,
+    std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> postConnectSender) {
+    PowerMonitor::getInstance()->assignThreadPowerResource(m_mainLoopPowerResource);
+    FinallyGuard removePowerResource([] { PowerMonitor::getInstance()->removeThreadPowerResource(); });
+
+    auto& operation = m_operations[index];
+    ACSDK_DEBUG5(LX("runOperation").d("priority", operation->getOperationPriority()));
+    bool succeeded = operation->performOperation(postConnectSender);
+    if (!succeeded) {
+        ACSDK_ERROR(LX("runOperationFailed").d("priority", operation->getOperationPriority()));
+    }
 
-void PostConnectSequencer::resetCurrentOperation() {
     std::lock_guard<std::mutex> lock{m_mutex};
-    m_currentPostConnectOperation.reset();
+    m_states[index] = succeeded ? OperationState::SUCCEEDED : OperationState::FAILED;
+    m_wakeTrigger.notify_all();
 }
 
-bool PostConnectSequencer::isStopping() {
-    std::lock_guard<std::mutex> lock{m_mutex};
-    return m_isStopping;
+bool PostConnectSequencer::isReadyLocked(size_t index) const {
+    for (auto dependency : m_dependencies[index]) {
+        if (m_states[dependency] != OperationState::SUCCEEDED) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PostConnectSequencer::abortRunningOperationsLocked() {
+    for (size_t i = 0; i < m_states.size(); ++i) {
+        if (OperationState::RUNNING == m_states[i]) {
+            m_operations[i]->abortOperation();
+        }
+    }
+}
+
+void PostConnectSequencer::submitMetric(std::chrono::milliseconds elapsed, bool succeeded) {
+    if (!m_metricRecorder) {
+        return;
+    }
+    auto activityName = succeeded ? POST_CONNECT_SUCCEEDED_ACTIVITY_NAME : POST_CONNECT_FAILED_ACTIVITY_NAME;
+    auto metricEvent =
+        MetricEventBuilder{}
+            .setActivityName(METRIC_ACTIVITY_NAME_PREFIX + activityName)
+            .addDataPoint(DataPointCounterBuilder{}.setName(activityName).increment(1).build())
+            .addDataPoint(DataPointDurationBuilder{elapsed}.setName(TIME_TO_CONNECTED_KEY).build())
+            .build();
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("submitMetricFailed").d("reason", "invalidMetricEvent"));
+        return;
+    }
+    recordMetric(m_metricRecorder, metricEvent);
+}
+
+void PostConnectSequencer::onDisconnect() {
+    ACSDK_DEBUG5(LX("onDisconnect"));
+    stop();
 }
 
 void PostConnectSequencer::stop() {
@@ -171,10 +298,9 @@ void PostConnectSequencer::stop() {
         }
 
         m_isStopping = true;
-        if (m_currentPostConnectOperation) {
-            m_currentPostConnectOperation->abortOperation();
-        }
+        abortRunningOperationsLocked();
     }
+    m_wakeTrigger.notify_all();
 
     {
         std::lock_guard<std::mutex> lock{m_mainLoopThreadMutex};
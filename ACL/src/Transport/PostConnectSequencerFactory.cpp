@@ -81,16 +81,18 @@ LegacyProviderRegistrar::getProviders() {
 }
 
 std::shared_ptr<PostConnectFactoryInterface> PostConnectSequencerFactory::createPostConnectFactoryInterface(
-    const std::shared_ptr<PostConnectOperationProviderRegistrarInterface>& registrar) {
+    const std::shared_ptr<PostConnectOperationProviderRegistrarInterface>& registrar,
+    const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder) {
     if (!registrar) {
         ACSDK_ERROR(LX("createPostConectFactoryInterfaceFailed").d("reason", "nullRegistrar"));
         return nullptr;
     }
-    return std::shared_ptr<PostConnectSequencerFactory>(new PostConnectSequencerFactory(registrar));
+    return std::shared_ptr<PostConnectSequencerFactory>(new PostConnectSequencerFactory(registrar, metricRecorder));
 }
 
 std::shared_ptr<PostConnectSequencerFactory> PostConnectSequencerFactory::create(
-    const std::vector<std::shared_ptr<PostConnectOperationProviderInterface>>& providers) {
+    const std::vector<std::shared_ptr<PostConnectOperationProviderInterface>>& providers,
+    const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder) {
     for (auto& provider : providers) {
         if (!provider) {
             ACSDK_ERROR(LX("createFailed").d("reason", "invalidProviderFound"));
@@ -98,12 +100,14 @@ std::shared_ptr<PostConnectSequencerFactory> PostConnectSequencerFactory::create
         }
     }
     auto registrar = std::make_shared<LegacyProviderRegistrar>(providers);
-    return std::shared_ptr<PostConnectSequencerFactory>(new PostConnectSequencerFactory(registrar));
+    return std::shared_ptr<PostConnectSequencerFactory>(new PostConnectSequencerFactory(registrar, metricRecorder));
 }
 
 PostConnectSequencerFactory::PostConnectSequencerFactory(
-    const std::shared_ptr<PostConnectOperationProviderRegistrarInterface>& registrar) :
-        m_registrar{registrar} {
+    const std::shared_ptr<PostConnectOperationProviderRegistrarInterface>& registrar,
+    const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder) :
+        m_registrar{registrar},
+        m_metricRecorder{metricRecorder} {
 }
 
 std::shared_ptr<PostConnectInterface> PostConnectSequencerFactory::createPostConnect() {
@@ -119,7 +123,7 @@ std::shared_ptr<PostConnectInterface> PostConnectSequencerFactory::createPostCon
             postConnectOperationsSet.insert(postConnectOperation);
         }
     }
-    return PostConnectSequencer::create(postConnectOperationsSet);
+    return PostConnectSequencer::create(postConnectOperationsSet, m_metricRecorder);
 }
 
 }  // namespace acl
@@ -59,11 +59,23 @@ std::shared_ptr<MessageRequest> SynchronizedMessageRequestQueue::dequeueSendable
     return m_requestQueue.dequeueSendableRequest();
 }
 
+std::shared_ptr<MessageRequest> SynchronizedMessageRequestQueue::dequeueSendableRequest(
+    MessageRequest::Priority lowestPriority,
+    std::chrono::steady_clock::duration* queuedDuration) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_requestQueue.dequeueSendableRequest(lowestPriority, queuedDuration);
+}
+
 bool SynchronizedMessageRequestQueue::isMessageRequestAvailable() const {
     std::lock_guard<std::mutex> lock{m_mutex};
     return m_requestQueue.isMessageRequestAvailable();
 }
 
+bool SynchronizedMessageRequestQueue::isMessageRequestAvailable(MessageRequest::Priority lowestPriority) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_requestQueue.isMessageRequestAvailable(lowestPriority);
+}
+
 void SynchronizedMessageRequestQueue::setWaitingForSendAcknowledgement() {
     std::lock_guard<std::mutex> lock{m_mutex};
     m_requestQueue.setWaitingForSendAcknowledgement();
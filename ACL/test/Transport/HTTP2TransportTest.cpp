@@ -154,6 +154,12 @@ static const unsigned MAX_AVS_STREAMS = 10;
 // Maximum allowed of POST streams
 static const unsigned MAX_POST_STREAMS = MAX_AVS_STREAMS - MAX_DOWNCHANNEL_STREAMS - MAX_PING_STREAMS;
 
+// The number of POST streams reserved for interactive requests
+static const unsigned RESERVED_INTERACTIVE_POST_STREAMS = 1;
+
+// Maximum allowed of POST streams for requests which are not interactive
+static const unsigned MAX_NON_INTERACTIVE_POST_STREAMS = MAX_POST_STREAMS - RESERVED_INTERACTIVE_POST_STREAMS;
+
 /// Test harness for @c HTTP2Transport class.
 class HTTP2TransportTest : public Test {
 public:
@@ -1312,8 +1318,8 @@ TEST_F(HTTP2TransportTest, testSlow_avsStreamsLimit) {
     // Check that there was a downchannel request sent out.
     ASSERT_NE(m_mockHttp2Connection->getDownchannelRequest(RESPONSE_TIMEOUT), nullptr);
 
-    // Check the messages we sent were limited.
-    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), MAX_POST_STREAMS);
+    // Check the messages we sent were limited, leaving the streams reserved for interactive requests.
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), MAX_NON_INTERACTIVE_POST_STREAMS);
 
     unsigned int completed = 0;
     std::shared_ptr<MockHTTP2Request> request;
@@ -1329,7 +1335,77 @@ TEST_F(HTTP2TransportTest, testSlow_avsStreamsLimit) {
     ASSERT_EQ(completed, messagesCount);
 
     // Check that the maximum number of enqueued messages at any time has been limited.
-    ASSERT_EQ(m_mockHttp2Connection->getMaxPostRequestsEnqueud(), MAX_POST_STREAMS);
+    ASSERT_EQ(m_mockHttp2Connection->getMaxPostRequestsEnqueud(), MAX_NON_INTERACTIVE_POST_STREAMS);
+}
+
+/**
+ * Test that an interactive request is sent on the reserved stream while other requests wait for a free stream.
+ */
+TEST_F(HTTP2TransportTest, test_interactiveRequestUsesReservedStream) {
+    authorizeAndConnect();
+
+    m_mockHttp2Connection->setResponseToPOSTRequests(HTTPResponseCode::SUCCESS_OK);
+
+    auto waitForPostRequestsNum = [this](std::size_t count) {
+        auto deadline = std::chrono::steady_clock::now() + RESPONSE_TIMEOUT;
+        while (m_mockHttp2Connection->getPostRequestsNum() < count && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+        }
+        return m_mockHttp2Connection->getPostRequestsNum();
+    };
+
+    for (unsigned messageNum = 0; messageNum < MAX_POST_STREAMS * 2; messageNum++) {
+        auto messageReq = std::make_shared<MessageRequest>(TEST_MESSAGE + std::to_string(messageNum), "");
+        m_synchronizedMessageRequestQueue->enqueueRequest(messageReq);
+        m_http2Transport->onRequestEnqueued();
+    }
+    ASSERT_EQ(waitForPostRequestsNum(MAX_NON_INTERACTIVE_POST_STREAMS), MAX_NON_INTERACTIVE_POST_STREAMS);
+
+    // Give m_http2Transport a little time to misbehave.
+    std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), MAX_NON_INTERACTIVE_POST_STREAMS);
+
+    auto interactiveReq = std::make_shared<MessageRequest>(TEST_MESSAGE, "");
+    interactiveReq->setPriority(MessageRequest::Priority::INTERACTIVE);
+    m_synchronizedMessageRequestQueue->enqueueRequest(interactiveReq);
+    m_http2Transport->onRequestEnqueued();
+
+    ASSERT_EQ(waitForPostRequestsNum(MAX_POST_STREAMS), MAX_POST_STREAMS);
+}
+
+/**
+ * Test that a reservation covering every stream is clamped so that one request which is not interactive is still sent.
+ */
+TEST_F(HTTP2TransportTest, test_reservationOfAllStreamsIsClamped) {
+    HTTP2Transport::Configuration cfg;
+    cfg.maxConcurrentMessageRequests = MAX_POST_STREAMS * 2;
+    cfg.reservedInteractiveMessageRequests = MAX_POST_STREAMS * 2;
+    m_http2Transport = HTTP2Transport::create(
+        m_mockAuthDelegate,
+        TEST_AVS_GATEWAY_STRING,
+        m_mockHttp2Connection,
+        m_mockMessageConsumer,
+        m_attachmentManager,
+        m_mockTransportObserver,
+        m_mockPostConnectFactory,
+        m_synchronizedMessageRequestQueue,
+        cfg,
+        m_mockMetricRecorder,
+        m_mockEventTracer);
+    ASSERT_NE(m_http2Transport, nullptr);
+
+    authorizeAndConnect();
+
+    for (unsigned messageNum = 0; messageNum < MAX_POST_STREAMS; messageNum++) {
+        auto messageReq = std::make_shared<MessageRequest>(TEST_MESSAGE + std::to_string(messageNum), "");
+        m_synchronizedMessageRequestQueue->enqueueRequest(messageReq);
+        m_http2Transport->onRequestEnqueued();
+    }
+    ASSERT_NE(m_mockHttp2Connection->waitForPostRequest(RESPONSE_TIMEOUT), nullptr);
+
+    // Give m_http2Transport a little time to misbehave.
+    std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 1u);
 }
 
 /**
@@ -48,6 +48,8 @@ public:
     }
     void onMessageRequestTimeout() override {
     }
+    void onMessageRequestThrottled() override {
+    }
     void onMessageRequestAcknowledged(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) override {
     }
     void onMessageRequestFinished() override {
@@ -0,0 +1,115 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ACL/Transport/MessageRequestQueue.h>
+
+namespace alexaClientSDK {
+namespace acl {
+namespace transport {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace ::testing;
+
+/**
+ * Create a @c MessageRequest with the given priority.
+ *
+ * @param priority The priority of the request.
+ * @param isSerialized Whether the request is serialized.
+ * @return The new request.
+ */
+static std::shared_ptr<MessageRequest> createRequest(MessageRequest::Priority priority, bool isSerialized = true) {
+    auto request = std::make_shared<MessageRequest>("{}", isSerialized);
+    request->setPriority(priority);
+    return request;
+}
+
+/// Test that higher priority lanes are drained first and each lane is drained in order.
+TEST(MessageRequestQueueTest, test_dequeueSendableRequestDrainsHigherPriorityFirst) {
+    MessageRequestQueue queue;
+    auto background = createRequest(MessageRequest::Priority::BACKGROUND);
+    auto normal1 = createRequest(MessageRequest::Priority::NORMAL);
+    auto normal2 = createRequest(MessageRequest::Priority::NORMAL);
+    auto interactive = createRequest(MessageRequest::Priority::INTERACTIVE);
+    queue.enqueueRequest(background);
+    queue.enqueueRequest(normal1);
+    queue.enqueueRequest(normal2);
+    queue.enqueueRequest(interactive);
+
+    EXPECT_EQ(queue.dequeueSendableRequest(), interactive);
+    EXPECT_EQ(queue.dequeueSendableRequest(), normal1);
+    EXPECT_EQ(queue.dequeueSendableRequest(), normal2);
+    EXPECT_EQ(queue.dequeueSendableRequest(), background);
+    EXPECT_TRUE(queue.empty());
+}
+
+/// Test that lanes below the requested priority are ignored.
+TEST(MessageRequestQueueTest, test_lowestPriorityLimitsLanes) {
+    MessageRequestQueue queue;
+    auto normal = createRequest(MessageRequest::Priority::NORMAL);
+    queue.enqueueRequest(normal);
+
+    EXPECT_FALSE(queue.isMessageRequestAvailable(MessageRequest::Priority::INTERACTIVE));
+    EXPECT_EQ(queue.dequeueSendableRequest(MessageRequest::Priority::INTERACTIVE, nullptr), nullptr);
+    EXPECT_TRUE(queue.isMessageRequestAvailable(MessageRequest::Priority::NORMAL));
+
+    std::chrono::steady_clock::duration queuedDuration{-1};
+    EXPECT_EQ(queue.dequeueSendableRequest(MessageRequest::Priority::NORMAL, &queuedDuration), normal);
+    EXPECT_GE(queuedDuration.count(), 0);
+}
+
+/// Test that waiting for an acknowledgement blocks serialized requests in every lane.
+TEST(MessageRequestQueueTest, test_serializedRequestsBlockedInEveryLane) {
+    MessageRequestQueue queue;
+    auto interactive = createRequest(MessageRequest::Priority::INTERACTIVE);
+    auto background = createRequest(MessageRequest::Priority::BACKGROUND, false);
+    queue.enqueueRequest(interactive);
+    queue.enqueueRequest(background);
+
+    queue.setWaitingForSendAcknowledgement();
+    EXPECT_EQ(queue.dequeueSendableRequest(), background);
+    EXPECT_FALSE(queue.isMessageRequestAvailable());
+
+    queue.clearWaitingForSendAcknowledgement();
+    EXPECT_EQ(queue.dequeueSendableRequest(), interactive);
+}
+
+/// Test that the oldest request is found across lanes.
+TEST(MessageRequestQueueTest, test_dequeueOldestRequestAcrossLanes) {
+    MessageRequestQueue queue;
+    auto background = createRequest(MessageRequest::Priority::BACKGROUND);
+    queue.enqueueRequest(background);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto interactive = createRequest(MessageRequest::Priority::INTERACTIVE);
+    queue.enqueueRequest(interactive);
+
+    auto oldestTime = queue.peekRequestTime();
+    ASSERT_TRUE(oldestTime.hasValue());
+    EXPECT_EQ(queue.dequeueOldestRequest(), background);
+    EXPECT_GT(queue.peekRequestTime().value(), oldestTime.value());
+    EXPECT_EQ(queue.dequeueOldestRequest(), interactive);
+    EXPECT_FALSE(queue.peekRequestTime().hasValue());
+}
+
+}  // namespace test
+}  // namespace transport
+}  // namespace acl
+}  // namespace alexaClientSDK
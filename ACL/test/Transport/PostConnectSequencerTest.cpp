@@ -13,7 +13,9 @@
  * permissions and limitations under the License.
  */
 
+#include <future>
 #include <memory>
+#include <set>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -22,6 +24,7 @@
 #include "MockPostConnectOperation.h"
 #include <ACL/Transport/PostConnectSequencer.h>
 #include <AVSCommon/SDKInterfaces/MockMessageSender.h>
+#include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
 #include <AVSCommon/Utils/PromiseFuturePair.h>
 
 namespace alexaClientSDK {
@@ -32,11 +35,35 @@ namespace test {
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::sdkInterfaces::test;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::metrics;
+using namespace avsCommon::utils::metrics::test;
 using namespace ::testing;
 
 /// A short delay used in tests.
 static const auto SHORT_DELAY = std::chrono::seconds(1);
 
+/**
+ * A @c MockPostConnectOperation which only depends on the operations with the given priorities.
+ */
+class DependentPostConnectOperation : public MockPostConnectOperation {
+public:
+    /**
+     * Constructor.
+     *
+     * @param dependencies The priorities of the operations this operation depends on.
+     */
+    explicit DependentPostConnectOperation(const std::set<unsigned int>& dependencies) : m_dependencies{dependencies} {
+    }
+
+    bool dependsOn(unsigned int operationPriority) override {
+        return m_dependencies.count(operationPriority) != 0;
+    }
+
+private:
+    /// The priorities of the operations this operation depends on.
+    std::set<unsigned int> m_dependencies;
+};
+
 /**
  * Test harness for @c PostConnectSequencer class.
  */
@@ -238,6 +265,136 @@ TEST_F(PostConnectSequencerTest, test_onDisconnectStopsExecution) {
     postConnectSequencer->onDisconnect();
 }
 
+/**
+ * Check that operations which only share a dependency run concurrently once the dependency completed.
+ */
+TEST_F(PostConnectSequencerTest, test_independentOperationsRunConcurrently) {
+    auto operation1 = std::make_shared<StrictMock<MockPostConnectOperation>>();
+    auto operation2 = std::make_shared<StrictMock<DependentPostConnectOperation>>(std::set<unsigned int>{1});
+    auto operation3 = std::make_shared<StrictMock<DependentPostConnectOperation>>(std::set<unsigned int>{1});
+
+    EXPECT_CALL(*operation1, getOperationPriority()).WillRepeatedly(Return(1));
+    EXPECT_CALL(*operation2, getOperationPriority()).WillRepeatedly(Return(2));
+    EXPECT_CALL(*operation3, getOperationPriority()).WillRepeatedly(Return(3));
+
+    PostConnectSequencer::PostConnectOperationsSet operationsSet;
+    operationsSet.insert(operation1);
+    operationsSet.insert(operation2);
+    operationsSet.insert(operation3);
+
+    auto postConnectSequencer = PostConnectSequencer::create(operationsSet);
+    ASSERT_NE(postConnectSequencer, nullptr);
+
+    /// Each of operation2 and operation3 only succeeds if the other one starts while it is running.
+    std::promise<void> operation1Done, operation2Started, operation3Started;
+    auto operation1DoneFuture = operation1Done.get_future().share();
+    auto operation2StartedFuture = operation2Started.get_future();
+    auto operation3StartedFuture = operation3Started.get_future();
+    EXPECT_CALL(*operation1, performOperation(_)).WillOnce(InvokeWithoutArgs([&operation1Done] {
+        operation1Done.set_value();
+        return true;
+    }));
+    EXPECT_CALL(*operation2, performOperation(_))
+        .WillOnce(InvokeWithoutArgs([&operation1DoneFuture, &operation2Started, &operation3StartedFuture] {
+            EXPECT_EQ(operation1DoneFuture.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+            operation2Started.set_value();
+            return operation3StartedFuture.wait_for(SHORT_DELAY) == std::future_status::ready;
+        }));
+    EXPECT_CALL(*operation3, performOperation(_))
+        .WillOnce(InvokeWithoutArgs([&operation1DoneFuture, &operation3Started, &operation2StartedFuture] {
+            EXPECT_EQ(operation1DoneFuture.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+            operation3Started.set_value();
+            return operation2StartedFuture.wait_for(SHORT_DELAY) == std::future_status::ready;
+        }));
+
+    PromiseFuturePair<bool> promiseFuturePair;
+    EXPECT_CALL(*m_mockPostConnectObserver, onPostConnected()).WillOnce(Invoke([&promiseFuturePair] {
+        promiseFuturePair.setValue(true);
+    }));
+
+    postConnectSequencer->doPostConnect(m_mockMessageSender, m_mockPostConnectObserver);
+
+    ASSERT_TRUE(promiseFuturePair.waitFor(SHORT_DELAY * 2));
+}
+
+/**
+ * Check that a failing operation aborts the operations running concurrently and skips the ones depending on it.
+ */
+TEST_F(PostConnectSequencerTest, test_failureAbortsConcurrentOperations) {
+    auto operation1 = std::make_shared<StrictMock<MockPostConnectOperation>>();
+    auto operation2 = std::make_shared<StrictMock<DependentPostConnectOperation>>(std::set<unsigned int>{});
+    auto operation3 = std::make_shared<StrictMock<MockPostConnectOperation>>();
+
+    EXPECT_CALL(*operation1, getOperationPriority()).WillRepeatedly(Return(1));
+    EXPECT_CALL(*operation2, getOperationPriority()).WillRepeatedly(Return(2));
+    EXPECT_CALL(*operation3, getOperationPriority()).WillRepeatedly(Return(3));
+
+    PostConnectSequencer::PostConnectOperationsSet operationsSet;
+    operationsSet.insert(operation1);
+    operationsSet.insert(operation2);
+    operationsSet.insert(operation3);
+
+    auto postConnectSequencer = PostConnectSequencer::create(operationsSet);
+    ASSERT_NE(postConnectSequencer, nullptr);
+
+    PromiseFuturePair<bool> operation2Started, operation2Aborted;
+    EXPECT_CALL(*operation1, performOperation(_)).WillOnce(InvokeWithoutArgs([&operation2Started] {
+        operation2Started.waitFor(SHORT_DELAY);
+        return false;
+    }));
+    EXPECT_CALL(*operation2, performOperation(_)).WillOnce(InvokeWithoutArgs([&operation2Started, &operation2Aborted] {
+        operation2Started.setValue(true);
+        return !operation2Aborted.waitFor(SHORT_DELAY);
+    }));
+    EXPECT_CALL(*operation2, abortOperation()).WillOnce(InvokeWithoutArgs([&operation2Aborted] {
+        operation2Aborted.setValue(true);
+    }));
+
+    PromiseFuturePair<bool> promiseFuturePair;
+    EXPECT_CALL(*m_mockPostConnectObserver, onUnRecoverablePostConnectFailure()).WillOnce(Invoke([&promiseFuturePair] {
+        promiseFuturePair.setValue(true);
+    }));
+
+    postConnectSequencer->doPostConnect(m_mockMessageSender, m_mockPostConnectObserver);
+
+    ASSERT_TRUE(promiseFuturePair.waitFor(SHORT_DELAY * 2));
+}
+
+/**
+ * Check that the time taken by a successful post connect is recorded.
+ */
+TEST_F(PostConnectSequencerTest, test_timeToConnectedMetricRecorded) {
+    auto operation1 = std::make_shared<NiceMock<MockPostConnectOperation>>();
+    EXPECT_CALL(*operation1, getOperationPriority()).WillRepeatedly(Return(1));
+    EXPECT_CALL(*operation1, performOperation(_)).WillOnce(Return(true));
+
+    PostConnectSequencer::PostConnectOperationsSet operationsSet;
+    operationsSet.insert(operation1);
+
+    auto metricRecorder = std::make_shared<NiceMock<MockMetricRecorder>>();
+    auto postConnectSequencer = PostConnectSequencer::create(operationsSet, metricRecorder);
+    ASSERT_NE(postConnectSequencer, nullptr);
+
+    std::shared_ptr<MetricEvent> recordedMetric;
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    EXPECT_CALL(*metricRecorder, recordMetric(_)).WillOnce(SaveArg<0>(&recordedMetric));
+#endif
+
+    PromiseFuturePair<bool> promiseFuturePair;
+    EXPECT_CALL(*m_mockPostConnectObserver, onPostConnected()).WillOnce(Invoke([&promiseFuturePair] {
+        promiseFuturePair.setValue(true);
+    }));
+
+    postConnectSequencer->doPostConnect(m_mockMessageSender, m_mockPostConnectObserver);
+
+    ASSERT_TRUE(promiseFuturePair.waitFor(SHORT_DELAY));
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    ASSERT_NE(recordedMetric, nullptr);
+    EXPECT_EQ(recordedMetric->getActivityName(), "POST_CONNECT_SEQUENCER-postConnectSucceeded");
+    EXPECT_TRUE(recordedMetric->getDataPoint("TIME_TO_CONNECTED", DataType::DURATION).hasValue());
+#endif
+}
+
 }  // namespace test
 }  // namespace transport
 }  // namespace acl
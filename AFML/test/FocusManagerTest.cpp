@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
 #include <memory>
 #include <gtest/gtest.h>
 
@@ -1046,6 +1047,35 @@ TEST_F(FocusManagerTest, test_activityTracker) {
     m_activityTracker->waitForActivityUpdates(DEFAULT_TIMEOUT, test9);
 }
 
+/**
+ * Measures how many times per second a dialog activity can interrupt and then release a content activity.  Every
+ * interruption looks up the content activity's @c MixingBehavior in the @c InterruptModel.  This is a benchmark, so it
+ * is disabled by default; run it with --gtest_also_run_disabled_tests.
+ */
+TEST_F(FocusManagerTest, DISABLED_test_interruptAndReleaseThroughput) {
+    const int iterations = 2000;
+
+    ASSERT_TRUE(acquireChannelHelper(contentClient, ContentType::MIXABLE));
+    assertFocusChange(contentClient, FocusState::FOREGROUND);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        ASSERT_TRUE(acquireChannelHelper(dialogClient, ContentType::MIXABLE));
+        ASSERT_TRUE(m_focusManager->releaseChannel(DIALOG_CHANNEL_NAME, dialogClient).get());
+    }
+    // The content Channel is foregrounded after the release is reported, so queue one more (failing) release to
+    // wait for the FocusManager to finish processing the last one.
+    ASSERT_FALSE(m_focusManager->releaseChannel(DIALOG_CHANNEL_NAME, dialogClient).get());
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    auto contentInfo = getWaitResult(contentClient);
+    ASSERT_EQ(FocusState::FOREGROUND, contentInfo.focusState);
+    ASSERT_EQ(MixingBehavior::PRIMARY, contentInfo.mixingBehavior);
+
+    auto perSecond = static_cast<int>(iterations / elapsed);
+    RecordProperty("interruptAndReleasePerSecond", perSecond);
+}
+
 /// Test fixture for testing Channel.
 class ChannelTest
         : public ::testing::Test
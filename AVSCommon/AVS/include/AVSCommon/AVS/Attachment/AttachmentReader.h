@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <ostream>
 
 #include "AVSCommon/Utils/SDS/ReaderPolicy.h"
@@ -107,6 +108,24 @@ public:
      * @param closePoint The point at which the reader should stop reading from the attachment.
      */
     virtual void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) = 0;
+
+    /**
+     * Sets a callback which is made when a @c read() may be able to make progress: when data is written to the
+     * attachment, when the attachment's writer closes, and when this reader is closed.  This lets a reader be driven
+     * by an event loop, or wait on its own condition, instead of polling with timed reads.  To avoid missing a
+     * notification, the callback should be set before the first @c read().
+     *
+     * The callback may be made on any thread, possibly while locks of the underlying data representation are held.
+     * It must not block or call back into the attachment; it should only signal the thread which reads.
+     *
+     * @param callback The callback to make, or @c nullptr to stop making callbacks.  Clearing the callback waits for
+     *     a callback which is in progress to return.
+     * @return Whether readiness callbacks are supported by this reader.  The default implementation does not support
+     *     them and returns @c false.
+     */
+    virtual bool setDataAvailableCallback(std::function<void()> callback) {
+        return false;
+    }
 };
 
 /**
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <ostream>
 
 namespace alexaClientSDK {
@@ -76,6 +77,23 @@ public:
      * needs to use an attachment.
      */
     virtual void close() = 0;
+
+    /**
+     * Sets a callback which is made when a @c write() may be able to make progress: when a reader of the attachment
+     * consumes data or is removed, and when this writer is closed.  This lets a writer be driven by an event loop
+     * instead of polling with timed writes.
+     *
+     * The callback may be made on any thread, possibly while locks of the underlying data representation are held.
+     * It must not block or call back into the attachment; it should only signal the thread which writes.
+     *
+     * @param callback The callback to make, or @c nullptr to stop making callbacks.  Clearing the callback waits for
+     *     a callback which is in progress to return.
+     * @return Whether readiness callbacks are supported by this writer.  The default implementation does not support
+     *     them and returns @c false.
+     */
+    virtual bool setSpaceAvailableCallback(std::function<void()> callback) {
+        return false;
+    }
 };
 
 /**
@@ -72,6 +72,8 @@ public:
 
     uint64_t getNumUnreadBytes() override;
 
+    bool setDataAvailableCallback(std::function<void()> callback) override;
+
     /// @}
 private:
     /**
@@ -258,6 +260,17 @@ uint64_t DefaultAttachmentReader<SDSType>::getNumUnreadBytes() {
     return 0;
 }
 
+template <typename SDSType>
+bool DefaultAttachmentReader<SDSType>::setDataAvailableCallback(std::function<void()> callback) {
+    if (m_reader) {
+        m_reader->setDataAvailableCallback(std::move(callback));
+        return true;
+    }
+
+    ACSDK_ERROR(utils::logger::LogEntry(TAG, "setDataAvailableCallbackFailed").d("reason", "noReader"));
+    return false;
+}
+
 template <typename SDSType>
 DefaultAttachmentReader<SDSType>::DefaultAttachmentReader(
     typename SDSType::Reader::Policy policy,
@@ -61,6 +61,8 @@ public:
 
     void close() override;
 
+    bool setSpaceAvailableCallback(std::function<void()> callback) override;
+
 protected:
     /**
      * Constructor.
@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -39,6 +40,20 @@ class EditableMessageRequest;
  */
 class MessageRequest {
 public:
+    /**
+     * The priority class of a message. The transport keeps a separate send lane per priority, drains higher priority
+     * lanes first, and reserves part of its stream budget for @c INTERACTIVE messages. Messages are only kept in
+     * order with other messages of the same priority.
+     */
+    enum class Priority {
+        /// Messages a user is actively waiting on, such as Recognize or button presses.
+        INTERACTIVE,
+        /// Messages with no particular latency requirement. This is the default.
+        NORMAL,
+        /// Messages which may be delayed behind any other traffic, such as periodic reports.
+        BACKGROUND
+    };
+
     /// A struct to hold an @c AttachmentReader alongside its name.
     struct NamedReader {
         /**
@@ -159,6 +174,20 @@ public:
      */
     bool getIsSerialized() const;
 
+    /**
+     * Set the priority class of this message. This must be called before the message is sent.
+     *
+     * @param priority The priority class of this message.
+     */
+    void setPriority(Priority priority);
+
+    /**
+     * Get the priority class of this message.
+     *
+     * @return The priority class of this message.
+     */
+    Priority getPriority() const;
+
     /**
      * Retrieves the path extension to be appended to the base URL when sending.
      *
@@ -261,6 +290,9 @@ protected:
     /// True if sending this message must be serialized with sending other serialized messages.
     bool m_isSerialized;
 
+    /// The priority class of this message.
+    Priority m_priority;
+
     /// The path extension to be appended to the base URL when sending.
     std::string m_uriPathExtension;
 
@@ -280,6 +312,25 @@ protected:
     unsigned int m_streamBytesThreshold;
 };
 
+/**
+ * Write a @c MessageRequest::Priority value to an @c ostream as a string.
+ *
+ * @param stream The stream to write the value to.
+ * @param priority The value to write to the @c ostream as a string.
+ * @return The @c ostream that was passed in and written to.
+ */
+inline std::ostream& operator<<(std::ostream& stream, MessageRequest::Priority priority) {
+    switch (priority) {
+        case MessageRequest::Priority::INTERACTIVE:
+            return stream << "INTERACTIVE";
+        case MessageRequest::Priority::NORMAL:
+            return stream << "NORMAL";
+        case MessageRequest::Priority::BACKGROUND:
+            return stream << "BACKGROUND";
+    }
+    return stream << "UNKNOWN";
+}
+
 }  // namespace avs
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
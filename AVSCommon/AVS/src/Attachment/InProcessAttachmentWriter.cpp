@@ -143,6 +143,15 @@ void InProcessAttachmentWriter::close() {
     }
 }
 
+bool InProcessAttachmentWriter::setSpaceAvailableCallback(std::function<void()> callback) {
+    if (!m_writer) {
+        ACSDK_ERROR(LX("setSpaceAvailableCallbackFailed").d("reason", "SDS is closed or uninitialized"));
+        return false;
+    }
+    m_writer->setSpaceAvailableCallback(std::move(callback));
+    return true;
+}
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -40,6 +40,7 @@ MessageRequest::MessageRequest(
     const std::string& streamMetricName) :
         m_jsonContent{jsonContent},
         m_isSerialized{true},
+        m_priority{Priority::NORMAL},
         m_uriPathExtension{uriPathExtension},
         m_streamMetricName{streamMetricName},
         m_streamBytesThreshold{threshold} {
@@ -50,6 +51,7 @@ MessageRequest::MessageRequest(
     const std::string& streamMetricName) :
         m_jsonContent{jsonContent},
         m_isSerialized{true},
+        m_priority{Priority::NORMAL},
         m_uriPathExtension{""},
         m_streamMetricName{streamMetricName},
         m_streamBytesThreshold{threshold} {
@@ -64,6 +66,7 @@ MessageRequest::MessageRequest(
     const std::string& streamMetricName) :
         m_jsonContent{jsonContent},
         m_isSerialized{isSerialized},
+        m_priority{Priority::NORMAL},
         m_uriPathExtension{uriPathExtension},
         m_headers(std::move(headers)),
         m_resolver{resolver},
@@ -74,6 +77,7 @@ MessageRequest::MessageRequest(
 MessageRequest::MessageRequest(const MessageRequest& messageRequest) :
         m_jsonContent{messageRequest.m_jsonContent},
         m_isSerialized{messageRequest.m_isSerialized},
+        m_priority{messageRequest.m_priority},
         m_uriPathExtension{messageRequest.m_uriPathExtension},
         m_readers{messageRequest.m_readers},
         m_headers{messageRequest.m_headers},
@@ -105,6 +109,14 @@ bool MessageRequest::getIsSerialized() const {
     return m_isSerialized;
 }
 
+void MessageRequest::setPriority(Priority priority) {
+    m_priority = priority;
+}
+
+MessageRequest::Priority MessageRequest::getPriority() const {
+    return m_priority;
+}
+
 std::string MessageRequest::getUriPathExtension() const {
     return m_uriPathExtension;
 }
@@ -50,6 +50,22 @@ public:
      */
     virtual unsigned int getOperationPriority() = 0;
 
+    /**
+     * Returns whether this operation has to wait for the successful completion of the operation with the given
+     * priority before it may start. Operations which do not depend on each other are run concurrently.
+     *
+     * The default implementation depends on every operation with a lower priority, which runs all operations strictly
+     * in sequence.
+     *
+     * @note The dependencies declared by a set of operations must not be cyclic.
+     *
+     * @param operationPriority The priority of another operation in the same post connect sequence.
+     * @return Whether this operation depends on the operation with the given priority.
+     */
+    virtual bool dependsOn(unsigned int operationPriority) {
+        return operationPriority < getOperationPriority();
+    }
+
     /**
      * Performs the post connect operation. The implementation should ensure that the performOperation returns
      * immediately after the abortOperation() method is called.
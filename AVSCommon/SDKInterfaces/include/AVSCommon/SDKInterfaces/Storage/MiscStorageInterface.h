@@ -183,6 +183,30 @@ public:
         const std::string& key,
         const std::string& value) = 0;
 
+    /**
+     * Puts several values in the table.
+     * Entries for keys that don't exist are added, and entries for keys that already exist are updated.
+     *
+     * Implementations should apply all entries in a single transaction, so either all or none of them are stored. The
+     * default implementation puts entries one by one and stops on the first error.
+     *
+     * @param componentName The component name.
+     * @param tableName The table name.
+     * @param entries The keys and values of the table entries.
+     * @return @c true If all values were put ok, @c false if not.
+     */
+    virtual bool putBatch(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::unordered_map<std::string, std::string>& entries) {
+        for (const auto& entry : entries) {
+            if (!put(componentName, tableName, entry.first, entry.second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * Removes a value from the table.
      *
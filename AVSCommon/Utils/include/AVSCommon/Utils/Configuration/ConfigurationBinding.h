@@ -0,0 +1,399 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONBINDING_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONBINDING_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace configuration {
+
+/**
+ * Binds the members of a settings struct to values in the global configuration, so that a component reads its
+ * configuration once into typed fields instead of looking keys up in a @c ConfigurationNode on each access.
+ *
+ * Each binding names a key, the member that receives the value, a default used when the key is absent, and an
+ * optional validator.  A value that fails validation is replaced by the default and logged.  For example:
+ * @code
+ *     struct Settings {
+ *         int minUnmuteVolume;
+ *         std::chrono::milliseconds window;
+ *     };
+ *
+ *     ConfigurationBinding<Settings> binding({"someComponent"});
+ *     binding.bindInt("minUnmuteVolume", &Settings::minUnmuteVolume, 10)
+ *         .bindDuration<std::chrono::milliseconds>("windowMs", &Settings::window, std::chrono::milliseconds(0));
+ *     auto settings = binding.get();
+ * @endcode
+ *
+ * @c get() returns an immutable snapshot.  If the global configuration has been initialized again since the snapshot
+ * was taken, @c get() first reloads it, so a caller that calls @c get() on each use sees configuration changes, while
+ * a caller that keeps a snapshot does not.
+ *
+ * Bindings must all be added before the first call to @c load() or @c get().  After that, this class is thread safe.
+ *
+ * @tparam Settings The struct receiving the values.  It must be default constructible.
+ */
+template <typename Settings>
+class ConfigurationBinding {
+public:
+    /**
+     * Function checking whether a value read from the configuration is acceptable.
+     *
+     * @tparam Type The type of the value.
+     */
+    template <typename Type>
+    using Validator = std::function<bool(const Type& value)>;
+
+    /**
+     * Constructor.
+     *
+     * @param path Keys of the nested objects, starting from the root of the global configuration, that hold the
+     * bound values.
+     */
+    explicit ConfigurationBinding(std::vector<std::string> path);
+
+    /**
+     * Bind a @c bool value.
+     *
+     * @param key The key of the value.
+     * @param member The member receiving the value.
+     * @param defaultValue The value used if @c key is absent.
+     * @return This binding, to allow chaining.
+     */
+    ConfigurationBinding& bindBool(const std::string& key, bool Settings::*member, bool defaultValue);
+
+    /**
+     * Bind an @c int value.
+     *
+     * @param key The key of the value.
+     * @param member The member receiving the value.
+     * @param defaultValue The value used if @c key is absent or the value is invalid.
+     * @param validator Optional function checking the value.
+     * @return This binding, to allow chaining.
+     */
+    ConfigurationBinding& bindInt(
+        const std::string& key,
+        int Settings::*member,
+        int defaultValue,
+        Validator<int> validator = nullptr);
+
+    /**
+     * Bind a @c uint32_t value.
+     *
+     * @param key The key of the value.
+     * @param member The member receiving the value.
+     * @param defaultValue The value used if @c key is absent or the value is invalid.
+     * @param validator Optional function checking the value.
+     * @return This binding, to allow chaining.
+     */
+    ConfigurationBinding& bindUint32(
+        const std::string& key,
+        uint32_t Settings::*member,
+        uint32_t defaultValue,
+        Validator<uint32_t> validator = nullptr);
+
+    /**
+     * Bind a @c string value.
+     *
+     * @param key The key of the value.
+     * @param member The member receiving the value.
+     * @param defaultValue The value used if @c key is absent or the value is invalid.
+     * @param validator Optional function checking the value.
+     * @return This binding, to allow chaining.
+     */
+    ConfigurationBinding& bindString(
+        const std::string& key,
+        std::string Settings::*member,
+        std::string defaultValue,
+        Validator<std::string> validator = nullptr);
+
+    /**
+     * Bind a @c string value whose presence matters, even when it is empty.
+     *
+     * @param key The key of the value.
+     * @param member The member receiving the value, or the empty string if @c key is absent.
+     * @param isPresent The member receiving whether @c key is present.
+     * @return This binding, to allow chaining.
+     */
+    ConfigurationBinding& bindOptionalString(
+        const std::string& key,
+        std::string Settings::*member,
+        bool Settings::*isPresent);
+
+    /**
+     * Bind a duration derived from an integer value.
+     *
+     * @tparam InputType std::chrono::duration type whose unit specifies how the integer value is interpreted.
+     * @tparam OutputType std::chrono::duration type of the member.
+     * @param key The key of the value.
+     * @param member The member receiving the value.
+     * @param defaultValue The value used if @c key is absent or the value is invalid.
+     * @param validator Optional function checking the value.  Its type is not used to deduce @c OutputType, so that a
+     * lambda may be passed.
+     * @return This binding, to allow chaining.
+     */
+    template <typename InputType, typename OutputType>
+    ConfigurationBinding& bindDuration(
+        const std::string& key,
+        OutputType Settings::*member,
+        OutputType defaultValue,
+        Validator<typename std::common_type<OutputType>::type> validator = nullptr);
+
+    /**
+     * Read the bound values from the current global configuration.
+     *
+     * @return Whether every value present in the configuration was valid.
+     */
+    bool load();
+
+    /**
+     * Get the bound values, loading them first if they have not been loaded from the current global configuration.
+     *
+     * @return The bound values.
+     */
+    std::shared_ptr<const Settings> get() const;
+
+private:
+    /**
+     * Function reading one value from a @c ConfigurationNode into @c Settings.
+     *
+     * @param node The node holding the value.
+     * @param[out] settings The settings receiving the value.
+     * @return Whether the value was absent or valid.
+     */
+    using Binder = std::function<bool(const ConfigurationNode& node, Settings* settings)>;
+
+    /**
+     * Common logic for binding a value of a specific type.
+     *
+     * @tparam Type The type of the value.
+     * @param key The key of the value.
+     * @param member The member receiving the value.
+     * @param defaultValue The value used if @c key is absent or the value is invalid.
+     * @param validator Optional function checking the value.
+     * @param getValue Function fetching the value from a @c ConfigurationNode, with the signature of
+     * @c ConfigurationNode::getInt().
+     * @return This binding, to allow chaining.
+     */
+    template <typename Type>
+    ConfigurationBinding& bind(
+        const std::string& key,
+        Type Settings::*member,
+        Type defaultValue,
+        Validator<Type> validator,
+        std::function<bool(const ConfigurationNode&, const std::string&, Type*, Type)> getValue);
+
+    /**
+     * Read the bound values from the global configuration.  @c m_mutex must be held.
+     *
+     * @param generation The generation of the global configuration being read.
+     * @return Whether every value present in the configuration was valid.
+     */
+    bool loadLocked(uint64_t generation) const;
+
+    /// String to identify log entries originating from this file.
+    static const std::string TAG;
+
+    /// Keys of the nested objects holding the bound values.
+    const std::vector<std::string> m_path;
+
+    /// The bindings, in the order they were added.
+    std::vector<Binder> m_binders;
+
+    /// Serializes access to the members below.
+    mutable std::mutex m_mutex;
+
+    /// The values last loaded, or nullptr if none have been loaded.
+    mutable std::shared_ptr<const Settings> m_settings;
+
+    /// Generation of the global configuration from which @c m_settings was loaded.
+    mutable uint64_t m_generation;
+};
+
+template <typename Settings>
+const std::string ConfigurationBinding<Settings>::TAG = "ConfigurationBinding";
+
+template <typename Settings>
+ConfigurationBinding<Settings>::ConfigurationBinding(std::vector<std::string> path) :
+        m_path{std::move(path)},
+        m_generation{0} {
+}
+
+template <typename Settings>
+ConfigurationBinding<Settings>& ConfigurationBinding<Settings>::bindBool(
+    const std::string& key,
+    bool Settings::*member,
+    bool defaultValue) {
+    return bind<bool>(
+        key, member, defaultValue, nullptr, [](const ConfigurationNode& node, const std::string& k, bool* out, bool d) {
+            return node.getBool(k, out, d);
+        });
+}
+
+template <typename Settings>
+ConfigurationBinding<Settings>& ConfigurationBinding<Settings>::bindInt(
+    const std::string& key,
+    int Settings::*member,
+    int defaultValue,
+    Validator<int> validator) {
+    return bind<int>(
+        key, member, defaultValue, validator, [](const ConfigurationNode& node, const std::string& k, int* out, int d) {
+            return node.getInt(k, out, d);
+        });
+}
+
+template <typename Settings>
+ConfigurationBinding<Settings>& ConfigurationBinding<Settings>::bindUint32(
+    const std::string& key,
+    uint32_t Settings::*member,
+    uint32_t defaultValue,
+    Validator<uint32_t> validator) {
+    return bind<uint32_t>(
+        key,
+        member,
+        defaultValue,
+        validator,
+        [](const ConfigurationNode& node, const std::string& k, uint32_t* out, uint32_t d) {
+            return node.getUint32(k, out, d);
+        });
+}
+
+template <typename Settings>
+ConfigurationBinding<Settings>& ConfigurationBinding<Settings>::bindString(
+    const std::string& key,
+    std::string Settings::*member,
+    std::string defaultValue,
+    Validator<std::string> validator) {
+    return bind<std::string>(
+        key,
+        member,
+        defaultValue,
+        validator,
+        [](const ConfigurationNode& node, const std::string& k, std::string* out, std::string d) {
+            return node.getString(k, out, d);
+        });
+}
+
+template <typename Settings>
+ConfigurationBinding<Settings>& ConfigurationBinding<Settings>::bindOptionalString(
+    const std::string& key,
+    std::string Settings::*member,
+    bool Settings::*isPresent) {
+    m_binders.push_back([key, member, isPresent](const ConfigurationNode& node, Settings* settings) {
+        std::string value;
+        settings->*isPresent = node.getString(key, &value);
+        settings->*member = value;
+        return true;
+    });
+    return *this;
+}
+
+template <typename Settings>
+template <typename InputType, typename OutputType>
+ConfigurationBinding<Settings>& ConfigurationBinding<Settings>::bindDuration(
+    const std::string& key,
+    OutputType Settings::*member,
+    OutputType defaultValue,
+    Validator<typename std::common_type<OutputType>::type> validator) {
+    return bind<OutputType>(
+        key,
+        member,
+        defaultValue,
+        validator,
+        [](const ConfigurationNode& node, const std::string& k, OutputType* out, OutputType d) {
+            return node.getDuration<InputType>(k, out, d);
+        });
+}
+
+template <typename Settings>
+template <typename Type>
+ConfigurationBinding<Settings>& ConfigurationBinding<Settings>::bind(
+    const std::string& key,
+    Type Settings::*member,
+    Type defaultValue,
+    Validator<Type> validator,
+    std::function<bool(const ConfigurationNode&, const std::string&, Type*, Type)> getValue) {
+    m_binders.push_back([key, member, defaultValue, validator, getValue](
+                            const ConfigurationNode& node, Settings* settings) {
+        Type value;
+        if (!getValue(node, key, &value, defaultValue)) {
+            settings->*member = defaultValue;
+            return true;
+        }
+        if (validator && !validator(value)) {
+            ACSDK_WARN(logger::LogEntry(TAG, "loadValueFailed").d("reason", "invalidValue").d("key", key));
+            settings->*member = defaultValue;
+            return false;
+        }
+        settings->*member = value;
+        return true;
+    });
+    return *this;
+}
+
+template <typename Settings>
+bool ConfigurationBinding<Settings>::load() {
+    auto generation = ConfigurationNode::getGeneration();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return loadLocked(generation);
+}
+
+template <typename Settings>
+std::shared_ptr<const Settings> ConfigurationBinding<Settings>::get() const {
+    auto generation = ConfigurationNode::getGeneration();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_settings || m_generation != generation) {
+        loadLocked(generation);
+    }
+    return m_settings;
+}
+
+template <typename Settings>
+bool ConfigurationBinding<Settings>::loadLocked(uint64_t generation) const {
+    auto node = ConfigurationNode::getRoot();
+    for (const auto& key : m_path) {
+        node = node[key];
+    }
+
+    auto settings = std::make_shared<Settings>();
+    bool valid = true;
+    for (const auto& binder : m_binders) {
+        valid = binder(node, settings.get()) && valid;
+    }
+
+    m_settings = settings;
+    m_generation = generation;
+    return valid;
+}
+
+}  // namespace configuration
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONBINDING_H_
@@ -16,8 +16,10 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONNODE_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONNODE_H_
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -108,6 +110,14 @@ public:
      */
     static ConfigurationNode getRoot();
 
+    /**
+     * Get the generation of the global configuration.  The generation changes each time the global configuration is
+     * initialized or uninitialized, so that values read from an earlier configuration can be detected as stale.
+     *
+     * @return The generation of the global configuration.
+     */
+    static uint64_t getGeneration();
+
     /**
      * Constructor.
      */
@@ -286,6 +296,9 @@ private:
 
     /// static instance of @c ConfigurationNode identifying the root object within the global configuration.
     static ConfigurationNode m_root;
+
+    /// static generation of the global configuration, incremented by @c initialize() and @c uninitialize().
+    static std::atomic<uint64_t> m_generation;
 };
 
 template <typename InputType, typename OutputType, typename DefaultType>
@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTPCONTENTFETCHER_H_
 
 #include <atomic>
+#include <condition_variable>
 #include <future>
 #include <string>
 #include <thread>
@@ -141,6 +142,9 @@ private:
     /// A mutex to ensure that all state transitions on the m_state variable are thead-safe.
     std::mutex m_stateMutex;
 
+    /// Notified on every state transition, so that the transfer thread can wait for @c getBody() to be called.
+    std::condition_variable m_stateChangeTrigger;
+
     /**
      * A mutex to ensure that concurrent calls to getBody are thread-safe. The @c getBody() function should be called
      * only once in order to ensure that the content fetcher receives a single attachment writer at the right state.
@@ -171,6 +175,14 @@ private:
      */
     bool waitingForBodyRequest();
 
+    /**
+     * Checks if a state is one where the content fetcher is still waiting for the @c getBody method to be called.
+     *
+     * @param state The state to check.
+     * @return @c true if the content fetcher is waiting for the method call in @c state.
+     */
+    static bool isWaitingForBodyRequest(State state);
+
     /**
      * Updates the effective URL using CURL's inbuilt functions.
      * @note: This method should only be called after the curl multi perform method.
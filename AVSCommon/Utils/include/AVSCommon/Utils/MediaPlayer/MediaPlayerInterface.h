@@ -297,6 +297,23 @@ public:
         return false;
     }
 
+    /**
+     * Prepares the audio specified by the @c setSource() call for playback without starting it.
+     *
+     * Implementations may build their decoding pipeline and decode the first buffers of the source ahead of time, so
+     * that a subsequent @c play() only has to start the output. No observer callbacks are made as a result of this
+     * call. Playback is started as usual with @c play().
+     *
+     * NOTE: This call is optional, and may not be implemented by all MediaPlayers.
+     *
+     * @param id The unique id of the source on which to operate.
+     *
+     * @return @c true if the source is being prepared, or @c false otherwise.
+     */
+    virtual bool preroll(SourceId id) {
+        return false;
+    }
+
     /**
      * Returns the offset, in milliseconds, of the media source.
      *
@@ -16,8 +16,10 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -331,8 +333,47 @@ public:
      *     updated.
      *
      * @note As an optimization, we could skip this function if Writer policy is nonblockable (ACSDK-251).
+     *
+     * @return @c true if @c oldestUnconsumedCursor moved forward, else @c false.
+     */
+    bool updateOldestUnconsumedCursorLocked();
+
+    /**
+     * This function sets the callback made when data may have become available to a @c Reader.  The callback is made
+     * when the @c Writer writes or closes, and when the @c Reader is closed.
+     *
+     * @note Readiness callbacks are local to this @c BufferLayout, so they are only made for @c Writers and
+     *     @c Readers created from the same @c SharedDataStream instance.  They are made while stream locks are held,
+     *     so they must not block or call back into the stream; they should only signal another thread or event loop.
+     *     Clearing a callback waits for a callback which is in progress to return.
+     *
+     * @param id The id of the @c Reader.
+     * @param callback The callback to make, or @c nullptr to stop making callbacks.
+     */
+    void setDataAvailableCallback(size_t id, std::function<void()> callback);
+
+    /**
+     * This function sets the callback made when space may have become available to the @c Writer.  The callback is
+     * made when a @c Reader consumes data or is removed, and when the @c Writer closes.
+     *
+     * @note The restrictions on callbacks described in @c setDataAvailableCallback() apply.
+     *
+     * @param callback The callback to make, or @c nullptr to stop making callbacks.
+     */
+    void setSpaceAvailableCallback(std::function<void()> callback);
+
+    /// This function makes the data available callbacks of all @c Readers.
+    void notifyDataAvailable();
+
+    /**
+     * This function makes the data available callback of one @c Reader.
+     *
+     * @param id The id of the @c Reader.
      */
-    void updateOldestUnconsumedCursorLocked();
+    void notifyDataAvailable(size_t id);
+
+    /// This function makes the space available callback of the @c Writer.
+    void notifySpaceAvailable();
 
 private:
     /**
@@ -388,6 +429,12 @@ private:
      */
     void calculateAndCacheConstants(size_t wordSize, size_t maxReaders);
 
+    /**
+     * This function updates @c m_hasReadinessCallbacks after a callback has been set.  It must be called while holding
+     * @c m_readinessCallbackMutex.
+     */
+    void updateHasReadinessCallbacksLocked();
+
     /**
      * The tag associated with log entries from this class.
      */
@@ -417,6 +464,18 @@ private:
 
     /// Precalculated pointer to the circular data.
     uint8_t* m_data;
+
+    /// This mutex serializes access to the readiness callbacks, and is held while they are made.
+    std::mutex m_readinessCallbackMutex;
+
+    /// Whether any readiness callback is set, so that notifications can skip the mutex when none is.
+    std::atomic<bool> m_hasReadinessCallbacks;
+
+    /// The data available callbacks, indexed by @c Reader id.
+    std::vector<std::function<void()>> m_dataAvailableCallbacks;
+
+    /// The space available callback of the @c Writer.
+    std::function<void()> m_spaceAvailableCallback;
 };
 
 template <typename T>
@@ -429,7 +488,8 @@ SharedDataStream<T>::BufferLayout::BufferLayout(std::shared_ptr<Buffer> buffer)
         m_readerCursorArray{nullptr},
         m_readerCloseIndexArray{nullptr},
         m_dataSize{0},
-        m_data{nullptr} {
+        m_data{nullptr},
+        m_hasReadinessCallbacks{false} {
 }
 
 template <typename T>
@@ -631,12 +691,18 @@ size_t SharedDataStream<T>::BufferLayout::calculateDataOffset(size_t wordSize, s
 template <typename T>
 void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursor() {
     // Note: as an optimization, we could skip this function if Writer policy is nonblockable (ACSDK-251).
-    std::lock_guard<Mutex> backwardSeekLock(getHeader()->backwardSeekMutex);
-    updateOldestUnconsumedCursorLocked();
+    bool moved = false;
+    {
+        std::lock_guard<Mutex> backwardSeekLock(getHeader()->backwardSeekMutex);
+        moved = updateOldestUnconsumedCursorLocked();
+    }
+    if (moved) {
+        notifySpaceAvailable();
+    }
 }
 
 template <typename T>
-void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
+bool SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
     auto header = getHeader();
 
     // Note: as an optimization, we could skip this function if Writer policy is nonblockable (ACSDK-251).
@@ -680,6 +746,72 @@ void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
         // Notify the writer(s).
         // Note: as an optimization, we could skip this if there are no blocking writers (ACSDK-251).
         header->spaceAvailableConditionVariable.notify_all();
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::setDataAvailableCallback(size_t id, std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(m_readinessCallbackMutex);
+    if (id >= m_dataAvailableCallbacks.size()) {
+        if (!callback) {
+            return;
+        }
+        m_dataAvailableCallbacks.resize(id + 1);
+    }
+    m_dataAvailableCallbacks[id] = std::move(callback);
+    updateHasReadinessCallbacksLocked();
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::setSpaceAvailableCallback(std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(m_readinessCallbackMutex);
+    m_spaceAvailableCallback = std::move(callback);
+    updateHasReadinessCallbacksLocked();
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::updateHasReadinessCallbacksLocked() {
+    bool hasCallbacks = static_cast<bool>(m_spaceAvailableCallback);
+    for (const auto& callback : m_dataAvailableCallbacks) {
+        hasCallbacks = hasCallbacks || static_cast<bool>(callback);
+    }
+    m_hasReadinessCallbacks = hasCallbacks;
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifyDataAvailable() {
+    if (!m_hasReadinessCallbacks) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_readinessCallbackMutex);
+    for (const auto& callback : m_dataAvailableCallbacks) {
+        if (callback) {
+            callback();
+        }
+    }
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifyDataAvailable(size_t id) {
+    if (!m_hasReadinessCallbacks) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_readinessCallbackMutex);
+    if (id < m_dataAvailableCallbacks.size() && m_dataAvailableCallbacks[id]) {
+        m_dataAvailableCallbacks[id]();
+    }
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifySpaceAvailable() {
+    if (!m_hasReadinessCallbacks) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_readinessCallbackMutex);
+    if (m_spaceAvailableCallback) {
+        m_spaceAvailableCallback();
     }
 }
 
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <vector>
 #include <mutex>
 #include <limits>
@@ -198,13 +199,26 @@ public:
      * @param offset The position (in @c wordSize words) in the stream, relative to @c reference, to close at.
      * @param reference The position in the stream the close point is measured against.
      *
-     * @note This function can be called from any thread or process, and it will schedule the @c Reader to close,
-     *     however it will *not* wake up a @c BLOCKING @c Reader which is already blocked waiting for data.  In the
-     *     case of a blocked @c read(), that @c read() will return when it wakes up - either due to a timeout, or due
-     *     to a @c Writer adding data to the stream.
+     * @note This function can be called from any thread or process, and it will schedule the @c Reader to close.  A
+     *     @c BLOCKING @c Reader which is already blocked waiting for data is woken up, and its @c read() returns
+     *     @c Error::CLOSED if the close point has been reached.
      */
     void close(Index offset = 0, Reference reference = Reference::AFTER_READER);
 
+    /**
+     * This function sets a callback which is made when this @c Reader may be able to make progress: when the
+     * @c Writer writes data or closes, and when this @c Reader is closed.  The callback lets a @c Reader be driven by
+     * an event loop instead of polling with timed reads.  To avoid missing a notification, the callback should be set
+     * before the first @c read().
+     *
+     * @note The callback is only made for a @c Writer created from the same @c SharedDataStream instance as this
+     *     @c Reader.  It is made while stream locks are held, so it must not block or call back into the stream.
+     *
+     * @param callback The callback to make, or @c nullptr to stop making callbacks.  Setting a callback replaces any
+     *     previous one.
+     */
+    void setDataAvailableCallback(std::function<void()> callback);
+
     /**
      * This function returns the id assigned to this @c Reader.  If a @c Reader instance is not destroyed cleanly (e.g.
      * a @c Reader from another process that crashes), its id can be passed to @c SharedDataStream::reset() to free up
@@ -279,6 +293,8 @@ SharedDataStream<T>::Reader::Reader(Policy policy, std::shared_ptr<BufferLayout>
 
 template <typename T>
 SharedDataStream<T>::Reader::~Reader() {
+    m_bufferLayout->setDataAvailableCallback(m_id, nullptr);
+
     // Note: We can't leave a reader with its cursor in the future; doing so can introduce a race condition in
     // updateOldestUnconsumedCursor().  See updateOldestUnconsumedCursor() comments for further explanation.
     seek(0, Reference::BEFORE_WRITER);
@@ -345,9 +361,10 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
         } else if (Policy::NONBLOCKING == m_policy) {
             return Error::WOULDBLOCK;
         } else if (Policy::BLOCKING == m_policy) {
-            // Condition for returning from read: the Writer has been closed or there is data to read
+            // Condition for returning from read: the Writer or this Reader has been closed, or there is data to read
             auto predicate = [this, header] {
-                return header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) > 0;
+                return header->hasWriterBeenClosed || *m_readerCursor >= *m_readerCloseIndex ||
+                       tell(Reference::BEFORE_WRITER) > 0;
             };
 
             if (std::chrono::milliseconds::zero() == timeout) {
@@ -355,6 +372,12 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
             } else if (!header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate)) {
                 return Error::TIMEDOUT;
             }
+
+            // This Reader may have been closed while waiting.
+            readerCloseIndex = m_readerCloseIndex->load();
+            if (*m_readerCursor >= readerCloseIndex) {
+                return Error::CLOSED;
+            }
         }
         wordsAvailable = tell(Reference::BEFORE_WRITER);
 
@@ -539,7 +562,20 @@ void SharedDataStream<T>::Reader::close(Index offset, Reference reference) {
         logger::acsdkError(logger::LogEntry(TAG, "closeFailed").d("reason", "invalidReference"));
     }
 
-    *m_readerCloseIndex = absolute;
+    // Note: The close index is updated while holding dataAvailableMutex so that a blocked read() cannot miss the
+    // notification below between checking its predicate and waiting.
+    auto header = m_bufferLayout->getHeader();
+    {
+        std::lock_guard<Mutex> lock(header->dataAvailableMutex);
+        *m_readerCloseIndex = absolute;
+    }
+    header->dataAvailableConditionVariable.notify_all();
+    m_bufferLayout->notifyDataAvailable(m_id);
+}
+
+template <typename T>
+void SharedDataStream<T>::Reader::setDataAvailableCallback(std::function<void()> callback) {
+    m_bufferLayout->setDataAvailableCallback(m_id, std::move(callback));
 }
 
 template <typename T>
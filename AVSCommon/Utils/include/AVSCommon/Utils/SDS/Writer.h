@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <mutex>
 #include <vector>
@@ -105,10 +106,24 @@ public:
 
     /**
      * This function closes the @c Writer, such that @c Readers will return 0 when they catch up with the @c Writer,
-     * and subsequent calls to @c write() will return 0.
+     * and subsequent calls to @c write() will return 0.  A @c BLOCKING @c write() which is waiting for space is woken
+     * up and returns 0.
      */
     void close();
 
+    /**
+     * This function sets a callback which is made when this @c Writer may be able to make progress: when a @c Reader
+     * consumes data or is removed, and when this @c Writer is closed.  The callback lets a @c Writer be driven by an
+     * event loop instead of polling with timed writes.
+     *
+     * @note The callback is only made for @c Readers created from the same @c SharedDataStream instance as this
+     *     @c Writer.  It is made while stream locks are held, so it must not block or call back into the stream.
+     *
+     * @param callback The callback to make, or @c nullptr to stop making callbacks.  Setting a callback replaces any
+     *     previous one.
+     */
+    void setSpaceAvailableCallback(std::function<void()> callback);
+
     /**
      * This function returns the word size (in bytes).  All @c SharedDataStream operations that work with data or
      * position in the stream are quantified in words.
@@ -161,6 +176,7 @@ SharedDataStream<T>::Writer::Writer(Policy policy, std::shared_ptr<BufferLayout>
 template <typename T>
 SharedDataStream<T>::Writer::~Writer() {
     close();
+    m_bufferLayout->setSpaceAvailableCallback(nullptr);
 }
 
 template <typename T>
@@ -209,9 +225,9 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         case Policy::BLOCKING:
             // For BLOCKING, we need to wait until there is room for at least one word.
 
-            // Condition for returning from write: there is space for a write.
+            // Condition for returning from write: the Writer has been closed, or there is space for a write.
             auto predicate = [this, header] {
-                return (header->writeStartCursor < header->oldestUnconsumedCursor) ||
+                return !header->isWriterEnabled || (header->writeStartCursor < header->oldestUnconsumedCursor) ||
                        (header->writeStartCursor - header->oldestUnconsumedCursor) < m_bufferLayout->getDataSize();
             };
 
@@ -226,6 +242,11 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
                 return Error::TIMEDOUT;
             }
 
+            // The Writer may have been closed while waiting.
+            if (!header->isWriterEnabled) {
+                return Error::CLOSED;
+            }
+
             // Figure out how much space we have.
             auto spaceAvailable = m_bufferLayout->getDataSize();
             if (header->writeStartCursor >= header->oldestUnconsumedCursor) {
@@ -295,6 +316,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
     // Notify the reader(s).
     // Note: as an optimization, we could skip this if there are no blocking readers (ACSDK-251).
     header->dataAvailableConditionVariable.notify_all();
+    m_bufferLayout->notifyDataAvailable();
 
     return nWords;
 }
@@ -319,10 +341,26 @@ void SharedDataStream<T>::Writer::close() {
         header->hasWriterBeenClosed = true;
 
         header->dataAvailableConditionVariable.notify_all();
+        dataAvailableLock.unlock();
+
+        // Wake up a blocked write().  Its predicate is checked while holding backwardSeekMutex, so lock it to make sure
+        // the notification cannot be missed.
+        {
+            std::lock_guard<Mutex> backwardSeekLock(header->backwardSeekMutex);
+        }
+        header->spaceAvailableConditionVariable.notify_all();
+
+        m_bufferLayout->notifyDataAvailable();
+        m_bufferLayout->notifySpaceAvailable();
     }
     m_closed = true;
 }
 
+template <typename T>
+void SharedDataStream<T>::Writer::setSpaceAvailableCallback(std::function<void()> callback) {
+    m_bufferLayout->setSpaceAvailableCallback(std::move(callback));
+}
+
 template <typename T>
 size_t SharedDataStream<T>::Writer::getWordSize() const {
     return m_bufferLayout->getHeader()->wordSize;
@@ -0,0 +1,123 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_STARTUPTRACE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_STARTUPTRACE_H_
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * Records how long each component takes to be constructed and started, so that the critical path of startup can be
+ * examined.
+ *
+ * A trace is a list of spans, each with a category, a name, and the thread on which it ran.  The trace can be
+ * written in the Chrome trace event format, which can be loaded in chrome://tracing or Perfetto.
+ *
+ * This class is thread safe.
+ */
+class StartupTrace {
+public:
+    /// The clock used to time spans.
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Create a @c StartupTrace.  Span times are reported relative to the time the trace is created.
+     *
+     * @return A new @c StartupTrace.
+     */
+    static std::shared_ptr<StartupTrace> create();
+
+    /**
+     * Add a span which ran on the calling thread.
+     *
+     * @param category The category of the span, for example "construct" or "startup".
+     * @param name The name of the span.
+     * @param start When the span started.
+     * @param end When the span ended.
+     */
+    void addSpan(const std::string& category, const std::string& name, Clock::time_point start, Clock::time_point end);
+
+    /**
+     * Get the number of spans added so far.
+     *
+     * @return The number of spans.
+     */
+    size_t getSpanCount() const;
+
+    /**
+     * Get the trace in the Chrome trace event format.
+     *
+     * @return A JSON object with a "traceEvents" array holding one complete event per span.
+     */
+    std::string toChromeTraceJson() const;
+
+    /**
+     * Write the trace to a file in the Chrome trace event format.
+     *
+     * @param path The path of the file to write.
+     * @return Whether the file was written.
+     */
+    bool writeChromeTrace(const std::string& path) const;
+
+private:
+    /// A span added to the trace.
+    struct Span {
+        /// The category of the span.
+        std::string category;
+        /// The name of the span.
+        std::string name;
+        /// The start of the span, in microseconds since the trace was created.
+        long long startMicroseconds;
+        /// The duration of the span, in microseconds.
+        long long durationMicroseconds;
+        /// Index of the thread on which the span ran, in the order threads were first seen.
+        size_t threadIndex;
+    };
+
+    /**
+     * Constructor.
+     */
+    StartupTrace();
+
+    /// The time the trace was created.
+    const Clock::time_point m_origin;
+
+    /// Serializes access to the members below.
+    mutable std::mutex m_mutex;
+
+    /// The spans added so far.
+    std::vector<Span> m_spans;
+
+    /// Map of the threads seen so far to their index.
+    std::unordered_map<std::thread::id, size_t> m_threadIndices;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_STARTUPTRACE_H_
@@ -16,6 +16,9 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_UUIDGENERATION_UUIDGENERATION_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_UUIDGENERATION_UUIDGENERATION_H_
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -25,6 +28,12 @@ namespace avsCommon {
 namespace utils {
 namespace uuidGeneration {
 
+/// Number of characters in a UUID string - 32 hexadecimal digits and 4 hyphens.
+constexpr size_t UUID_STRING_LENGTH = 36;
+
+/// Buffer holding the characters of a UUID string, without a terminating null.
+using UUIDBuffer = std::array<char, UUID_STRING_LENGTH>;
+
 /**
  * Set the customized function to read entropy value instead of the default.
  * @param func Customized function used to read entropy value.
@@ -38,10 +47,29 @@ void setEntropyReader(std::function<double(void)> func);
  * variant 1.
  * @see https://tools.ietf.org/html/rfc4122.
  *
+ * Each thread has its own random number generator, so concurrent calls do not contend.  A thread's generator is
+ * seeded from @c std::random_device before its first UUID, and again after @c addSeeds() or @c setSalt() is called.
+ *
  * @return A uuid as a string.
  */
 const std::string generateUUID();
 
+/**
+ * Generates a UUID as @c generateUUID() does, writing its characters to a buffer instead of allocating a string.
+ *
+ * @param[out] uuid The buffer to write to.
+ * @return Whether a UUID was written.
+ */
+bool generateUUID(UUIDBuffer* uuid);
+
+/**
+ * Generates several UUIDs as @c generateUUID() does.
+ *
+ * @param count The number of UUIDs to generate.
+ * @return The UUIDs.
+ */
+std::vector<std::string> generateUUIDs(size_t count);
+
 /**
  * Allows caller to set a specific salt to be used in any seeding operation.
  * Salt wil be a prefix to the seed and should be as specific to the unique device as possible.
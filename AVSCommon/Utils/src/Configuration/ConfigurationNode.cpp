@@ -42,6 +42,7 @@ using namespace rapidjson;
 std::mutex ConfigurationNode::m_mutex;
 Document ConfigurationNode::m_document;
 ConfigurationNode ConfigurationNode::m_root;
+std::atomic<uint64_t> ConfigurationNode::m_generation{0};
 
 #ifdef ACSDK_DEBUG_LOG_ENABLED
 /**
@@ -122,6 +123,7 @@ bool ConfigurationNode::initialize(const std::vector<std::shared_ptr<std::istrea
     }
 
     m_root = ConfigurationNode(&m_document);
+    m_generation++;
     ACSDK_DEBUG0(LX("initializeSuccess").sensitive("configuration", valueToString(m_document)));
     return true;
 }
@@ -130,6 +132,7 @@ void ConfigurationNode::uninitialize() {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_document.SetObject();
     m_root = ConfigurationNode();
+    m_generation++;
 }
 
 std::shared_ptr<ConfigurationNode> ConfigurationNode::createRoot() {
@@ -140,6 +143,10 @@ ConfigurationNode ConfigurationNode::getRoot() {
     return m_root;
 }
 
+uint64_t ConfigurationNode::getGeneration() {
+    return m_generation;
+}
+
 ConfigurationNode::ConfigurationNode() : m_object{nullptr} {
 }
 
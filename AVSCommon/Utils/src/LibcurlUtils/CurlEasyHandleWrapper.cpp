@@ -16,7 +16,7 @@
 #include <iostream>
 
 #include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
-#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Configuration/ConfigurationBinding.h"
 #include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
 #include <AVSCommon/Utils/LibcurlUtils/LibcurlUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -129,6 +129,35 @@ static const char* curlInfoTypeToPrefix(curl_infotype type) {
 }
 #endif  // ACSDK_EMIT_CURL_LOGS
 
+/// Settings read from the @c LibCurlUtil @c ConfigurationNode.
+struct CurlEasyHandleSettings {
+    /// Value for @c CURLOPT_INTERFACE, or empty if not configured.
+    std::string interfaceName;
+#ifdef ACSDK_EMIT_CURL_LOGS
+    /// Path/prefix of per-stream log file names, or empty if streams are not logged.
+    std::string streamLogPrefix;
+#endif
+};
+
+/**
+ * Get the current @c CurlEasyHandleSettings.  Handles are reset at runtime, so the settings are bound once and
+ * reloaded only when the global configuration is initialized again.
+ *
+ * @return The current settings.
+ */
+static std::shared_ptr<const CurlEasyHandleSettings> getSettings() {
+    static const std::unique_ptr<configuration::ConfigurationBinding<CurlEasyHandleSettings>> binding = [] {
+        std::unique_ptr<configuration::ConfigurationBinding<CurlEasyHandleSettings>> newBinding(
+            new configuration::ConfigurationBinding<CurlEasyHandleSettings>({LIBCURLUTILS_CONFIG_KEY}));
+        newBinding->bindString(INTERFACE_CONFIG_KEY, &CurlEasyHandleSettings::interfaceName, "");
+#ifdef ACSDK_EMIT_CURL_LOGS
+        newBinding->bindString(STREAM_LOG_PREFIX_KEY, &CurlEasyHandleSettings::streamLogPrefix, "");
+#endif
+        return newBinding;
+    }();
+    return binding->get();
+}
+
 CurlEasyHandleWrapper::CurlEasyHandleWrapper(std::string id) :
         m_handle{curl_easy_init()},
         m_requestHeaders{nullptr},
@@ -432,9 +461,7 @@ std::string CurlEasyHandleWrapper::getInterfaceName() {
 }
 
 void CurlEasyHandleWrapper::initializeNetworkInterfaceNameLocked() {
-    auto config = configuration::ConfigurationNode::getRoot()[LIBCURLUTILS_CONFIG_KEY];
-    std::string interfaceNameFromConfig;
-    config.getString(INTERFACE_CONFIG_KEY, &interfaceNameFromConfig, "");
+    auto interfaceNameFromConfig = getSettings()->interfaceName;
 
     if (m_interfaceName.empty() && !interfaceNameFromConfig.empty()) {
         // Update the value from config, so that getInterfaceName always
@@ -451,9 +478,7 @@ CurlEasyHandleWrapperOptionsSettingAdapter& CurlEasyHandleWrapper::curlOptionsSe
 
 #ifdef ACSDK_EMIT_CURL_LOGS
 void CurlEasyHandleWrapper::initStreamLog() {
-    std::string streamLogPrefix;
-    configuration::ConfigurationNode::getRoot()[LIBCURLUTILS_CONFIG_KEY].getString(
-        STREAM_LOG_PREFIX_KEY, &streamLogPrefix);
+    auto streamLogPrefix = getSettings()->streamLogPrefix;
     if (streamLogPrefix.empty()) {
         return;
     }
@@ -36,11 +36,6 @@ using namespace avsCommon::utils::libcurlUtils;
 /// String to identify log entries originating from this file.
 static const std::string TAG("LibCurlHttpContentFetcher");
 
-/**
- * The timeout for a blocking write call to an @c AttachmentWriter. This value may be increased to decrease wakeups but
- * may also increase latency.
- */
-static const std::chrono::milliseconds TIMEOUT_FOR_BLOCKING_WRITE = std::chrono::milliseconds(100);
 /// Timeout for polling loops that check activities running on separate threads.
 static const std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT{100};
 /// Timeout for curl connection.
@@ -126,13 +121,12 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
     }
 
     // Waits until the content fetcher is shutting down or the @c getBody method gets called.
-    auto startTime = std::chrono::steady_clock::now();
-    auto elapsedTime = std::chrono::steady_clock::now() - startTime;
-    while ((MAX_GET_BODY_WAIT > elapsedTime) && !fetcher->m_isShutdown && fetcher->waitingForBodyRequest()) {
-        std::this_thread::sleep_for(WAIT_FOR_ACTIVITY_TIMEOUT);
-        elapsedTime = std::chrono::steady_clock::now() - startTime;
-    }
-    if (MAX_GET_BODY_WAIT <= elapsedTime) {
+    std::unique_lock<std::mutex> stateLock(fetcher->m_stateMutex);
+    auto bodyRequested = fetcher->m_stateChangeTrigger.wait_for(stateLock, MAX_GET_BODY_WAIT, [fetcher] {
+        return fetcher->m_isShutdown || !isWaitingForBodyRequest(fetcher->m_state);
+    });
+    stateLock.unlock();
+    if (!bodyRequested) {
         ACSDK_ERROR(LX("bodyCallback").d("reason", "getBodyCallWaitTimeout"));
         fetcher->stateTransition(State::ERROR, false);
         return 0;
@@ -143,14 +137,17 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
 
     fetcher->stateTransition(State::FETCHING_BODY, true);
 
-    if (!fetcher->m_streamWriter) {
-        ACSDK_DEBUG9(LX("bodyCallback").m("No writer received. Creating a new one."));
-        // Using the url as the identifier for the attachment
-        auto stream = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(fetcher->m_url);
-        fetcher->m_streamWriter = stream->createWriter(sds::WriterPolicy::BLOCKING);
+    std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> streamWriter;
+    {
+        std::lock_guard<std::mutex> lock(fetcher->m_getBodyMutex);
+        if (!fetcher->m_streamWriter) {
+            ACSDK_DEBUG9(LX("bodyCallback").m("No writer received. Creating a new one."));
+            // Using the url as the identifier for the attachment
+            auto stream = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(fetcher->m_url);
+            fetcher->m_streamWriter = stream->createWriter(sds::WriterPolicy::BLOCKING);
+        }
+        streamWriter = fetcher->m_streamWriter;
     }
-
-    auto streamWriter = fetcher->m_streamWriter;
     size_t totalBytesWritten = 0;
 
     if (streamWriter) {
@@ -159,11 +156,8 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
         while ((totalBytesWritten < targetNumBytes) && !fetcher->m_done) {
             auto writeStatus = avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK;
 
-            size_t numBytesWritten = streamWriter->write(
-                data,
-                targetNumBytes - totalBytesWritten,
-                &writeStatus,
-                std::chrono::milliseconds(TIMEOUT_FOR_BLOCKING_WRITE));
+            // Blocks until there is space to write.  The destructor closes the writer to interrupt the write.
+            size_t numBytesWritten = streamWriter->write(data, targetNumBytes - totalBytesWritten, &writeStatus);
             totalBytesWritten += numBytesWritten;
             data += numBytesWritten;
 
@@ -569,9 +563,20 @@ curl_slist* LibCurlHttpContentFetcher::getCustomHeaderList(const std::vector<std
 LibCurlHttpContentFetcher::~LibCurlHttpContentFetcher() {
     ACSDK_DEBUG9(LX("~LibCurlHttpContentFetcher").sensitive("URL", m_url));
     if (m_thread.joinable()) {
-        m_done = true;
+        bool transferInProgress = !m_done.exchange(true);
         m_isShutdown = true;
         stateTransition(State::BODY_DONE, true);
+        if (transferInProgress) {
+            // Writing to the attachment aborts, so close the writer to interrupt a write waiting for space.
+            std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> streamWriter;
+            {
+                std::lock_guard<std::mutex> lock(m_getBodyMutex);
+                streamWriter = m_streamWriter;
+            }
+            if (streamWriter) {
+                streamWriter->close();
+            }
+        }
         m_thread.join();
     }
 }
@@ -585,6 +590,8 @@ void LibCurlHttpContentFetcher::reportInvalidStateTransitionAttempt(State curren
 
 void LibCurlHttpContentFetcher::stateTransition(State newState, bool value) {
     std::lock_guard<std::mutex> lock(m_stateMutex);
+    // Waiters check their condition once the lock is released, after the transition below.
+    m_stateChangeTrigger.notify_all();
     switch (m_state) {
         case State::INITIALIZED:
             switch (newState) {
@@ -709,7 +716,10 @@ void LibCurlHttpContentFetcher::stateTransition(State newState, bool value) {
 }
 
 bool LibCurlHttpContentFetcher::waitingForBodyRequest() {
-    State state = getState();
+    return isWaitingForBodyRequest(getState());
+}
+
+bool LibCurlHttpContentFetcher::isWaitingForBodyRequest(State state) {
     return (State::INITIALIZED == state) || (State::FETCHING_HEADER == state) || (State::HEADER_DONE == state);
 }
 
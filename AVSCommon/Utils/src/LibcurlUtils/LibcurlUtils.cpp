@@ -18,7 +18,7 @@
 
 #include <curl/curl.h>
 
-#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Configuration/ConfigurationBinding.h"
 #include "AVSCommon/Utils/LibcurlUtils/LibcurlUtils.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 
@@ -52,6 +52,43 @@ static const std::string PROXY_CONFIG_KEY = "CURLOPT_PROXY";
 /// Key for looking up a configuration value for verifying hosts and peers.
 static const std::string VERIFY_HOSTS_AND_PEERS_CONFIG_KEY = "verifyHostsAndPeers";
 
+/// Settings read from the @c LibCurlUtil @c ConfigurationNode.
+struct LibcurlSettings {
+    /// Value for @c CURLOPT_CAPATH.
+    std::string caPath;
+    /// Whether @c CURLOPT_CAPATH is configured.
+    bool hasCaPath;
+    /// Value for @c CURLOPT_CAINFO.
+    std::string caInfo;
+    /// Whether @c CURLOPT_CAINFO is configured.
+    bool hasCaInfo;
+    /// Value for @c CURLOPT_PROXY.  An empty value is configured to disable proxies set in the environment.
+    std::string proxy;
+    /// Whether @c CURLOPT_PROXY is configured.
+    bool hasProxy;
+    /// Whether hosts and peers are verified.
+    bool verifyHostsAndPeers;
+};
+
+/**
+ * Get the current @c LibcurlSettings.  Handles are prepared at runtime, so the settings are bound once and reloaded
+ * only when the global configuration is initialized again.
+ *
+ * @return The current settings.
+ */
+static std::shared_ptr<const LibcurlSettings> getSettings() {
+    static const std::unique_ptr<configuration::ConfigurationBinding<LibcurlSettings>> binding = [] {
+        std::unique_ptr<configuration::ConfigurationBinding<LibcurlSettings>> newBinding(
+            new configuration::ConfigurationBinding<LibcurlSettings>({LIBCURLUTILS_CONFIG_KEY}));
+        newBinding->bindOptionalString(CAPATH_CONFIG_KEY, &LibcurlSettings::caPath, &LibcurlSettings::hasCaPath)
+            .bindOptionalString(CAINFO_CONFIG_KEY, &LibcurlSettings::caInfo, &LibcurlSettings::hasCaInfo)
+            .bindOptionalString(PROXY_CONFIG_KEY, &LibcurlSettings::proxy, &LibcurlSettings::hasProxy)
+            .bindBool(VERIFY_HOSTS_AND_PEERS_CONFIG_KEY, &LibcurlSettings::verifyHostsAndPeers, true);
+        return newBinding;
+    }();
+    return binding->get();
+}
+
 /**
  * Set an @c option on a @c libcurl handle to @c value with stringification of @c option name and @c value for logging.
  *
@@ -103,24 +140,21 @@ bool prepareForTLS(CURL* handle) {
         return false;
     }
 
-    auto config = configuration::ConfigurationNode::getRoot()[LIBCURLUTILS_CONFIG_KEY];
+    auto settings = getSettings();
 
-    std::string caPath;
-    if (config.getString(CAPATH_CONFIG_KEY, &caPath) &&
-        !setopt(handle, CURLOPT_CAPATH, caPath.c_str(), "CURLOPT_CAPATH", caPath.c_str())) {
+    if (settings->hasCaPath &&
+        !setopt(handle, CURLOPT_CAPATH, settings->caPath.c_str(), "CURLOPT_CAPATH", settings->caPath.c_str())) {
         return false;
     }
 
-    std::string caInfo;
-    if (config.getString(CAINFO_CONFIG_KEY, &caInfo) &&
-        !setopt(handle, CURLOPT_CAINFO, caInfo.c_str(), "CURLOPT_CAINFO", caInfo.c_str())) {
+    if (settings->hasCaInfo &&
+        !setopt(handle, CURLOPT_CAINFO, settings->caInfo.c_str(), "CURLOPT_CAINFO", settings->caInfo.c_str())) {
         return false;
     }
 
 // Only allow disabling the verification of hosts and peers in debug configurations.
 #ifdef DEBUG
-    bool verifyHostsAndPeers = true;
-    if (config.getBool(VERIFY_HOSTS_AND_PEERS_CONFIG_KEY, &verifyHostsAndPeers) && !verifyHostsAndPeers) {
+    if (!settings->verifyHostsAndPeers) {
         if (!(SETOPT(handle, CURLOPT_SSL_VERIFYPEER, 0L) && SETOPT(handle, CURLOPT_SSL_VERIFYHOST, 0L))) {
             return false;
         }
@@ -137,11 +171,10 @@ bool prepareForProxy(CURL* handle) {
         return false;
     }
 
-    auto config = configuration::ConfigurationNode::getRoot()[LIBCURLUTILS_CONFIG_KEY];
+    auto settings = getSettings();
 
-    std::string proxy;
-    if (config.getString(PROXY_CONFIG_KEY, &proxy) &&
-        !setopt(handle, CURLOPT_PROXY, proxy.c_str(), "CURLOPT_PROXY", proxy.c_str())) {
+    if (settings->hasProxy &&
+        !setopt(handle, CURLOPT_PROXY, settings->proxy.c_str(), "CURLOPT_PROXY", settings->proxy.c_str())) {
         ACSDK_ERROR(LX("prepareForProxyFailed").d("reason", "CURLOPT_PROXY setopt Failed"));
         return false;
     }
@@ -0,0 +1,128 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fstream>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include "AVSCommon/Utils/Timing/StartupTrace.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("StartupTrace");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Process ID reported for every event.  Chrome groups events by process, and a trace only covers one process.
+static const int TRACE_PROCESS_ID = 1;
+
+/// Phase of a complete event (one with a start and a duration) in the Chrome trace event format.
+static const char COMPLETE_EVENT_PHASE[] = "X";
+
+std::shared_ptr<StartupTrace> StartupTrace::create() {
+    return std::shared_ptr<StartupTrace>(new StartupTrace());
+}
+
+void StartupTrace::addSpan(
+    const std::string& category,
+    const std::string& name,
+    Clock::time_point start,
+    Clock::time_point end) {
+    auto startMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(start - m_origin).count();
+    auto durationMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    if (durationMicroseconds < 0) {
+        ACSDK_WARN(LX("addSpan").d("reason", "endBeforeStart").d("name", name));
+        durationMicroseconds = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto threadIt = m_threadIndices.insert({std::this_thread::get_id(), m_threadIndices.size()}).first;
+    m_spans.push_back({category, name, startMicroseconds, durationMicroseconds, threadIt->second});
+}
+
+size_t StartupTrace::getSpanCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_spans.size();
+}
+
+std::string StartupTrace::toChromeTraceJson() const {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& span : m_spans) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(span.name.c_str(), span.name.size());
+            writer.Key("cat");
+            writer.String(span.category.c_str(), span.category.size());
+            writer.Key("ph");
+            writer.String(COMPLETE_EVENT_PHASE);
+            writer.Key("ts");
+            writer.Int64(span.startMicroseconds);
+            writer.Key("dur");
+            writer.Int64(span.durationMicroseconds);
+            writer.Key("pid");
+            writer.Int(TRACE_PROCESS_ID);
+            writer.Key("tid");
+            writer.Uint64(span.threadIndex);
+            writer.EndObject();
+        }
+    }
+    writer.EndArray();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.EndObject();
+
+    return buffer.GetString();
+}
+
+bool StartupTrace::writeChromeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.good()) {
+        ACSDK_ERROR(LX("writeChromeTraceFailed").d("reason", "openFailed").d("path", path));
+        return false;
+    }
+    file << toChromeTraceJson();
+    file.close();
+    if (file.fail()) {
+        ACSDK_ERROR(LX("writeChromeTraceFailed").d("reason", "writeFailed").d("path", path));
+        return false;
+    }
+    return true;
+}
+
+StartupTrace::StartupTrace() : m_origin{Clock::now()} {
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
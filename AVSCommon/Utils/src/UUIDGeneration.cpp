@@ -13,17 +13,18 @@
  * permissions and limitations under the License.
  */
 
-#include <random>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <sstream>
-#include <string>
-#include <iomanip>
-#include <cmath>
-#include <mutex>
 #include <climits>
-#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
 #include <list>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
 
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h"
@@ -43,25 +44,34 @@ static const std::string TAG("UUIDGeneration");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-/// The UUID version (Version 4), shifted into the correct position in the byte.
-static const uint8_t UUID_VERSION_VALUE = 4 << 4;
+/// Mask of the version bits within the most significant 64 bits of a UUID.
+static const uint64_t UUID_VERSION_MASK = 0xf000;
 
-/// The UUID variant (Variant 1), shifted into the correct position in the byte.
-static const size_t UUID_VARIANT_VALUE = 2 << 6;
+/// The UUID version (Version 4), shifted into the correct position within the most significant 64 bits.
+static const uint64_t UUID_VERSION_VALUE = 0x4000;
 
-/// Separator used between UUID fields.
-static const std::string SEPARATOR("-");
+/// Mask of the variant bits within the least significant 64 bits of a UUID.
+static const uint64_t UUID_VARIANT_MASK = 0xc000000000000000;
+
+/// The UUID variant (Variant 1), shifted into the correct position within the least significant 64 bits.
+static const uint64_t UUID_VARIANT_VALUE = 0x8000000000000000;
 
-/// Number of bits in the replacement value.
-static const size_t MAX_NUM_REPLACEMENT_BITS = CHAR_BIT;
+/// Number of bytes in a UUID.
+static const size_t UUID_BYTE_COUNT = 16;
+
+/// Lowercase hex digits, indexed by value.
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+/// Separator used between UUID fields.
+static const char SEPARATOR = '-';
 
 /// Number of bits in a hex digit.
 static const size_t BITS_IN_HEX_DIGIT = 4;
 
-/// Indicates if next UUID should be seeded. Must not be accessed unless g_mutex is locked.
-static bool g_seedNeeded = true;
+/// Number of words read from the random device when seeding a generator.
+static const size_t RANDOM_DEVICE_SEED_WORDS = 8;
 
-/// Lock to avoid collisions in generationing uuid and setting seed.
+/// Lock serializing access to the seed pool and the entropy statistics below.
 static std::mutex g_mutex;
 
 /// Entropy Threshold for sufficient uniqueness. Value chosen by experiment.
@@ -70,11 +80,14 @@ static const double ENTROPY_THRESHOLD = 600;
 /// extra seeds
 static const size_t MAX_SEEDS_POOL_SIZE = 1024;
 
-/// pool of seeds
+/// pool of seeds. Must not be accessed unless g_mutex is locked.
 static std::list<uint32_t> seedsPool;
 
-/// last time generateUUID was invoked
-static uint64_t lastInvokeTime;
+/**
+ * Generation of the seed pool, incremented whenever seeds are added.  Each thread's generator is reseeded before its
+ * next UUID when the generation it was seeded with is out of date.
+ */
+static std::atomic<uint64_t> g_seedGeneration{1};
 
 /// Catch for platforms where entropy is a hard coded value. Value chosen by experiment.
 static const int ENTROPY_REPEAT_THRESHOLD = 16;
@@ -85,152 +98,152 @@ static std::function<double(void)> readEntropyFunc = []() {
     return rd.entropy();
 };
 
+/// A random number generator owned by one thread, so that generating a UUID does not need a lock.
+struct ThreadGenerator {
+    /// The random number generator.
+    std::mt19937_64 engine;
+
+    /// Generation of the seed pool the engine was seeded with, or zero if it has not been seeded.
+    uint64_t seedGeneration = 0;
+};
+
 void setEntropyReader(std::function<double(void)> func) {
+    std::lock_guard<std::mutex> lock(g_mutex);
     readEntropyFunc = func;
 }
 
 void setSalt(const std::string& newSalt) {
     std::unique_lock<std::mutex> lock(g_mutex);
     std::copy_n(newSalt.begin(), std::min(newSalt.size(), MAX_SEEDS_POOL_SIZE), std::front_inserter(seedsPool));
-    g_seedNeeded = true;
+    if (seedsPool.size() > MAX_SEEDS_POOL_SIZE) {
+        seedsPool.resize(MAX_SEEDS_POOL_SIZE);
+    }
+    g_seedGeneration++;
 }
 
 void addSeeds(const std::vector<uint32_t>& seeds) {
     std::unique_lock<std::mutex> lock(g_mutex);
     std::copy_n(seeds.begin(), std::min(seeds.size(), MAX_SEEDS_POOL_SIZE), std::front_inserter(seedsPool));
-    g_seedNeeded = true;
+    if (seedsPool.size() > MAX_SEEDS_POOL_SIZE) {
+        seedsPool.resize(MAX_SEEDS_POOL_SIZE);
+    }
+    g_seedGeneration++;
 }
 
 /**
- * Randomly generate a string of hex digits. Before the conversion of hex to string,
- * the function allows replacement of the bits of the first two generated hex digits.
- * Replacement happens starting at the most significant, to the least significant bit.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- * @param replacementBits The replacement value for up to the first two digits generated.
- * @param numReplacementBits The number of bits of @c replacementBits to use.
- *
- * @return A hex string of length @c numDigits.
+ * Check the entropy reported by the random device, and log if it is too low for the random device alone to make
+ * generators unique.  Must be called with g_mutex locked.
  */
-static const std::string generateHexWithReplacement(
-    std::independent_bits_engine<std::mt19937, CHAR_BIT, uint32_t>& ibe,
-    unsigned int numDigits,
-    uint8_t replacementBits,
-    uint8_t numReplacementBits) {
-    if (numReplacementBits > MAX_NUM_REPLACEMENT_BITS) {
-        ACSDK_ERROR(LX("generateHexWithReplacementFailed")
-                        .d("reason", "replacingMoreBitsThanProvided")
-                        .d("numReplacementBitsLimit", MAX_NUM_REPLACEMENT_BITS)
-                        .d("numReplacementBits", numReplacementBits));
-        return "";
+static void checkEntropyLocked() {
+    static int consistentEntropyReports = 0;
+    static double priorEntropyResult = 0;
+
+    double currentEntropy = readEntropyFunc();
+    if (std::fabs(currentEntropy - priorEntropyResult) < std::numeric_limits<double>::epsilon()) {
+        ++consistentEntropyReports;
+    } else {
+        consistentEntropyReports = 0;
     }
+    priorEntropyResult = currentEntropy;
 
-    if (numReplacementBits > (numDigits * BITS_IN_HEX_DIGIT)) {
-        ACSDK_ERROR(LX("generateHexWithReplacementFailed")
-                        .d("reason", "replacingMoreBitsThanGenerated")
-                        .d("numDigitsInBits", numDigits * BITS_IN_HEX_DIGIT)
-                        .d("numReplacementBits", numReplacementBits));
-        return "";
+    // Platforms that always report the same value are only logged once.
+    if (currentEntropy <= ENTROPY_THRESHOLD && consistentEntropyReports <= ENTROPY_REPEAT_THRESHOLD) {
+        ACSDK_INFO(LX("low entropy on seeding UUID generator").d("current entropy", currentEntropy));
     }
+}
 
-    const size_t arrayLen = (numDigits + 1) / 2;
-
-    std::vector<uint8_t> bytes(arrayLen);
-    std::generate(bytes.begin(), bytes.end(), std::ref(ibe));
-
-    // Replace the specified number of bits from the first byte.
-    bytes.at(0) &= (0xff >> numReplacementBits);
-    replacementBits &= (0xff << (MAX_NUM_REPLACEMENT_BITS - numReplacementBits));
-    bytes.at(0) |= replacementBits;
-
-    std::ostringstream oss;
-    for (const auto& byte : bytes) {
-        oss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(byte);
+/**
+ * Seed a thread's generator from the random device, the seed pool, the time and the identity of the thread, so that
+ * generators are unique even where the random device is weak.
+ *
+ * @param[out] generator The generator to seed.
+ * @param seedGeneration The generation of the seed pool being used.
+ */
+static void seedGenerator(ThreadGenerator* generator, uint64_t seedGeneration) {
+    std::vector<uint32_t> seeds;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        checkEntropyLocked();
+        seeds.assign(seedsPool.begin(), seedsPool.end());
     }
 
-    std::string bytesText = oss.str();
-    // Remove the last digit for odd numDigits case.
-    bytesText.resize(numDigits);
-
-    return bytesText;
+    std::random_device rd;
+    for (size_t i = 0; i < RANDOM_DEVICE_SEED_WORDS; ++i) {
+        seeds.push_back(rd());
+    }
+    uint64_t timeSeed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    seeds.push_back(static_cast<uint32_t>(timeSeed));
+    seeds.push_back(static_cast<uint32_t>(timeSeed >> 32));
+    seeds.push_back(static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+    seeds.push_back(static_cast<uint32_t>(reinterpret_cast<std::uintptr_t>(generator)));
+
+    std::seed_seq seed(seeds.begin(), seeds.end());
+    generator->engine.seed(seed);
+    generator->seedGeneration = seedGeneration;
 }
 
 /**
- * Randomly generate a string of hex digits.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
+ * Get the calling thread's generator, seeding it first if it has not been seeded since seeds were last added.
  *
- * @return A hex string of length @c numDigits.
+ * @return The calling thread's generator.
  */
-static const std::string generateHex(
-    std::independent_bits_engine<std::mt19937, CHAR_BIT, uint32_t>& ibe,
-    unsigned int numDigits) {
-    return generateHexWithReplacement(ibe, numDigits, 0, 0);
+static std::mt19937_64& getThreadEngine() {
+    thread_local ThreadGenerator generator;
+    auto seedGeneration = g_seedGeneration.load();
+    if (generator.seedGeneration != seedGeneration) {
+        seedGenerator(&generator, seedGeneration);
+    }
+    return generator.engine;
 }
 
 /**
- * Add default seed to the pool, should only be used in generateUUID and locked by g_mutex.
+ * Write a UUID into a buffer.
+ *
+ * @param engine The random number generator to use.
+ * @param[out] out The buffer to write to.
  */
-static void addDefaultSeedLocked() {
-    std::random_device rd;
-    uint64_t timeSeed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    if (lastInvokeTime > 0) {
-        seedsPool.push_front((uint32_t)(timeSeed - lastInvokeTime));  // interval between two invocations
-    }
-    lastInvokeTime = timeSeed;
-    seedsPool.push_front((uint32_t)timeSeed);  // lower 32bits of current time
-    seedsPool.push_front(rd());                // random device
-    seedsPool.push_front(
-        reinterpret_cast<std::intptr_t>(&timeSeed));  // lower 32bits of memory address of temporary variable
-
-    if (seedsPool.size() > MAX_SEEDS_POOL_SIZE) {
-        seedsPool.resize(MAX_SEEDS_POOL_SIZE);
+static void writeUUID(std::mt19937_64& engine, char* out) {
+    uint64_t halves[2] = {engine(), engine()};
+    halves[0] = (halves[0] & ~UUID_VERSION_MASK) | UUID_VERSION_VALUE;
+    halves[1] = (halves[1] & ~UUID_VARIANT_MASK) | UUID_VARIANT_VALUE;
+
+    for (size_t i = 0; i < UUID_BYTE_COUNT; ++i) {
+        // Fields start at bytes 4, 6, 8 and 10.
+        if (4 == i || 6 == i || 8 == i || 10 == i) {
+            *out++ = SEPARATOR;
+        }
+        auto shift = (sizeof(uint64_t) - 1 - i % sizeof(uint64_t)) * CHAR_BIT;
+        auto byte = static_cast<uint8_t>(halves[i / sizeof(uint64_t)] >> shift);
+        *out++ = HEX_DIGITS[byte >> BITS_IN_HEX_DIGIT];
+        *out++ = HEX_DIGITS[byte & 0xf];
     }
 }
 
 const std::string generateUUID() {
-    static std::independent_bits_engine<std::mt19937, CHAR_BIT, uint32_t> ibe;
-    std::unique_lock<std::mutex> lock(g_mutex);
-
-    if (g_seedNeeded) {
-        static int consistentEntropyReports = 0;
-        static double priorEntropyResult = 0;
-        addDefaultSeedLocked();
-        std::seed_seq seed(seedsPool.begin(), seedsPool.end());
-        ibe.seed(seed);
-
-        double currentEntropy = readEntropyFunc();
+    UUIDBuffer uuid;
+    generateUUID(&uuid);
+    return std::string(uuid.data(), uuid.size());
+}
 
-        if (std::fabs(currentEntropy - priorEntropyResult) < std::numeric_limits<double>::epsilon()) {
-            ++consistentEntropyReports;
-        } else {
-            consistentEntropyReports = 0;
-        }
-        priorEntropyResult = currentEntropy;
-
-        if (currentEntropy > ENTROPY_THRESHOLD) {
-            g_seedNeeded = false;
-        } else {
-            ACSDK_INFO(LX("low entropy on call to generate UUID").d("current entropy", currentEntropy));
-            if (consistentEntropyReports > ENTROPY_REPEAT_THRESHOLD) {
-                g_seedNeeded = false;
-                ACSDK_INFO(LX("multiple repeat values for entropy")
-                               .d("current entropy", currentEntropy)
-                               .d("consistent entropy reports", consistentEntropyReports));
-            }
-        }
+bool generateUUID(UUIDBuffer* uuid) {
+    if (!uuid) {
+        ACSDK_ERROR(LX("generateUUIDFailed").d("reason", "nullUuid"));
+        return false;
     }
+    writeUUID(getThreadEngine(), uuid->data());
+    return true;
+}
 
-    std::ostringstream uuidText;
-    uuidText << generateHex(ibe, 8) << SEPARATOR << generateHex(ibe, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VERSION_VALUE, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VARIANT_VALUE, 2) << SEPARATOR << generateHex(ibe, 12);
-
-    lock.unlock();
-
-    return uuidText.str();
+std::vector<std::string> generateUUIDs(size_t count) {
+    auto& engine = getThreadEngine();
+    std::vector<std::string> uuids;
+    uuids.reserve(count);
+    UUIDBuffer uuid;
+    for (size_t i = 0; i < count; ++i) {
+        writeUUID(engine, uuid.data());
+        uuids.emplace_back(uuid.data(), uuid.size());
+    }
+    return uuids;
 }
 
 }  // namespace uuidGeneration
@@ -127,6 +127,7 @@ public:
     MOCK_METHOD1(pause, bool(SourceId));
     MOCK_METHOD1(resume, bool(SourceId));
     MOCK_METHOD3(seekTo, bool(SourceId, std::chrono::milliseconds location, bool fromStart));
+    MOCK_METHOD1(preroll, bool(SourceId));
     MOCK_METHOD1(stop, bool(SourceId));
     MOCK_METHOD2(stop, bool(SourceId, std::chrono::seconds));
     MOCK_METHOD1(getOffset, std::chrono::milliseconds(SourceId));
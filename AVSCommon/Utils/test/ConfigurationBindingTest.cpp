@@ -0,0 +1,184 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Configuration/ConfigurationBinding.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace configuration {
+namespace test {
+
+using namespace ::testing;
+
+/// Configuration holding a valid value for every bound key.
+static const std::string VALID_CONFIGURATION = R"({
+    "component": {
+        "sub": {
+            "enabled": false,
+            "volume": 7,
+            "count": 3,
+            "name": "configured",
+            "label": "",
+            "windowMs": 250
+        }
+    }
+})";
+
+/// Configuration holding values that fail validation.
+static const std::string INVALID_CONFIGURATION = R"({
+    "component": {
+        "sub": {
+            "volume": 200,
+            "windowMs": -5
+        }
+    }
+})";
+
+/// Default for the bound @c bool value.
+static const bool DEFAULT_ENABLED = true;
+
+/// Default for the bound @c int value.
+static const int DEFAULT_VOLUME = 10;
+
+/// Default for the bound @c uint32_t value.
+static const uint32_t DEFAULT_COUNT = 1;
+
+/// Default for the bound @c string value.
+static const std::string DEFAULT_NAME = "default";
+
+/// Default for the bound duration value.
+static const std::chrono::milliseconds DEFAULT_WINDOW{100};
+
+/// Settings bound in these tests.
+struct TestSettings {
+    bool enabled;
+    int volume;
+    uint32_t count;
+    std::string name;
+    std::string label;
+    bool hasLabel;
+    std::chrono::milliseconds window;
+};
+
+/// Test harness for @c ConfigurationBinding.
+class ConfigurationBindingTest : public ::testing::Test {
+protected:
+    /// Constructor.
+    ConfigurationBindingTest();
+
+    /// TearDown after each test.
+    void TearDown() override;
+
+    /**
+     * Initialize the global configuration from a JSON string.
+     *
+     * @param json The configuration.
+     */
+    void initialize(const std::string& json);
+
+    /// The binding under test.
+    ConfigurationBinding<TestSettings> m_binding;
+};
+
+ConfigurationBindingTest::ConfigurationBindingTest() : m_binding({"component", "sub"}) {
+    m_binding.bindBool("enabled", &TestSettings::enabled, DEFAULT_ENABLED)
+        .bindInt("volume", &TestSettings::volume, DEFAULT_VOLUME, [](const int& volume) { return volume <= 100; })
+        .bindUint32("count", &TestSettings::count, DEFAULT_COUNT)
+        .bindString("name", &TestSettings::name, DEFAULT_NAME)
+        .bindOptionalString("label", &TestSettings::label, &TestSettings::hasLabel)
+        .bindDuration<std::chrono::milliseconds>(
+            "windowMs", &TestSettings::window, DEFAULT_WINDOW, [](const std::chrono::milliseconds& window) {
+                return window.count() >= 0;
+            });
+}
+
+void ConfigurationBindingTest::TearDown() {
+    ConfigurationNode::uninitialize();
+}
+
+void ConfigurationBindingTest::initialize(const std::string& json) {
+    ConfigurationNode::uninitialize();
+    std::shared_ptr<std::istream> stream(new std::stringstream(json));
+    ASSERT_TRUE(ConfigurationNode::initialize({stream}));
+}
+
+/**
+ * Verify that values present in the configuration are bound to their members.
+ */
+TEST_F(ConfigurationBindingTest, test_loadValidValues) {
+    initialize(VALID_CONFIGURATION);
+
+    ASSERT_TRUE(m_binding.load());
+    auto settings = m_binding.get();
+    ASSERT_TRUE(settings);
+    EXPECT_FALSE(settings->enabled);
+    EXPECT_EQ(7, settings->volume);
+    EXPECT_EQ(3u, settings->count);
+    EXPECT_EQ("configured", settings->name);
+    // An empty value is still present.
+    EXPECT_TRUE(settings->hasLabel);
+    EXPECT_EQ("", settings->label);
+    EXPECT_EQ(std::chrono::milliseconds(250), settings->window);
+}
+
+/**
+ * Verify that absent values and values failing validation are replaced by their defaults.
+ */
+TEST_F(ConfigurationBindingTest, test_defaultsForAbsentAndInvalidValues) {
+    initialize(INVALID_CONFIGURATION);
+
+    ASSERT_FALSE(m_binding.load());
+    auto settings = m_binding.get();
+    ASSERT_TRUE(settings);
+    EXPECT_EQ(DEFAULT_ENABLED, settings->enabled);
+    EXPECT_EQ(DEFAULT_VOLUME, settings->volume);
+    EXPECT_EQ(DEFAULT_COUNT, settings->count);
+    EXPECT_EQ(DEFAULT_NAME, settings->name);
+    EXPECT_FALSE(settings->hasLabel);
+    EXPECT_EQ(DEFAULT_WINDOW, settings->window);
+}
+
+/**
+ * Verify that @c get() reuses its snapshot while the configuration is unchanged, and reloads it once the configuration
+ * is initialized again, without affecting snapshots already handed out.
+ */
+TEST_F(ConfigurationBindingTest, test_getReloadsChangedConfiguration) {
+    initialize("{}");
+
+    auto first = m_binding.get();
+    ASSERT_TRUE(first);
+    EXPECT_EQ(DEFAULT_VOLUME, first->volume);
+    EXPECT_EQ(first, m_binding.get());
+
+    initialize(VALID_CONFIGURATION);
+
+    auto second = m_binding.get();
+    ASSERT_TRUE(second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(7, second->volume);
+    EXPECT_EQ(DEFAULT_VOLUME, first->volume);
+}
+
+}  // namespace test
+}  // namespace configuration
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -16,9 +16,11 @@
 /// @file SharedDataStreamTest.cpp
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <climits>
 #include <functional>
+#include <future>
 #include <random>
 #include <unordered_map>
 #include <vector>
@@ -1317,6 +1319,106 @@ TEST_F(SharedDataStreamTest, test_firstReaderCanSeekSDSBeginning) {
     EXPECT_TRUE(reader->seek(0, Sds::Reader::Reference::ABSOLUTE));
 }
 
+/// This tests that @c SharedDataStream::Reader::close() wakes up a blocked @c SharedDataStream::Reader::read().
+TEST_F(SharedDataStreamTest, test_readerCloseWakesBlockedRead) {
+    static const size_t WORDSIZE = 1;
+    static const size_t WORDCOUNT = 10;
+    static const size_t MAXREADERS = 1;
+    static const std::chrono::seconds WAKE_TIMEOUT(2);
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    std::shared_ptr<Sds::Reader> reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Block in a read without a timeout, then close the reader from this thread.
+    auto result = std::async(std::launch::async, [reader] {
+        uint8_t readBuf[WORDSIZE * WORDCOUNT];
+        return reader->read(readBuf, WORDCOUNT);
+    });
+    EXPECT_EQ(result.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    reader->close();
+    ASSERT_EQ(result.wait_for(WAKE_TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(result.get(), Sds::Reader::Error::CLOSED);
+}
+
+/// This tests that @c SharedDataStream::Writer::close() wakes up a blocked @c SharedDataStream::Writer::write().
+TEST_F(SharedDataStreamTest, test_writerCloseWakesBlockedWrite) {
+    static const size_t WORDSIZE = 1;
+    static const size_t WORDCOUNT = 10;
+    static const size_t MAXREADERS = 1;
+    static const std::chrono::seconds WAKE_TIMEOUT(2);
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    std::shared_ptr<Sds::Writer> writer = sds->createWriter(Sds::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Fill the buffer so the next write blocks until the reader consumes data, then close the writer.
+    uint8_t writeBuf[WORDSIZE * WORDCOUNT] = {};
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    auto result = std::async(std::launch::async, [writer, &writeBuf] { return writer->write(writeBuf, WORDCOUNT); });
+    EXPECT_EQ(result.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    writer->close();
+    ASSERT_EQ(result.wait_for(WAKE_TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(result.get(), Sds::Writer::Error::CLOSED);
+}
+
+/// This tests the readiness callbacks of @c SharedDataStream::Reader and @c SharedDataStream::Writer.
+TEST_F(SharedDataStreamTest, test_readinessCallbacks) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 10;
+    static const size_t MAXREADERS = 2;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto otherReader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(otherReader, nullptr);
+
+    std::atomic<int> dataAvailableCount{0};
+    std::atomic<int> spaceAvailableCount{0};
+    reader->setDataAvailableCallback([&dataAvailableCount] { ++dataAvailableCount; });
+    writer->setSpaceAvailableCallback([&spaceAvailableCount] { ++spaceAvailableCount; });
+
+    // Writes notify readers.
+    uint8_t buf[WORDSIZE * WORDCOUNT] = {};
+    ASSERT_EQ(writer->write(buf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    EXPECT_EQ(dataAvailableCount, 1);
+    EXPECT_EQ(spaceAvailableCount, 0);
+
+    // Space is only available once the oldest reader has consumed data.
+    ASSERT_EQ(reader->read(buf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    EXPECT_EQ(spaceAvailableCount, 0);
+    ASSERT_EQ(otherReader->read(buf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    EXPECT_EQ(spaceAvailableCount, 1);
+
+    // Closing a reader only notifies that reader.
+    otherReader->close();
+    EXPECT_EQ(dataAvailableCount, 1);
+    reader->close();
+    EXPECT_EQ(dataAvailableCount, 2);
+
+    // Cleared callbacks are not made.
+    reader->setDataAvailableCallback(nullptr);
+    writer->close();
+    EXPECT_EQ(dataAvailableCount, 2);
+    EXPECT_EQ(spaceAvailableCount, 2);
+}
+
 }  // namespace test
 }  // namespace sds
 }  // namespace utils
@@ -0,0 +1,85 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file StartupTraceTest.cpp
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "AVSCommon/Utils/Timing/StartupTrace.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+/// Duration of the spans added by the tests.
+static const std::chrono::milliseconds SPAN_DURATION{5};
+
+/**
+ * Test that spans are written as complete events in the Chrome trace event format.
+ */
+TEST(StartupTraceTest, test_chromeTraceJson) {
+    auto trace = StartupTrace::create();
+    ASSERT_TRUE(trace);
+
+    auto start = StartupTrace::Clock::now();
+    trace->addSpan("construct", "Component \"A\"", start, start + SPAN_DURATION);
+    std::thread([&trace, start] { trace->addSpan("startup", "B", start, start + SPAN_DURATION * 2); }).join();
+    EXPECT_EQ(trace->getSpanCount(), 2u);
+
+    rapidjson::Document document;
+    ASSERT_FALSE(document.Parse(trace->toChromeTraceJson()).HasParseError());
+    ASSERT_TRUE(document.HasMember("traceEvents"));
+    const auto& events = document["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+    ASSERT_EQ(events.Size(), 2u);
+
+    EXPECT_STREQ(events[0]["name"].GetString(), "Component \"A\"");
+    EXPECT_STREQ(events[0]["cat"].GetString(), "construct");
+    EXPECT_STREQ(events[0]["ph"].GetString(), "X");
+    EXPECT_GE(events[0]["ts"].GetInt64(), 0);
+    EXPECT_EQ(events[0]["dur"].GetInt64(), 5000);
+    EXPECT_STREQ(events[1]["cat"].GetString(), "startup");
+    EXPECT_EQ(events[1]["dur"].GetInt64(), 10000);
+    EXPECT_EQ(events[0]["ts"].GetInt64(), events[1]["ts"].GetInt64());
+
+    // Spans added on different threads are reported on different tracks.
+    EXPECT_NE(events[0]["tid"].GetUint64(), events[1]["tid"].GetUint64());
+}
+
+/**
+ * Test that a span which ends before it starts is recorded with no duration.
+ */
+TEST(StartupTraceTest, test_endBeforeStart) {
+    auto trace = StartupTrace::create();
+    auto start = StartupTrace::Clock::now();
+    trace->addSpan("construct", "A", start, start - SPAN_DURATION);
+
+    rapidjson::Document document;
+    ASSERT_FALSE(document.Parse(trace->toChromeTraceJson()).HasParseError());
+    ASSERT_EQ(document["traceEvents"].Size(), 1u);
+    EXPECT_EQ(document["traceEvents"][0]["dur"].GetInt64(), 0);
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
 #include <string>
 #include <future>
 #include <vector>
@@ -71,6 +72,30 @@ static const unsigned int MAX_TEST_THREADS(10);
 /// The maximum number of retries.
 static const unsigned int MAX_RETRIES(20);
 
+/// The number of threads generating UUIDs concurrently in the contention benchmark.
+static const unsigned int BENCHMARK_THREADS(8);
+
+/// The number of UUIDs each thread generates in the contention benchmark.
+static const unsigned int BENCHMARK_UUIDS_PER_THREAD(20000);
+
+/**
+ * Check that a UUID has the right length, hyphens, version and variant, and only lowercase hex digits elsewhere.
+ *
+ * @param uuid The UUID to check.
+ */
+static void checkUUIDFormat(const std::string& uuid) {
+    ASSERT_EQ(UUID_LENGTH, uuid.length());
+    for (unsigned int i = 0; i < uuid.length(); ++i) {
+        if (HYPHEN1_POSITION == i || HYPHEN2_POSITION == i || HYPHEN3_POSITION == i || HYPHEN4_POSITION == i) {
+            ASSERT_EQ(HYPHEN[0], uuid[i]);
+        } else {
+            ASSERT_TRUE(isxdigit(uuid[i]) && !isupper(uuid[i]));
+        }
+    }
+    ASSERT_EQ(UUID_VERSION, uuid.substr(UUID_VERSION_OFFSET, 1));
+    ASSERT_EQ(UUID_VARIANT, strtoul(uuid.substr(UUID_VARIANT_OFFSET, 1).c_str(), nullptr, 16) & 0xc);
+}
+
 class UUIDGenerationTest : public ::testing::Test {};
 
 /**
@@ -240,6 +265,72 @@ TEST_F(UUIDGenerationTest, test_allHexValuesGenerated) {
     ASSERT_TRUE(hexCharacters.empty());
 }
 
+/**
+ * Call @c generateUUID with a buffer and check the UUID written to it.
+ */
+TEST_F(UUIDGenerationTest, test_generateIntoBuffer) {
+    utils::uuidGeneration::UUIDBuffer first;
+    utils::uuidGeneration::UUIDBuffer second;
+    ASSERT_TRUE(generateUUID(&first));
+    ASSERT_TRUE(generateUUID(&second));
+    ASSERT_FALSE(generateUUID(nullptr));
+
+    checkUUIDFormat(std::string(first.data(), first.size()));
+    ASSERT_NE(first, second);
+}
+
+/**
+ * Call @c generateUUIDs and check that it returns the requested number of well formed, unique UUIDs.
+ */
+TEST_F(UUIDGenerationTest, test_generateBatch) {
+    ASSERT_TRUE(generateUUIDs(0).empty());
+
+    auto uuids = generateUUIDs(MAX_UUIDS_TO_GENERATE);
+    ASSERT_EQ(MAX_UUIDS_TO_GENERATE, uuids.size());
+    std::unordered_set<std::string> uuidsGenerated(uuids.begin(), uuids.end());
+    ASSERT_EQ(MAX_UUIDS_TO_GENERATE, uuidsGenerated.size());
+    for (const auto& uuid : uuids) {
+        checkUUIDFormat(uuid);
+    }
+}
+
+/**
+ * Generate UUIDs from @c BENCHMARK_THREADS threads at once, check that they are all unique and well formed, and report
+ * the combined rate at which they were generated.
+ */
+TEST_F(UUIDGenerationTest, test_concurrentGenerationBenchmark) {
+    std::vector<std::future<std::vector<std::string>>> generators;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < BENCHMARK_THREADS; ++i) {
+        generators.push_back(std::async(std::launch::async, []() {
+            std::vector<std::string> uuids;
+            uuids.reserve(BENCHMARK_UUIDS_PER_THREAD);
+            for (unsigned int j = 0; j < BENCHMARK_UUIDS_PER_THREAD; ++j) {
+                uuids.push_back(generateUUID());
+            }
+            return uuids;
+        }));
+    }
+
+    std::vector<std::vector<std::string>> results;
+    for (auto& generator : generators) {
+        results.push_back(generator.get());
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::unordered_set<std::string> uuidsGenerated;
+    for (const auto& uuids : results) {
+        for (const auto& uuid : uuids) {
+            checkUUIDFormat(uuid);
+            uuidsGenerated.insert(uuid);
+        }
+    }
+    ASSERT_EQ(BENCHMARK_THREADS * BENCHMARK_UUIDS_PER_THREAD, uuidsGenerated.size());
+
+    auto uuidsPerSecond = static_cast<int>(uuidsGenerated.size() / elapsed.count());
+    RecordProperty("uuidsPerSecond", uuidsPerSecond);
+}
+
 }  // namespace test
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -255,19 +255,22 @@ private:
      * stored in the database, but are not registered or pending registration. @c m_endpointsMutex must be locked
      * to call this method.
      *
-     * @param storedEndpointConfig The reference to the stored map of endpointId to configuration.
+     * @param storedEndpointConfigHashes The reference to the stored map of endpointId to configuration hash.
      */
-    void addStaleEndpointsToPendingDeleteLocked(std::unordered_map<std::string, std::string>* storedEndpointConfig);
+    void addStaleEndpointsToPendingDeleteLocked(
+        std::unordered_map<std::string, std::string>* storedEndpointConfigHashes);
 
     /**
      * Filters m_addOrUpdate.pending endpoints to remove those that are already in the database, and therefore
-     * do not need to be sent in an addOrUpdateReport. @c m_endpointsMutex must be locked to call this method.
+     * do not need to be sent in an addOrUpdateReport. Endpoints are compared by the hash of their configuration, so
+     * the stored configurations do not need to be loaded or parsed. @c m_endpointsMutex must be locked to call this
+     * method.
      *
-     * @param storedEndpointConfig The reference to the stored map of endpointId to configuration. This map
+     * @param storedEndpointConfigHashes The reference to the stored map of endpointId to configuration hash. This map
      * is filtered to remove endpoints that do not need to be registered to AVS.
      */
     void filterUnchangedPendingAddOrUpdateEndpointsLocked(
-        std::unordered_map<std::string, std::string>* storedEndpointConfig);
+        std::unordered_map<std::string, std::string>* storedEndpointConfigHashes);
 
     /**
      * Moves in-flight endpoints to pending for re-try purposes (e.g. on re-connect). @c m_endpointsMutex must
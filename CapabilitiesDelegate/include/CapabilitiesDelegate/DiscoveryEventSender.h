@@ -20,6 +20,8 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <AVSCommon/AVS/WaitableMessageRequest.h>
 #include <AVSCommon/SDKInterfaces/AlexaEventProcessedObserverInterface.h>
@@ -37,6 +39,10 @@ namespace capabilitiesDelegate {
 
 /**
  * This class publishes @c Discovery.AddOrUpdateReport and @c Discovery.DeleteReport events.
+ *
+ * Endpoints are split into size-bounded batches, each encoded once and reused across retries. The batches of a report
+ * are sent concurrently, up to a small limit, and the @c Discovery.DeleteReport events are only sent after all the
+ * @c Discovery.AddOrUpdateReport events were accepted.
  */
 class DiscoveryEventSender
         : public DiscoveryEventSenderInterface
@@ -103,7 +109,8 @@ private:
      * Sends the discovery event while taking into account retries.
      *
      * @param messageSender The @c MessageSenderInterface to send messages.
-     * @param endpointConfigurations The endpointConfigurations to be sent.
+     * @param encodedEndpointConfigurations The endpointConfigurations to be sent, encoded with
+     * @c utils::encodeEndpointConfigurations.
      * @param isAddOrUpdateReportEvent boolean indicating which Discovery event to send, true indicates @c
      * AddOrUpdateReport, false indicates @c DeleteReport event.
      * @return true if the event was sent successfully. False if there is a fatal error response or if there
@@ -111,7 +118,7 @@ private:
      */
     bool sendDiscoveryEventWithRetries(
         const std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
-        const std::vector<std::string>& endpointConfigurations,
+        const std::string& encodedEndpointConfigurations,
         bool isAddOrUpdateReportEvent = true);
 
     /**
@@ -119,14 +126,15 @@ private:
      *
      * @param messageSender The @c MessageSenderInterface to send messages.
      * @param eventString The eventJson string to be sent.
-     * @param waitForEventProcessed Flag indicating if the event should wait for the EventProcessed directive.
+     * @param eventCorrelationToken The eventCorrelationToken of the event. If not empty, and if the sender was created
+     * to do so, the event waits for the EventProcessed directive carrying this token.
      * @return true if the event was sent successfully. False if there is a fatal error response or if there
      * post connect operation is aborted.
      */
     avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status sendDiscoveryEvent(
         const std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
         const std::string& eventString,
-        bool waitForEventProcessed = true);
+        const std::string& eventCorrelationToken);
 
     /**
      * Sends multiple Discovery.AddOrUpdateReport events based on the number of endpoints requested for.
@@ -148,7 +156,8 @@ private:
     bool sendDeleteReportEvents(const std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender);
 
     /**
-     * Sends multiple Discovery events based on the number of endpoints requested for.
+     * Sends multiple Discovery events based on the number of endpoints requested for. The endpoints are split into
+     * batches that respect the size and count limits of a single event, and the batches are sent concurrently.
      *
      * @param endpointConfigurations The list of endpointConfigurations to be sent in the discovery events.
      * @param messageSender The @c MessageSenderInterface to send messages.
@@ -161,6 +170,17 @@ private:
         const std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
         bool isAddOrUpdateReportEvent = true);
 
+    /**
+     * Splits endpoint configurations into batches that fit in a single Discovery event, and encodes each batch.
+     *
+     * @param endpointConfigurations The list of endpointConfigurations to split.
+     * @param isAddOrUpdateReportEvent boolean indicating if the batches are for AddOrUpdateReport events.
+     * @return The encoded batches.
+     */
+    static std::vector<std::string> createEncodedBatches(
+        const std::vector<std::string>& endpointConfigurations,
+        bool isAddOrUpdateReportEvent);
+
     /**
      * This method checks if the capabilities delegate reports the discovery status to the capabilities delegate
      * while checking if its shutting down.
@@ -202,24 +222,23 @@ private:
     /// Used to check if the auth delegate is ready.
     avsCommon::utils::threading::ConditionVariableWrapper m_authStatusReady;
 
-    /// The current event correlation token.
-    /// @note Access to this member is serialized by sendDiscoveryEvents() method which is only called once.
-    std::string m_currentEventCorrelationToken;
-
     /// Flag that will be set when the @c DiscoveryEventSender is being shutdown.
     bool m_isStopping;
 
-    /// The @c WaitEvent to wait on EventProcessed directive.
-    avsCommon::utils::WaitEvent m_eventProcessedWaitEvent;
-
-    /// The @c WaitEvent to cancel retry waits.
+    /// The @c WaitEvent to cancel retry waits, woken on stop or when a batch fails with a non retriable error.
     avsCommon::utils::WaitEvent m_retryWait;
 
-    /// Mutex to synchronize access to @c MessageRequest.
+    /// Mutex to synchronize access to @c m_isStopping, @c m_messageRequests and @c m_eventProcessedWaitEvents.
     std::mutex m_mutex;
 
-    /// The @c MessageRequest used to send messages.
-    std::shared_ptr<avsCommon::avs::WaitableMessageRequest> m_messageRequest;
+    /// The @c MessageRequest instances of the events currently in flight.
+    std::unordered_set<std::shared_ptr<avsCommon::avs::WaitableMessageRequest>> m_messageRequests;
+
+    /// The @c WaitEvent instances used to wait on the EventProcessed directive, keyed by event correlation token.
+    std::unordered_map<std::string, std::shared_ptr<avsCommon::utils::WaitEvent>> m_eventProcessedWaitEvents;
+
+    /// Mutex to serialize the status reports of concurrently sent events.
+    std::mutex m_reportMutex;
 
     /// The mutex to serialize the observer added.
     std::mutex m_observerMutex;
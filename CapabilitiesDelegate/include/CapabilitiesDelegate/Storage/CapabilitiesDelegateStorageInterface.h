@@ -19,6 +19,8 @@
 #include <string>
 #include <unordered_map>
 
+#include "CapabilitiesDelegate/Utils/DiscoveryUtils.h"
+
 namespace alexaClientSDK {
 namespace capabilitiesDelegate {
 namespace storage {
@@ -80,6 +82,31 @@ public:
      */
     virtual bool load(std::unordered_map<std::string, std::string>* endpointConfigMap) = 0;
 
+    /**
+     * Loads the content hashes of the stored endpoint configurations, as computed by @c utils::getEndpointConfigHash.
+     *
+     * This is used to find the endpoints that changed since they were last reported without loading and comparing the
+     * full endpoint configurations. Implementations that keep the hashes alongside the configurations should override
+     * this method; the default implementation loads the configurations and hashes them.
+     *
+     * @param endpointIdToConfigHashMap The pointer to the endpointId to configuration hash map to be filled.
+     * @return True if successful, else false.
+     */
+    virtual bool loadEndpointConfigHashes(std::unordered_map<std::string, std::string>* endpointIdToConfigHashMap) {
+        if (!endpointIdToConfigHashMap || !endpointIdToConfigHashMap->empty()) {
+            return false;
+        }
+        std::unordered_map<std::string, std::string> endpointConfigMap;
+        if (!load(&endpointConfigMap)) {
+            return false;
+        }
+        for (const auto& endpointIdToConfig : endpointConfigMap) {
+            endpointIdToConfigHashMap->insert(
+                {endpointIdToConfig.first, utils::getEndpointConfigHash(endpointIdToConfig.second)});
+        }
+        return true;
+    }
+
     /**
      * Loads the endpointConfig with the given endpoint Id.
      *
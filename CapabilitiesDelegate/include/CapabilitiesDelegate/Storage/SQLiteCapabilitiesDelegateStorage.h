@@ -61,6 +61,7 @@ public:
     bool store(const std::string& endpointId, const std::string& endpointConfig) override;
     bool store(const std::unordered_map<std::string, std::string>& endpointIdToConfigMap) override;
     bool load(std::unordered_map<std::string, std::string>* endpointConfigMap) override;
+    bool loadEndpointConfigHashes(std::unordered_map<std::string, std::string>* endpointIdToConfigHashMap) override;
     bool load(const std::string& endpointId, std::string* endpointConfig) override;
     bool erase(const std::string& endpointId) override;
     bool erase(const std::unordered_map<std::string, std::string>& endpointIdToConfigMap) override;
@@ -81,13 +82,33 @@ private:
     SQLiteCapabilitiesDelegateStorage(const std::string& dbFilePath);
 
     /**
-     * Method that stores the given endpoint configuration with the endpointId as key.
+     * Method that stores the given endpoint configuration and its hash with the endpointId as key.
      *
+     * @param statement The store statement to execute. Must be freshly created or reset.
      * @param endpointId The endpointId used as key to store.
      * @param endpointConfig The value to be stored int he database.
      * @return True if successful, else false.
      */
-    bool storeLocked(const std::string& endpointId, const std::string& endpointConfig);
+    bool storeLocked(
+        alexaClientSDK::storage::sqliteStorage::SQLiteStatement* statement,
+        const std::string& endpointId,
+        const std::string& endpointConfig);
+
+    /**
+     * Method that stores the given endpoint configurations in a single transaction.
+     *
+     * @param endpointIdToConfigMap The endpointId to configuration map.
+     * @return True if successful, else false.
+     */
+    bool storeLocked(const std::unordered_map<std::string, std::string>& endpointIdToConfigMap);
+
+    /**
+     * Method that loads all the stored endpoint configurations.
+     *
+     * @param endpointConfigMap The endpoint config map pointer.
+     * @return True if successful, else false.
+     */
+    bool loadLocked(std::unordered_map<std::string, std::string>* endpointConfigMap);
 
     /**
      * Method that erases the given key and the corresponding value from the database.
@@ -105,6 +126,15 @@ private:
      */
     bool createEndpointConfigTableLocked();
 
+    /**
+     * Utility method to add the endpoint config hash column to a table created by a previous version, and fill it in
+     * for the endpoint configs already stored. Does nothing if the column already exists.
+     * @Note: This method is not thread safe.
+     *
+     * @return True if the table has the endpoint config hash column, else false.
+     */
+    bool addEndpointConfigHashColumnLocked();
+
     /**
      * Utility method to close the underlying database.
      * @Note: This method is not thread safe.
@@ -66,6 +66,18 @@ bool compareEndpointConfigurations(
     const std::string& firstEndpointConfigJson,
     const std::string& secondEndpointConfigJson);
 
+/**
+ * Computes a content hash of the given endpoint configuration JSON.
+ *
+ * The hash is stable across runs and platforms, so it can be persisted alongside the endpoint configuration and later
+ * used to detect whether the configuration changed without parsing either JSON. The endpoint configuration JSONs
+ * generated by @c getEndpointConfigJson are deterministic, so identical configurations always yield the same hash.
+ *
+ * @param endpointConfigJson The endpoint configuration JSON.
+ * @return The hash as a hexadecimal string.
+ */
+std::string getEndpointConfigHash(const std::string& endpointConfigJson);
+
 /**
  * Formats the given @c EndpointAttributes and @c CapabilityConfigurations into a JSON required to send in the
  * @c Discovery.AddOrUpdateReport event.
@@ -90,6 +102,29 @@ std::pair<std::string, std::string> getAddOrUpdateReportEventJson(
     const std::vector<std::string>& endpointConfigurations,
     const std::string& authToken);
 
+/**
+ * Encodes the given endpoint configurations into the JSON array sent as the endpoints of a @c Discovery event, so that
+ * it can be built once and reused by @c getAddOrUpdateReportEventJsonForEncodedEndpoints and
+ * @c getDeleteReportEventJsonForEncodedEndpoints every time the event is (re)sent.
+ *
+ * @param endpointConfigurations The endpointConfiguration jsons to encode.
+ * @return The JSON array containing the endpoint configurations.
+ */
+std::string encodeEndpointConfigurations(const std::vector<std::string>& endpointConfigurations);
+
+/**
+ * Formats the @c Discovery.AddOrUpdateReport event from endpoint configurations encoded by
+ * @c encodeEndpointConfigurations.
+ *
+ * @param encodedEndpointConfigurations The JSON array of endpoint configurations to be included in the event.
+ * @param authToken The authorization token that needs to be included in the event.
+ * @return The string pair containing the JSON formatted Discovery.AddOrUpdateReport event and the
+ * eventCorrelationToken.
+ */
+std::pair<std::string, std::string> getAddOrUpdateReportEventJsonForEncodedEndpoints(
+    const std::string& encodedEndpointConfigurations,
+    const std::string& authToken);
+
 /**
  * Formats the endpoint ID into endpointConfig JSON that will be sent in the payload of @c Discovery.DeleteReport
  * event.
@@ -110,6 +145,17 @@ std::string getDeleteReportEventJson(
     const std::vector<std::string>& endpointConfigurations,
     const std::string& authToken);
 
+/**
+ * Formats the @c Discovery.DeleteReport event from endpoint configurations encoded by @c encodeEndpointConfigurations.
+ *
+ * @param encodedEndpointConfigurations The JSON array of endpoint configurations to be included in the event.
+ * @param authToken The authorization token that needs to be included in the event.
+ * @return The string containing the JSON formatted Discovery.DeleteReport event.
+ */
+std::string getDeleteReportEventJsonForEncodedEndpoints(
+    const std::string& encodedEndpointConfigurations,
+    const std::string& authToken);
+
 }  // namespace utils
 }  // namespace capabilitiesDelegate
 }  // namespace alexaClientSDK
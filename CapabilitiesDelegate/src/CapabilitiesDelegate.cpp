@@ -475,15 +475,15 @@ std::shared_ptr<PostConnectOperationInterface> CapabilitiesDelegate::createPostC
 
         originalPendingAddOrUpdateEndpoints = m_addOrUpdateEndpoints.pending;
 
-        std::unordered_map<std::string, std::string> storedEndpointConfig;
-        if (!m_capabilitiesDelegateStorage->load(&storedEndpointConfig)) {
+        std::unordered_map<std::string, std::string> storedEndpointConfigHashes;
+        if (!m_capabilitiesDelegateStorage->loadEndpointConfigHashes(&storedEndpointConfigHashes)) {
             ACSDK_ERROR(LX("createPostConnectOperationFailed").m("Could not load previous config from database."));
             return nullptr;
         }
-        ACSDK_DEBUG5(LX(__func__).d("num endpoints stored", storedEndpointConfig.size()));
+        ACSDK_DEBUG5(LX(__func__).d("num endpoints stored", storedEndpointConfigHashes.size()));
 
         /// If the database is empty, send any cached endpoints as part of this post-connect operation.
-        if (storedEndpointConfig.empty()) {
+        if (storedEndpointConfigHashes.empty()) {
             for (auto& endpoint : m_endpoints) {
                 auto endpointId = endpoint.first;
 
@@ -501,8 +501,8 @@ std::shared_ptr<PostConnectOperationInterface> CapabilitiesDelegate::createPostC
                 }
             }
         } else {
-            filterUnchangedPendingAddOrUpdateEndpointsLocked(&storedEndpointConfig);
-            addStaleEndpointsToPendingDeleteLocked(&storedEndpointConfig);
+            filterUnchangedPendingAddOrUpdateEndpointsLocked(&storedEndpointConfigHashes);
+            addStaleEndpointsToPendingDeleteLocked(&storedEndpointConfigHashes);
         }
 
         /// Move endpoints from pending to in-flight, since they will now be sent.
@@ -752,15 +752,15 @@ void CapabilitiesDelegate::moveInFlightEndpointsToRegisteredEndpoints() {
 }
 
 void CapabilitiesDelegate::addStaleEndpointsToPendingDeleteLocked(
-    std::unordered_map<std::string, std::string>* storedEndpointConfig) {
+    std::unordered_map<std::string, std::string>* storedEndpointConfigHashes) {
     ACSDK_DEBUG5(LX(__func__));
 
-    if (!storedEndpointConfig) {
-        ACSDK_ERROR(LX("findEndpointsToDeleteLockedFailed").d("reason", "invalidStoredEndpointConfig"));
+    if (!storedEndpointConfigHashes) {
+        ACSDK_ERROR(LX("findEndpointsToDeleteLockedFailed").d("reason", "invalidStoredEndpointConfigHashes"));
         return;
     }
 
-    for (auto& it : *storedEndpointConfig) {
+    for (auto& it : *storedEndpointConfigHashes) {
         if (m_endpoints.end() == m_endpoints.find(it.first) &&
             m_addOrUpdateEndpoints.pending.end() == m_addOrUpdateEndpoints.pending.find(it.first)) {
             ACSDK_DEBUG9(LX(__func__).d("step", "endpoint included in deleteReport").sensitive("endpointId", it.first));
@@ -770,12 +770,12 @@ void CapabilitiesDelegate::addStaleEndpointsToPendingDeleteLocked(
 }
 
 void CapabilitiesDelegate::filterUnchangedPendingAddOrUpdateEndpointsLocked(
-    std::unordered_map<std::string, std::string>* storedEndpointConfig) {
+    std::unordered_map<std::string, std::string>* storedEndpointConfigHashes) {
     ACSDK_DEBUG5(LX(__func__));
 
-    if (!storedEndpointConfig) {
-        ACSDK_ERROR(
-            LX("filterUnchangedPendingAddOrUpdateEndpointsLockedFailed").d("reason", "invalidStoredEndpointConfig"));
+    if (!storedEndpointConfigHashes) {
+        ACSDK_ERROR(LX("filterUnchangedPendingAddOrUpdateEndpointsLockedFailed")
+                        .d("reason", "invalidStoredEndpointConfigHashes"));
         return;
     }
 
@@ -794,9 +794,9 @@ void CapabilitiesDelegate::filterUnchangedPendingAddOrUpdateEndpointsLocked(
 
     /// Find the endpoints that are unchanged
     for (auto& endpointIdToConfigPair : addOrUpdateEndpointIdToConfigPairs) {
-        auto storedEndpointConfigId = storedEndpointConfig->find(endpointIdToConfigPair.first);
-        if (storedEndpointConfig->end() != storedEndpointConfigId) {
-            if (compareEndpointConfigurations(endpointIdToConfigPair.second, storedEndpointConfigId->second)) {
+        auto storedEndpointConfigHashIt = storedEndpointConfigHashes->find(endpointIdToConfigPair.first);
+        if (storedEndpointConfigHashes->end() != storedEndpointConfigHashIt) {
+            if (getEndpointConfigHash(endpointIdToConfigPair.second) == storedEndpointConfigHashIt->second) {
                 ACSDK_DEBUG9(LX(__func__)
                                  .d("step", "endpoint not be included in addOrUpdateReport")
                                  .sensitive("endpointId", endpointIdToConfigPair.first));
@@ -810,7 +810,7 @@ void CapabilitiesDelegate::filterUnchangedPendingAddOrUpdateEndpointsLocked(
                 m_endpoints[endpointIdToConfigPair.first] = endpointIdToConfigPair.second;
 
                 /// Remove this endpoint from the stored endpoint list.
-                storedEndpointConfig->erase(endpointIdToConfigPair.first);
+                storedEndpointConfigHashes->erase(endpointIdToConfigPair.first);
             } else {
                 ACSDK_DEBUG9(LX(__func__)
                                  .d("step", "endpoint included in addOrUpdateReport")
@@ -16,6 +16,10 @@
 #include "CapabilitiesDelegate/DiscoveryEventSender.h"
 #include "CapabilitiesDelegate/Utils/DiscoveryUtils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/RetryTimer.h>
 
@@ -54,6 +58,9 @@ static avsCommon::utils::RetryTimer RETRY_TIMER{RETRY_TABLE};
 /// Maximum number of endpoints per event.
 static constexpr int MAX_ENDPOINTS_PER_ADD_OR_UPDATE_REPORT_EVENT = 300;
 
+/// Maximum number of Discovery events of a report sent concurrently.
+static constexpr size_t MAX_CONCURRENT_DISCOVERY_EVENTS = 4;
+
 /// The timeout for the Asynchronous response directive (Alexa.EventProcessed) to be received.
 static const auto ASYNC_RESPONSE_TIMEOUT = std::chrono::seconds(2);
 
@@ -150,27 +157,31 @@ std::string DiscoveryEventSender::getAuthToken() {
 
 void DiscoveryEventSender::stop() {
     ACSDK_DEBUG5(LX(__func__));
-    std::shared_ptr<WaitableMessageRequest> requestCopy;
+    std::unordered_set<std::shared_ptr<WaitableMessageRequest>> requestsCopy;
+    std::unordered_map<std::string, std::shared_ptr<avsCommon::utils::WaitEvent>> eventProcessedWaitEventsCopy;
     {
         std::lock_guard<std::mutex> lock{m_mutex};
         if (m_isStopping) {
             return;
         }
         m_isStopping = true;
-        requestCopy = m_messageRequest;
+        requestsCopy = m_messageRequests;
+        eventProcessedWaitEventsCopy = m_eventProcessedWaitEvents;
     }
 
-    if (requestCopy) {
-        requestCopy->shutdown();
+    for (const auto& request : requestsCopy) {
+        request->shutdown();
     }
 
     {
         std::lock_guard<std::mutex> lock{m_authStatusMutex};
-        m_authStatusReady.notifyOne();
+        m_authStatusReady.notifyAll();
     }
 
     m_retryWait.wakeUp();
-    m_eventProcessedWaitEvent.wakeUp();
+    for (const auto& eventProcessedWaitEvent : eventProcessedWaitEventsCopy) {
+        eventProcessedWaitEvent.second->wakeUp();
+    }
 
     {
         /// Reset the observer.
@@ -187,22 +198,30 @@ bool DiscoveryEventSender::isStopping() {
 MessageRequestObserverInterface::Status DiscoveryEventSender::sendDiscoveryEvent(
     const std::shared_ptr<MessageSenderInterface>& messageSender,
     const std::string& eventString,
-    bool waitForEventProcessed) {
+    const std::string& eventCorrelationToken) {
     ACSDK_DEBUG5(LX(__func__).sensitive("discoveryEvent", eventString));
-    std::unique_lock<std::mutex> lock{m_mutex};
-    m_eventProcessedWaitEvent.reset();
-    m_messageRequest.reset();
-    m_messageRequest = std::make_shared<WaitableMessageRequest>(eventString);
-    lock.unlock();
+    bool waitForEventProcessed = !eventCorrelationToken.empty() && m_waitForEventProcessed;
+    auto messageRequest = std::make_shared<WaitableMessageRequest>(eventString);
+    auto eventProcessedWaitEvent = std::make_shared<avsCommon::utils::WaitEvent>();
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_isStopping) {
+            return MessageRequestObserverInterface::Status::CANCELED;
+        }
+        m_messageRequests.insert(messageRequest);
+        // Register before sending, the EventProcessed directive may be received before the request completes.
+        if (waitForEventProcessed) {
+            m_eventProcessedWaitEvents[eventCorrelationToken] = eventProcessedWaitEvent;
+        }
+    }
 
-    messageSender->sendMessage(m_messageRequest);
-    auto status = m_messageRequest->waitForCompletion();
+    messageSender->sendMessage(messageRequest);
+    auto status = messageRequest->waitForCompletion();
 
     ACSDK_DEBUG5(LX(__func__).d("Discovery event status", status));
-    if (MessageRequestObserverInterface::Status::SUCCESS_ACCEPTED == status && waitForEventProcessed &&
-        m_waitForEventProcessed) {
+    if (MessageRequestObserverInterface::Status::SUCCESS_ACCEPTED == status && waitForEventProcessed) {
         ACSDK_DEBUG5(LX(__func__).m("waiting for Event Processed directive"));
-        if (!m_eventProcessedWaitEvent.wait(ASYNC_RESPONSE_TIMEOUT)) {
+        if (!eventProcessedWaitEvent->wait(ASYNC_RESPONSE_TIMEOUT)) {
             ACSDK_ERROR(LX("sendDiscoveryEventFailed").d("reason", "Timeout on waiting for Event Processed Directive"));
             status = MessageRequestObserverInterface::Status::TIMEDOUT;
         } else if (isStopping()) {
@@ -210,18 +229,25 @@ MessageRequestObserverInterface::Status DiscoveryEventSender::sendDiscoveryEvent
         }
     }
 
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_messageRequests.erase(messageRequest);
+        if (waitForEventProcessed) {
+            m_eventProcessedWaitEvents.erase(eventCorrelationToken);
+        }
+    }
+
     return status;
 }
 
 bool DiscoveryEventSender::sendDiscoveryEventWithRetries(
     const std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
-    const std::vector<std::string>& endpointConfigurations,
+    const std::string& encodedEndpointConfigurations,
     bool isAddOrUpdateReportEvent) {
     ACSDK_DEBUG5(LX(__func__));
-    m_retryWait.reset();
     int retryAttempt = 0;
     while (!isStopping()) {
-        std::string eventString, authToken;
+        std::string eventString, eventCorrelationToken, authToken;
         authToken = getAuthToken();
         if (authToken.empty()) {
             ACSDK_ERROR(LX("sendDiscoveryEventWithRetriesFailed").d("reason", "empty auth token"));
@@ -229,14 +255,15 @@ bool DiscoveryEventSender::sendDiscoveryEventWithRetries(
         }
 
         if (isAddOrUpdateReportEvent) {
-            auto eventAndEventCorrelationTokenPair = getAddOrUpdateReportEventJson(endpointConfigurations, authToken);
+            auto eventAndEventCorrelationTokenPair =
+                getAddOrUpdateReportEventJsonForEncodedEndpoints(encodedEndpointConfigurations, authToken);
             eventString = eventAndEventCorrelationTokenPair.first;
-            m_currentEventCorrelationToken = eventAndEventCorrelationTokenPair.second;
+            eventCorrelationToken = eventAndEventCorrelationTokenPair.second;
         } else {
-            eventString = getDeleteReportEventJson(endpointConfigurations, authToken);
+            eventString = getDeleteReportEventJsonForEncodedEndpoints(encodedEndpointConfigurations, authToken);
         }
 
-        auto status = sendDiscoveryEvent(messageSender, eventString, isAddOrUpdateReportEvent);
+        auto status = sendDiscoveryEvent(messageSender, eventString, eventCorrelationToken);
         switch (status) {
             case MessageRequestObserverInterface::Status::SUCCESS_ACCEPTED:
                 /// Successful response, proceed to send next event if available.
@@ -261,50 +288,77 @@ bool DiscoveryEventSender::sendDiscoveryEventWithRetries(
     return false;
 }
 
-bool DiscoveryEventSender::sendDiscoveryEvents(
+std::vector<std::string> DiscoveryEventSender::createEncodedBatches(
     const std::vector<std::string>& endpointConfigurations,
-    const std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
     bool isAddOrUpdateReportEvent) {
+    std::vector<std::string> encodedBatches;
     int currentEventSize = 0;
     std::vector<std::string> currentEndpointConfigurationsBuffer;
-    auto currentEndpointConfigIt = endpointConfigurations.begin();
 
-    while (currentEndpointConfigIt != endpointConfigurations.end()) {
-        int currentEndpointConfigSize = currentEndpointConfigIt->size();
+    for (const auto& endpointConfiguration : endpointConfigurations) {
+        int currentEndpointConfigSize = endpointConfiguration.size();
 
-        bool sendEvent = false;
+        bool flushBuffer = false;
 
         // Check for maximum allowed endpoints in Discovery.AddOrUpdateReport event.
         if (isAddOrUpdateReportEvent) {
             if (currentEndpointConfigurationsBuffer.size() == MAX_ENDPOINTS_PER_ADD_OR_UPDATE_REPORT_EVENT) {
-                sendEvent = true;
+                flushBuffer = true;
             }
         }
 
         // Check for endpoint config size in payload
         if (currentEventSize + currentEndpointConfigSize > MAX_ENDPOINTS_SIZE_IN_PAYLOAD) {
-            sendEvent = true;
+            flushBuffer = true;
         }
 
-        if (sendEvent) {
-            if (!sendDiscoveryEventWithRetries(
-                    messageSender, currentEndpointConfigurationsBuffer, isAddOrUpdateReportEvent)) {
-                return false;
-            }
+        if (flushBuffer) {
+            encodedBatches.push_back(encodeEndpointConfigurations(currentEndpointConfigurationsBuffer));
 
             // Reset buffer
             currentEventSize = 0;
             currentEndpointConfigurationsBuffer.clear();
         }
 
-        currentEndpointConfigurationsBuffer.push_back(*currentEndpointConfigIt);
+        currentEndpointConfigurationsBuffer.push_back(endpointConfiguration);
         currentEventSize += currentEndpointConfigSize;
+    }
+
+    // Add the remaining endpoints.
+    encodedBatches.push_back(encodeEndpointConfigurations(currentEndpointConfigurationsBuffer));
+    return encodedBatches;
+}
+
+bool DiscoveryEventSender::sendDiscoveryEvents(
+    const std::vector<std::string>& endpointConfigurations,
+    const std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface>& messageSender,
+    bool isAddOrUpdateReportEvent) {
+    auto encodedBatches = createEncodedBatches(endpointConfigurations, isAddOrUpdateReportEvent);
+    ACSDK_DEBUG5(LX(__func__).d("num events", encodedBatches.size()));
+
+    std::atomic<size_t> nextBatch{0};
+    std::atomic<bool> failed{false};
+    auto sendBatches = [&]() {
+        for (size_t batch = nextBatch++; batch < encodedBatches.size() && !failed; batch = nextBatch++) {
+            if (!sendDiscoveryEventWithRetries(messageSender, encodedBatches[batch], isAddOrUpdateReportEvent)) {
+                failed = true;
+                // Abort the retries of the batches still being sent, the report can not complete anymore.
+                m_retryWait.wakeUp();
+            }
+        }
+    };
 
-        currentEndpointConfigIt++;
+    std::vector<std::thread> workers;
+    auto numWorkers = std::min(encodedBatches.size(), MAX_CONCURRENT_DISCOVERY_EVENTS);
+    for (size_t i = 1; i < numWorkers; ++i) {
+        workers.emplace_back(sendBatches);
+    }
+    sendBatches();
+    for (auto& worker : workers) {
+        worker.join();
     }
 
-    // Send the remaining endpoints.
-    return sendDiscoveryEventWithRetries(messageSender, currentEndpointConfigurationsBuffer, isAddOrUpdateReportEvent);
+    return !failed;
 }
 
 bool DiscoveryEventSender::sendAddOrUpdateReportEvents(
@@ -344,9 +398,18 @@ bool DiscoveryEventSender::sendDeleteReportEvents(
 
 void DiscoveryEventSender::onAlexaEventProcessedReceived(const std::string& eventCorrelationToken) {
     ACSDK_DEBUG5(LX(__func__));
-    if (m_currentEventCorrelationToken == eventCorrelationToken) {
+    std::shared_ptr<avsCommon::utils::WaitEvent> eventProcessedWaitEvent;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto it = m_eventProcessedWaitEvents.find(eventCorrelationToken);
+        if (m_eventProcessedWaitEvents.end() != it) {
+            eventProcessedWaitEvent = it->second;
+        }
+    }
+
+    if (eventProcessedWaitEvent) {
         ACSDK_DEBUG5(LX(__func__).m("valid event correlation token received"));
-        m_eventProcessedWaitEvent.wakeUp();
+        eventProcessedWaitEvent->wakeUp();
     } else {
         ACSDK_WARN(LX(__func__).m("invalid event correlation token received"));
     }
@@ -382,6 +445,9 @@ void DiscoveryEventSender::removeDiscoveryStatusObserver(
 void DiscoveryEventSender::reportDiscoveryStatus(MessageRequestObserverInterface::Status status) {
     ACSDK_DEBUG5(LX(__func__));
 
+    // Events of a report are sent concurrently, make sure the observer is notified of one status at a time.
+    std::lock_guard<std::mutex> reportLock{m_reportMutex};
+
     std::shared_ptr<DiscoveryStatusObserverInterface> observer;
     {
         std::lock_guard<std::mutex> lock{m_observerMutex};
@@ -17,6 +17,8 @@
 
 #include <AVSCommon/Utils/Logger/Logger.h>
 
+#include "CapabilitiesDelegate/Utils/DiscoveryUtils.h"
+
 namespace alexaClientSDK {
 namespace capabilitiesDelegate {
 namespace storage {
@@ -45,10 +47,22 @@ static const std::string ENDPOINT_CONFIG_TABLE_NAME = "endpointConfigTable";
 static const std::string DATABASE_COLUMN_ENDPOINT_ID_NAME = "endpointId";
 /// The name of the 'endpointConfig' field we will.
 static const std::string DATABASE_COLUMN_ENDPOINT_CONFIG_NAME = "endpointConfig";
+/// The name of the 'endpointConfigHash' field holding the content hash of the endpoint config.
+static const std::string DATABASE_COLUMN_ENDPOINT_CONFIG_HASH_NAME = "endpointConfigHash";
 /// The SQL string to create the alerts table.
 static const std::string CREATE_ENDPOINT_CONFIG_TABLE_SQL_STRING =
     std::string("CREATE TABLE ") + ENDPOINT_CONFIG_TABLE_NAME + " (" + DATABASE_COLUMN_ENDPOINT_ID_NAME +
-    " TEXT NOT NULL UNIQUE," + DATABASE_COLUMN_ENDPOINT_CONFIG_NAME + " TEXT NOT NULL);";
+    " TEXT NOT NULL UNIQUE," + DATABASE_COLUMN_ENDPOINT_CONFIG_NAME + " TEXT NOT NULL," +
+    DATABASE_COLUMN_ENDPOINT_CONFIG_HASH_NAME + " TEXT);";
+/// The SQL string to store an endpoint config.
+static const std::string STORE_ENDPOINT_CONFIG_SQL_STRING = "REPLACE INTO " + ENDPOINT_CONFIG_TABLE_NAME + " (" +
+                                                            DATABASE_COLUMN_ENDPOINT_ID_NAME + ", " +
+                                                            DATABASE_COLUMN_ENDPOINT_CONFIG_NAME + ", " +
+                                                            DATABASE_COLUMN_ENDPOINT_CONFIG_HASH_NAME +
+                                                            ") VALUES (?, ?, ?);";
+/// The SQL string to erase an endpoint config.
+static const std::string ERASE_ENDPOINT_CONFIG_SQL_STRING =
+    "DELETE FROM " + ENDPOINT_CONFIG_TABLE_NAME + " WHERE " + DATABASE_COLUMN_ENDPOINT_ID_NAME + "=?;";
 
 std::unique_ptr<CapabilitiesDelegateStorageInterface> SQLiteCapabilitiesDelegateStorage::
     createCapabilitiesDelegateStorageInterface(
@@ -119,6 +133,9 @@ bool SQLiteCapabilitiesDelegateStorage::open() {
             closeLocked();
             return false;
         }
+    } else if (!addEndpointConfigHashColumnLocked()) {
+        closeLocked();
+        return false;
     }
 
     return true;
@@ -144,23 +161,51 @@ bool SQLiteCapabilitiesDelegateStorage::createEndpointConfigTableLocked() {
     return true;
 }
 
-bool SQLiteCapabilitiesDelegateStorage::storeLocked(const std::string& endpointId, const std::string& endpointConfig) {
-    ACSDK_DEBUG5(LX(__func__));
-    const std::string sqlString = "REPLACE INTO " + ENDPOINT_CONFIG_TABLE_NAME + " (" +
-                                  DATABASE_COLUMN_ENDPOINT_ID_NAME + ", " + DATABASE_COLUMN_ENDPOINT_CONFIG_NAME +
-                                  ") VALUES (?, ?);";
+bool SQLiteCapabilitiesDelegateStorage::addEndpointConfigHashColumnLocked() {
+    auto tableInfoStatement = m_database.createStatement("PRAGMA table_info(" + ENDPOINT_CONFIG_TABLE_NAME + ");");
+    if (!tableInfoStatement || !tableInfoStatement->step()) {
+        ACSDK_ERROR(LX("addEndpointConfigHashColumnFailed").d("reason", "unable to read table info"));
+        return false;
+    }
 
-    auto statement = m_database.createStatement(sqlString);
-    if (!statement) {
-        ACSDK_ERROR(LX("storeFailed").m("Could not create statement"));
+    // The second column of the table_info pragma holds the column name.
+    const int TABLE_INFO_NAME_INDEX = 1;
+    while (SQLITE_ROW == tableInfoStatement->getStepResult()) {
+        if (DATABASE_COLUMN_ENDPOINT_CONFIG_HASH_NAME == tableInfoStatement->getColumnText(TABLE_INFO_NAME_INDEX)) {
+            return true;
+        }
+        tableInfoStatement->step();
+    }
+    tableInfoStatement.reset();
+
+    ACSDK_INFO(LX(__func__).m("Adding endpoint config hashes to existing table"));
+    if (!m_database.performQuery(
+            "ALTER TABLE " + ENDPOINT_CONFIG_TABLE_NAME + " ADD COLUMN " + DATABASE_COLUMN_ENDPOINT_CONFIG_HASH_NAME +
+            " TEXT;")) {
+        ACSDK_ERROR(LX("addEndpointConfigHashColumnFailed").d("reason", "unable to add column"));
+        return false;
+    }
+
+    std::unordered_map<std::string, std::string> endpointConfigMap;
+    if (!loadLocked(&endpointConfigMap)) {
+        ACSDK_ERROR(LX("addEndpointConfigHashColumnFailed").d("reason", "unable to load endpoint configs"));
         return false;
     }
 
+    return storeLocked(endpointConfigMap);
+}
+
+bool SQLiteCapabilitiesDelegateStorage::storeLocked(
+    alexaClientSDK::storage::sqliteStorage::SQLiteStatement* statement,
+    const std::string& endpointId,
+    const std::string& endpointConfig) {
     int ENDPOINT_ID_INDEX = 1;
     int ENDPOINT_CONFIG_INDEX = 2;
+    int ENDPOINT_CONFIG_HASH_INDEX = 3;
 
     if (!statement->bindStringParameter(ENDPOINT_ID_INDEX, endpointId) ||
-        !statement->bindStringParameter(ENDPOINT_CONFIG_INDEX, endpointConfig)) {
+        !statement->bindStringParameter(ENDPOINT_CONFIG_INDEX, endpointConfig) ||
+        !statement->bindStringParameter(ENDPOINT_CONFIG_HASH_INDEX, utils::getEndpointConfigHash(endpointConfig))) {
         ACSDK_ERROR(LX("storeFailed").m("Could not bind parameter"));
         return false;
     }
@@ -173,29 +218,63 @@ bool SQLiteCapabilitiesDelegateStorage::storeLocked(const std::string& endpointI
     return true;
 }
 
+bool SQLiteCapabilitiesDelegateStorage::storeLocked(
+    const std::unordered_map<std::string, std::string>& endpointIdToConfigMap) {
+    if (endpointIdToConfigMap.empty()) {
+        return true;
+    }
+
+    auto statement = m_database.createStatement(STORE_ENDPOINT_CONFIG_SQL_STRING);
+    if (!statement) {
+        ACSDK_ERROR(LX("storeFailed").m("Could not create statement"));
+        return false;
+    }
+
+    // Store all endpoints in a single transaction, so a large discovery is persisted with a single commit.
+    auto transaction = m_database.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("storeFailed").m("Could not begin transaction"));
+        return false;
+    }
+
+    for (const auto& endpointIdToConfig : endpointIdToConfigMap) {
+        if (!statement->reset() || !storeLocked(statement.get(), endpointIdToConfig.first, endpointIdToConfig.second)) {
+            ACSDK_ERROR(LX("storeFailed").m("Could not store endpointConfigMap"));
+            transaction->rollback();
+            return false;
+        }
+    }
+
+    return transaction->commit();
+}
+
 bool SQLiteCapabilitiesDelegateStorage::store(const std::string& endpointId, const std::string& endpointConfig) {
     ACSDK_DEBUG5(LX(__func__));
     std::lock_guard<std::mutex> lock{m_mutex};
-    return storeLocked(endpointId, endpointConfig);
+
+    auto statement = m_database.createStatement(STORE_ENDPOINT_CONFIG_SQL_STRING);
+    if (!statement) {
+        ACSDK_ERROR(LX("storeFailed").m("Could not create statement"));
+        return false;
+    }
+
+    return storeLocked(statement.get(), endpointId, endpointConfig);
 }
 
 bool SQLiteCapabilitiesDelegateStorage::store(
     const std::unordered_map<std::string, std::string>& endpointIdToConfigMap) {
     ACSDK_DEBUG5(LX(__func__));
     std::lock_guard<std::mutex> lock{m_mutex};
-    for (auto it = endpointIdToConfigMap.begin(); it != endpointIdToConfigMap.end(); ++it) {
-        if (!storeLocked(it->first, it->second)) {
-            ACSDK_ERROR(LX("storeFailed").m("Could not store endpointConfigMap"));
-            return false;
-        }
-    }
-
-    return true;
+    return storeLocked(endpointIdToConfigMap);
 }
 
 bool SQLiteCapabilitiesDelegateStorage::load(std::unordered_map<std::string, std::string>* endpointConfigMap) {
     ACSDK_DEBUG5(LX(__func__));
     std::lock_guard<std::mutex> lock{m_mutex};
+    return loadLocked(endpointConfigMap);
+}
+
+bool SQLiteCapabilitiesDelegateStorage::loadLocked(std::unordered_map<std::string, std::string>* endpointConfigMap) {
     if (!endpointConfigMap || !endpointConfigMap->empty()) {
         ACSDK_ERROR(LX("loadFailed").d("reason", "Invalid endpointConfigMap"));
         return false;
@@ -238,6 +317,41 @@ bool SQLiteCapabilitiesDelegateStorage::load(std::unordered_map<std::string, std
     return true;
 }
 
+bool SQLiteCapabilitiesDelegateStorage::loadEndpointConfigHashes(
+    std::unordered_map<std::string, std::string>* endpointIdToConfigHashMap) {
+    ACSDK_DEBUG5(LX(__func__));
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (!endpointIdToConfigHashMap || !endpointIdToConfigHashMap->empty()) {
+        ACSDK_ERROR(LX("loadEndpointConfigHashesFailed").d("reason", "Invalid endpointIdToConfigHashMap"));
+        return false;
+    }
+
+    const std::string sqlString = "SELECT " + DATABASE_COLUMN_ENDPOINT_ID_NAME + ", " +
+                                  DATABASE_COLUMN_ENDPOINT_CONFIG_HASH_NAME + " FROM " + ENDPOINT_CONFIG_TABLE_NAME +
+                                  ";";
+
+    auto statement = m_database.createStatement(sqlString);
+    if (!statement) {
+        ACSDK_ERROR(LX("loadEndpointConfigHashesFailed").m("Could not create statement."));
+        return false;
+    }
+
+    if (!statement->step()) {
+        ACSDK_ERROR(LX("loadEndpointConfigHashesFailed").m("Could not perform step."));
+        return false;
+    }
+
+    const int ENDPOINT_ID_INDEX = 0;
+    const int ENDPOINT_CONFIG_HASH_INDEX = 1;
+    while (SQLITE_ROW == statement->getStepResult()) {
+        endpointIdToConfigHashMap->insert(
+            {statement->getColumnText(ENDPOINT_ID_INDEX), statement->getColumnText(ENDPOINT_CONFIG_HASH_INDEX)});
+        statement->step();
+    }
+
+    return true;
+}
+
 bool SQLiteCapabilitiesDelegateStorage::load(const std::string& endpointId, std::string* endpointConfig) {
     ACSDK_DEBUG5(LX(__func__));
 
@@ -277,9 +391,7 @@ bool SQLiteCapabilitiesDelegateStorage::load(const std::string& endpointId, std:
 
 bool SQLiteCapabilitiesDelegateStorage::eraseLocked(const std::string& endpointId) {
     ACSDK_DEBUG5(LX(__func__));
-    const std::string sqlString =
-        "DELETE FROM " + ENDPOINT_CONFIG_TABLE_NAME + " WHERE " + DATABASE_COLUMN_ENDPOINT_ID_NAME + "=?;";
-    auto statement = m_database.createStatement(sqlString);
+    auto statement = m_database.createStatement(ERASE_ENDPOINT_CONFIG_SQL_STRING);
 
     if (!statement) {
         ACSDK_ERROR(LX("eraseFailed").m("Could not create statement."));
@@ -310,13 +422,24 @@ bool SQLiteCapabilitiesDelegateStorage::erase(
     const std::unordered_map<std::string, std::string>& endpointIdToConfigMap) {
     ACSDK_DEBUG5(LX(__func__));
     std::lock_guard<std::mutex> lock{m_mutex};
-    for (auto endpointIdToConfig : endpointIdToConfigMap) {
+    if (endpointIdToConfigMap.empty()) {
+        return true;
+    }
+
+    auto transaction = m_database.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("eraseFailed").m("Could not begin transaction"));
+        return false;
+    }
+
+    for (const auto& endpointIdToConfig : endpointIdToConfigMap) {
         if (!eraseLocked(endpointIdToConfig.first)) {
+            transaction->rollback();
             return false;
         }
     }
 
-    return true;
+    return transaction->commit();
 }
 
 bool SQLiteCapabilitiesDelegateStorage::clearDatabase() {
@@ -15,6 +15,8 @@
 
 #include "CapabilitiesDelegate/Utils/DiscoveryUtils.h"
 
+#include <cstdint>
+
 #include <AVSCommon/AVS/AVSMessageEndpoint.h>
 #include <AVSCommon/AVS/AVSMessageHeader.h>
 #include <AVSCommon/AVS/EventBuilder.h>
@@ -113,6 +115,11 @@ static const std::string SCOPE_TYPE_BEARER_TOKEN = "BearerToken";
 /// Scope Token key
 static const std::string SCOPE_TOKEN_KEY = "token";
 
+/// Offset basis of the 64 bit FNV-1a hash used for endpoint configuration hashes.
+static constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+/// Prime of the 64 bit FNV-1a hash used for endpoint configuration hashes.
+static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+
 /**
  * Helper struct to build json objects
  */
@@ -293,6 +300,22 @@ bool compareEndpointConfigurations(const std::string& firstEndpointJson, const s
     return (firstEndpointDocument == secondEndpointDocument);
 }
 
+std::string getEndpointConfigHash(const std::string& endpointConfigJson) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (auto c : endpointConfigJson) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= FNV_PRIME;
+    }
+
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    std::string hashString(2 * sizeof(hash), '0');
+    for (auto it = hashString.rbegin(); it != hashString.rend(); ++it) {
+        *it = HEX_DIGITS[hash & 0xf];
+        hash >>= 4;
+    }
+    return hashString;
+}
+
 std::string getEndpointConfigJson(
     const AVSDiscoveryEndpointAttributes& endpointAttributes,
     const std::vector<avsCommon::avs::CapabilityConfiguration>& capabilities) {
@@ -379,9 +402,35 @@ std::string getDeleteReportEndpointConfigJson(const std::string& endpointId) {
     return deleteReportEndpointConfigGenerator.toString();
 }
 
+std::string encodeEndpointConfigurations(const std::vector<std::string>& endpointConfigurations) {
+    size_t size = 2;
+    for (const auto& endpointConfiguration : endpointConfigurations) {
+        size += endpointConfiguration.size() + 1;
+    }
+
+    std::string encoded;
+    encoded.reserve(size);
+    encoded.push_back('[');
+    for (const auto& endpointConfiguration : endpointConfigurations) {
+        if (encoded.size() > 1) {
+            encoded.push_back(',');
+        }
+        encoded.append(endpointConfiguration);
+    }
+    encoded.push_back(']');
+    return encoded;
+}
+
 std::pair<std::string, std::string> getAddOrUpdateReportEventJson(
     const std::vector<std::string>& endpointConfigurations,
     const std::string& authToken) {
+    return getAddOrUpdateReportEventJsonForEncodedEndpoints(
+        encodeEndpointConfigurations(endpointConfigurations), authToken);
+}
+
+std::pair<std::string, std::string> getAddOrUpdateReportEventJsonForEncodedEndpoints(
+    const std::string& encodedEndpointConfigurations,
+    const std::string& authToken) {
     ACSDK_DEBUG5(LX(__func__));
 
     auto header = AVSMessageHeader::createAVSEventHeader(
@@ -389,7 +438,8 @@ std::pair<std::string, std::string> getAddOrUpdateReportEventJson(
     JsonGenerator payloadGenerator;
     {
         payloadGenerator.addRawJsonMember(SCOPE_KEY, getScopeJson(authToken));
-        payloadGenerator.addMembersArray(ENDPOINTS_KEY, endpointConfigurations);
+        // The endpoint configurations were generated by getEndpointConfigJson, no need to parse them again.
+        payloadGenerator.addRawJsonMember(ENDPOINTS_KEY, encodedEndpointConfigurations, false);
     }
 
     std::string addOrUpdateEvent =
@@ -400,6 +450,12 @@ std::pair<std::string, std::string> getAddOrUpdateReportEventJson(
 std::string getDeleteReportEventJson(
     const std::vector<std::string>& endpointConfigurations,
     const std::string& authToken) {
+    return getDeleteReportEventJsonForEncodedEndpoints(encodeEndpointConfigurations(endpointConfigurations), authToken);
+}
+
+std::string getDeleteReportEventJsonForEncodedEndpoints(
+    const std::string& encodedEndpointConfigurations,
+    const std::string& authToken) {
     ACSDK_DEBUG5(LX(__func__));
 
     auto header =
@@ -408,7 +464,7 @@ std::string getDeleteReportEventJson(
     JsonGenerator payloadGenerator;
     {
         payloadGenerator.addRawJsonMember(SCOPE_KEY, getScopeJson(authToken));
-        payloadGenerator.addMembersArray(ENDPOINTS_KEY, endpointConfigurations);
+        payloadGenerator.addRawJsonMember(ENDPOINTS_KEY, encodedEndpointConfigurations, false);
     }
 
     return buildJsonEventString(header, Optional<AVSMessageEndpoint>(), payloadGenerator.toString());
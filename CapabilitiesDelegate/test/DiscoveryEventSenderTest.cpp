@@ -13,7 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
 #include <gmock/gmock.h>
 
@@ -550,6 +553,84 @@ TEST_F(DiscoveryEventSenderTest, test_sendDiscoveryEventsSplitsEventsWhenMaxPayl
     discoveryEventSender->removeDiscoveryStatusObserver(m_mockDiscoveryStatusObserver);
 }
 
+/**
+ * Test that the events of a report are sent concurrently, with a bounded number of events in flight.
+ */
+TEST_F(DiscoveryEventSenderTest, test_sendDiscoveryEventsSendsEventsConcurrently) {
+    std::unordered_map<std::string, std::string> addOrUpdateReportEndpoints;
+    std::string endpointIdPrefix = "ENDPOINT_ID_";
+    int testNumAddOrUpdateReportEndpoints = 1400;
+
+    for (int i = 1; i <= testNumAddOrUpdateReportEndpoints; ++i) {
+        std::string endpointId = endpointIdPrefix + std::to_string(i);
+        std::string endpointIdConfig = "{\"endpointId\":\"" + std::to_string(i) + "\"}";
+        addOrUpdateReportEndpoints.insert({endpointId, endpointIdConfig});
+    }
+
+    auto discoveryEventSender =
+        DiscoveryEventSender::create(addOrUpdateReportEndpoints, TEST_DELETE_ENDPOINTS, m_mockAuthDelegate);
+    discoveryEventSender->addDiscoveryStatusObserver(m_mockDiscoveryStatusObserver);
+    validateCallsToAuthDelegate(discoveryEventSender);
+
+    std::mutex endpointIdsMutex;
+    std::multiset<std::string> sentEndpointIds;
+    std::atomic<int> eventsInFlight{0};
+    std::atomic<int> maxEventsInFlight{0};
+    auto handleAddOrUpdateReport = [&](std::shared_ptr<MessageRequest> request) {
+        EventData eventData;
+        ASSERT_TRUE(parseEventJson(request->getJsonContent(), &eventData));
+        validateDiscoveryEvent(eventData, ADD_OR_UPDATE_REPORT_NAME);
+        {
+            std::lock_guard<std::mutex> lock(endpointIdsMutex);
+            sentEndpointIds.insert(eventData.endpointIdsInPayload.begin(), eventData.endpointIdsInPayload.end());
+        }
+
+        int inFlight = ++eventsInFlight;
+        int maxInFlight = maxEventsInFlight;
+        while (inFlight > maxInFlight && !maxEventsInFlight.compare_exchange_weak(maxInFlight, inFlight)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        --eventsInFlight;
+
+        request->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS_ACCEPTED);
+        discoveryEventSender->onAlexaEventProcessedReceived(eventData.eventCorrelationTokenString);
+    };
+
+    auto handleDeleteReport = [&](std::shared_ptr<MessageRequest> request) {
+        EXPECT_EQ(eventsInFlight, 0);
+        EventData eventData;
+        ASSERT_TRUE(parseEventJson(request->getJsonContent(), &eventData));
+        validateDiscoveryEvent(eventData, DELETE_REPORT_NAME);
+        request->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS_ACCEPTED);
+    };
+
+    int expectedNumOfAddOrUpdateReportEvents =
+        getExpectedNumberOfDiscoveryEventsFromEndpointNum(testNumAddOrUpdateReportEndpoints);
+    {
+        InSequence s;
+        EXPECT_CALL(*m_mockMessageSender, sendMessage(_))
+            .Times(expectedNumOfAddOrUpdateReportEvents)
+            .WillRepeatedly(Invoke(handleAddOrUpdateReport));
+        EXPECT_CALL(*m_mockMessageSender, sendMessage(_)).WillOnce(Invoke(handleDeleteReport));
+    }
+
+    EXPECT_CALL(
+        *m_mockDiscoveryStatusObserver, onDiscoveryCompleted(addOrUpdateReportEndpoints, TEST_DELETE_ENDPOINTS))
+        .WillOnce(Return());
+
+    ASSERT_TRUE(discoveryEventSender->sendDiscoveryEvents(m_mockMessageSender));
+
+    /// Every endpoint was sent exactly once.
+    ASSERT_EQ(sentEndpointIds.size(), static_cast<size_t>(testNumAddOrUpdateReportEndpoints));
+    EXPECT_EQ(std::set<std::string>(sentEndpointIds.begin(), sentEndpointIds.end()).size(), sentEndpointIds.size());
+
+    EXPECT_GT(maxEventsInFlight, 1);
+    EXPECT_LE(maxEventsInFlight, 4);
+
+    // Cleanup.
+    discoveryEventSender->removeDiscoveryStatusObserver(m_mockDiscoveryStatusObserver);
+}
+
 /**
  * Test when AddOrUpdateReport response is 202 and DeleteReport response is 4xx.
  */
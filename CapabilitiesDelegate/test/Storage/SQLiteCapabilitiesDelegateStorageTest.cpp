@@ -22,6 +22,7 @@
 
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <CapabilitiesDelegate/Storage/SQLiteCapabilitiesDelegateStorage.h>
+#include <CapabilitiesDelegate/Utils/DiscoveryUtils.h>
 #include <SQLiteStorage/SQLiteDatabase.h>
 
 namespace alexaClientSDK {
@@ -291,6 +292,62 @@ TEST_F(SQLiteCapabilitiesDelegateStorageTest, test_eraseWorks) {
     ASSERT_EQ(it->second, TEST_ENDPOINT_CONFIG_2);
 }
 
+TEST_F(SQLiteCapabilitiesDelegateStorageTest, test_loadEndpointConfigHashesWorks) {
+    setupDatabase();
+    std::unordered_map<std::string, std::string> storeMap;
+    storeMap.insert({TEST_ENDPOINT_ID_1, TEST_ENDPOINT_CONFIG_1});
+    storeMap.insert({TEST_ENDPOINT_ID_2, TEST_ENDPOINT_CONFIG_2});
+    ASSERT_TRUE(m_db->store(storeMap));
+
+    std::unordered_map<std::string, std::string> hashMap;
+    ASSERT_TRUE(m_db->loadEndpointConfigHashes(&hashMap));
+    ASSERT_THAT(hashMap.size(), Eq(2U));
+    EXPECT_EQ(hashMap[TEST_ENDPOINT_ID_1], utils::getEndpointConfigHash(TEST_ENDPOINT_CONFIG_1));
+    EXPECT_EQ(hashMap[TEST_ENDPOINT_ID_2], utils::getEndpointConfigHash(TEST_ENDPOINT_CONFIG_2));
+
+    /// Hashes follow the updates of the endpoint configs.
+    ASSERT_TRUE(m_db->store(TEST_ENDPOINT_ID_1, TEST_ENDPOINT_CONFIG_2));
+    hashMap.clear();
+    ASSERT_TRUE(m_db->loadEndpointConfigHashes(&hashMap));
+    EXPECT_EQ(hashMap[TEST_ENDPOINT_ID_1], utils::getEndpointConfigHash(TEST_ENDPOINT_CONFIG_2));
+
+    /// Loading into a non empty map fails.
+    ASSERT_FALSE(m_db->loadEndpointConfigHashes(&hashMap));
+}
+
+TEST_F(SQLiteCapabilitiesDelegateStorageTest, test_openAddsEndpointConfigHashesToExistingTable) {
+    /// Create a database with the endpoint config table of previous versions, without hashes.
+    auto sqliteDB = std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteDatabase>(
+        new alexaClientSDK::storage::sqliteStorage::SQLiteDatabase(TEST_DATABASE_FILE_NAME));
+    ASSERT_TRUE(sqliteDB->initialize());
+    ASSERT_TRUE(sqliteDB->performQuery(
+        "CREATE TABLE " + ENDPOINT_CONFIG_TABLE_NAME + " (endpointId TEXT NOT NULL UNIQUE,endpointConfig TEXT NOT NULL);"));
+    ASSERT_TRUE(sqliteDB->performQuery(
+        "INSERT INTO " + ENDPOINT_CONFIG_TABLE_NAME + " VALUES ('" + TEST_ENDPOINT_ID_1 + "', '" +
+        TEST_ENDPOINT_CONFIG_1 + "');"));
+    sqliteDB->close();
+
+    m_db = SQLiteCapabilitiesDelegateStorage::create(ConfigurationNode::getRoot());
+    ASSERT_THAT(m_db, NotNull());
+    ASSERT_TRUE(m_db->open());
+
+    std::unordered_map<std::string, std::string> hashMap;
+    ASSERT_TRUE(m_db->loadEndpointConfigHashes(&hashMap));
+    ASSERT_THAT(hashMap.size(), Eq(1U));
+    EXPECT_EQ(hashMap[TEST_ENDPOINT_ID_1], utils::getEndpointConfigHash(TEST_ENDPOINT_CONFIG_1));
+
+    std::string endpointConfig;
+    ASSERT_TRUE(m_db->load(TEST_ENDPOINT_ID_1, &endpointConfig));
+    EXPECT_EQ(endpointConfig, TEST_ENDPOINT_CONFIG_1);
+
+    /// Reopening a migrated database keeps the hashes.
+    m_db->close();
+    ASSERT_TRUE(m_db->open());
+    hashMap.clear();
+    ASSERT_TRUE(m_db->loadEndpointConfigHashes(&hashMap));
+    EXPECT_EQ(hashMap[TEST_ENDPOINT_ID_1], utils::getEndpointConfigHash(TEST_ENDPOINT_CONFIG_1));
+}
+
 TEST_F(SQLiteCapabilitiesDelegateStorageTest, test_clearDatabaseWorks) {
     setupDatabase();
     /// Store one item in the database.
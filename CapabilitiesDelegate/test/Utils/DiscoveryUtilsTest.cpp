@@ -540,6 +540,48 @@ TEST_F(DiscoveryUtilsTest, test_deleteReportEvent) {
     validateDiscoveryEvent(event, DELETE_REPORT_EVENT_NAME, TEST_AUTH_TOKEN, {TEST_ENDPOINT_ID});
 }
 
+/**
+ * Test that endpoint configuration hashes are stable and change with the configuration.
+ */
+TEST_F(DiscoveryUtilsTest, test_getEndpointConfigHash) {
+    /// 64 bit FNV-1a test vectors.
+    EXPECT_EQ(getEndpointConfigHash(""), "cbf29ce484222325");
+    EXPECT_EQ(getEndpointConfigHash("a"), "af63dc4c8601ec8c");
+
+    auto endpointConfig = getEndpointConfigJson(
+        createEndpointAttributes(
+            TEST_ENDPOINT_ID, TEST_FRIENDLY_NAME, TEST_DESCRIPTION, TEST_MANUFACTURER_NAME, TEST_DISPLAY_CATEGORIES),
+        {});
+    auto sameEndpointConfig = getEndpointConfigJson(
+        createEndpointAttributes(
+            TEST_ENDPOINT_ID, TEST_FRIENDLY_NAME, TEST_DESCRIPTION, TEST_MANUFACTURER_NAME, TEST_DISPLAY_CATEGORIES),
+        {});
+    auto otherEndpointConfig = getEndpointConfigJson(
+        createEndpointAttributes(
+            TEST_ENDPOINT_ID, "OTHER_FRIENDLY_NAME", TEST_DESCRIPTION, TEST_MANUFACTURER_NAME, TEST_DISPLAY_CATEGORIES),
+        {});
+
+    EXPECT_EQ(getEndpointConfigHash(endpointConfig), getEndpointConfigHash(sameEndpointConfig));
+    EXPECT_NE(getEndpointConfigHash(endpointConfig), getEndpointConfigHash(otherEndpointConfig));
+}
+
+/**
+ * Test that events built from encoded endpoint configurations match the ones built from the configurations.
+ */
+TEST_F(DiscoveryUtilsTest, test_discoveryEventsForEncodedEndpoints) {
+    std::vector<std::string> testEndpointConfigs = {TEST_ENDPOINT_CONFIG, R"({"endpointId":"OTHER_ENDPOINT_ID"})"};
+    auto encodedEndpointConfigs = encodeEndpointConfigurations(testEndpointConfigs);
+    EXPECT_EQ(encodedEndpointConfigs, "[" + testEndpointConfigs[0] + "," + testEndpointConfigs[1] + "]");
+    EXPECT_EQ(encodeEndpointConfigurations({}), "[]");
+
+    auto pair = getAddOrUpdateReportEventJsonForEncodedEndpoints(encodedEndpointConfigs, TEST_AUTH_TOKEN);
+    validateDiscoveryEvent(
+        pair.first, ADD_OR_UPDATE_REPORT_EVENT_NAME, TEST_AUTH_TOKEN, {TEST_ENDPOINT_ID, "OTHER_ENDPOINT_ID"});
+
+    auto event = getDeleteReportEventJsonForEncodedEndpoints(encodedEndpointConfigs, TEST_AUTH_TOKEN);
+    validateDiscoveryEvent(event, DELETE_REPORT_EVENT_NAME, TEST_AUTH_TOKEN, {TEST_ENDPOINT_ID, "OTHER_ENDPOINT_ID"});
+}
+
 TEST_F(DiscoveryUtilsTest, test_compareEndpointConfigJsons) {
     std::string endpointConfig1, endpointConfig2;
 
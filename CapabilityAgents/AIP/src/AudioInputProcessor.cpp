@@ -1391,6 +1391,8 @@ void AudioInputProcessor::executeOnContextAvailable(const std::string& jsonConte
             }
         }
     }
+    m_recognizeRequest->setPriority(MessageRequest::Priority::INTERACTIVE);
+
     // If we already have focus, there won't be a callback to send the message, so send it now.
     if (avsCommon::avs::FocusState::FOREGROUND == m_focusState) {
         sendRequestNow();
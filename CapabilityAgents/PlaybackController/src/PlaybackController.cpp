@@ -158,8 +158,10 @@ void PlaybackController::onContextAvailable(const std::string& jsonContext) {
 
         auto msgIdAndJsonEvent = buildJsonEventString(
             PLAYBACK_CONTROLLER_NAMESPACE, command.getEventName(), "", command.getEventPayload(), jsonContext);
-        m_messageSender->sendMessage(
-            std::make_shared<PlaybackMessageRequest>(command, msgIdAndJsonEvent.second, shared_from_this()));
+        auto request = std::make_shared<PlaybackMessageRequest>(command, msgIdAndJsonEvent.second, shared_from_this());
+        // Playback commands are user initiated, so they should not wait behind background events.
+        request->setPriority(MessageRequest::Priority::INTERACTIVE);
+        m_messageSender->sendMessage(request);
         if (!m_commands.empty()) {
             ACSDK_DEBUG9(LX("onContextAvailableExecutor").m("Queue is not empty, call getContext()."));
             m_contextManager->getContext(shared_from_this());
@@ -39,6 +39,7 @@
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
+#include <AVSCommon/Utils/Timing/Timer.h>
 #include <AVSCommon/Utils/RetryTimer.h>
 #include <AVSCommon/Utils/WaitEvent.h>
 #include <SpeakerManager/SpeakerManagerStorageInterface.h>
@@ -435,6 +436,29 @@ private:
      */
     void executePersistConfiguration();
 
+    /**
+     * Checks whether a volume change from the given source is coalesced. Changes requested by AVS directives are
+     * never coalesced, since AVS expects a prompt @c VolumeChanged event in response.
+     *
+     * @param source Whether the call is a result from an AVS directive or local interaction.
+     * @return Whether persistence and the @c VolumeChanged event of the change are deferred.
+     */
+    bool shouldCoalesceVolumeChange(avsCommon::sdkInterfaces::SpeakerManagerObserverInterface::Source source) const;
+
+    /**
+     * Records deferred work for a coalesced volume change, and starts the coalescing timer if it is not running.
+     *
+     * @param persist Whether the configuration needs to be persisted.
+     * @param sendVolumeChangedEvent Whether a @c VolumeChanged event needs to be sent.
+     */
+    void executeScheduleCoalescedChanges(bool persist, bool sendVolumeChangedEvent);
+
+    /**
+     * Persists the configuration and sends the @c VolumeChanged event deferred by coalesced volume changes, using the
+     * current settings.
+     */
+    void executeFlushCoalescedChanges();
+
     /**
      * Helper method to convert internally stored channel state into config format.
      *
@@ -544,6 +568,18 @@ private:
     /// Restore mute state flag from configuration
     bool m_restoreMuteState;
 
+    /// The window used to coalesce local volume changes. Zero disables coalescing.
+    std::chrono::milliseconds m_volumeChangeCoalescingWindow;
+
+    /// Whether a coalesced volume change is waiting to be persisted.
+    bool m_pendingPersist;
+
+    /// Whether a coalesced volume change is waiting to be reported to AVS.
+    bool m_pendingVolumeChangedEvent;
+
+    /// Timer which flushes coalesced volume changes at the end of the coalescing window.
+    avsCommon::utils::timing::Timer m_coalescingTimer;
+
     /// Mapping of each speaker type to its speaker settings.
     std::map<
         avsCommon::sdkInterfaces::ChannelVolumeInterface::Type,
@@ -16,8 +16,10 @@
 #ifndef ALEXA_CLIENT_SDK_CAPABILITYAGENTS_SPEAKERMANAGER_INCLUDE_SPEAKERMANAGER_SPEAKERMANAGERCONFIGHELPER_H_
 #define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_SPEAKERMANAGER_INCLUDE_SPEAKERMANAGER_SPEAKERMANAGERCONFIGHELPER_H_
 
+#include <chrono>
+
 #include <SpeakerManager/SpeakerManagerStorageInterface.h>
-#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationBinding.h>
 
 namespace alexaClientSDK {
 namespace capabilityAgents {
@@ -74,7 +76,30 @@ public:
      */
     bool getRestoreMuteState() const;
 
+    /**
+     * Loads the window used to coalesce local volume changes from configuration. Within the window, volume changes are
+     * applied to the speakers immediately, while persistence and the @c VolumeChanged event are deferred to the
+     * settled value. By default the window is zero, and every change is persisted and reported as it happens.
+     *
+     * @return The coalescing window.
+     */
+    std::chrono::milliseconds getVolumeChangeCoalescingWindow() const;
+
 private:
+    /// Settings read from the platform configuration.
+    struct Settings {
+        /// Default volume of the speaker channel, or @c UNCONFIGURED_VOLUME.
+        int defaultSpeakerVolume;
+        /// Default volume of the alerts channel, or @c UNCONFIGURED_VOLUME.
+        int defaultAlertsVolume;
+        /// Minimum volume level to unmute speakers.
+        int minUnmuteVolume;
+        /// Whether mute status is restored from the last saved state.
+        bool restoreMuteState;
+        /// Window used to coalesce local volume changes.
+        std::chrono::milliseconds volumeChangeCoalescingWindow;
+    };
+
     /**
      * Load channels settings from hardcoded defaults.
      *
@@ -98,6 +123,9 @@ private:
 
     /// Reference to configuration storage interface.
     std::shared_ptr<SpeakerManagerStorageInterface> m_storage;
+
+    /// Binding of @c Settings to the platform configuration, reloaded when the configuration changes.
+    avsCommon::utils::configuration::ConfigurationBinding<Settings> m_settings;
 };
 
 }  // namespace speakerManager
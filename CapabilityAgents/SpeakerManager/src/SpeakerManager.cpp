@@ -213,7 +213,10 @@ SpeakerManager::SpeakerManager(
         m_retryTimer{DEFAULT_RETRY_TABLE},
         m_maxRetries{DEFAULT_RETRY_TABLE.size()},
         m_maximumVolumeLimit{AVS_SET_VOLUME_MAX},
-        m_restoreMuteState{true} {
+        m_restoreMuteState{true},
+        m_volumeChangeCoalescingWindow{0},
+        m_pendingPersist{false},
+        m_pendingVolumeChangedEvent{false} {
     for (auto& groupVolume : groupVolumeInterfaces) {
         addChannelVolumeInterfaceIntoSpeakerMap(groupVolume);
     }
@@ -278,6 +281,9 @@ DirectiveHandlerConfiguration SpeakerManager::getConfiguration() const {
 
 void SpeakerManager::doShutdown() {
     m_waitCancelEvent.wakeUp();
+    m_coalescingTimer.stop();
+    // Coalesced volume changes are flushed, so the settled volume is persisted and reported before shutdown.
+    m_executor.submit([this] { executeFlushCoalescedChanges(); }).wait();
     m_executor.shutdown();
     m_messageSender.reset();
     m_contextManager.reset();
@@ -355,6 +361,11 @@ void SpeakerManager::executeSendSpeakerSettingsChangedEvent(
         return;
     }
 
+    if (VOLUME_CHANGED == eventName) {
+        // This event reports the latest settings, so it replaces any coalesced VolumeChanged event.
+        m_pendingVolumeChangedEvent = false;
+    }
+
     auto event = buildJsonEventString(eventName, "", buffer.GetString());
     auto request = std::make_shared<MessageRequest>(event.second);
     m_messageSender->sendMessage(request);
@@ -658,7 +669,9 @@ bool SpeakerManager::executeSetVolume(
 
     ACSDK_DEBUG(LX("executeSetVolumeSuccess").d("newVolume", static_cast<int>(settings.volume)));
 
-    if (previousVolume != settings.volume) {
+    const bool coalesce = shouldCoalesceVolumeChange(properties.source);
+    const bool persist = previousVolume != settings.volume;
+    if (persist && !coalesce) {
         executePersistConfiguration();
     }
 
@@ -668,11 +681,17 @@ bool SpeakerManager::executeSetVolume(
         executeNotifyObserver(properties.source, type, settings);
     }
 
-    if (properties.notifyAVS && !(previousVolume == settings.volume &&
-                                  SpeakerManagerObserverInterface::Source::LOCAL_API == properties.source)) {
+    const bool notifyAVS =
+        properties.notifyAVS &&
+        !(previousVolume == settings.volume && SpeakerManagerObserverInterface::Source::LOCAL_API == properties.source);
+    if (notifyAVS && !coalesce) {
         executeNotifySettingsChanged(settings, VOLUME_CHANGED, properties.source, type);
     }
 
+    if (coalesce) {
+        executeScheduleCoalescedChanges(persist, notifyAVS && ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME == type);
+    }
+
     return true;
 }
 
@@ -689,6 +708,7 @@ void SpeakerManager::executePersistConfiguration() {
     convertSettingsToChannelState(ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME, &state.speakerChannelState);
     convertSettingsToChannelState(ChannelVolumeInterface::Type::AVS_ALERTS_VOLUME, &state.alertsChannelState);
 
+    m_pendingPersist = false;
     if (!m_config.saveState(state)) {
         ACSDK_ERROR(LX("executePersistConfigurationFailed"));
     } else {
@@ -696,6 +716,39 @@ void SpeakerManager::executePersistConfiguration() {
     }
 }
 
+bool SpeakerManager::shouldCoalesceVolumeChange(SpeakerManagerObserverInterface::Source source) const {
+    return m_volumeChangeCoalescingWindow.count() > 0 && SpeakerManagerObserverInterface::Source::DIRECTIVE != source;
+}
+
+void SpeakerManager::executeScheduleCoalescedChanges(bool persist, bool sendVolumeChangedEvent) {
+    m_pendingPersist = m_pendingPersist || persist;
+    m_pendingVolumeChangedEvent = m_pendingVolumeChangedEvent || sendVolumeChangedEvent;
+    if (!m_pendingPersist && !m_pendingVolumeChangedEvent) {
+        return;
+    }
+
+    // The timer is not restarted by later changes, so a continuous stream of changes is still flushed once per window.
+    // If the timer has fired but is still active, the flush it submitted runs after this change.
+    if (!m_coalescingTimer.isActive()) {
+        m_coalescingTimer.start(m_volumeChangeCoalescingWindow, [this] {
+            m_executor.submit([this] { executeFlushCoalescedChanges(); });
+        });
+    }
+}
+
+void SpeakerManager::executeFlushCoalescedChanges() {
+    if (m_pendingPersist) {
+        executePersistConfiguration();
+    }
+    if (m_pendingVolumeChangedEvent) {
+        executeNotifySettingsChanged(
+            m_speakerSettings[ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME],
+            VOLUME_CHANGED,
+            SpeakerManagerObserverInterface::Source::LOCAL_API,
+            ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME);
+    }
+}
+
 bool SpeakerManager::executeRestoreVolume(
     ChannelVolumeInterface::Type type,
     SpeakerManagerObserverInterface::Source source) {
@@ -826,7 +879,9 @@ bool SpeakerManager::executeAdjustVolume(
 
     ACSDK_DEBUG(LX("executeAdjustVolumeSuccess").d("newVolume", static_cast<int>(settings.volume)));
 
-    if (previousVolume != settings.volume) {
+    const bool coalesce = shouldCoalesceVolumeChange(properties.source);
+    const bool persist = previousVolume != settings.volume;
+    if (persist && !coalesce) {
         executePersistConfiguration();
     }
 
@@ -836,11 +891,17 @@ bool SpeakerManager::executeAdjustVolume(
         executeNotifyObserver(properties.source, type, settings);
     }
 
-    if (properties.notifyAVS && !(previousVolume == settings.volume &&
-                                  SpeakerManagerObserverInterface::Source::LOCAL_API == properties.source)) {
+    const bool notifyAVS =
+        properties.notifyAVS &&
+        !(previousVolume == settings.volume && SpeakerManagerObserverInterface::Source::LOCAL_API == properties.source);
+    if (notifyAVS && !coalesce) {
         executeNotifySettingsChanged(settings, VOLUME_CHANGED, properties.source, type);
     }
 
+    if (coalesce) {
+        executeScheduleCoalescedChanges(persist, notifyAVS && ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME == type);
+    }
+
     return true;
 }
 
@@ -926,6 +987,8 @@ bool SpeakerManager::executeSetMute(
     ACSDK_DEBUG(LX("executeSetMuteSuccess").d("mute", mute));
 
     executePersistConfiguration();
+    // Report coalesced volume changes before the mute change, so AVS receives events in order.
+    executeFlushCoalescedChanges();
 
     updateContextManager(type, settings);
 
@@ -1132,6 +1195,7 @@ void SpeakerManager::loadConfiguration() {
 
     m_minUnmuteVolume = m_config.getMinUnmuteVolume();
     m_restoreMuteState = m_config.getRestoreMuteState();
+    m_volumeChangeCoalescingWindow = m_config.getVolumeChangeCoalescingWindow();
 
     SpeakerManagerStorageState state;
     m_config.loadState(state);
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <limits>
+
 #include <SpeakerManager/SpeakerManager.h>
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
 
@@ -22,17 +24,6 @@ using namespace alexaClientSDK::avsCommon::avs::speakerConstants;
 using namespace alexaClientSDK::capabilityAgents::speakerManager;
 using namespace alexaClientSDK::avsCommon::utils::configuration;
 
-/// String to identify log entries originating from this file.
-static const std::string TAG{"SpeakerManagerConfigHelper"};
-
-/**
- * Create a LogEntry using this file's TAG and the specified event string.
- *
- * @param TAG Component tag.
- * @param evemt The event string for this @c LogEntry.
- */
-#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
-
 /// The key in our config file to find the root of speaker manager configuration.
 static const std::string SPEAKERMANAGER_CONFIGURATION_ROOT_KEY = "speakerManagerCapabilityAgent";
 /// The key in our config file to find the minUnmuteVolume value.
@@ -43,22 +34,32 @@ static const std::string SPEAKERMANAGER_DEFAULT_SPEAKER_VOLUME_KEY = "defaultSpe
 static const std::string SPEAKERMANAGER_DEFAULT_ALERTS_VOLUME_KEY = "defaultAlertsVolume";
 /// The key in our config file to find mute status keep flag
 static const std::string SPEAKERMANAGER_RESTORE_MUTE_STATE_KEY = "restoreMuteState";
+/// The key in our config file to find the window used to coalesce volume changes.
+static const std::string SPEAKERMANAGER_VOLUME_CHANGE_COALESCING_WINDOW_KEY = "volumeChangeCoalescingWindowMs";
+/// By default volume changes are not coalesced.
+static const std::chrono::milliseconds DEFAULT_VOLUME_CHANGE_COALESCING_WINDOW{0};
+/// Marks a default channel volume that is absent from the platform configuration.
+static const int UNCONFIGURED_VOLUME = std::numeric_limits<int>::min();
 
 const SpeakerManagerStorageState SpeakerManagerConfigHelper::c_defaults = {{DEFAULT_SPEAKER_VOLUME, false},
                                                                            {DEFAULT_ALERTS_VOLUME, false}};
 
 SpeakerManagerConfigHelper::SpeakerManagerConfigHelper(const std::shared_ptr<SpeakerManagerStorageInterface>& storage) :
-        m_storage(storage) {
+        m_storage(storage),
+        m_settings({SPEAKERMANAGER_CONFIGURATION_ROOT_KEY}) {
+    m_settings.bindInt(SPEAKERMANAGER_DEFAULT_SPEAKER_VOLUME_KEY, &Settings::defaultSpeakerVolume, UNCONFIGURED_VOLUME)
+        .bindInt(SPEAKERMANAGER_DEFAULT_ALERTS_VOLUME_KEY, &Settings::defaultAlertsVolume, UNCONFIGURED_VOLUME)
+        .bindInt(SPEAKERMANAGER_MIN_UNMUTE_VOLUME_KEY, &Settings::minUnmuteVolume, MIN_UNMUTE_VOLUME)
+        .bindBool(SPEAKERMANAGER_RESTORE_MUTE_STATE_KEY, &Settings::restoreMuteState, true)
+        .bindDuration<std::chrono::milliseconds>(
+            SPEAKERMANAGER_VOLUME_CHANGE_COALESCING_WINDOW_KEY,
+            &Settings::volumeChangeCoalescingWindow,
+            DEFAULT_VOLUME_CHANGE_COALESCING_WINDOW,
+            [](const std::chrono::milliseconds& window) { return window.count() >= 0; });
 }
 
 int SpeakerManagerConfigHelper::getMinUnmuteVolume() const {
-    int minUnmuteVolume = MIN_UNMUTE_VOLUME;
-
-    auto node = ConfigurationNode::getRoot()[SPEAKERMANAGER_CONFIGURATION_ROOT_KEY];
-    // If key is present, then read and initialize the value from config or set to default.
-    node.getInt(SPEAKERMANAGER_MIN_UNMUTE_VOLUME_KEY, &minUnmuteVolume, MIN_UNMUTE_VOLUME);
-
-    return minUnmuteVolume;
+    return m_settings.get()->minUnmuteVolume;
 }
 
 void SpeakerManagerConfigHelper::loadState(SpeakerManagerStorageState& state) {
@@ -72,17 +73,13 @@ bool SpeakerManagerConfigHelper::saveState(const SpeakerManagerStorageState& sta
 }
 
 bool SpeakerManagerConfigHelper::loadStateFromConfig(SpeakerManagerStorageState& state) {
-    int speakerVolume = 0;
-    int alertsVolume = 0;
-
-    auto node = ConfigurationNode::getRoot()[SPEAKERMANAGER_CONFIGURATION_ROOT_KEY];
+    auto settings = m_settings.get();
 
-    if (node.getInt(SPEAKERMANAGER_DEFAULT_SPEAKER_VOLUME_KEY, &speakerVolume) &&
-        node.getInt(SPEAKERMANAGER_DEFAULT_ALERTS_VOLUME_KEY, &alertsVolume)) {
+    if (settings->defaultSpeakerVolume != UNCONFIGURED_VOLUME && settings->defaultAlertsVolume != UNCONFIGURED_VOLUME) {
         state.speakerChannelState.channelMuteStatus = false;
-        state.speakerChannelState.channelVolume = speakerVolume;
+        state.speakerChannelState.channelVolume = settings->defaultSpeakerVolume;
         state.alertsChannelState.channelMuteStatus = false;
-        state.alertsChannelState.channelVolume = alertsVolume;
+        state.alertsChannelState.channelVolume = settings->defaultAlertsVolume;
 
         return true;
     }
@@ -94,11 +91,9 @@ void SpeakerManagerConfigHelper::loadHardcodedState(SpeakerManagerStorageState&
 }
 
 bool SpeakerManagerConfigHelper::getRestoreMuteState() const {
-    auto node = ConfigurationNode::getRoot()[SPEAKERMANAGER_CONFIGURATION_ROOT_KEY];
-    bool result = false;
-    if (node.getBool(SPEAKERMANAGER_RESTORE_MUTE_STATE_KEY, &result)) {
-        return result;
-    } else {
-        return true;
-    }
+    return m_settings.get()->restoreMuteState;
+}
+
+std::chrono::milliseconds SpeakerManagerConfigHelper::getVolumeChangeCoalescingWindow() const {
+    return m_settings.get()->volumeChangeCoalescingWindow;
 }
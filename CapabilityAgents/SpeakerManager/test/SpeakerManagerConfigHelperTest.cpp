@@ -230,6 +230,26 @@ TEST_F(SpeakerManagerConfigHelperTest, test_saveState) {
     ASSERT_FALSE(saved.alertsChannelState.channelMuteStatus);
 }
 
+TEST_F(SpeakerManagerConfigHelperTest, test_getVolumeChangeCoalescingWindow) {
+    ConfigurationNode::uninitialize();
+    ASSERT_TRUE(ConfigurationNode::initialize({}));
+
+    SpeakerManagerConfigHelper helper(m_stubStorage);
+    ASSERT_EQ(std::chrono::milliseconds::zero(), helper.getVolumeChangeCoalescingWindow());
+
+    std::shared_ptr<std::istream> istr(
+        new std::istringstream("{\"speakerManagerCapabilityAgent\":{\"volumeChangeCoalescingWindowMs\":250}}"));
+    ConfigurationNode::uninitialize();
+    ASSERT_TRUE(ConfigurationNode::initialize({istr}));
+    ASSERT_EQ(std::chrono::milliseconds(250), helper.getVolumeChangeCoalescingWindow());
+
+    istr.reset(new std::istringstream("{\"speakerManagerCapabilityAgent\":{\"volumeChangeCoalescingWindowMs\":-1}}"));
+    ConfigurationNode::uninitialize();
+    ASSERT_TRUE(ConfigurationNode::initialize({istr}));
+    ASSERT_EQ(std::chrono::milliseconds::zero(), helper.getVolumeChangeCoalescingWindow());
+    ConfigurationNode::uninitialize();
+}
+
 }  // namespace test
 }  // namespace speakerManager
 }  // namespace capabilityAgents
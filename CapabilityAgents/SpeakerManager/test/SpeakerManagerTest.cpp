@@ -16,6 +16,7 @@
 #include <future>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <vector>
 
 #include <AVSCommon/AVS/Attachment/MockAttachmentManager.h>
@@ -26,6 +27,7 @@
 #include <AVSCommon/SDKInterfaces/MockMessageSender.h>
 #include <AVSCommon/SDKInterfaces/MockSpeakerInterface.h>
 #include <AVSCommon/SDKInterfaces/SpeakerManagerObserverInterface.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
 #include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
 #include <SpeakerManager/SpeakerManagerConstants.h>
@@ -48,6 +50,7 @@ using namespace avsCommon::avs::attachment::test;
 using namespace avsCommon::avs::speakerConstants;
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::sdkInterfaces::test;
+using namespace avsCommon::utils::configuration;
 using namespace avsCommon::utils::memory;
 using namespace rapidjson;
 using namespace ::testing;
@@ -66,6 +69,20 @@ static const std::string VOLUME_PAYLOAD =
     ""
     "}";
 
+/// Configuration which coalesces local volume changes within 500 ms.
+static const std::string COALESCING_CONFIG =
+    "{\"speakerManagerCapabilityAgent\":{\"volumeChangeCoalescingWindowMs\":500}}";
+
+/// Configuration which coalesces local volume changes for longer than any test runs.
+static const std::string LONG_COALESCING_CONFIG =
+    "{\"speakerManagerCapabilityAgent\":{\"volumeChangeCoalescingWindowMs\":60000}}";
+
+/// Number of volume steps in coalescing tests.
+static const int COALESCED_VOLUME_STEPS = 10;
+
+/// Timeout when waiting for coalesced changes to be flushed.
+static const std::chrono::seconds COALESCING_FLUSH_TIMEOUT(5);
+
 /// A @c SetMute payload.
 static const std::string MUTE_PAYLOAD =
     "{"
@@ -983,6 +1000,115 @@ TEST_F(SpeakerManagerTest, testSetMaximumVolumeLimitWithInvalidValue) {
 }
 #endif
 
+/**
+ * Initializes the configuration from a JSON string.
+ *
+ * @param json The configuration.
+ */
+static void initializeConfiguration(const std::string& json) {
+    ConfigurationNode::uninitialize();
+    std::shared_ptr<std::istream> stream(new std::istringstream(json));
+    ASSERT_TRUE(ConfigurationNode::initialize({stream}));
+}
+
+/**
+ * Test that rapid local volume changes are applied to speakers immediately, while persistence and the VolumeChanged
+ * event are coalesced to the settled volume.
+ */
+TEST_F(SpeakerManagerTest, test_coalesceLocalVolumeChanges) {
+    initializeConfiguration(COALESCING_CONFIG);
+    auto channelVolumeInterface = std::make_shared<NiceMock<MockChannelVolumeInterface>>();
+    channelVolumeInterface->DelegateToReal();
+    auto groupVec = std::vector<std::shared_ptr<ChannelVolumeInterface>>{channelVolumeInterface};
+
+    std::promise<std::string> eventPromise;
+    auto eventFuture = eventPromise.get_future();
+    EXPECT_CALL(*m_mockStorage, saveState(_)).Times(1);
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_))
+        .Times(1)
+        .WillOnce(Invoke([&eventPromise](std::shared_ptr<MessageRequest> request) {
+            eventPromise.set_value(request->getJsonContent());
+        }));
+
+    m_speakerManager = SpeakerManager::create(
+        m_mockStorage, groupVec, m_mockContextManager, m_mockMessageSender, m_mockExceptionSender, m_metricRecorder);
+    m_speakerManager->addSpeakerManagerObserver(m_observer);
+    EXPECT_CALL(*m_observer, onSpeakerSettingsChanged(_, _, _)).Times(COALESCED_VOLUME_STEPS);
+
+    SpeakerManagerInterface::NotificationProperties properties;
+    for (int step = 1; step <= COALESCED_VOLUME_STEPS; ++step) {
+        ASSERT_TRUE(
+            m_speakerManager->adjustVolume(ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME, 1, properties).get());
+        SpeakerInterface::SpeakerSettings settings;
+        ASSERT_TRUE(channelVolumeInterface->getSpeakerSettings(&settings));
+        ASSERT_EQ(AVS_SET_VOLUME_MIN + step, settings.volume);
+    }
+
+    ASSERT_EQ(std::future_status::ready, eventFuture.wait_for(COALESCING_FLUSH_TIMEOUT));
+    Document event;
+    ASSERT_FALSE(event.Parse(eventFuture.get()).HasParseError());
+    ASSERT_EQ(VOLUME_CHANGED, std::string(event["event"]["header"]["name"].GetString()));
+    ASSERT_EQ(AVS_SET_VOLUME_MIN + COALESCED_VOLUME_STEPS, event["event"]["payload"]["volume"].GetInt());
+    ASSERT_EQ(AVS_SET_VOLUME_MIN + COALESCED_VOLUME_STEPS, m_mockStorage->m_state.speakerChannelState.channelVolume);
+
+    ConfigurationNode::uninitialize();
+}
+
+/**
+ * Test that volume changes requested by AVS are not coalesced, and report coalesced local changes with them.
+ */
+TEST_F(SpeakerManagerTest, test_directiveVolumeChangesAreNotCoalesced) {
+    initializeConfiguration(LONG_COALESCING_CONFIG);
+    auto groupVec = createChannelVolumeInterfaces();
+
+    EXPECT_CALL(*m_mockStorage, saveState(_)).Times(1);
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_)).Times(1);
+
+    m_speakerManager = SpeakerManager::create(
+        m_mockStorage, groupVec, m_mockContextManager, m_mockMessageSender, m_mockExceptionSender, m_metricRecorder);
+
+    SpeakerManagerInterface::NotificationProperties localProperties;
+    ASSERT_TRUE(
+        m_speakerManager->adjustVolume(ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME, 1, localProperties).get());
+    SpeakerManagerInterface::NotificationProperties directiveProperties(
+        SpeakerManagerObserverInterface::Source::DIRECTIVE);
+    auto future = m_speakerManager->setVolume(
+        ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME, AVS_SET_VOLUME_MAX, directiveProperties);
+    ASSERT_TRUE(future.get());
+
+    // The directive persisted and reported the latest volume, so nothing is left to flush.
+    ASSERT_EQ(AVS_SET_VOLUME_MAX, m_mockStorage->m_state.speakerChannelState.channelVolume);
+    m_speakerManager->shutdown();
+
+    ConfigurationNode::uninitialize();
+}
+
+/**
+ * Test that coalesced volume changes are persisted and reported on shutdown.
+ */
+TEST_F(SpeakerManagerTest, test_coalescedVolumeChangesFlushedOnShutdown) {
+    initializeConfiguration(LONG_COALESCING_CONFIG);
+    auto groupVec = createChannelVolumeInterfaces();
+
+    EXPECT_CALL(*m_mockStorage, saveState(_)).Times(1);
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_)).Times(1);
+
+    m_speakerManager = SpeakerManager::create(
+        m_mockStorage, groupVec, m_mockContextManager, m_mockMessageSender, m_mockExceptionSender, m_metricRecorder);
+
+    SpeakerManagerInterface::NotificationProperties properties;
+    for (int step = 1; step <= COALESCED_VOLUME_STEPS; ++step) {
+        ASSERT_TRUE(
+            m_speakerManager->adjustVolume(ChannelVolumeInterface::Type::AVS_SPEAKER_VOLUME, 1, properties).get());
+    }
+    ASSERT_EQ(AVS_SET_VOLUME_MIN, m_mockStorage->m_state.speakerChannelState.channelVolume);
+
+    m_speakerManager->shutdown();
+    ASSERT_EQ(AVS_SET_VOLUME_MIN + COALESCED_VOLUME_STEPS, m_mockStorage->m_state.speakerChannelState.channelVolume);
+
+    ConfigurationNode::uninitialize();
+}
+
 /**
  * Create different combinations of @c Type for  parameterized tests (TEST_P).
  */
@@ -214,6 +214,10 @@ private:
         /// The @c AttachmentReader from which to read speech audio.
         std::unique_ptr<avsCommon::avs::attachment::AttachmentReader> attachmentReader;
 
+        /// The id of the source set on the @c MediaPlayer during preHandle and not played yet, or
+        /// @c MediaPlayerInterface::ERROR.
+        avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId prerolledSourceId;
+
         /// A flag to indicate if an event needs to be sent to AVS on playback started.
         bool sendPlaybackStartedMessage;
 
@@ -441,6 +445,21 @@ private:
      */
     void startPlaying();
 
+    /**
+     * Set the source of a Speak directive on the @c MediaPlayer and ask it to preroll, so decoding starts while focus
+     * is being acquired. This is only done when the @c MediaPlayer is idle and the directive is the next one to play.
+     *
+     * @param speakInfo The directive to preroll.
+     */
+    void prerollIfIdle(std::shared_ptr<SpeakDirectiveInfo> speakInfo);
+
+    /**
+     * Stop the source prerolled for a Speak directive which will not be played.
+     *
+     * @param speakInfo The directive being discarded.
+     */
+    void discardPrerolledSource(std::shared_ptr<SpeakDirectiveInfo> speakInfo);
+
     /**
      * Stop playing Speak directive audio.
      */
@@ -592,6 +611,13 @@ private:
      */
     avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId m_mediaSourceId;
 
+    /**
+     * Ids of the sources which were set on the @c MediaPlayer during preHandle and have not been played yet. A stop
+     * notification for one of these is expected when the @c MediaPlayer discards it, and is not an error. This is
+     * only accessed from the executor.
+     */
+    std::unordered_set<avsCommon::utils::mediaPlayer::MediaPlayerInterface::SourceId> m_prerolledSourceIds;
+
     /// The last media player offset reportted. This is used to provide the interrupted state information.
     int64_t m_offsetInMilliseconds;
 
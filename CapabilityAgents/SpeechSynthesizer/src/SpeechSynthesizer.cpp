@@ -475,6 +475,7 @@ void SpeechSynthesizer::onBufferUnderrun(SourceId id, const MediaPlayerState&) {
 SpeechSynthesizer::SpeakDirectiveInfo::SpeakDirectiveInfo(std::shared_ptr<DirectiveInfo> directiveInfo) :
         directive{directiveInfo->directive},
         result{directiveInfo->result},
+        prerolledSourceId{MediaPlayerInterface::ERROR},
         sendPlaybackStartedMessage{false},
         sendPlaybackFinishedMessage{false},
         sendCompletedMessage{false},
@@ -487,6 +488,7 @@ SpeechSynthesizer::SpeakDirectiveInfo::SpeakDirectiveInfo(std::shared_ptr<Direct
 
 void SpeechSynthesizer::SpeakDirectiveInfo::clear() {
     attachmentReader.reset();
+    prerolledSourceId = MediaPlayerInterface::ERROR;
     sendPlaybackStartedMessage = false;
     sendPlaybackFinishedMessage = false;
     sendCompletedMessage = false;
@@ -579,6 +581,8 @@ void SpeechSynthesizer::doShutdown() {
         }
     }
 
+    // The executor is stopped and the observer removed, so no stop notification will remove these.
+    m_prerolledSourceIds.clear();
     m_speechPlayer.reset();
     m_waitOnStateChange.notify_one();
     m_messageSender.reset();
@@ -770,6 +774,7 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
     }
 
     addToDirectiveQueue(speakInfo);
+    prerollIfIdle(speakInfo);
 }
 
 void SpeechSynthesizer::executeHandleAfterValidation(std::shared_ptr<SpeakDirectiveInfo> speakInfo) {
@@ -852,6 +857,7 @@ void SpeechSynthesizer::executeCancel(std::shared_ptr<SpeakDirectiveInfo> speakI
     ACSDK_DEBUG(LX(__func__).d("messageId", speakInfo->directive->getMessageId()));
     if (!m_currentInfo || (speakInfo->directive->getMessageId() != m_currentInfo->directive->getMessageId())) {
         ACSDK_DEBUG3(LX(__func__).d("result", "cancelPendingDirective"));
+        discardPrerolledSource(speakInfo);
         speakInfo->clear();
         removeSpeakDirectiveInfo(speakInfo->directive->getMessageId());
         {
@@ -1030,6 +1036,11 @@ void SpeechSynthesizer::executePlaybackStopped(SourceId id) {
 
     // MediaPlayer is for some reason stopping the playback of the speech.
 
+    if (m_prerolledSourceIds.erase(id) && m_mediaSourceId != id) {
+        ACSDK_DEBUG5(LX("executePlaybackStopped").d("result", "ignored").d("reason", "prerolledSourceDiscarded"));
+        return;
+    }
+
     if (m_currentInfo && m_mediaSourceId == id) {
         // Playback stop can happen in a number of cases, including:
         // - CA shutdown.
@@ -1133,10 +1144,58 @@ std::string SpeechSynthesizer::buildPayload(std::string& token) {
     return generator.toString();
 }
 
+void SpeechSynthesizer::prerollIfIdle(std::shared_ptr<SpeakDirectiveInfo> speakInfo) {
+    if (m_currentInfo || MediaPlayerInterface::ERROR != m_mediaSourceId || !speakInfo->attachmentReader) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_speakInfoQueueMutex);
+        if (m_isShuttingDown || m_speakInfoQueue.empty() || m_speakInfoQueue.front() != speakInfo) {
+            return;
+        }
+        for (const auto& info : m_speakInfoQueue) {
+            if (MediaPlayerInterface::ERROR != info->prerolledSourceId) {
+                return;
+            }
+        }
+    }
+
+    auto sourceId = m_speechPlayer->setSource(std::move(speakInfo->attachmentReader));
+    if (MediaPlayerInterface::ERROR == sourceId) {
+        ACSDK_WARN(LX("prerollFailed").d("reason", "setSourceFailed"));
+        return;
+    }
+    speakInfo->prerolledSourceId = sourceId;
+    m_prerolledSourceIds.insert(sourceId);
+    if (!m_speechPlayer->preroll(sourceId)) {
+        // The attachment reader now belongs to the source, so keep it. It is played like a source set in
+        // startPlaying(), only without the decoding done ahead of time.
+        ACSDK_WARN(LX("prerollFailed").d("reason", "prerollNotStarted").d("sourceId", sourceId));
+        return;
+    }
+    ACSDK_DEBUG5(LX("prerollIfIdle").d("messageId", speakInfo->directive->getMessageId()).d("sourceId", sourceId));
+}
+
+void SpeechSynthesizer::discardPrerolledSource(std::shared_ptr<SpeakDirectiveInfo> speakInfo) {
+    if (MediaPlayerInterface::ERROR == speakInfo->prerolledSourceId) {
+        return;
+    }
+    ACSDK_DEBUG5(LX(__func__).d("sourceId", speakInfo->prerolledSourceId));
+    if (!m_speechPlayer->stop(speakInfo->prerolledSourceId)) {
+        // No stop notification will follow, so the id will not be removed when it arrives.
+        m_prerolledSourceIds.erase(speakInfo->prerolledSourceId);
+    }
+    speakInfo->prerolledSourceId = MediaPlayerInterface::ERROR;
+}
+
 void SpeechSynthesizer::startPlaying() {
     ACSDK_DEBUG9(LX("startPlaying"));
     std::shared_ptr<AttachmentReader> attachmentReader;
-    if (m_currentInfo && m_currentInfo->attachmentReader) {
+    if (m_currentInfo && MediaPlayerInterface::ERROR != m_currentInfo->prerolledSourceId) {
+        m_mediaSourceId = m_currentInfo->prerolledSourceId;
+        m_prerolledSourceIds.erase(m_mediaSourceId);
+        m_currentInfo->prerolledSourceId = MediaPlayerInterface::ERROR;
+    } else if (m_currentInfo && m_currentInfo->attachmentReader) {
         attachmentReader = std::move(m_currentInfo->attachmentReader);
         m_mediaSourceId = m_speechPlayer->setSource(std::move(attachmentReader));
     } else {
@@ -1218,6 +1277,7 @@ void SpeechSynthesizer::resetCurrentInfo() {
             removeSpeakDirectiveInfo(directive->getMessageId());
             removeDirective(directive->getMessageId());
         }
+        discardPrerolledSource(m_currentInfo);
         m_currentInfo->clear();
         m_currentInfo.reset();
     }
@@ -1259,6 +1319,7 @@ void SpeechSynthesizer::sendExceptionEncounteredAndReportFailed(
         } else {
             ACSDK_ERROR(LX("sendExceptionEncounteredAndReportFailed").d("reason", "speakInfoHasNoResult"));
         }
+        discardPrerolledSource(speakInfo);
         speakInfo->clear();
     } else {
         ACSDK_ERROR(LX("sendExceptionEncounteredAndReportFailed").d("reason", "speakInfoNotFound"));
@@ -1366,6 +1427,7 @@ void SpeechSynthesizer::clearPendingDirectivesLocked() {
         }
         removeSpeakDirectiveInfo(info->directive->getMessageId());
         removeDirective(info->directive->getMessageId());
+        discardPrerolledSource(info);
         info->clear();
         m_speakInfoQueue.pop_front();
     }
@@ -683,6 +683,110 @@ TEST_F(SpeechSynthesizerTest, test_callingHandle) {
     ASSERT_TRUE(std::future_status::ready == m_wakeSendMessageFuture.wait_for(MY_WAIT_TIMEOUT));
 }
 
+/**
+ * Tests that preHandle prerolls the speech when the @c MediaPlayer is idle.
+ * Call preHandle with a valid SPEAK directive. Expect the source to be set and prerolled before focus is acquired,
+ * and that the prerolled source is played without setting the source again once the focus becomes @c FOREGROUND.
+ */
+TEST_F(SpeechSynthesizerTest, test_preHandlePrerollsSpeech) {
+    auto avsMessageHeader = std::make_shared<AVSMessageHeader>(
+        NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_TEST, DIALOG_REQUEST_ID_TEST);
+    std::shared_ptr<AVSDirective> directive =
+        AVSDirective::create("", avsMessageHeader, PAYLOAD_TEST, m_attachmentManager, CONTEXT_ID_TEST);
+
+    std::promise<MediaPlayerInterface::SourceId> prerollPromise;
+    auto prerollFuture = prerollPromise.get_future();
+    EXPECT_CALL(
+        *(m_mockSpeechPlayer.get()),
+        attachmentSetSource(A<std::shared_ptr<avsCommon::avs::attachment::AttachmentReader>>(), nullptr))
+        .Times(1);
+    EXPECT_CALL(*(m_mockSpeechPlayer.get()), preroll(_))
+        .WillOnce(Invoke([&prerollPromise](MediaPlayerInterface::SourceId id) {
+            prerollPromise.set_value(id);
+            return true;
+        }));
+    EXPECT_CALL(*(m_mockFocusManager.get()), acquireChannel(CHANNEL_NAME, _))
+        .Times(1)
+        .WillOnce(InvokeWithoutArgs(this, &SpeechSynthesizerTest::wakeOnAcquireChannel));
+    EXPECT_CALL(*m_mockPowerResourceManager, acquire(_, _)).Times(AtLeast(1));
+
+    m_speechSynthesizer->CapabilityAgent::preHandleDirective(directive, std::move(m_mockDirHandlerResult));
+    ASSERT_TRUE(std::future_status::ready == prerollFuture.wait_for(MY_WAIT_TIMEOUT));
+    auto prerolledSourceId = prerollFuture.get();
+
+    EXPECT_CALL(*(m_mockSpeechPlayer.get()), play(prerolledSourceId)).Times(1);
+    m_speechSynthesizer->CapabilityAgent::handleDirective(MESSAGE_ID_TEST);
+    ASSERT_TRUE(std::future_status::ready == m_wakeAcquireChannelFuture.wait_for(MY_WAIT_TIMEOUT));
+    m_speechSynthesizer->onFocusChanged(FocusState::FOREGROUND, MixingBehavior::PRIMARY);
+    ASSERT_TRUE(m_mockSpeechPlayer->waitUntilPlaybackStarted());
+}
+
+/**
+ * Tests that the speech is still played when the @c MediaPlayer does not preroll it.
+ * Call preHandle with a valid SPEAK directive and have preroll fail. Expect the source set during preHandle to be played
+ * without setting the source again once the focus becomes @c FOREGROUND.
+ */
+TEST_F(SpeechSynthesizerTest, test_prerollFailurePlaysSourceSetInPreHandle) {
+    auto avsMessageHeader = std::make_shared<AVSMessageHeader>(
+        NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_TEST, DIALOG_REQUEST_ID_TEST);
+    std::shared_ptr<AVSDirective> directive =
+        AVSDirective::create("", avsMessageHeader, PAYLOAD_TEST, m_attachmentManager, CONTEXT_ID_TEST);
+
+    std::promise<MediaPlayerInterface::SourceId> prerollPromise;
+    auto prerollFuture = prerollPromise.get_future();
+    EXPECT_CALL(
+        *(m_mockSpeechPlayer.get()),
+        attachmentSetSource(A<std::shared_ptr<avsCommon::avs::attachment::AttachmentReader>>(), nullptr))
+        .Times(1);
+    EXPECT_CALL(*(m_mockSpeechPlayer.get()), preroll(_))
+        .WillOnce(Invoke([&prerollPromise](MediaPlayerInterface::SourceId id) {
+            prerollPromise.set_value(id);
+            return false;
+        }));
+    EXPECT_CALL(*(m_mockFocusManager.get()), acquireChannel(CHANNEL_NAME, _))
+        .Times(1)
+        .WillOnce(InvokeWithoutArgs(this, &SpeechSynthesizerTest::wakeOnAcquireChannel));
+    EXPECT_CALL(*m_mockPowerResourceManager, acquire(_, _)).Times(AtLeast(1));
+
+    m_speechSynthesizer->CapabilityAgent::preHandleDirective(directive, std::move(m_mockDirHandlerResult));
+    ASSERT_TRUE(std::future_status::ready == prerollFuture.wait_for(MY_WAIT_TIMEOUT));
+    auto sourceId = prerollFuture.get();
+
+    EXPECT_CALL(*(m_mockSpeechPlayer.get()), play(sourceId)).Times(1);
+    m_speechSynthesizer->CapabilityAgent::handleDirective(MESSAGE_ID_TEST);
+    ASSERT_TRUE(std::future_status::ready == m_wakeAcquireChannelFuture.wait_for(MY_WAIT_TIMEOUT));
+    m_speechSynthesizer->onFocusChanged(FocusState::FOREGROUND, MixingBehavior::PRIMARY);
+    ASSERT_TRUE(m_mockSpeechPlayer->waitUntilPlaybackStarted());
+}
+
+/**
+ * Tests that cancelling a prerolled Speak directive stops its source.
+ * Call preHandle with a valid SPEAK directive, then cancelDirective. Expect the prerolled source to be stopped and no
+ * event to be sent.
+ */
+TEST_F(SpeechSynthesizerTest, test_cancelStopsPrerolledSource) {
+    auto avsMessageHeader = std::make_shared<AVSMessageHeader>(
+        NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_TEST, DIALOG_REQUEST_ID_TEST);
+    std::shared_ptr<AVSDirective> directive =
+        AVSDirective::create("", avsMessageHeader, PAYLOAD_TEST, m_attachmentManager, CONTEXT_ID_TEST);
+
+    MediaPlayerInterface::SourceId prerolledSourceId = MediaPlayerInterface::ERROR;
+    std::promise<void> stopPromise;
+    auto stopFuture = stopPromise.get_future();
+    EXPECT_CALL(*(m_mockSpeechPlayer.get()), preroll(_)).WillOnce(DoAll(SaveArg<0>(&prerolledSourceId), Return(true)));
+    EXPECT_CALL(*(m_mockSpeechPlayer.get()), stop(_)).WillOnce(InvokeWithoutArgs([&stopPromise] {
+        stopPromise.set_value();
+        return true;
+    }));
+    EXPECT_CALL(*(m_mockSpeechPlayer.get()), play(_)).Times(0);
+    EXPECT_CALL(*(m_mockMessageSender.get()), sendMessage(_)).Times(0);
+
+    m_speechSynthesizer->CapabilityAgent::preHandleDirective(directive, std::move(m_mockDirHandlerResult));
+    m_speechSynthesizer->CapabilityAgent::cancelDirective(MESSAGE_ID_TEST);
+    ASSERT_TRUE(std::future_status::ready == stopFuture.wait_for(MY_WAIT_TIMEOUT));
+    EXPECT_TRUE(MediaPlayerInterface::ERROR != prerolledSourceId);
+}
+
 /**
  * Tests cancelDirective.
  * Call preHandle with a valid SPEAK directive. Then call cancelDirective. Expect that neither @c setState nor
@@ -17,8 +17,11 @@
 #define ALEXA_CLIENT_SDK_CAPTIONS_IMPLEMENTATION_INCLUDE_CAPTIONS_CAPTIONMANAGER_H_
 
 #include <atomic>
+#include <list>
 #include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <AVSCommon/AVS/FocusState.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
@@ -41,6 +44,7 @@ namespace captions {
  * This class:
  * - routes unparsed caption data to the caption parser
  * - wraps caption text according to how much can fit on the screen, based on CaptionPresenterInterface#getWrapIndex()
+ * - caches the wrapped lines of recently seen caption text, so repeated captions do not need to be measured again
  * - notifies a @c CaptionPresenterInterface when and for how long each @c CaptionFrame should be shown
  * - monitors media players to watch for when captions should be shown and hidden
  * - may receive captions from multiple sources in parallel; caption focus will match with the originating media
@@ -143,6 +147,37 @@ private:
         const std::string& reason,
         CaptionFrame::MediaPlayerSourceId id);
 
+    /**
+     * Look up the wrapped lines of a caption line in the line wrap cache, and mark them as most recently used.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param key The cache key of the caption line.
+     * @param[out] wrappedLines The cached wrapped lines, if found.
+     * @return Whether the caption line was found in the cache.
+     */
+    bool getCachedLineWrapLocked(const std::string& key, std::vector<CaptionLine>* wrappedLines);
+
+    /**
+     * Add the wrapped lines of a caption line to the line wrap cache, evicting the least recently used entry if the
+     * cache is full.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param key The cache key of the caption line.
+     * @param wrappedLines The wrapped lines to cache.
+     */
+    void cacheLineWrapLocked(const std::string& key, const std::vector<CaptionLine>& wrappedLines);
+
+    /// An entry of the line wrap cache.
+    struct LineWrapCacheEntry {
+        /// The cache key of the caption line, built from its text and styles.
+        std::string key;
+
+        /// The lines the caption line was wrapped into.
+        std::vector<CaptionLine> wrappedLines;
+    };
+
     /**
      * A map of @c CaptionTimingAdapter objects by the media source ID they are responsible for.
      *
@@ -155,6 +190,12 @@ private:
     /// The presenter which handles the measuring and display of captions.
     std::shared_ptr<CaptionPresenterInterface> m_presenter;
 
+    /// The line wrap cache entries computed with @c m_presenter, most recently used first.
+    std::list<LineWrapCacheEntry> m_lineWrapCache;
+
+    /// Index of @c m_lineWrapCache by cache key.
+    std::unordered_map<std::string, std::list<LineWrapCacheEntry>::iterator> m_lineWrapCacheIndex;
+
     /// The parsing implementation to convert raw caption data into @c CaptionFrame objects.
     std::shared_ptr<CaptionParserInterface> m_parser;
 
@@ -164,7 +205,7 @@ private:
     /// The media players whose playback states will be used to keep playing media in sync with the associated captions.
     std::vector<std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface>> m_mediaPlayers;
 
-    /// Mutex for accessing the unordered_map objects, m_captionIdCounter, and m_mediaPlayers vector.
+    /// Mutex for accessing the unordered_map objects, m_captionIdCounter, the line wrap cache and m_mediaPlayers vector.
     std::mutex m_mutex;
 };
 
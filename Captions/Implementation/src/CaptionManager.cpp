@@ -39,6 +39,99 @@ static const std::string TAG = "CaptionManager";
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The maximum number of caption lines whose wrapped lines are kept in the line wrap cache.
+static const size_t MAX_LINE_WRAP_CACHE_ENTRIES = 64;
+
+/**
+ * Build the line wrap cache key of a caption line. Two lines with the same text and styles wrap the same way on the
+ * same presenter.
+ *
+ * @param line The caption line.
+ * @return The cache key of @c line.
+ */
+static std::string buildLineWrapCacheKey(const CaptionLine& line) {
+    std::string key;
+    key.reserve(line.text.size() + 1 + line.styles.size() * 8);
+    key.append(line.text);
+    key.push_back('\0');
+    for (const auto& style : line.styles) {
+        key.append(std::to_string(style.charIndex));
+        key.push_back(style.activeStyle.m_bold ? 'b' : '-');
+        key.push_back(style.activeStyle.m_italic ? 'i' : '-');
+        key.push_back(style.activeStyle.m_underline ? 'u' : '-');
+    }
+    return key;
+}
+
+/**
+ * Split a caption line into lines that fit on the presenter's display.
+ *
+ * The presenter is asked once per resulting line where the text stops fitting. The break between words before that
+ * point is then found with a binary search over the space positions of the original text, which are computed once,
+ * since every remaining line is a suffix of it.
+ *
+ * @param line The caption line to wrap.
+ * @param presenter The presenter used to measure the lines.
+ * @return The wrapped lines.
+ */
+static std::vector<CaptionLine> wrapCaptionLine(
+    CaptionLine line,
+    const std::shared_ptr<CaptionPresenterInterface>& presenter) {
+    std::vector<size_t> spaceIndices;
+    for (size_t i = 0; i < line.text.size(); ++i) {
+        if (' ' == line.text[i]) {
+            spaceIndices.push_back(i);
+        }
+    }
+    const size_t originalTextLength = line.text.size();
+
+    std::vector<CaptionLine> wrappedCaptionLines;
+    bool shouldWrap = true;
+    int lineWrapIterationCount = 0;
+    while (shouldWrap && lineWrapIterationCount < CaptionFrame::getLineWrapLimit()) {
+        auto wrapIndexResult = presenter->getWrapIndex(line);
+        shouldWrap = wrapIndexResult.first;
+        if (shouldWrap) {
+            size_t requestedWrapIndex = static_cast<size_t>(wrapIndexResult.second);
+            size_t wrapIndex = requestedWrapIndex;
+
+            // Attempt to split at the last break between words in (0, requestedWrapIndex] of the current line. The
+            // current line starts at lineOffset in the original text.
+            size_t lineOffset = originalTextLength - line.text.size();
+            auto nextSpace = std::upper_bound(spaceIndices.begin(), spaceIndices.end(), lineOffset + requestedWrapIndex);
+            if (nextSpace != spaceIndices.begin() && *std::prev(nextSpace) > lineOffset) {
+                wrapIndex = *std::prev(nextSpace) - lineOffset;
+            }
+
+            // CaptionLine::splitAtTextIndex() should return at least one, but at most two elements in the returned
+            // vector. If one line was returned then no splitting was done, but if two lines are present then the second
+            // line should be checked with the presenter to see if it is also too long to fit on a single line.
+            std::vector<CaptionLine> splitLines = line.splitAtTextIndex(wrapIndex);
+            if (splitLines.size() == 1) {
+                wrappedCaptionLines.emplace_back(std::move(splitLines.front()));
+            } else if (splitLines.size() == 2) {
+                wrappedCaptionLines.emplace_back(std::move(splitLines.front()));
+                line = std::move(splitLines.back());
+            } else {
+                ACSDK_WARN(LX("unexpectedLineSplitResult").d("wrapIndex", wrapIndex).d("lineCount", splitLines.size()));
+                std::move(splitLines.begin(), splitLines.end(), std::back_inserter(wrappedCaptionLines));
+            }
+        }
+        lineWrapIterationCount++;
+    }
+
+    if (shouldWrap) {
+        ACSDK_WARN(LX("exceededLineWrapLimit").d("LineWrapLimit", CaptionFrame::getLineWrapLimit()));
+    }
+
+    // add the remaining unwrapped line
+    if (!line.text.empty()) {
+        wrappedCaptionLines.emplace_back(std::move(line));
+    }
+
+    return wrappedCaptionLines;
+}
+
 CaptionManager::CaptionManager(
     std::shared_ptr<CaptionParserInterface> parser,
     std::shared_ptr<TimingAdapterFactory> timingAdapterFactory) :
@@ -100,6 +193,8 @@ void CaptionManager::setCaptionPresenter(const std::shared_ptr<CaptionPresenterI
     ACSDK_DEBUG7(LX(__func__));
     std::lock_guard<std::mutex> lock(m_mutex);
     m_presenter = presenter;
+    m_lineWrapCache.clear();
+    m_lineWrapCacheIndex.clear();
 }
 
 void CaptionManager::setMediaPlayers(const std::vector<std::shared_ptr<MediaPlayerInterface>>& mediaPlayers) {
@@ -228,57 +323,20 @@ void CaptionManager::onParsed(const CaptionFrame& captionFrame) {
     // text will be displayed on, for example, a television.
     CaptionLine line = CaptionLine::merge(captionFrame.getCaptionLines());
 
-    // find the wrap points and build up the final lines of text
+    // find the wrap points and build up the final lines of text, unless this text was wrapped recently.
     std::vector<CaptionLine> wrappedCaptionLines;
-    std::pair<bool, int> wrapIndexResult;
-    bool shouldWrap = true;
-    int wrapIndex = 0;
-    int lineWrapIterationCount = 0;
-    std::string lineText = line.text;
-    while (shouldWrap && lineWrapIterationCount < CaptionFrame::getLineWrapLimit()) {
-        wrapIndexResult = presenterCopy->getWrapIndex(line);
-        shouldWrap = wrapIndexResult.first;
-        if (shouldWrap) {
-            wrapIndex = wrapIndexResult.second;
-            // Attempt to split at the first available break between words before the requested wrap point.
-            for (size_t i = wrapIndex; i > 0; i--) {
-                if (' ' == lineText[i]) {
-                    wrapIndex = i;
-                    break;
-                }
-            }
-            // No suitable wrap point found, so it's necessary to split in the middle of the word.
-            if (0 == wrapIndex) {
-                wrapIndex = wrapIndexResult.second;
-            }
-
-            // CaptionLine::splitAtTextIndex() should return at least one, but at most two elements in the returned
-            // vector. If one line was returned then no splitting was done, but if two lines are present then the second
-            // line should be checked with the presenter to see if it is also too long to fit on a single line.
-            std::vector<CaptionLine> splitLines = line.splitAtTextIndex(wrapIndex);
-            if (splitLines.size() == 1) {
-                wrappedCaptionLines.emplace_back(splitLines.front());
-            } else if (splitLines.size() == 2) {
-                wrappedCaptionLines.emplace_back(splitLines.front());
-                line = splitLines.back();
-            } else {
-                ACSDK_WARN(LX("unexpectedLineSplitResult").d("wrapIndex", wrapIndex).d("lineCount", splitLines.size()));
-                for (const auto& splitLine : splitLines) {
-                    wrappedCaptionLines.emplace_back(splitLine);
-                }
-            }
+    auto cacheKey = buildLineWrapCacheKey(line);
+    lock.lock();
+    bool isCached = getCachedLineWrapLocked(cacheKey, &wrappedCaptionLines);
+    lock.unlock();
+    if (!isCached) {
+        wrappedCaptionLines = wrapCaptionLine(std::move(line), presenterCopy);
+        lock.lock();
+        // Do not cache lines measured by a presenter which has been replaced in the meantime.
+        if (presenterCopy == m_presenter) {
+            cacheLineWrapLocked(cacheKey, wrappedCaptionLines);
         }
-        lineText = line.text;
-        lineWrapIterationCount++;
-    }
-
-    if (lineWrapIterationCount > CaptionFrame::getLineWrapLimit()) {
-        ACSDK_WARN(LX("exceededLineWrapLimit").d("LineWrapLimit", CaptionFrame::getLineWrapLimit()));
-    }
-
-    // add the remaining unwrapped line
-    if (!line.text.empty()) {
-        wrappedCaptionLines.emplace_back(line);
+        lock.unlock();
     }
 
     // Build up the new caption frame based on the new caption lines
@@ -306,6 +364,28 @@ void CaptionManager::onParsed(const CaptionFrame& captionFrame) {
     ACSDK_DEBUG5(LX("finishedOnParsed"));
 }
 
+bool CaptionManager::getCachedLineWrapLocked(const std::string& key, std::vector<CaptionLine>* wrappedLines) {
+    auto itr = m_lineWrapCacheIndex.find(key);
+    if (itr == m_lineWrapCacheIndex.end()) {
+        return false;
+    }
+    m_lineWrapCache.splice(m_lineWrapCache.begin(), m_lineWrapCache, itr->second);
+    *wrappedLines = itr->second->wrappedLines;
+    return true;
+}
+
+void CaptionManager::cacheLineWrapLocked(const std::string& key, const std::vector<CaptionLine>& wrappedLines) {
+    if (m_lineWrapCacheIndex.count(key) != 0) {
+        return;
+    }
+    if (m_lineWrapCache.size() >= MAX_LINE_WRAP_CACHE_ENTRIES) {
+        m_lineWrapCacheIndex.erase(m_lineWrapCache.back().key);
+        m_lineWrapCache.pop_back();
+    }
+    m_lineWrapCache.push_front({key, wrappedLines});
+    m_lineWrapCacheIndex[key] = m_lineWrapCache.begin();
+}
+
 void CaptionManager::onPlaybackStarted(CaptionFrame::MediaPlayerSourceId id, const MediaPlayerState&) {
     ACSDK_DEBUG3(LX(__func__).d("id", id));
 
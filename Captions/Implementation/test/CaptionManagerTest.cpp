@@ -287,6 +287,57 @@ TEST_F(CaptionManagerTest, test_splitCaptionFrameAtSpaceIndex) {
     caption_manager->onParsed(captionFrame);
 }
 
+/**
+ * Tests that every wrapped line of a caption breaks at the last space before the requested wrap index.
+ */
+TEST_F(CaptionManagerTest, test_splitCaptionFrameMultipleLinesAtLastSpace) {
+    auto mockTimingAdapter = m_timingFactory->getMockTimingAdapter();
+    std::vector<CaptionLine> expectedLines;
+    expectedLines.emplace_back(CaptionLine("one two", {TextStyle()}));
+    expectedLines.emplace_back(CaptionLine("three four", {TextStyle()}));
+    expectedLines.emplace_back(CaptionLine("five", {TextStyle()}));
+    auto expectedCaptionFrame =
+        CaptionFrame(1, std::chrono::milliseconds(1), std::chrono::milliseconds(0), expectedLines);
+    EXPECT_CALL(*m_presenter, getWrapIndex(_))
+        .Times(3)
+        .WillOnce(Return(std::pair<bool, uint32_t>(true, 9)))
+        .WillOnce(Return(std::pair<bool, uint32_t>(true, 11)))
+        .WillOnce(Return(std::pair<bool, uint32_t>(false, 0)));
+    EXPECT_CALL(*mockTimingAdapter, queueForDisplay(expectedCaptionFrame, _)).Times(1);
+
+    std::vector<CaptionLine> lines;
+    lines.emplace_back(CaptionLine("one two three four five", {}));
+    caption_manager->onParsed(CaptionFrame(1, std::chrono::milliseconds(1), std::chrono::milliseconds(0), lines));
+}
+
+/**
+ * Tests that the line wraps of a repeated caption are reused until the presenter is set again.
+ */
+TEST_F(CaptionManagerTest, test_repeatedCaptionUsesCachedLineWrap) {
+    auto mockTimingAdapter = m_timingFactory->getMockTimingAdapter();
+    std::vector<CaptionLine> expectedLines;
+    expectedLines.emplace_back(CaptionLine("The time is", {TextStyle()}));
+    expectedLines.emplace_back(CaptionLine("2:17 PM.", {TextStyle()}));
+    auto expectedCaptionFrame =
+        CaptionFrame(1, std::chrono::milliseconds(1), std::chrono::milliseconds(0), expectedLines);
+    EXPECT_CALL(*m_presenter, getWrapIndex(_))
+        .Times(4)
+        .WillRepeatedly(Invoke([](const CaptionLine& line) {
+            return std::pair<bool, int>(line.text.size() > 12, 12);
+        }));
+    EXPECT_CALL(*mockTimingAdapter, queueForDisplay(expectedCaptionFrame, _)).Times(3);
+
+    std::vector<CaptionLine> lines;
+    lines.emplace_back(CaptionLine("The time is 2:17 PM.", {}));
+    auto captionFrame = CaptionFrame(1, std::chrono::milliseconds(1), std::chrono::milliseconds(0), lines);
+    caption_manager->onParsed(captionFrame);
+    caption_manager->onParsed(captionFrame);
+
+    // Setting the presenter again, e.g. after its display width changed, discards the cached line wraps.
+    caption_manager->setCaptionPresenter(m_presenter);
+    caption_manager->onParsed(captionFrame);
+}
+
 /**
  * Test that CaptionManager::addMediaPlayer() does not add the same media player twice.
  */
@@ -48,7 +48,8 @@ public:
     /**
      * Sets the @c CaptionPresenterInterface instance responsible for measuring styled caption text and displaying or
      * hiding the captions. If called multiple times, the last @c CaptionPresenterInterface set will be the active
-     * presenter.
+     * presenter. Setting a presenter also discards the line wraps computed with the previous one, so this should be
+     * called again with the same presenter if its display width changes.
      *
      * @param presenter The @c CaptionPresenterInterface instance to use for caption text measurement and presentation.
      */
@@ -0,0 +1,105 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_MAPPEDWAVFILE_H_
+#define ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_MAPPEDWAVFILE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+/**
+ * A WAV file mapped into memory, so that its samples can be read without loading the whole file.  Pages are brought
+ * in by the kernel as they are read and may be dropped again under memory pressure, which allows long recordings to be
+ * replayed with a small resident footprint.
+ *
+ * The file must hold audio in the format accepted by @c utils::validateAudioFormat().  Chunks other than "fmt " and
+ * "data" are skipped.
+ */
+class MappedWavFile {
+public:
+    /**
+     * Map a WAV file.
+     *
+     * @param filePath The path of the file.
+     * @return The mapped file, or @c nullptr if it could not be mapped or does not hold supported audio.
+     */
+    static std::unique_ptr<MappedWavFile> create(const std::string& filePath);
+
+    /**
+     * Destructor.  Unmaps the file.
+     */
+    ~MappedWavFile();
+
+    /**
+     * Get the audio samples.  The samples are little endian and may not be aligned for direct access as @c int16_t.
+     *
+     * @return The first byte of the samples.
+     */
+    const void* getSamples() const;
+
+    /**
+     * Get the number of audio samples.
+     *
+     * @return The number of samples.
+     */
+    size_t getSampleCount() const;
+
+    /**
+     * Get the sample rate of the audio.
+     *
+     * @return The sample rate, in Hz.
+     */
+    unsigned int getSampleRateHz() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param mapping The start of the mapping.
+     * @param mappingSize The size of the mapping.
+     */
+    MappedWavFile(void* mapping, size_t mappingSize);
+
+    /**
+     * Find the format and the samples in the mapped file.
+     *
+     * @return Whether the file holds supported audio.
+     */
+    bool parse();
+
+    /// The start of the mapping.
+    void* m_mapping;
+
+    /// The size of the mapping.
+    size_t m_mappingSize;
+
+    /// The first byte of the samples.
+    const unsigned char* m_samples;
+
+    /// The number of samples.
+    size_t m_sampleCount;
+
+    /// The sample rate, in Hz.
+    unsigned int m_sampleRateHz;
+};
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_MAPPEDWAVFILE_H_
@@ -0,0 +1,185 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_WAVFILESTREAMER_H_
+#define ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_WAVFILESTREAMER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AVSCommon/AVS/AudioInputStream.h>
+
+#include "Diagnostics/MappedWavFile.h"
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+/**
+ * Streams a playlist of WAV files into an @c AudioInputStream, for replaying recorded audio through the keyword
+ * detector and @c AudioInputProcessor in soak and regression tests.
+ *
+ * Files are mapped with @c MappedWavFile one at a time as the playlist reaches them, rather than loaded into memory,
+ * so that hours of audio can be replayed.  Each instance writes from its own thread, so several instances can feed the
+ * streams of several clients in parallel.
+ *
+ * Files that cannot be mapped are logged and skipped.
+ */
+class WavFileStreamer {
+public:
+    /// Options controlling how the playlist is streamed.
+    struct Options {
+        /**
+         * Constructor.  The default options stream the playlist once, in real time, in chunks of 10 ms.
+         */
+        Options();
+
+        /**
+         * Playback speed relative to real time.  For example, 2.0 streams twice as fast as real time.  Zero streams
+         * as fast as the stream accepts the audio.
+         */
+        double speed;
+
+        /// Whether to restart the playlist after its last file.
+        bool loop;
+
+        /// Duration of the audio written to the stream at a time.
+        std::chrono::milliseconds chunkDuration;
+    };
+
+    /**
+     * Create a @c WavFileStreamer.  Streaming does not start until @c start() is called.
+     *
+     * @param stream The stream to write to.  Its word size must be 2 bytes.
+     * @param playlist The paths of the WAV files to stream, in order.
+     * @param options Options controlling how the playlist is streamed.
+     * @return The new @c WavFileStreamer, or @c nullptr if the arguments are invalid or no writer could be created.
+     */
+    static std::unique_ptr<WavFileStreamer> create(
+        const std::shared_ptr<avsCommon::avs::AudioInputStream>& stream,
+        const std::vector<std::string>& playlist,
+        const Options& options = Options());
+
+    /**
+     * Destructor.  Stops streaming.
+     */
+    ~WavFileStreamer();
+
+    /**
+     * Start streaming the playlist from the start.
+     *
+     * @return Whether streaming started.  It does not start if it is already in progress.
+     */
+    bool start();
+
+    /**
+     * Stop streaming and wait for the streaming thread to exit.
+     */
+    void stop();
+
+    /**
+     * Wait until the whole playlist has been streamed, @c stop() has been called, or writing failed.  With
+     * @c Options::loop, only the latter two end streaming.
+     *
+     * @param timeout The maximum time to wait.
+     * @return Whether streaming has ended.
+     */
+    bool waitUntilFinished(std::chrono::milliseconds timeout);
+
+    /**
+     * Get the number of samples written to the stream since streaming was last started.
+     *
+     * @return The number of samples written.
+     */
+    uint64_t getSamplesWritten() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param writer The writer of the stream.
+     * @param playlist The paths of the WAV files to stream, in order.
+     * @param options Options controlling how the playlist is streamed.
+     */
+    WavFileStreamer(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Writer> writer,
+        const std::vector<std::string>& playlist,
+        const Options& options);
+
+    /**
+     * Body of the streaming thread.
+     */
+    void streamLoop();
+
+    /**
+     * Stream one file.
+     *
+     * @param file The file to stream.
+     * @return Whether the file was streamed to its end.
+     */
+    bool streamFile(const MappedWavFile& file);
+
+    /**
+     * Wait until the audio written so far has been played out at the configured speed.
+     *
+     * @param sampleRateHz The sample rate of the audio being streamed.
+     * @return Whether streaming should continue.
+     */
+    bool waitForPacing(unsigned int sampleRateHz);
+
+    /// The writer of the stream.
+    const std::shared_ptr<avsCommon::avs::AudioInputStream::Writer> m_writer;
+
+    /// The paths of the WAV files to stream, in order.
+    const std::vector<std::string> m_playlist;
+
+    /// Options controlling how the playlist is streamed.
+    const Options m_options;
+
+    /// Serializes access to @c m_isStopping and @c m_isFinished.
+    std::mutex m_mutex;
+
+    /// Notified when @c m_isStopping or @c m_isFinished is set.
+    std::condition_variable m_wakeTrigger;
+
+    /// Whether @c stop() has been called.
+    bool m_isStopping;
+
+    /// Whether the streaming thread has finished.
+    bool m_isFinished;
+
+    /// When streaming started.
+    std::chrono::steady_clock::time_point m_startTime;
+
+    /// The number of samples written since streaming started.
+    std::atomic<uint64_t> m_samplesWritten;
+
+    /// The streaming thread.
+    std::thread m_thread;
+};
+
+inline WavFileStreamer::Options::Options() : speed{1.0}, loop{false}, chunkDuration{10} {
+}
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_DIAGNOSTICS_INCLUDE_DIAGNOSTICS_WAVFILESTREAMER_H_
@@ -0,0 +1,204 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "Diagnostics/MappedWavFile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/WavUtils.h>
+
+#include "Diagnostics/DiagnosticsUtils.h"
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("MappedWavFile");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Size of a chunk ID or a chunk size in a RIFF file.
+static constexpr size_t RIFF_FIELD_SIZE = 4;
+
+/// Size of the header of each chunk in a RIFF file.
+static constexpr size_t CHUNK_HEADER_SIZE = 2 * RIFF_FIELD_SIZE;
+
+/// Offset of the first chunk after the "RIFF" header.
+static constexpr size_t FIRST_CHUNK_OFFSET = 12;
+
+/// Minimum size of the "fmt " chunk of a PCM file.
+static constexpr size_t MIN_FMT_CHUNK_SIZE = 16;
+
+/// Offset of the audio format within the "fmt " chunk.
+static constexpr size_t FMT_AUDIO_FORMAT_OFFSET = 0;
+
+/// Offset of the number of channels within the "fmt " chunk.
+static constexpr size_t FMT_NUM_CHANNELS_OFFSET = 2;
+
+/// Offset of the sample rate within the "fmt " chunk.
+static constexpr size_t FMT_SAMPLE_RATE_OFFSET = 4;
+
+/// Offset of the bits per sample within the "fmt " chunk.
+static constexpr size_t FMT_BITS_PER_SAMPLE_OFFSET = 14;
+
+/// Size of each sample, in bytes.
+static constexpr size_t BYTES_PER_SAMPLE = 2;
+
+/**
+ * Read a little endian 16 bit value.
+ *
+ * @param data The first byte of the value.
+ * @return The value.
+ */
+static uint16_t readUint16(const unsigned char* data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+/**
+ * Read a little endian 32 bit value.
+ *
+ * @param data The first byte of the value.
+ * @return The value.
+ */
+static uint32_t readUint32(const unsigned char* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+std::unique_ptr<MappedWavFile> MappedWavFile::create(const std::string& filePath) {
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "openFailed").d("path", filePath).d("errno", errno));
+        return nullptr;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "emptyOrUnreadableFile").d("path", filePath));
+        close(fd);
+        return nullptr;
+    }
+
+    auto mappingSize = static_cast<size_t>(fileStat.st_size);
+    auto mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping holds its own reference to the file.
+    close(fd);
+    if (MAP_FAILED == mapping) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "mmapFailed").d("path", filePath).d("errno", errno));
+        return nullptr;
+    }
+    madvise(mapping, mappingSize, MADV_SEQUENTIAL);
+
+    std::unique_ptr<MappedWavFile> file(new MappedWavFile(mapping, mappingSize));
+    if (!file->parse()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "unsupportedFile").d("path", filePath));
+        return nullptr;
+    }
+    return file;
+}
+
+MappedWavFile::~MappedWavFile() {
+    munmap(m_mapping, m_mappingSize);
+}
+
+const void* MappedWavFile::getSamples() const {
+    return m_samples;
+}
+
+size_t MappedWavFile::getSampleCount() const {
+    return m_sampleCount;
+}
+
+unsigned int MappedWavFile::getSampleRateHz() const {
+    return m_sampleRateHz;
+}
+
+MappedWavFile::MappedWavFile(void* mapping, size_t mappingSize) :
+        m_mapping{mapping},
+        m_mappingSize{mappingSize},
+        m_samples{nullptr},
+        m_sampleCount{0},
+        m_sampleRateHz{0} {
+}
+
+bool MappedWavFile::parse() {
+    auto data = static_cast<const unsigned char*>(m_mapping);
+    if (m_mappingSize < FIRST_CHUNK_OFFSET ||
+        memcmp(data, avsCommon::utils::ID_RIFF, RIFF_FIELD_SIZE) != 0 ||
+        memcmp(data + 2 * RIFF_FIELD_SIZE, avsCommon::utils::ID_WAVE, RIFF_FIELD_SIZE) != 0) {
+        ACSDK_ERROR(LX("parseFailed").d("reason", "notRiffWave"));
+        return false;
+    }
+
+    avsCommon::utils::WavHeader header = {};
+    bool hasFormat = false;
+    size_t offset = FIRST_CHUNK_OFFSET;
+    while (offset + CHUNK_HEADER_SIZE <= m_mappingSize) {
+        auto chunkId = data + offset;
+        size_t chunkSize = readUint32(chunkId + RIFF_FIELD_SIZE);
+        auto chunkData = chunkId + CHUNK_HEADER_SIZE;
+        size_t available = m_mappingSize - offset - CHUNK_HEADER_SIZE;
+
+        if (memcmp(chunkId, avsCommon::utils::ID_FMT, RIFF_FIELD_SIZE) == 0) {
+            if (chunkSize < MIN_FMT_CHUNK_SIZE || chunkSize > available) {
+                ACSDK_ERROR(LX("parseFailed").d("reason", "invalidFmtChunk").d("size", chunkSize));
+                return false;
+            }
+            header.audioFormat = readUint16(chunkData + FMT_AUDIO_FORMAT_OFFSET);
+            header.numChannels = readUint16(chunkData + FMT_NUM_CHANNELS_OFFSET);
+            header.sampleRate = readUint32(chunkData + FMT_SAMPLE_RATE_OFFSET);
+            header.bitsPerSample = readUint16(chunkData + FMT_BITS_PER_SAMPLE_OFFSET);
+            hasFormat = true;
+        } else if (memcmp(chunkId, avsCommon::utils::ID_DATA, RIFF_FIELD_SIZE) == 0) {
+            if (!hasFormat) {
+                ACSDK_ERROR(LX("parseFailed").d("reason", "dataBeforeFmt"));
+                return false;
+            }
+            if (!utils::validateAudioFormat(header)) {
+                return false;
+            }
+            // Recorders that were interrupted, or that stream their output, may leave the size unset or too large.
+            m_samples = chunkData;
+            m_sampleCount = std::min(chunkSize, available) / BYTES_PER_SAMPLE;
+            m_sampleRateHz = header.sampleRate;
+            return true;
+        }
+
+        if (chunkSize > available) {
+            break;
+        }
+        // Chunks are padded to an even size.
+        offset += CHUNK_HEADER_SIZE + chunkSize + (chunkSize & 1);
+    }
+
+    ACSDK_ERROR(LX("parseFailed").d("reason", "noDataChunk"));
+    return false;
+}
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
@@ -0,0 +1,205 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "Diagnostics/WavFileStreamer.h"
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace diagnostics {
+
+using avsCommon::avs::AudioInputStream;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("WavFileStreamer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The word size the stream must have, which is the size of a sample.
+static constexpr size_t WORD_SIZE = 2;
+
+/// The timeout of each write, after which the streamer checks whether it has been stopped.
+static const std::chrono::milliseconds WRITE_TIMEOUT{100};
+
+/// Milliseconds per second.
+static constexpr unsigned int MILLISECONDS_PER_SECOND = 1000;
+
+std::unique_ptr<WavFileStreamer> WavFileStreamer::create(
+    const std::shared_ptr<AudioInputStream>& stream,
+    const std::vector<std::string>& playlist,
+    const Options& options) {
+    if (!stream) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullStream"));
+        return nullptr;
+    }
+    if (stream->getWordSize() != WORD_SIZE) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "unsupportedWordSize").d("wordSize", stream->getWordSize()));
+        return nullptr;
+    }
+    if (playlist.empty()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "emptyPlaylist"));
+        return nullptr;
+    }
+    if (options.speed < 0 || options.chunkDuration.count() <= 0) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "invalidOptions")
+                        .d("speed", options.speed)
+                        .d("chunkDurationMs", options.chunkDuration.count()));
+        return nullptr;
+    }
+
+    auto writer = stream->createWriter(AudioInputStream::Writer::Policy::BLOCKING);
+    if (!writer) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "createWriterFailed"));
+        return nullptr;
+    }
+
+    return std::unique_ptr<WavFileStreamer>(new WavFileStreamer(std::move(writer), playlist, options));
+}
+
+WavFileStreamer::~WavFileStreamer() {
+    stop();
+    m_writer->close();
+}
+
+bool WavFileStreamer::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_thread.joinable()) {
+        if (!m_isFinished) {
+            ACSDK_ERROR(LX("startFailed").d("reason", "alreadyStarted"));
+            return false;
+        }
+        m_thread.join();
+    }
+    m_isStopping = false;
+    m_isFinished = false;
+    m_samplesWritten = 0;
+    m_startTime = std::chrono::steady_clock::now();
+    m_thread = std::thread(&WavFileStreamer::streamLoop, this);
+    return true;
+}
+
+void WavFileStreamer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_wakeTrigger.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+bool WavFileStreamer::waitUntilFinished(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_wakeTrigger.wait_for(lock, timeout, [this] { return m_isFinished; });
+}
+
+uint64_t WavFileStreamer::getSamplesWritten() const {
+    return m_samplesWritten;
+}
+
+WavFileStreamer::WavFileStreamer(
+    std::shared_ptr<AudioInputStream::Writer> writer,
+    const std::vector<std::string>& playlist,
+    const Options& options) :
+        m_writer{std::move(writer)},
+        m_playlist{playlist},
+        m_options(options),
+        m_isStopping{false},
+        m_isFinished{false},
+        m_samplesWritten{0} {
+}
+
+void WavFileStreamer::streamLoop() {
+    size_t index = 0;
+    bool hasStreamedFile = false;
+    while (true) {
+        if (m_playlist.size() == index) {
+            // Stop looping if no file in the playlist could be streamed, rather than spinning on the same failures.
+            if (!m_options.loop || !hasStreamedFile) {
+                break;
+            }
+            index = 0;
+            hasStreamedFile = false;
+        }
+
+        const auto& path = m_playlist[index++];
+        auto file = MappedWavFile::create(path);
+        if (!file) {
+            ACSDK_WARN(LX("streamLoop").d("reason", "skippingFile").d("path", path));
+            continue;
+        }
+        ACSDK_DEBUG5(LX("streamLoop").d("path", path).d("samples", file->getSampleCount()));
+        if (!streamFile(*file)) {
+            break;
+        }
+        hasStreamedFile = true;
+    }
+
+    ACSDK_DEBUG5(LX("streamLoopFinished").d("samplesWritten", m_samplesWritten));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isFinished = true;
+    }
+    m_wakeTrigger.notify_all();
+}
+
+bool WavFileStreamer::streamFile(const MappedWavFile& file) {
+    auto samples = static_cast<const unsigned char*>(file.getSamples());
+    auto sampleCount = file.getSampleCount();
+    size_t chunkSamples =
+        std::max<size_t>(1, file.getSampleRateHz() * m_options.chunkDuration.count() / MILLISECONDS_PER_SECOND);
+
+    size_t offset = 0;
+    while (offset < sampleCount) {
+        if (!waitForPacing(file.getSampleRateHz())) {
+            return false;
+        }
+
+        auto toWrite = std::min(chunkSamples, sampleCount - offset);
+        auto result = m_writer->write(samples + offset * WORD_SIZE, toWrite, WRITE_TIMEOUT);
+        if (result > 0) {
+            offset += result;
+            m_samplesWritten += result;
+        } else if (AudioInputStream::Writer::Error::TIMEDOUT != result) {
+            ACSDK_ERROR(LX("streamFileFailed").d("reason", "writeFailed").d("error", result));
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WavFileStreamer::waitForPacing(unsigned int sampleRateHz) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_isStopping || m_options.speed <= 0) {
+        return !m_isStopping;
+    }
+
+    std::chrono::duration<double> playedOut(m_samplesWritten / (sampleRateHz * m_options.speed));
+    auto deadline = m_startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(playedOut);
+    m_wakeTrigger.wait_until(lock, deadline, [this] { return m_isStopping; });
+    return !m_isStopping;
+}
+
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
@@ -0,0 +1,250 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/WavUtils.h>
+#include <Diagnostics/WavFileStreamer.h>
+
+namespace alexaClientSDK {
+namespace diagnostics {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace testing;
+
+/// The sample rate of the test files.
+static constexpr uint32_t SAMPLE_RATE_HZ = 16000;
+
+/// The number of samples in each test file, which is 100 ms of audio.
+static constexpr size_t FILE_SAMPLE_COUNT = SAMPLE_RATE_HZ / 10;
+
+/// The word size of the stream.
+static constexpr size_t WORD_SIZE = 2;
+
+/// The number of words the stream can hold, which is more than any test writes.
+static constexpr size_t STREAM_WORD_COUNT = FILE_SAMPLE_COUNT * 8;
+
+/// Timeout for streaming to finish.
+static const std::chrono::milliseconds FINISH_TIMEOUT{2000};
+
+/// Path that does not hold a file.
+static const std::string MISSING_FILE_PATH = "/nonexistent/WavFileStreamerTest.wav";
+
+/**
+ * Append a little endian value to a byte vector.
+ *
+ * @param value The value.
+ * @param size The number of bytes of the value to append.
+ * @param[out] out The vector to append to.
+ */
+static void appendLittleEndian(uint32_t value, size_t size, std::vector<char>* out) {
+    for (size_t i = 0; i < size; ++i) {
+        out->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+/// Test harness for @c WavFileStreamer.
+class WavFileStreamerTest : public ::testing::Test {
+protected:
+    /// SetUp before each test.
+    void SetUp() override;
+
+    /// TearDown after each test.
+    void TearDown() override;
+
+    /**
+     * Write a WAV file of @c FILE_SAMPLE_COUNT samples, each holding @c value.  A "LIST" chunk precedes the "data"
+     * chunk, as written by many recorders.
+     *
+     * @param value The value of every sample.
+     * @return The path of the file.
+     */
+    std::string writeWavFile(int16_t value);
+
+    /**
+     * Read all the words in the stream.
+     *
+     * @return The words read.
+     */
+    std::vector<int16_t> readAll();
+
+    /// The stream written by the streamer.
+    std::shared_ptr<AudioInputStream> m_stream;
+
+    /// The reader of @c m_stream.
+    std::shared_ptr<AudioInputStream::Reader> m_reader;
+
+    /// The paths of the files written by the test.
+    std::vector<std::string> m_files;
+};
+
+void WavFileStreamerTest::SetUp() {
+    auto bufferSize = AudioInputStream::calculateBufferSize(STREAM_WORD_COUNT, WORD_SIZE, 1);
+    m_stream = AudioInputStream::create(std::make_shared<AudioInputStream::Buffer>(bufferSize), WORD_SIZE, 1);
+    ASSERT_TRUE(m_stream);
+    m_reader = m_stream->createReader(AudioInputStream::Reader::Policy::NONBLOCKING);
+    ASSERT_TRUE(m_reader);
+}
+
+void WavFileStreamerTest::TearDown() {
+    for (const auto& file : m_files) {
+        std::remove(file.c_str());
+    }
+}
+
+std::string WavFileStreamerTest::writeWavFile(int16_t value) {
+    const std::string list = "LIST";
+    const std::string info = "INFO";
+    const uint32_t dataSize = FILE_SAMPLE_COUNT * WORD_SIZE;
+
+    std::vector<char> bytes;
+    bytes.insert(bytes.end(), avsCommon::utils::ID_RIFF, avsCommon::utils::ID_RIFF + 4);
+    appendLittleEndian(4 + (8 + 16) + (8 + 5 + 1) + (8 + dataSize), 4, &bytes);
+    bytes.insert(bytes.end(), avsCommon::utils::ID_WAVE, avsCommon::utils::ID_WAVE + 4);
+    bytes.insert(bytes.end(), avsCommon::utils::ID_FMT, avsCommon::utils::ID_FMT + 4);
+    appendLittleEndian(16, 4, &bytes);
+    appendLittleEndian(avsCommon::utils::FORMAT_PCM, 2, &bytes);
+    appendLittleEndian(1, 2, &bytes);
+    appendLittleEndian(SAMPLE_RATE_HZ, 4, &bytes);
+    appendLittleEndian(SAMPLE_RATE_HZ * WORD_SIZE, 4, &bytes);
+    appendLittleEndian(WORD_SIZE, 2, &bytes);
+    appendLittleEndian(16, 2, &bytes);
+    // An odd sized chunk, which is padded to an even size.
+    bytes.insert(bytes.end(), list.begin(), list.end());
+    appendLittleEndian(5, 4, &bytes);
+    bytes.insert(bytes.end(), info.begin(), info.end());
+    bytes.push_back('x');
+    bytes.push_back(0);
+    bytes.insert(bytes.end(), avsCommon::utils::ID_DATA, avsCommon::utils::ID_DATA + 4);
+    appendLittleEndian(dataSize, 4, &bytes);
+    for (size_t i = 0; i < FILE_SAMPLE_COUNT; ++i) {
+        appendLittleEndian(static_cast<uint16_t>(value), 2, &bytes);
+    }
+
+    auto path = "/tmp/WavFileStreamerTest-" + std::to_string(m_files.size()) + ".wav";
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), bytes.size());
+    file.close();
+    m_files.push_back(path);
+    return path;
+}
+
+std::vector<int16_t> WavFileStreamerTest::readAll() {
+    std::vector<int16_t> words(STREAM_WORD_COUNT);
+    auto result = m_reader->read(words.data(), words.size());
+    words.resize(result > 0 ? result : 0);
+    return words;
+}
+
+/**
+ * Verify that the files of a playlist are streamed in order, and that files which cannot be read are skipped.
+ */
+TEST_F(WavFileStreamerTest, test_streamPlaylistInOrder) {
+    WavFileStreamer::Options options;
+    options.speed = 0;
+    auto streamer = WavFileStreamer::create(m_stream, {writeWavFile(1), MISSING_FILE_PATH, writeWavFile(2)}, options);
+    ASSERT_TRUE(streamer);
+
+    ASSERT_TRUE(streamer->start());
+    ASSERT_TRUE(streamer->waitUntilFinished(FINISH_TIMEOUT));
+    EXPECT_EQ(2 * FILE_SAMPLE_COUNT, streamer->getSamplesWritten());
+
+    auto words = readAll();
+    ASSERT_EQ(2 * FILE_SAMPLE_COUNT, words.size());
+    EXPECT_EQ(1, words.front());
+    EXPECT_EQ(1, words[FILE_SAMPLE_COUNT - 1]);
+    EXPECT_EQ(2, words[FILE_SAMPLE_COUNT]);
+    EXPECT_EQ(2, words.back());
+}
+
+/**
+ * Verify that streaming at real time takes about as long as the audio, and that a faster speed takes less time.
+ */
+TEST_F(WavFileStreamerTest, test_pacing) {
+    auto path = writeWavFile(1);
+
+    auto streamer = WavFileStreamer::create(m_stream, {path, path});
+    ASSERT_TRUE(streamer);
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(streamer->start());
+    ASSERT_TRUE(streamer->waitUntilFinished(FINISH_TIMEOUT));
+    auto realTime = std::chrono::steady_clock::now() - start;
+    // The last chunk is written when the audio before it has played out.
+    EXPECT_GE(realTime, std::chrono::milliseconds(180));
+    streamer.reset();
+
+    WavFileStreamer::Options options;
+    options.speed = 4;
+    streamer = WavFileStreamer::create(m_stream, {path, path}, options);
+    ASSERT_TRUE(streamer);
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(streamer->start());
+    ASSERT_TRUE(streamer->waitUntilFinished(FINISH_TIMEOUT));
+    auto fastTime = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(fastTime, std::chrono::milliseconds(40));
+    EXPECT_LT(fastTime, realTime);
+}
+
+/**
+ * Verify that a looping playlist keeps streaming until it is stopped.
+ */
+TEST_F(WavFileStreamerTest, test_loopUntilStopped) {
+    WavFileStreamer::Options options;
+    options.speed = 10;
+    options.loop = true;
+    auto streamer = WavFileStreamer::create(m_stream, {writeWavFile(1)}, options);
+    ASSERT_TRUE(streamer);
+
+    ASSERT_TRUE(streamer->start());
+    EXPECT_FALSE(streamer->waitUntilFinished(std::chrono::milliseconds(100)));
+    streamer->stop();
+    EXPECT_TRUE(streamer->waitUntilFinished(std::chrono::milliseconds(0)));
+    EXPECT_GT(streamer->getSamplesWritten(), FILE_SAMPLE_COUNT);
+}
+
+/**
+ * Verify that a looping playlist in which no file can be read ends instead of spinning.
+ */
+TEST_F(WavFileStreamerTest, test_loopWithoutReadableFilesEnds) {
+    WavFileStreamer::Options options;
+    options.loop = true;
+    auto streamer = WavFileStreamer::create(m_stream, {MISSING_FILE_PATH}, options);
+    ASSERT_TRUE(streamer);
+
+    ASSERT_TRUE(streamer->start());
+    EXPECT_TRUE(streamer->waitUntilFinished(FINISH_TIMEOUT));
+    EXPECT_EQ(0u, streamer->getSamplesWritten());
+}
+
+/**
+ * Verify that invalid arguments are rejected.
+ */
+TEST_F(WavFileStreamerTest, test_createWithInvalidArguments) {
+    EXPECT_FALSE(WavFileStreamer::create(nullptr, {MISSING_FILE_PATH}));
+    EXPECT_FALSE(WavFileStreamer::create(m_stream, {}));
+
+    WavFileStreamer::Options options;
+    options.speed = -1;
+    EXPECT_FALSE(WavFileStreamer::create(m_stream, {MISSING_FILE_PATH}, options));
+}
+
+}  // namespace test
+}  // namespace diagnostics
+}  // namespace alexaClientSDK
@@ -17,6 +17,7 @@
 #define ALEXA_CLIENT_SDK_ENDPOINTS_INCLUDE_ENDPOINTS_ENDPOINT_H_
 
 #include <list>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <unordered_map>
@@ -33,6 +34,10 @@ namespace endpoints {
 
 /**
  * Provides an implementation for @c EndpointInterface.
+ *
+ * The attributes and capabilities are kept in an immutable snapshot that is replaced, rather than modified, on each
+ * change.  Getters load the current snapshot without taking @c m_mutex, so that the lookups made while routing and
+ * publishing capabilities are not serialized behind registration work.  @c m_mutex only serializes writers.
  */
 class Endpoint : public avsCommon::sdkInterfaces::endpoints::EndpointInterface {
 public:
@@ -111,17 +116,62 @@ public:
         const std::list<std::shared_ptr<avsCommon::utils::RequiresShutdown>>& requireShutdownObjects);
 
 private:
-    /// Mutex used to synchronize members(m_capabilities and m_attributes) access.
-    mutable std::mutex m_mutex;
+    /// Alias for the map of capabilities and the handlers for their directives.
+    using CapabilityMap = std::unordered_map<
+        avsCommon::avs::CapabilityConfiguration,
+        std::shared_ptr<avsCommon::sdkInterfaces::DirectiveHandlerInterface>>;
 
-    /// The endpoint attributes.
-    EndpointAttributes m_attributes;
+    /// An immutable snapshot of the endpoint.
+    struct State {
+        /// The endpoint attributes.
+        EndpointAttributes attributes;
 
-    /// The map of capabilities and the handlers for their directives.
-    std::unordered_map<
-        avsCommon::avs::CapabilityConfiguration,
-        std::shared_ptr<avsCommon::sdkInterfaces::DirectiveHandlerInterface>>
-        m_capabilities;
+        /// The map of capabilities and the handlers for their directives.
+        CapabilityMap capabilities;
+    };
+
+    /**
+     * Add a capability to a snapshot that is being built.
+     *
+     * @param state The snapshot.
+     * @param capabilityConfiguration The capability agent configuration.
+     * @param directiveHandler The @c DirectiveHandler for this capability, or @c nullptr if the interface does not have
+     * any associated directive.
+     * @return @c true if successful; @c false if the capability already exists.
+     */
+    static bool insertCapability(
+        State* state,
+        const avsCommon::avs::CapabilityConfiguration& capabilityConfiguration,
+        std::shared_ptr<avsCommon::sdkInterfaces::DirectiveHandlerInterface> directiveHandler);
+
+    /**
+     * Remove a capability from a snapshot that is being built.
+     *
+     * @param state The snapshot.
+     * @param capabilityConfiguration The capability agent configuration.
+     * @return @c true if successful; @c false if the capability does not exist.
+     */
+    static bool eraseCapability(State* state, const avsCommon::avs::CapabilityConfiguration& capabilityConfiguration);
+
+    /**
+     * Get the current snapshot of the endpoint.
+     *
+     * @return The current snapshot.
+     */
+    std::shared_ptr<const State> loadState() const;
+
+    /**
+     * Replace the current snapshot of the endpoint.  @c m_mutex must be held.
+     *
+     * @param state The new snapshot.
+     */
+    void storeStateLocked(std::shared_ptr<const State> state);
+
+    /// Mutex used to serialize changes to @c m_state.  Readers do not take it.
+    std::mutex m_mutex;
+
+    /// The current snapshot of the endpoint.  Only accessed with @c std::atomic_load and @c std::atomic_store.
+    std::shared_ptr<const State> m_state;
 
     /// The list of objects that require explicit shutdown calls.
     std::set<std::shared_ptr<avsCommon::utils::RequiresShutdown>> m_requireShutdownObjects;
@@ -15,6 +15,7 @@
 #ifndef ALEXA_CLIENT_SDK_ENDPOINTS_INCLUDE_ENDPOINTS_ENDPOINTREGISTRATIONMANAGER_H_
 #define ALEXA_CLIENT_SDK_ENDPOINTS_INCLUDE_ENDPOINTS_ENDPOINTREGISTRATIONMANAGER_H_
 
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <list>
@@ -55,6 +56,18 @@ public:
         avsCommon::sdkInterfaces::endpoints::EndpointRegistrationObserverInterface;
     /// @}
 
+    /**
+     * An immutable, versioned snapshot of the registered endpoints.  A new snapshot is published once per batch of
+     * registration changes, so holders of a snapshot can keep using it without synchronization.
+     */
+    struct EndpointsSnapshot {
+        /// The version of the snapshot, incremented each time a new snapshot is published.
+        uint64_t version;
+
+        /// The registered endpoints.
+        std::unordered_map<EndpointIdentifier, std::shared_ptr<EndpointInterface>> endpoints;
+    };
+
     /**
      * Destructor.
      */
@@ -78,6 +91,21 @@ public:
      */
     void waitForPendingRegistrationsToEnqueue();
 
+    /**
+     * Get the latest snapshot of the registered endpoints.  This does not take the registration lock.
+     *
+     * @return The latest snapshot.  It is never @c nullptr.
+     */
+    std::shared_ptr<const EndpointsSnapshot> getEndpointsSnapshot() const;
+
+    /**
+     * Get a registered endpoint from the latest snapshot.  This does not take the registration lock.
+     *
+     * @param endpointId The @c EndpointIdentifier of the endpoint.
+     * @return The endpoint, or @c nullptr if it is not registered.
+     */
+    std::shared_ptr<EndpointInterface> getEndpoint(const EndpointIdentifier& endpointId) const;
+
     /// @name @c EndpointRegistrationManagerInterface methods.
     /// @{
     std::future<RegistrationResult> registerEndpoint(std::shared_ptr<EndpointInterface> endpoint) override;
@@ -277,6 +305,11 @@ private:
         const std::pair<CapabilityRegistrationProxy::State, std::vector<EndpointIdentifier>>& addedOrUpdatedEndpoints,
         const std::pair<CapabilityRegistrationProxy::State, std::vector<EndpointIdentifier>>& deletedEndpoints);
 
+    /**
+     * Publish a new snapshot built from @c m_endpoints.  @c m_endpointsMutex must be held.
+     */
+    void publishEndpointsSnapshotLocked();
+
     /// Mutex to synchronize access to observers.
     mutable std::mutex m_observersMutex;
 
@@ -292,9 +325,13 @@ private:
     /// Mutex to synchronize access the various maps of endpoints.
     mutable std::mutex m_endpointsMutex;
 
-    /// A map for the endpoints currently registered.
+    /// The working copy of the registered endpoints, from which each snapshot is built.  Guarded by @c m_endpointsMutex;
+    /// lookups go through @c m_endpointsSnapshot instead.
     std::unordered_map<EndpointIdentifier, std::shared_ptr<EndpointInterface>> m_endpoints;
 
+    /// The latest snapshot of @c m_endpoints.  Only accessed with @c std::atomic_load and @c std::atomic_store.
+    std::shared_ptr<const EndpointsSnapshot> m_endpointsSnapshot;
+
     /// A list of ongoing registration.
     std::unordered_map<EndpointIdentifier, PendingRegistration> m_pendingRegistrations;
 
@@ -35,7 +35,8 @@ static const std::string TAG("Endpoint");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-Endpoint::Endpoint(const EndpointAttributes& attributes) : m_attributes(attributes) {
+Endpoint::Endpoint(const EndpointAttributes& attributes) :
+        m_state{std::make_shared<const State>(State{attributes, CapabilityMap()})} {
 }
 
 Endpoint::~Endpoint() {
@@ -49,29 +50,26 @@ void Endpoint::addRequireShutdownObjects(const std::list<std::shared_ptr<Require
 }
 
 Endpoint::EndpointIdentifier Endpoint::getEndpointId() const {
-    std::lock_guard<std::mutex> lock{m_mutex};
-    return m_attributes.endpointId;
+    return loadState()->attributes.endpointId;
 }
 
 AVSDiscoveryEndpointAttributes Endpoint::getAttributes() const {
-    std::lock_guard<std::mutex> lock{m_mutex};
-    return m_attributes;
+    return loadState()->attributes;
 }
 
 std::vector<avsCommon::avs::CapabilityConfiguration> Endpoint::getCapabilityConfigurations() const {
-    std::lock_guard<std::mutex> lock{m_mutex};
+    auto state = loadState();
     std::vector<CapabilityConfiguration> retValue;
-    std::for_each(
-        m_capabilities.begin(), m_capabilities.end(), [&retValue](decltype(m_capabilities)::value_type value) {
-            retValue.push_back(value.first);
-        });
+    retValue.reserve(state->capabilities.size());
+    for (const auto& capability : state->capabilities) {
+        retValue.push_back(capability.first);
+    }
     return retValue;
 }
 
 std::unordered_map<CapabilityConfiguration, std::shared_ptr<avsCommon::sdkInterfaces::DirectiveHandlerInterface>>
 Endpoint::getCapabilities() const {
-    std::lock_guard<std::mutex> lock{m_mutex};
-    return m_capabilities;
+    return loadState()->capabilities;
 }
 
 bool Endpoint::update(const std::shared_ptr<EndpointModificationData>& endpointModificationData) {
@@ -82,7 +80,6 @@ bool Endpoint::update(const std::shared_ptr<EndpointModificationData>& endpointM
     auto deletedCapabilities = endpointModificationData->capabilitiesToRemove;
     auto capabilitiesToShutDown = endpointModificationData->capabilitiesToShutDown;
 
-    // Update endpoint attributes
     if (updatedAttributes.hasValue()) {
         AVSDiscoveryEndpointAttributes newAttributes = updatedAttributes.value();
         if (endpointId != newAttributes.endpointId) {
@@ -93,59 +90,66 @@ bool Endpoint::update(const std::shared_ptr<EndpointModificationData>& endpointM
             ACSDK_ERROR(LX("updateFailed").d("reason", "invalid endpoint attributes"));
             return false;
         }
+    }
 
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_attributes = updatedAttributes.value();
-        lock.unlock();
-    }
-
-    // Update capability configurations
-    for (const auto& capabilityConfiguration : updatedConfigurations) {
-        auto capabilities = getCapabilities();
-        for (const auto& currentCapability : capabilities) {
-            if (currentCapability.first.interfaceName.compare(capabilityConfiguration.interfaceName) == 0 &&
-                currentCapability.first.instanceName.valueOr("").compare(
-                    capabilityConfiguration.instanceName.valueOr("")) == 0) {
-                auto handler = currentCapability.second;
-                if (!removeCapability(currentCapability.first)) {
-                    return false;
-                }
-
-                if ((handler == nullptr && !addCapabilityConfiguration(capabilityConfiguration)) ||
-                    (handler != nullptr && !addCapability(capabilityConfiguration, handler))) {
-                    return false;
-                }
-                ACSDK_DEBUG5(LX("updateCapabilitySucceeded")
-                                 .d("interface", capabilityConfiguration.interfaceName)
-                                 .d("type", capabilityConfiguration.type)
-                                 .d("instance", capabilityConfiguration.instanceName.valueOr("")));
-                break;
+    {
+        // Every change is applied to one copy that is published at the end, so readers never see a partial update,
+        // and a failed update leaves the endpoint unchanged.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto state = std::make_shared<State>(*loadState());
+
+        // Update endpoint attributes
+        if (updatedAttributes.hasValue()) {
+            state->attributes = updatedAttributes.value();
+        }
+
+        // Update capability configurations
+        for (const auto& capabilityConfiguration : updatedConfigurations) {
+            auto currentCapability = std::find_if(
+                state->capabilities.begin(),
+                state->capabilities.end(),
+                [&capabilityConfiguration](const CapabilityMap::value_type& capability) {
+                    return capability.first.interfaceName.compare(capabilityConfiguration.interfaceName) == 0 &&
+                           capability.first.instanceName.valueOr("").compare(
+                               capabilityConfiguration.instanceName.valueOr("")) == 0;
+                });
+            if (state->capabilities.end() == currentCapability) {
+                continue;
+            }
+            auto handler = currentCapability->second;
+            state->capabilities.erase(currentCapability);
+            if (!insertCapability(state.get(), capabilityConfiguration, handler)) {
+                return false;
             }
+            ACSDK_DEBUG5(LX("updateCapabilitySucceeded")
+                             .d("interface", capabilityConfiguration.interfaceName)
+                             .d("type", capabilityConfiguration.type)
+                             .d("instance", capabilityConfiguration.instanceName.valueOr("")));
         }
-    }
 
-    // Add capabilities
-    for (const auto& addedCapability : addedCapabilities) {
-        auto handler = addedCapability.second;
-        if ((handler == nullptr && !addCapabilityConfiguration(addedCapability.first)) ||
-            (handler != nullptr && !addCapability(addedCapability.first, handler))) {
-            return false;
+        // Add capabilities
+        for (const auto& addedCapability : addedCapabilities) {
+            if (!insertCapability(state.get(), addedCapability.first, addedCapability.second)) {
+                return false;
+            }
+            ACSDK_DEBUG5(LX("addCapabilitySucceeded")
+                             .d("interface", addedCapability.first.interfaceName)
+                             .d("type", addedCapability.first.type)
+                             .d("instance", addedCapability.first.instanceName.valueOr("")));
         }
-        ACSDK_DEBUG5(LX("addCapabilitySucceeded")
-                         .d("interface", addedCapability.first.interfaceName)
-                         .d("type", addedCapability.first.type)
-                         .d("instance", addedCapability.first.instanceName.valueOr("")));
-    }
 
-    // Remove capabilities
-    for (const auto& deletedCapability : deletedCapabilities) {
-        if (!removeCapability(deletedCapability)) {
-            return false;
+        // Remove capabilities
+        for (const auto& deletedCapability : deletedCapabilities) {
+            if (!eraseCapability(state.get(), deletedCapability)) {
+                return false;
+            }
+            ACSDK_DEBUG5(LX("removeCapabilitySucceeded")
+                             .d("interface", deletedCapability.interfaceName)
+                             .d("type", deletedCapability.type)
+                             .d("instance", deletedCapability.instanceName.valueOr("")));
         }
-        ACSDK_DEBUG5(LX("removeCapabilitySucceeded")
-                         .d("interface", deletedCapability.interfaceName)
-                         .d("type", deletedCapability.type)
-                         .d("instance", deletedCapability.instanceName.valueOr("")));
+
+        storeStateLocked(std::move(state));
     }
 
     // Add new capabilities needed to shut down
@@ -165,44 +169,31 @@ bool Endpoint::addCapability(
     }
 
     std::lock_guard<std::mutex> lock{m_mutex};
-    if (m_capabilities.find(capabilityConfiguration) != m_capabilities.end()) {
-        ACSDK_ERROR(LX("addCapabilityAgentFailed")
-                        .d("reason", "capabilityAlreadyExists")
-                        .d("interface", capabilityConfiguration.interfaceName)
-                        .d("type", capabilityConfiguration.type)
-                        .d("instance", capabilityConfiguration.instanceName.valueOr("")));
+    auto state = std::make_shared<State>(*loadState());
+    if (!insertCapability(state.get(), capabilityConfiguration, directiveHandler)) {
         return false;
     }
-
-    m_capabilities.insert(std::make_pair(capabilityConfiguration, directiveHandler));
+    storeStateLocked(std::move(state));
     return true;
 }
 
 bool Endpoint::removeCapability(const CapabilityConfiguration& capabilityConfiguration) {
     std::lock_guard<std::mutex> lock{m_mutex};
-    if (m_capabilities.find(capabilityConfiguration) == m_capabilities.end()) {
-        ACSDK_ERROR(LX("removeCapabilityAgentFailed")
-                        .d("reason", "capabilityNotExists")
-                        .d("interface", capabilityConfiguration.interfaceName)
-                        .d("type", capabilityConfiguration.type)
-                        .d("instance", capabilityConfiguration.instanceName.valueOr("")));
+    auto state = std::make_shared<State>(*loadState());
+    if (!eraseCapability(state.get(), capabilityConfiguration)) {
         return false;
     }
-    m_capabilities.erase(capabilityConfiguration);
+    storeStateLocked(std::move(state));
     return true;
 }
 
 bool Endpoint::addCapabilityConfiguration(const CapabilityConfiguration& capabilityConfiguration) {
     std::lock_guard<std::mutex> lock{m_mutex};
-    if (!m_capabilities.insert(std::make_pair(capabilityConfiguration, nullptr)).second) {
-        ACSDK_ERROR(LX("addCapabilityConfigurationFailed")
-                        .d("reason", "capabilityAlreadyExists")
-                        .d("interface", capabilityConfiguration.interfaceName)
-                        .d("type", capabilityConfiguration.type)
-                        .d("instance", capabilityConfiguration.instanceName.valueOr("")));
+    auto state = std::make_shared<State>(*loadState());
+    if (!insertCapability(state.get(), capabilityConfiguration, nullptr)) {
         return false;
     }
-
+    storeStateLocked(std::move(state));
     return true;
 }
 
@@ -248,5 +239,40 @@ bool Endpoint::validateEndpointAttributes(const EndpointAttributes& updatedAttri
     return true;
 }
 
+bool Endpoint::insertCapability(
+    State* state,
+    const CapabilityConfiguration& capabilityConfiguration,
+    std::shared_ptr<avsCommon::sdkInterfaces::DirectiveHandlerInterface> directiveHandler) {
+    if (!state->capabilities.insert(std::make_pair(capabilityConfiguration, directiveHandler)).second) {
+        ACSDK_ERROR(LX(directiveHandler ? "addCapabilityAgentFailed" : "addCapabilityConfigurationFailed")
+                        .d("reason", "capabilityAlreadyExists")
+                        .d("interface", capabilityConfiguration.interfaceName)
+                        .d("type", capabilityConfiguration.type)
+                        .d("instance", capabilityConfiguration.instanceName.valueOr("")));
+        return false;
+    }
+    return true;
+}
+
+bool Endpoint::eraseCapability(State* state, const CapabilityConfiguration& capabilityConfiguration) {
+    if (0 == state->capabilities.erase(capabilityConfiguration)) {
+        ACSDK_ERROR(LX("removeCapabilityAgentFailed")
+                        .d("reason", "capabilityNotExists")
+                        .d("interface", capabilityConfiguration.interfaceName)
+                        .d("type", capabilityConfiguration.type)
+                        .d("instance", capabilityConfiguration.instanceName.valueOr("")));
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<const Endpoint::State> Endpoint::loadState() const {
+    return std::atomic_load(&m_state);
+}
+
+void Endpoint::storeStateLocked(std::shared_ptr<const State> state) {
+    std::atomic_store(&m_state, std::move(state));
+}
+
 }  // namespace endpoints
 }  // namespace alexaClientSDK
@@ -66,6 +66,18 @@ void EndpointRegistrationManager::waitForPendingRegistrationsToEnqueue() {
     waiter.wait();
 }
 
+std::shared_ptr<const EndpointRegistrationManager::EndpointsSnapshot> EndpointRegistrationManager::
+    getEndpointsSnapshot() const {
+    return std::atomic_load(&m_endpointsSnapshot);
+}
+
+std::shared_ptr<EndpointInterface> EndpointRegistrationManager::getEndpoint(
+    const EndpointIdentifier& endpointId) const {
+    auto snapshot = getEndpointsSnapshot();
+    auto it = snapshot->endpoints.find(endpointId);
+    return snapshot->endpoints.end() != it ? it->second : nullptr;
+}
+
 std::future<EndpointRegistrationManager::RegistrationResult> EndpointRegistrationManager::registerEndpoint(
     std::shared_ptr<EndpointInterface> endpoint) {
     ACSDK_DEBUG5(LX(__func__));
@@ -108,7 +120,7 @@ std::future<EndpointRegistrationManager::RegistrationResult> EndpointRegistratio
         return promise.get_future();
     }
 
-    if (m_endpoints.end() != m_endpoints.find(endpointId)) {
+    if (getEndpoint(endpointId)) {
         ACSDK_ERROR(LX("registerEndpointFailed")
                         .d("reason", "endpointAlreadyRegistered")
                         .sensitive("endpointId", endpoint->getEndpointId()));
@@ -152,14 +164,14 @@ std::future<EndpointRegistrationManager::UpdateResult> EndpointRegistrationManag
         return promise.get_future();
     }
 
-    if (m_endpoints.end() == m_endpoints.find(endpointId)) {
+    auto endpoint = getEndpoint(endpointId);
+    if (!endpoint) {
         ACSDK_ERROR(LX("updateEndpoint").d("reason", "endpointNotRegistered").sensitive("endpointId", endpointId));
         std::promise<UpdateResult> promise;
         promise.set_value(UpdateResult::NOT_REGISTERED);
         return promise.get_future();
     }
 
-    auto endpoint = m_endpoints[endpointId];
     m_executor.submit(
         [this, endpoint, endpointModificationData]() { executeUpdateEndpoint(endpoint, endpointModificationData); });
     auto& pending = m_pendingUpdates[endpointId];
@@ -209,7 +221,8 @@ std::future<EndpointRegistrationManager::DeregistrationResult> EndpointRegistrat
         return promise.get_future();
     }
 
-    if (m_endpoints.end() == m_endpoints.find(endpointId)) {
+    auto endpoint = getEndpoint(endpointId);
+    if (!endpoint) {
         ACSDK_ERROR(
             LX("deregisterEndpointFailed").d("reason", "endpointNotRegistered").sensitive("endpointId", endpointId));
         std::promise<DeregistrationResult> promise;
@@ -217,8 +230,6 @@ std::future<EndpointRegistrationManager::DeregistrationResult> EndpointRegistrat
         return promise.get_future();
     }
 
-    auto endpoint = m_endpoints[endpointId];
-
     m_executor.submit([this, endpoint]() { executeDeregisterEndpoint(endpoint); });
 
     auto& pending = m_pendingDeregistrations[endpointId];
@@ -323,13 +334,7 @@ void EndpointRegistrationManager::executeUpdateEndpoint(
     std::unordered_set<std::shared_ptr<DirectiveHandlerInterface>> handlersAdded;
     std::unordered_set<std::shared_ptr<DirectiveHandlerInterface>> handlersRemoved;
     // Create logic that will restore the previous endpoint, in case of any failure while updating the new endpoint.
-    std::shared_ptr<EndpointInterface> previousEndpoint;
-    {
-        std::lock_guard<std::mutex> lock{m_endpointsMutex};
-        if (m_endpoints.end() != m_endpoints.find(endpoint->getEndpointId())) {
-            previousEndpoint = m_endpoints[endpointId];
-        }
-    }
+    auto previousEndpoint = getEndpoint(endpointId);
 
     error::FinallyGuard revertDirectiveRounting([this, &result, previousEndpoint, &handlersRemoved, &handlersAdded] {
         if (result != UpdateResult::SUCCEEDED && previousEndpoint) {
@@ -343,6 +348,7 @@ void EndpointRegistrationManager::executeUpdateEndpoint(
             }
             std::lock_guard<std::mutex> lock{m_endpointsMutex};
             m_endpoints[endpointId] = previousEndpoint;
+            publishEndpointsSnapshotLocked();
         }
     });
 
@@ -485,6 +491,7 @@ EndpointRegistrationManager::EndpointRegistrationManager(
         RequiresShutdown("EndpointRegistrationManager"),
         m_directiveSequencer{directiveSequencer},
         m_capabilitiesDelegate{capabilitiesDelegate},
+        m_endpointsSnapshot{std::make_shared<const EndpointsSnapshot>(EndpointsSnapshot{0, {}})},
         m_defaultEndpointId{defaultEndpointId},
         m_capabilityRegistrationProxy{std::make_shared<CapabilityRegistrationProxy>()} {
     m_capabilityRegistrationProxy->setCallback(std::bind(
@@ -574,7 +581,9 @@ void EndpointRegistrationManager::doShutdown() {
 
     m_capabilitiesDelegate->removeCapabilitiesObserver(m_capabilityRegistrationProxy);
 
+    std::lock_guard<std::mutex> lock{m_endpointsMutex};
     m_endpoints.clear();
+    publishEndpointsSnapshotLocked();
     m_pendingRegistrations.clear();
     m_pendingDeregistrations.clear();
     m_pendingUpdates.clear();
@@ -614,6 +623,7 @@ void EndpointRegistrationManager::updateAddedOrUpdatedEndpoints(
         addEndpointIdToAttributesPairs, updatedEndpointIdToAttributesPairs;
     {
         std::lock_guard<std::mutex> lock{m_endpointsMutex};
+        bool endpointsChanged = false;
         for (auto& addedOrUpdatedId : addedOrUpdatedEndpoints.second) {
             auto pendingRegistrationEndpointId = m_pendingRegistrations.find(addedOrUpdatedId);
             auto pendingUpdateEndpointId = m_pendingUpdates.find(addedOrUpdatedId);
@@ -629,6 +639,7 @@ void EndpointRegistrationManager::updateAddedOrUpdatedEndpoints(
                 if (RegistrationResult::SUCCEEDED == registrationResult) {
                     ACSDK_DEBUG9(LX(__func__).d("result", "success").sensitive("endpointId", addedOrUpdatedId));
                     m_endpoints[addedOrUpdatedId] = endpoint;
+                    endpointsChanged = true;
                 } else {
                     ACSDK_ERROR(LX(__func__).d("result", "failed").sensitive("endpointId", addedOrUpdatedId));
 
@@ -651,6 +662,7 @@ void EndpointRegistrationManager::updateAddedOrUpdatedEndpoints(
                 if (UpdateResult::SUCCEEDED == updateResult) {
                     ACSDK_DEBUG9(LX(__func__).d("result", "success").sensitive("endpointId", addedOrUpdatedId));
                     m_endpoints[addedOrUpdatedId] = endpoint;
+                    endpointsChanged = true;
                 } else {
                     ACSDK_ERROR(LX(__func__).d("result", "failed").sensitive("endpointId", addedOrUpdatedId));
 
@@ -664,6 +676,7 @@ void EndpointRegistrationManager::updateAddedOrUpdatedEndpoints(
                     if ((m_endpoints.end() != originalEndpoint) && !addCapabilities(originalEndpoint->second)) {
                         ACSDK_ERROR((LX("failedToRestorePreviousEndpoint").d("result", "removingPreviousEndpoint")));
                         m_endpoints.erase(addedOrUpdatedId);
+                        endpointsChanged = true;
                     }
                 }
                 m_pendingUpdates.erase(addedOrUpdatedId);
@@ -673,6 +686,9 @@ void EndpointRegistrationManager::updateAddedOrUpdatedEndpoints(
                                .sensitive("endpointId", addedOrUpdatedId));
             }
         }
+        if (endpointsChanged) {
+            publishEndpointsSnapshotLocked();
+        }
     }
 
     /// Notify observers.
@@ -704,6 +720,7 @@ void EndpointRegistrationManager::removeDeletedEndpoints(
     /// Remove deleted endpoints.
     {
         std::lock_guard<std::mutex> lock{m_endpointsMutex};
+        bool endpointsChanged = false;
         for (auto& deletedId : deletedEndpoints.second) {
             auto pendingEndpointId = m_pendingDeregistrations.find(deletedId);
             if (m_pendingDeregistrations.end() != pendingEndpointId) {
@@ -714,6 +731,7 @@ void EndpointRegistrationManager::removeDeletedEndpoints(
                 if (DeregistrationResult::SUCCEEDED == deregistrationResult) {
                     ACSDK_DEBUG5(LX(__func__).d("result", "success").sensitive("endpointId", deletedId));
                     m_endpoints.erase(deletedId);
+                    endpointsChanged = true;
                 } else {
                     /// If deregistration failed, restore the previous endpoint.
                     auto previousEndpoint = m_endpoints.find(deletedId);
@@ -722,6 +740,7 @@ void EndpointRegistrationManager::removeDeletedEndpoints(
                                          .d("result", "removingEndpoint")
                                          .sensitive("endpointId", deletedId)));
                         m_endpoints.erase(deletedId);
+                        endpointsChanged = true;
                     } else {
                         ACSDK_ERROR((LX("deregisterEndpointFailed")
                                          .d("result", "restoringEndpoint")
@@ -737,6 +756,9 @@ void EndpointRegistrationManager::removeDeletedEndpoints(
                 }
             }
         }
+        if (endpointsChanged) {
+            publishEndpointsSnapshotLocked();
+        }
     }
 
     /// Notify observers.
@@ -860,5 +882,13 @@ bool EndpointRegistrationManager::removeCapabilities(const std::shared_ptr<Endpo
     return removeCapabilities(endpoint, &handlersRemoved);
 }
 
+void EndpointRegistrationManager::publishEndpointsSnapshotLocked() {
+    // The next snapshot is built while only writers are blocked; readers keep using the previous one until the swap.
+    auto version = std::atomic_load(&m_endpointsSnapshot)->version + 1;
+    std::atomic_store(
+        &m_endpointsSnapshot, std::make_shared<const EndpointsSnapshot>(EndpointsSnapshot{version, m_endpoints}));
+    ACSDK_DEBUG9(LX(__func__).d("version", version).d("endpoints", m_endpoints.size()));
+}
+
 }  // namespace endpoints
 }  // namespace alexaClientSDK
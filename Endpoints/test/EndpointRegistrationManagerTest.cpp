@@ -277,6 +277,72 @@ TEST_F(EndpointRegistrationManagerTest, test_deregisterEndpointSucceeds) {
     EXPECT_EQ(deleteResult.get(), DeregistrationResult::SUCCEEDED);
 }
 
+/*
+ * Test that a batch of registrations publishes a single new snapshot, and that earlier snapshots are not modified.
+ */
+TEST_F(EndpointRegistrationManagerTest, test_endpointsSnapshotPublishedPerBatch) {
+    auto initialSnapshot = m_manager->getEndpointsSnapshot();
+    ASSERT_THAT(initialSnapshot, NotNull());
+    EXPECT_TRUE(initialSnapshot->endpoints.empty());
+
+    // Register two endpoints in the same batch.
+    auto endpoint1 = std::make_shared<MockEndpoint>();
+    auto endpoint2 = std::make_shared<MockEndpoint>();
+    EndpointIdentifier endpointId1 = "EndpointId1";
+    EndpointIdentifier endpointId2 = "EndpointId2";
+    validateEndpointConfiguration(endpoint1, endpointId1);
+    validateEndpointConfiguration(endpoint2, endpointId2);
+    EXPECT_CALL(*m_capabilitiesDelegate, addOrUpdateEndpoint(_, _)).Times(2).WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_registrationObserver, onEndpointRegistration(_, _, RegistrationResult::SUCCEEDED)).Times(2);
+    EXPECT_CALL(*m_registrationObserver, onPendingEndpointRegistrationOrUpdate(_, _, _)).Times(2);
+
+    auto result1 = m_manager->registerEndpoint(endpoint1);
+    auto result2 = m_manager->registerEndpoint(endpoint2);
+    m_manager->waitForPendingRegistrationsToEnqueue();
+    EXPECT_EQ(m_manager->getEndpointsSnapshot(), initialSnapshot);
+
+    m_capabilitiesObserver->onCapabilitiesStateChange(
+        CapabilitiesDelegateObserverInterface::State::SUCCESS,
+        CapabilitiesDelegateObserverInterface::Error::SUCCESS,
+        {endpointId1, endpointId2},
+        {});
+    ASSERT_EQ(result1.wait_for(MY_WAIT_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(result2.wait_for(MY_WAIT_TIMEOUT), std::future_status::ready);
+    m_manager->waitForPendingRegistrationsToEnqueue();
+
+    auto registeredSnapshot = m_manager->getEndpointsSnapshot();
+    EXPECT_EQ(registeredSnapshot->version, initialSnapshot->version + 1);
+    EXPECT_EQ(registeredSnapshot->endpoints.size(), 2u);
+    EXPECT_EQ(m_manager->getEndpoint(endpointId1), endpoint1);
+    EXPECT_EQ(m_manager->getEndpoint(endpointId2), endpoint2);
+    EXPECT_TRUE(initialSnapshot->endpoints.empty());
+
+    // Deregister one of them.
+    EXPECT_CALL(*m_capabilitiesDelegate, deleteEndpoint(_, _)).WillOnce(Return(true));
+    EXPECT_CALL(*m_registrationObserver, onEndpointDeregistration(endpointId1, DeregistrationResult::SUCCEEDED));
+    auto deleteResult = m_manager->deregisterEndpoint(endpointId1);
+    m_capabilitiesObserver->onCapabilitiesStateChange(
+        CapabilitiesDelegateObserverInterface::State::SUCCESS,
+        CapabilitiesDelegateObserverInterface::Error::SUCCESS,
+        {},
+        {endpointId1});
+    ASSERT_EQ(deleteResult.wait_for(MY_WAIT_TIMEOUT), std::future_status::ready);
+    m_manager->waitForPendingRegistrationsToEnqueue();
+
+    auto deregisteredSnapshot = m_manager->getEndpointsSnapshot();
+    EXPECT_EQ(deregisteredSnapshot->version, registeredSnapshot->version + 1);
+    EXPECT_THAT(m_manager->getEndpoint(endpointId1), IsNull());
+    EXPECT_EQ(m_manager->getEndpoint(endpointId2), endpoint2);
+    EXPECT_EQ(registeredSnapshot->endpoints.size(), 2u);
+
+    // Registration and update requests are checked against the published snapshot.
+    EXPECT_EQ(m_manager->registerEndpoint(endpoint2).get(), RegistrationResult::ALREADY_REGISTERED);
+    auto updatedData = std::make_shared<EndpointModificationData>(EndpointModificationData(
+        endpointId1, avsCommon::utils::Optional<AVSDiscoveryEndpointAttributes>(), {}, {}, {}, {}));
+    EXPECT_EQ(m_manager->updateEndpoint(endpointId1, updatedData).get(), UpdateResult::NOT_REGISTERED);
+    EXPECT_EQ(m_manager->deregisterEndpoint(endpointId1).get(), DeregistrationResult::NOT_REGISTERED);
+}
+
 /*
  * Test updating an endpoint happy path.
  */
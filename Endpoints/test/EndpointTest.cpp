@@ -199,6 +199,28 @@ TEST_F(EndpointTest, test_updateSameInterfaceDifferentInstances) {
     ASSERT_TRUE(endpoint->getCapabilities().begin()->first.instanceName.value() == "TV.1");
 }
 
+/**
+ * Tests @c update with new attributes and the removal of a capability that does not exist, expecting @c update to fail
+ * and to leave both the attributes and the capabilities unchanged.
+ */
+TEST_F(EndpointTest, test_failedUpdateLeavesEndpointUnchanged) {
+    auto attributes = createValidAttributes();
+    auto endpoint = std::make_shared<Endpoint>(attributes);
+    endpoint->addCapabilityConfiguration(CAPABILITY_CONFIGURATION);
+
+    auto updatedAttributes = attributes;
+    updatedAttributes.friendlyName = "UPDATED_FRIENDLY_NAME";
+    const CapabilityConfiguration missingCapabilityConfiguration =
+        CapabilityConfiguration({"TEST_TYPE", "MISSING_INTERFACE_NAME", "2.0"});
+    auto endpointModificationData = std::make_shared<EndpointModificationData>(EndpointModificationData(
+        "TEST_ENDPOINT_ID", updatedAttributes, {}, {}, {CAPABILITY_CONFIGURATION, missingCapabilityConfiguration}, {}));
+    ASSERT_FALSE(endpoint->update(endpointModificationData));
+
+    EXPECT_EQ(endpoint->getAttributes().friendlyName, attributes.friendlyName);
+    ASSERT_EQ(endpoint->getCapabilities().size(), 1u);
+    EXPECT_EQ(endpoint->getCapabilities().begin()->first, CAPABILITY_CONFIGURATION);
+}
+
 /**
  * Tests @c addCapability with a null directive handler, expecting @c addCapability to fail and to return @c false.
  */
@@ -0,0 +1,287 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_INTEGRATION_INCLUDE_INTEGRATION_LOCALAVSSERVER_H_
+#define ALEXA_CLIENT_SDK_INTEGRATION_INCLUDE_INTEGRATION_LOCALAVSSERVER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <AVSCommon/Utils/HTTP2/HTTP2ConnectionFactoryInterface.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2ConnectionInterface.h>
+
+namespace alexaClientSDK {
+namespace integration {
+namespace test {
+
+/**
+ * A local stand-in for @c AVS, used to measure latency and load without a live endpoint or credentials.
+ *
+ * The server is an @c HTTP2ConnectionFactoryInterface, so it replaces @c LibcurlHTTP2ConnectionFactory in the
+ * transport stack. Each connection created by the factory serves requests in process, with the same request and
+ * response callbacks a real HTTP/2 connection makes:
+ * <ul>
+ * <li>Downchannel requests receive a 200 response, and stay open to deliver directives pushed with
+ * @c pushDirective.</li>
+ * <li>Event requests are read completely, then answered with the directives scripted for the event with
+ * @c setEventResponse, or with a 204 response if there is no script.</li>
+ * <li>Ping requests receive a 204 response.</li>
+ * </ul>
+ *
+ * Responses can be delayed, and event responses dropped, with @c setFaultInjection. A dropped event finishes with
+ * @c HTTP2ResponseFinishedStatus::INTERNAL_ERROR and no response code, as a reset stream would.
+ *
+ * The server records timestamps for every event, so tests can compute end-to-end latencies. One server can serve any
+ * number of connections, which lets one process simulate many clients.
+ *
+ * This class is thread safe.
+ */
+class LocalAVSServer
+        : public avsCommon::utils::http2::HTTP2ConnectionFactoryInterface
+        , public std::enable_shared_from_this<LocalAVSServer> {
+public:
+    /// An attachment sent after a directive.
+    struct Attachment {
+        /// The Content-ID of the attachment, without the "cid:" prefix.
+        std::string contentId;
+        /// The attachment data.
+        std::string data;
+    };
+
+    /**
+     * A scripted directive.
+     *
+     * The directive JSON may contain placeholders which are replaced when the directive is sent: @c ${messageId} is
+     * replaced with a unique ID, and @c ${dialogRequestId} with the dialog request ID of the event being answered.
+     */
+    struct Directive {
+        /// The directive JSON.
+        std::string json;
+        /// Attachments to send after the directive.
+        std::vector<Attachment> attachments;
+    };
+
+    /// Faults injected into responses.
+    struct FaultInjection {
+        /// Delay added before every response and every pushed directive.
+        std::chrono::milliseconds responseDelay{0};
+        /// Probability in the range [0, 1] of dropping an event response.
+        double eventLossRate{0.0};
+    };
+
+    /// Timestamps and identity of an event received by the server.
+    struct EventRecord {
+        /// The namespace of the event.
+        std::string eventNamespace;
+        /// The name of the event.
+        std::string name;
+        /// The message ID of the event.
+        std::string messageId;
+        /// The dialog request ID of the event, if any.
+        std::string dialogRequestId;
+        /// When the request was created.
+        std::chrono::steady_clock::time_point requestStart;
+        /// When the first byte of the first attachment was received. Equals @c requestStart if there is none.
+        std::chrono::steady_clock::time_point firstAttachmentByte;
+        /// When the request body was complete.
+        std::chrono::steady_clock::time_point bodyComplete;
+        /// When the response code was sent. Equals @c bodyComplete if the response was dropped.
+        std::chrono::steady_clock::time_point responseStart;
+        /// Whether the event carried an attachment.
+        bool hasAttachment;
+        /// Whether the response was dropped.
+        bool lost;
+    };
+
+    /**
+     * Creates a @c LocalAVSServer.
+     *
+     * @param seed Seed for the random generator used for fault injection, so runs are repeatable.
+     * @return A new @c LocalAVSServer.
+     */
+    static std::shared_ptr<LocalAVSServer> create(uint32_t seed = 0);
+
+    /**
+     * Scripts the directives sent in response to an event.
+     *
+     * @param eventNamespace The namespace of the event.
+     * @param eventName The name of the event.
+     * @param directives The directives to send. An empty list makes the event receive a 204 response.
+     */
+    void setEventResponse(
+        const std::string& eventNamespace,
+        const std::string& eventName,
+        const std::vector<Directive>& directives);
+
+    /**
+     * Sets the faults injected into responses sent after this call.
+     *
+     * @param faultInjection The faults to inject.
+     */
+    void setFaultInjection(const FaultInjection& faultInjection);
+
+    /**
+     * Sends a directive on every open downchannel.
+     *
+     * @param directive The directive to send.
+     * @return The number of downchannels the directive was queued on.
+     */
+    size_t pushDirective(const Directive& directive);
+
+    /**
+     * Waits until a number of downchannels are open.
+     *
+     * @param count The number of downchannels to wait for.
+     * @param timeout The maximum time to wait.
+     * @return Whether @c count downchannels were open before the timeout.
+     */
+    bool waitForDownchannels(size_t count, std::chrono::milliseconds timeout);
+
+    /**
+     * Waits until an event has been answered or dropped.
+     *
+     * @param messageId The message ID of the event.
+     * @param timeout The maximum time to wait.
+     * @param[out] record The record of the event.
+     * @return Whether the event was answered or dropped before the timeout.
+     */
+    bool waitForEvent(const std::string& messageId, std::chrono::milliseconds timeout, EventRecord* record);
+
+    /**
+     * Gets the records of all events which have been answered or dropped.
+     *
+     * @return The event records, in the order the responses were sent.
+     */
+    std::vector<EventRecord> getEventRecords();
+
+    /**
+     * Gets the number of ping requests served.
+     *
+     * @return The number of pings.
+     */
+    size_t getPingCount();
+
+    /// @name HTTP2ConnectionFactoryInterface methods.
+    /// @{
+    std::shared_ptr<avsCommon::utils::http2::HTTP2ConnectionInterface> createHTTP2Connection() override;
+    /// @}
+
+private:
+    /// Forward declaration of the connection implementation.
+    class Connection;
+
+    /// Forward declaration of the request implementation.
+    class Request;
+
+    /// A response computed for an event.
+    struct EventResponse {
+        /// The HTTP response code.
+        long responseCode;
+        /// The response body.
+        std::string body;
+        /// Whether to drop the response.
+        bool lost;
+        /// When to send the response.
+        std::chrono::steady_clock::time_point sendTime;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param seed Seed for the random generator used for fault injection.
+     */
+    explicit LocalAVSServer(uint32_t seed);
+
+    /**
+     * Computes the response to a complete event request.
+     *
+     * @param requestBoundary The MIME boundary of the request body.
+     * @param body The request body.
+     * @param[in,out] record The record of the event, with timestamps filled in by the connection. The identity of the
+     * event is filled in from the body.
+     * @return The response to send.
+     */
+    EventResponse handleEvent(const std::string& requestBoundary, const std::string& body, EventRecord* record);
+
+    /**
+     * Records that the response to an event has been sent or dropped.
+     *
+     * @param messageId The message ID of the event.
+     * @param responseStart When the response code was sent.
+     */
+    void onEventResponseStarted(const std::string& messageId, std::chrono::steady_clock::time_point responseStart);
+
+    /// Records a served ping.
+    void onPing();
+
+    /**
+     * Gets the delay added before responses.
+     *
+     * @return The response delay.
+     */
+    std::chrono::milliseconds getResponseDelay();
+
+    /**
+     * Encodes a directive and its attachments as MIME parts, each followed by a boundary.
+     *
+     * @param directive The directive to encode.
+     * @param dialogRequestId The value for the @c ${dialogRequestId} placeholder.
+     * @return The encoded parts.
+     */
+    std::string encodeDirective(const Directive& directive, const std::string& dialogRequestId);
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when a downchannel opens or an event record is complete.
+    std::condition_variable m_wakeTrigger;
+
+    /// Random generator for fault injection.
+    std::mt19937 m_random;
+
+    /// The faults to inject.
+    FaultInjection m_faultInjection;
+
+    /// Scripted directives, keyed by "namespace.name" of the event.
+    std::map<std::string, std::vector<Directive>> m_eventResponses;
+
+    /// Connections created by this factory.
+    std::vector<std::weak_ptr<Connection>> m_connections;
+
+    /// Records of events which have been received but not yet answered, keyed by message ID.
+    std::map<std::string, EventRecord> m_pendingEvents;
+
+    /// Records of events which have been answered or dropped.
+    std::vector<EventRecord> m_completedEvents;
+
+    /// Counter used to generate unique message IDs.
+    uint64_t m_nextMessageId;
+
+    /// Number of pings served.
+    size_t m_pingCount;
+};
+
+}  // namespace test
+}  // namespace integration
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_INTEGRATION_INCLUDE_INTEGRATION_LOCALAVSSERVER_H_
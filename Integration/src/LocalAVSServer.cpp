@@ -0,0 +1,966 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "Integration/LocalAVSServer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <thread>
+
+#include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2RequestInterface.h>
+#include <AVSCommon/Utils/JSON/JSONUtils.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace integration {
+namespace test {
+
+using namespace avsCommon::utils::http;
+using namespace avsCommon::utils::http2;
+using namespace avsCommon::utils::json;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LocalAVSServer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Path of downchannel requests.
+static const std::string DOWNCHANNEL_PATH = "/v20160207/directives";
+
+/// Path of event requests.
+static const std::string EVENTS_PATH = "/v20160207/events";
+
+/// Path of ping requests.
+static const std::string PING_PATH = "/ping";
+
+/// MIME boundary of responses.
+static const std::string RESPONSE_BOUNDARY = "localAVSServerBoundary";
+
+/// Content type header of multipart responses.
+static const std::string RESPONSE_CONTENT_TYPE_HEADER =
+    "content-type: multipart/related; boundary=" + RESPONSE_BOUNDARY + "; type=application/json";
+
+/// Prefix of the boundary parameter in a content type header.
+static const std::string BOUNDARY_PREFIX = "boundary=";
+
+/// Line break in MIME messages.
+static const std::string CRLF = "\r\n";
+
+/// Dashes before a MIME boundary.
+static const std::string TWO_DASHES = "--";
+
+/// Separator between MIME part headers and data.
+static const std::string HEADERS_END = "\r\n\r\n";
+
+/// Headers of a MIME part containing a directive.
+static const std::string JSON_PART_HEADERS = "Content-Type: application/json; charset=UTF-8";
+
+/// Headers of a MIME part containing an attachment, before the content ID.
+static const std::string ATTACHMENT_PART_HEADERS = "Content-Type: application/octet-stream\r\nContent-ID: <";
+
+/// Placeholder for a unique message ID in scripted directives.
+static const std::string MESSAGE_ID_PLACEHOLDER = "${messageId}";
+
+/// Placeholder for the dialog request ID of the event in scripted directives.
+static const std::string DIALOG_REQUEST_ID_PLACEHOLDER = "${dialogRequestId}";
+
+/// Size of the buffer used to read request bodies.
+static const size_t READ_BUFFER_SIZE = 16 * 1024;
+
+/// Maximum number of bytes read from one request before other requests are serviced.
+static const size_t MAX_READ_PER_PASS = 256 * 1024;
+
+/// How long to wait before retrying a paused request or response.
+static const std::chrono::milliseconds PAUSE_RETRY_INTERVAL{1};
+
+/// How long the network loop sleeps when there is no work.
+static const std::chrono::milliseconds IDLE_INTERVAL{100};
+
+/**
+ * Replaces every occurrence of a string.
+ *
+ * @param text The text to modify.
+ * @param from The string to replace.
+ * @param to The replacement.
+ */
+static void replaceAll(std::string* text, const std::string& from, const std::string& to) {
+    for (auto pos = text->find(from); pos != std::string::npos; pos = text->find(from, pos + to.size())) {
+        text->replace(pos, from.size(), to);
+    }
+}
+
+/**
+ * Checks whether a URL ends with a path.
+ *
+ * @param url The URL.
+ * @param path The path.
+ * @return Whether @c url ends with @c path.
+ */
+static bool endsWith(const std::string& url, const std::string& path) {
+    return url.size() >= path.size() && url.compare(url.size() - path.size(), path.size(), path) == 0;
+}
+
+/**
+ * Finds the offset of the first byte of the second MIME part of a request body.
+ *
+ * @param body The request body received so far.
+ * @param boundary The MIME boundary of the body.
+ * @return The offset, or @c std::string::npos if the headers of the second part have not been received.
+ */
+static size_t findAttachmentDataOffset(const std::string& body, const std::string& boundary) {
+    auto delimiter = TWO_DASHES + boundary;
+    auto first = body.find(delimiter);
+    if (std::string::npos == first) {
+        return std::string::npos;
+    }
+    auto second = body.find(delimiter, first + delimiter.size());
+    if (std::string::npos == second) {
+        return std::string::npos;
+    }
+    auto afterSecond = second + delimiter.size();
+    if (body.compare(afterSecond, TWO_DASHES.size(), TWO_DASHES) == 0) {
+        // This is the closing boundary.
+        return std::string::npos;
+    }
+    auto headersEnd = body.find(HEADERS_END, afterSecond);
+    if (std::string::npos == headersEnd) {
+        return std::string::npos;
+    }
+    return headersEnd + HEADERS_END.size();
+}
+
+/**
+ * Extracts the JSON of the first MIME part of a request body.
+ *
+ * @param body The request body.
+ * @param boundary The MIME boundary of the body.
+ * @return The JSON, or an empty string if the body is malformed.
+ */
+static std::string extractJsonPart(const std::string& body, const std::string& boundary) {
+    auto delimiter = TWO_DASHES + boundary;
+    auto first = body.find(delimiter);
+    if (std::string::npos == first) {
+        return "";
+    }
+    auto headersEnd = body.find(HEADERS_END, first);
+    if (std::string::npos == headersEnd) {
+        return "";
+    }
+    auto start = headersEnd + HEADERS_END.size();
+    auto end = body.find(CRLF + delimiter, start);
+    if (std::string::npos == end) {
+        return "";
+    }
+    return body.substr(start, end - start);
+}
+
+/**
+ * A request served by a @c Connection.
+ *
+ * All members other than @c m_cancelled are only accessed by the network loop of the connection, or with the mutex of
+ * the connection held.
+ */
+class LocalAVSServer::Request : public HTTP2RequestInterface {
+public:
+    /// The kind of request.
+    enum class Type {
+        /// A downchannel request.
+        DOWNCHANNEL,
+        /// An event request.
+        EVENT,
+        /// A ping request.
+        PING,
+        /// A request to an unknown path.
+        UNKNOWN
+    };
+
+    /// A chunk of response data.
+    struct Chunk {
+        /// When the chunk may be delivered.
+        std::chrono::steady_clock::time_point sendTime;
+        /// The data.
+        std::string data;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param config The configuration of the request.
+     * @param connection The connection serving the request.
+     */
+    Request(const HTTP2RequestConfig& config, std::weak_ptr<Connection> connection);
+
+    /**
+     * Classifies a request by its URL.
+     *
+     * @param config The configuration of the request.
+     * @return The kind of request.
+     */
+    static Type classify(const HTTP2RequestConfig& config);
+
+    /// @name HTTP2RequestInterface methods.
+    /// @{
+    bool cancel() override;
+    std::string getId() const override;
+    /// @}
+
+    /// The configuration of the request.
+    const HTTP2RequestConfig m_config;
+
+    /// The kind of request.
+    const Type m_type;
+
+    /// The connection serving the request.
+    const std::weak_ptr<Connection> m_connection;
+
+    /// Whether the request has been cancelled.
+    std::atomic<bool> m_cancelled;
+
+    /// Whether the request headers have been read from the source.
+    bool m_headersRead;
+
+    /// The MIME boundary of the request body.
+    std::string m_requestBoundary;
+
+    /// The request body received so far.
+    std::string m_body;
+
+    /// Whether the request body is complete.
+    bool m_bodyComplete;
+
+    /// The record of the event, for event requests.
+    EventRecord m_record;
+
+    /// The response code to send.
+    long m_responseCode;
+
+    /// Whether to drop the response.
+    bool m_lost;
+
+    /// When to send the response code.
+    std::chrono::steady_clock::time_point m_responseTime;
+
+    /// Whether the response code has been sent.
+    bool m_responseStarted;
+
+    /// Response data waiting to be delivered. Guarded by the mutex of the connection.
+    std::deque<Chunk> m_chunks;
+
+    /// The chunk being delivered.
+    std::string m_currentChunk;
+
+    /// Whether to finish the response once all chunks are delivered.
+    bool m_finishWhenDrained;
+
+    /// Whether the response is finished.
+    bool m_finished;
+};
+
+/**
+ * A connection served in process by a @c LocalAVSServer.
+ *
+ * Requests are serviced by a single network loop thread, in the same way @c LibcurlHTTP2Connection services its
+ * streams, so callbacks into request sources and response sinks are never made concurrently.
+ */
+class LocalAVSServer::Connection
+        : public HTTP2ConnectionInterface
+        , public std::enable_shared_from_this<Connection> {
+public:
+    /**
+     * Creates a connection.
+     *
+     * @param server The server answering requests.
+     * @return A new connection.
+     */
+    static std::shared_ptr<Connection> create(std::shared_ptr<LocalAVSServer> server);
+
+    /**
+     * Destructor.
+     */
+    ~Connection();
+
+    /// @name HTTP2ConnectionInterface methods.
+    /// @{
+    std::shared_ptr<HTTP2RequestInterface> createAndSendRequest(const HTTP2RequestConfig& config) override;
+    void disconnect() override;
+    void addObserver(std::shared_ptr<HTTP2ConnectionObserverInterface> observer) override;
+    void removeObserver(std::shared_ptr<HTTP2ConnectionObserverInterface> observer) override;
+    /// @}
+
+    /**
+     * Queues data on every open downchannel of this connection.
+     *
+     * @param data The data to queue.
+     * @param sendTime When the data may be delivered.
+     * @return The number of downchannels the data was queued on.
+     */
+    size_t pushToDownchannels(const std::string& data, std::chrono::steady_clock::time_point sendTime);
+
+    /**
+     * Counts the open downchannels of this connection.
+     *
+     * @return The number of open downchannels.
+     */
+    size_t countDownchannels();
+
+    /// Wakes the network loop.
+    void wake();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param server The server answering requests.
+     */
+    explicit Connection(std::shared_ptr<LocalAVSServer> server);
+
+    /// The network loop.
+    void networkLoop();
+
+    /**
+     * Services a request.
+     *
+     * @param request The request.
+     * @param[in,out] nextWake The time the network loop must run again, lowered if the request needs it.
+     * @return Whether any progress was made.
+     */
+    bool serviceRequest(const std::shared_ptr<Request>& request, std::chrono::steady_clock::time_point* nextWake);
+
+    /**
+     * Reads the request body from its source.
+     *
+     * @param request The request.
+     * @param[in,out] nextWake The time the network loop must run again.
+     * @return Whether any progress was made.
+     */
+    bool readBody(const std::shared_ptr<Request>& request, std::chrono::steady_clock::time_point* nextWake);
+
+    /**
+     * Prepares the response once the request body is complete.
+     *
+     * @param request The request.
+     */
+    void onBodyComplete(const std::shared_ptr<Request>& request);
+
+    /**
+     * Delivers the response code, headers, and data.
+     *
+     * @param request The request.
+     * @param[in,out] nextWake The time the network loop must run again.
+     * @return Whether any progress was made.
+     */
+    bool sendResponse(const std::shared_ptr<Request>& request, std::chrono::steady_clock::time_point* nextWake);
+
+    /**
+     * Finishes a request.
+     *
+     * @param request The request.
+     * @param status The status to report to the response sink.
+     */
+    void finish(const std::shared_ptr<Request>& request, HTTP2ResponseFinishedStatus status);
+
+    /// The server answering requests.
+    std::shared_ptr<LocalAVSServer> m_server;
+
+    /// Serializes access to the members below, and to the chunk queues of requests.
+    std::mutex m_mutex;
+
+    /// Notified when there is new work for the network loop.
+    std::condition_variable m_wakeTrigger;
+
+    /// Whether there is new work for the network loop.
+    bool m_hasNewWork;
+
+    /// Whether the network loop should exit.
+    bool m_isStopping;
+
+    /// Active requests.
+    std::vector<std::shared_ptr<Request>> m_requests;
+
+    /// Connection observers.
+    std::vector<std::shared_ptr<HTTP2ConnectionObserverInterface>> m_observers;
+
+    /// The network loop thread.
+    std::thread m_networkThread;
+};
+
+LocalAVSServer::Request::Type LocalAVSServer::Request::classify(const HTTP2RequestConfig& config) {
+    auto url = config.getUrl();
+    if (endsWith(url, DOWNCHANNEL_PATH) && HTTP2RequestType::GET == config.getRequestType()) {
+        return Type::DOWNCHANNEL;
+    }
+    if (endsWith(url, EVENTS_PATH) && HTTP2RequestType::POST == config.getRequestType()) {
+        return Type::EVENT;
+    }
+    if (endsWith(url, PING_PATH)) {
+        return Type::PING;
+    }
+    return Type::UNKNOWN;
+}
+
+LocalAVSServer::Request::Request(const HTTP2RequestConfig& config, std::weak_ptr<Connection> connection) :
+        m_config{config},
+        m_type{classify(config)},
+        m_connection{std::move(connection)},
+        m_cancelled{false},
+        m_headersRead{false},
+        m_bodyComplete{false},
+        m_record{},
+        m_responseCode{HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED},
+        m_lost{false},
+        m_responseStarted{false},
+        m_finishWhenDrained{true},
+        m_finished{false} {
+    m_record.requestStart = std::chrono::steady_clock::now();
+    m_record.firstAttachmentByte = m_record.requestStart;
+    m_record.hasAttachment = false;
+    m_record.lost = false;
+}
+
+bool LocalAVSServer::Request::cancel() {
+    m_cancelled = true;
+    if (auto connection = m_connection.lock()) {
+        connection->wake();
+    }
+    return true;
+}
+
+std::string LocalAVSServer::Request::getId() const {
+    return m_config.getId();
+}
+
+std::shared_ptr<LocalAVSServer::Connection> LocalAVSServer::Connection::create(std::shared_ptr<LocalAVSServer> server) {
+    std::shared_ptr<Connection> connection(new Connection(std::move(server)));
+    connection->m_networkThread = std::thread(&Connection::networkLoop, connection.get());
+    return connection;
+}
+
+LocalAVSServer::Connection::Connection(std::shared_ptr<LocalAVSServer> server) :
+        m_server{std::move(server)},
+        m_hasNewWork{false},
+        m_isStopping{false} {
+}
+
+LocalAVSServer::Connection::~Connection() {
+    disconnect();
+}
+
+std::shared_ptr<HTTP2RequestInterface> LocalAVSServer::Connection::createAndSendRequest(
+    const HTTP2RequestConfig& config) {
+    if (!config.getSink()) {
+        ACSDK_ERROR(LX("createAndSendRequestFailed").d("reason", "nullSink"));
+        return nullptr;
+    }
+    auto request = std::make_shared<Request>(config, shared_from_this());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isStopping) {
+        ACSDK_ERROR(LX("createAndSendRequestFailed").d("reason", "disconnected"));
+        return nullptr;
+    }
+    if (Request::Type::DOWNCHANNEL == request->m_type) {
+        // The first boundary is queued up front, so directives pushed before the response starts follow it.
+        request->m_finishWhenDrained = false;
+        request->m_chunks.push_back(
+            {request->m_record.requestStart + m_server->getResponseDelay(), CRLF + TWO_DASHES + RESPONSE_BOUNDARY});
+    }
+    m_requests.push_back(request);
+    m_hasNewWork = true;
+    m_wakeTrigger.notify_all();
+    return request;
+}
+
+void LocalAVSServer::Connection::disconnect() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+        m_wakeTrigger.notify_all();
+    }
+    if (m_networkThread.joinable() && m_networkThread.get_id() != std::this_thread::get_id()) {
+        m_networkThread.join();
+    }
+}
+
+void LocalAVSServer::Connection::addObserver(std::shared_ptr<HTTP2ConnectionObserverInterface> observer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_observers.push_back(std::move(observer));
+}
+
+void LocalAVSServer::Connection::removeObserver(std::shared_ptr<HTTP2ConnectionObserverInterface> observer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+}
+
+size_t LocalAVSServer::Connection::pushToDownchannels(
+    const std::string& data,
+    std::chrono::steady_clock::time_point sendTime) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (auto& request : m_requests) {
+        if (Request::Type::DOWNCHANNEL == request->m_type && !request->m_cancelled) {
+            request->m_chunks.push_back({sendTime, data});
+            ++count;
+        }
+    }
+    m_hasNewWork = true;
+    m_wakeTrigger.notify_all();
+    return count;
+}
+
+size_t LocalAVSServer::Connection::countDownchannels() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::count_if(m_requests.begin(), m_requests.end(), [](const std::shared_ptr<Request>& request) {
+        return Request::Type::DOWNCHANNEL == request->m_type && !request->m_cancelled;
+    });
+}
+
+void LocalAVSServer::Connection::wake() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_hasNewWork = true;
+    m_wakeTrigger.notify_all();
+}
+
+void LocalAVSServer::Connection::networkLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_isStopping) {
+        m_hasNewWork = false;
+        auto requests = m_requests;
+        lock.unlock();
+
+        auto nextWake = std::chrono::steady_clock::now() + IDLE_INTERVAL;
+        bool progress = false;
+        for (auto& request : requests) {
+            progress = serviceRequest(request, &nextWake) || progress;
+        }
+
+        lock.lock();
+        m_requests.erase(
+            std::remove_if(
+                m_requests.begin(),
+                m_requests.end(),
+                [](const std::shared_ptr<Request>& request) { return request->m_finished; }),
+            m_requests.end());
+        if (!progress) {
+            m_wakeTrigger.wait_until(lock, nextWake, [this] { return m_isStopping || m_hasNewWork; });
+        }
+    }
+
+    auto requests = std::move(m_requests);
+    m_requests.clear();
+    lock.unlock();
+    for (auto& request : requests) {
+        if (!request->m_finished) {
+            finish(request, HTTP2ResponseFinishedStatus::CANCELLED);
+        }
+    }
+}
+
+bool LocalAVSServer::Connection::serviceRequest(
+    const std::shared_ptr<Request>& request,
+    std::chrono::steady_clock::time_point* nextWake) {
+    if (request->m_finished) {
+        return false;
+    }
+    if (request->m_cancelled) {
+        finish(request, HTTP2ResponseFinishedStatus::CANCELLED);
+        return true;
+    }
+
+    bool progress = false;
+    if (!request->m_bodyComplete) {
+        progress = readBody(request, nextWake);
+        if (request->m_finished || !request->m_bodyComplete) {
+            return progress;
+        }
+    }
+    return sendResponse(request, nextWake) || progress;
+}
+
+bool LocalAVSServer::Connection::readBody(
+    const std::shared_ptr<Request>& request,
+    std::chrono::steady_clock::time_point* nextWake) {
+    auto source = request->m_config.getSource();
+    if (!source) {
+        request->m_bodyComplete = true;
+        request->m_record.bodyComplete = std::chrono::steady_clock::now();
+        onBodyComplete(request);
+        return true;
+    }
+
+    if (!request->m_headersRead) {
+        request->m_headersRead = true;
+        for (const auto& line : source->getRequestHeaderLines()) {
+            auto pos = line.find(BOUNDARY_PREFIX);
+            if (pos != std::string::npos) {
+                request->m_requestBoundary = line.substr(pos + BOUNDARY_PREFIX.size());
+            }
+        }
+    }
+
+    bool progress = false;
+    char buffer[READ_BUFFER_SIZE];
+    size_t bytesRead = 0;
+    while (bytesRead < MAX_READ_PER_PASS) {
+        auto result = source->onSendData(buffer, sizeof(buffer));
+        switch (result.status) {
+            case HTTP2SendStatus::CONTINUE:
+                if (0 == result.size) {
+                    *nextWake = std::min(*nextWake, std::chrono::steady_clock::now() + PAUSE_RETRY_INTERVAL);
+                    return progress;
+                }
+                request->m_body.append(buffer, result.size);
+                bytesRead += result.size;
+                progress = true;
+                if (Request::Type::EVENT == request->m_type && !request->m_record.hasAttachment) {
+                    auto offset = findAttachmentDataOffset(request->m_body, request->m_requestBoundary);
+                    if (offset != std::string::npos && request->m_body.size() > offset) {
+                        request->m_record.hasAttachment = true;
+                        request->m_record.firstAttachmentByte = std::chrono::steady_clock::now();
+                    }
+                }
+                break;
+            case HTTP2SendStatus::PAUSE:
+                *nextWake = std::min(*nextWake, std::chrono::steady_clock::now() + PAUSE_RETRY_INTERVAL);
+                return progress;
+            case HTTP2SendStatus::COMPLETE:
+                request->m_bodyComplete = true;
+                request->m_record.bodyComplete = std::chrono::steady_clock::now();
+                onBodyComplete(request);
+                return true;
+            case HTTP2SendStatus::ABORT:
+                finish(request, HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+                return true;
+        }
+    }
+    // Let other requests make progress before reading more of this one.
+    *nextWake = std::chrono::steady_clock::now();
+    return progress;
+}
+
+void LocalAVSServer::Connection::onBodyComplete(const std::shared_ptr<Request>& request) {
+    auto now = std::chrono::steady_clock::now();
+    switch (request->m_type) {
+        case Request::Type::DOWNCHANNEL:
+            request->m_responseCode = HTTPResponseCode::SUCCESS_OK;
+            request->m_responseTime = now + m_server->getResponseDelay();
+            return;
+        case Request::Type::PING:
+            request->m_responseCode = HTTPResponseCode::SUCCESS_NO_CONTENT;
+            request->m_responseTime = now + m_server->getResponseDelay();
+            m_server->onPing();
+            return;
+        case Request::Type::EVENT: {
+            auto response = m_server->handleEvent(request->m_requestBoundary, request->m_body, &request->m_record);
+            request->m_body.clear();
+            request->m_responseCode = response.responseCode;
+            request->m_lost = response.lost;
+            request->m_responseTime = response.sendTime;
+            if (!response.body.empty()) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                request->m_chunks.push_back({response.sendTime, std::move(response.body)});
+            }
+            return;
+        }
+        case Request::Type::UNKNOWN:
+            ACSDK_WARN(LX("unknownRequest").d("url", request->m_config.getUrl()));
+            request->m_responseCode = HTTPResponseCode::CLIENT_ERROR_BAD_REQUEST;
+            request->m_responseTime = now;
+            return;
+    }
+}
+
+bool LocalAVSServer::Connection::sendResponse(
+    const std::shared_ptr<Request>& request,
+    std::chrono::steady_clock::time_point* nextWake) {
+    auto sink = request->m_config.getSink();
+    auto now = std::chrono::steady_clock::now();
+    bool progress = false;
+
+    if (!request->m_responseStarted) {
+        if (now < request->m_responseTime) {
+            *nextWake = std::min(*nextWake, request->m_responseTime);
+            return false;
+        }
+        if (Request::Type::EVENT == request->m_type) {
+            m_server->onEventResponseStarted(request->m_record.messageId, now);
+        }
+        if (request->m_lost) {
+            finish(request, HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+            return true;
+        }
+        request->m_responseStarted = true;
+        progress = true;
+        if (!sink->onReceiveResponseCode(request->m_responseCode)) {
+            finish(request, HTTP2ResponseFinishedStatus::CANCELLED);
+            return true;
+        }
+        if (HTTPResponseCode::SUCCESS_OK == request->m_responseCode &&
+            !sink->onReceiveHeaderLine(RESPONSE_CONTENT_TYPE_HEADER)) {
+            finish(request, HTTP2ResponseFinishedStatus::CANCELLED);
+            return true;
+        }
+    }
+
+    while (true) {
+        if (request->m_currentChunk.empty()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (request->m_chunks.empty()) {
+                break;
+            }
+            if (request->m_chunks.front().sendTime > now) {
+                *nextWake = std::min(*nextWake, request->m_chunks.front().sendTime);
+                return progress;
+            }
+            request->m_currentChunk = std::move(request->m_chunks.front().data);
+            request->m_chunks.pop_front();
+        }
+        switch (sink->onReceiveData(request->m_currentChunk.data(), request->m_currentChunk.size())) {
+            case HTTP2ReceiveDataStatus::SUCCESS:
+                request->m_currentChunk.clear();
+                progress = true;
+                break;
+            case HTTP2ReceiveDataStatus::PAUSE:
+                *nextWake = std::min(*nextWake, now + PAUSE_RETRY_INTERVAL);
+                return progress;
+            case HTTP2ReceiveDataStatus::ABORT:
+                finish(request, HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+                return true;
+        }
+    }
+
+    if (request->m_finishWhenDrained) {
+        finish(request, HTTP2ResponseFinishedStatus::COMPLETE);
+        return true;
+    }
+    return progress;
+}
+
+void LocalAVSServer::Connection::finish(const std::shared_ptr<Request>& request, HTTP2ResponseFinishedStatus status) {
+    if (request->m_finished) {
+        return;
+    }
+    request->m_finished = true;
+    if (Request::Type::EVENT == request->m_type && !request->m_responseStarted && !request->m_lost) {
+        // The event ended before it was answered, so its record is completed with the time it ended.
+        m_server->onEventResponseStarted(request->m_record.messageId, std::chrono::steady_clock::now());
+    }
+    request->m_config.getSink()->onResponseFinished(status);
+}
+
+std::shared_ptr<LocalAVSServer> LocalAVSServer::create(uint32_t seed) {
+    return std::shared_ptr<LocalAVSServer>(new LocalAVSServer(seed));
+}
+
+LocalAVSServer::LocalAVSServer(uint32_t seed) : m_random{seed}, m_nextMessageId{0}, m_pingCount{0} {
+}
+
+void LocalAVSServer::setEventResponse(
+    const std::string& eventNamespace,
+    const std::string& eventName,
+    const std::vector<Directive>& directives) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_eventResponses[eventNamespace + "." + eventName] = directives;
+}
+
+void LocalAVSServer::setFaultInjection(const FaultInjection& faultInjection) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_faultInjection = faultInjection;
+}
+
+size_t LocalAVSServer::pushDirective(const Directive& directive) {
+    auto data = encodeDirective(directive, "");
+    auto sendTime = std::chrono::steady_clock::now() + getResponseDelay();
+
+    std::vector<std::shared_ptr<Connection>> connections;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& weakConnection : m_connections) {
+            if (auto connection = weakConnection.lock()) {
+                connections.push_back(connection);
+            }
+        }
+    }
+
+    size_t count = 0;
+    for (auto& connection : connections) {
+        count += connection->pushToDownchannels(data, sendTime);
+    }
+    return count;
+}
+
+bool LocalAVSServer::waitForDownchannels(size_t count, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        std::vector<std::shared_ptr<Connection>> connections;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& weakConnection : m_connections) {
+                if (auto connection = weakConnection.lock()) {
+                    connections.push_back(connection);
+                }
+            }
+        }
+        size_t open = 0;
+        for (auto& connection : connections) {
+            open += connection->countDownchannels();
+        }
+        if (open >= count) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeTrigger.wait_until(lock, std::min(deadline, std::chrono::steady_clock::now() + IDLE_INTERVAL));
+    }
+}
+
+bool LocalAVSServer::waitForEvent(
+    const std::string& messageId,
+    std::chrono::milliseconds timeout,
+    EventRecord* record) {
+    if (!record) {
+        ACSDK_ERROR(LX("waitForEventFailed").d("reason", "nullRecord"));
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto findRecord = [this, &messageId]() {
+        return std::find_if(m_completedEvents.begin(), m_completedEvents.end(), [&messageId](const EventRecord& r) {
+            return r.messageId == messageId;
+        });
+    };
+    if (!m_wakeTrigger.wait_for(lock, timeout, [&] { return findRecord() != m_completedEvents.end(); })) {
+        return false;
+    }
+    *record = *findRecord();
+    return true;
+}
+
+std::vector<LocalAVSServer::EventRecord> LocalAVSServer::getEventRecords() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_completedEvents;
+}
+
+size_t LocalAVSServer::getPingCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pingCount;
+}
+
+std::shared_ptr<HTTP2ConnectionInterface> LocalAVSServer::createHTTP2Connection() {
+    auto connection = Connection::create(shared_from_this());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_connections.erase(
+        std::remove_if(
+            m_connections.begin(),
+            m_connections.end(),
+            [](const std::weak_ptr<Connection>& weakConnection) { return weakConnection.expired(); }),
+        m_connections.end());
+    m_connections.push_back(connection);
+    return connection;
+}
+
+LocalAVSServer::EventResponse LocalAVSServer::handleEvent(
+    const std::string& requestBoundary,
+    const std::string& body,
+    EventRecord* record) {
+    std::string header;
+    auto json = extractJsonPart(body, requestBoundary);
+    std::string event;
+    if (!jsonUtils::retrieveValue(json, "event", &event) || !jsonUtils::retrieveValue(event, "header", &header) ||
+        !jsonUtils::retrieveValue(header, "namespace", &record->eventNamespace) ||
+        !jsonUtils::retrieveValue(header, "name", &record->name)) {
+        ACSDK_ERROR(LX("handleEventFailed").d("reason", "malformedEvent"));
+        return {HTTPResponseCode::CLIENT_ERROR_BAD_REQUEST, "", false, std::chrono::steady_clock::now()};
+    }
+    jsonUtils::retrieveValue(header, "messageId", &record->messageId);
+    if (header.find("\"dialogRequestId\"") != std::string::npos) {
+        jsonUtils::retrieveValue(header, "dialogRequestId", &record->dialogRequestId);
+    }
+
+    std::vector<Directive> directives;
+    EventResponse response{HTTPResponseCode::SUCCESS_NO_CONTENT, "", false, std::chrono::steady_clock::now()};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_eventResponses.find(record->eventNamespace + "." + record->name);
+        if (it != m_eventResponses.end()) {
+            directives = it->second;
+        }
+        response.sendTime += m_faultInjection.responseDelay;
+        response.lost = std::uniform_real_distribution<double>(0.0, 1.0)(m_random) < m_faultInjection.eventLossRate;
+        record->lost = response.lost;
+        m_pendingEvents[record->messageId] = *record;
+    }
+
+    if (!directives.empty()) {
+        response.responseCode = HTTPResponseCode::SUCCESS_OK;
+        response.body = CRLF + TWO_DASHES + RESPONSE_BOUNDARY;
+        for (const auto& directive : directives) {
+            response.body += encodeDirective(directive, record->dialogRequestId);
+        }
+        response.body += TWO_DASHES + CRLF;
+    }
+    return response;
+}
+
+void LocalAVSServer::onEventResponseStarted(
+    const std::string& messageId,
+    std::chrono::steady_clock::time_point responseStart) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_pendingEvents.find(messageId);
+    if (m_pendingEvents.end() == it) {
+        return;
+    }
+    it->second.responseStart = responseStart;
+    m_completedEvents.push_back(it->second);
+    m_pendingEvents.erase(it);
+    m_wakeTrigger.notify_all();
+}
+
+void LocalAVSServer::onPing() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_pingCount;
+}
+
+std::chrono::milliseconds LocalAVSServer::getResponseDelay() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_faultInjection.responseDelay;
+}
+
+std::string LocalAVSServer::encodeDirective(const Directive& directive, const std::string& dialogRequestId) {
+    auto json = directive.json;
+    if (json.find(MESSAGE_ID_PLACEHOLDER) != std::string::npos) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        replaceAll(&json, MESSAGE_ID_PLACEHOLDER, "LocalAVSServer-" + std::to_string(++m_nextMessageId));
+    }
+    replaceAll(&json, DIALOG_REQUEST_ID_PLACEHOLDER, dialogRequestId);
+
+    auto delimiter = CRLF + TWO_DASHES + RESPONSE_BOUNDARY;
+    std::string data = CRLF + JSON_PART_HEADERS + HEADERS_END + json + delimiter;
+    for (const auto& attachment : directive.attachments) {
+        data += CRLF + ATTACHMENT_PART_HEADERS + attachment.contentId + ">" + HEADERS_END + attachment.data + delimiter;
+    }
+    return data;
+}
+
+}  // namespace test
+}  // namespace integration
+}  // namespace alexaClientSDK
@@ -0,0 +1,565 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file LocalAVSLatencyTest.cpp
+///
+/// End-to-end latency and load tests of the ACL stack against @c LocalAVSServer. These tests need no credentials or
+/// network access, so they run with the unit tests and report latency percentiles as test properties.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ACL/AVSConnectionManager.h>
+#include <ACL/Transport/HTTP2TransportFactory.h>
+#include <ACL/Transport/MessageRouter.h>
+#include <ACL/Transport/PostConnectSequencerFactory.h>
+#include <AVSCommon/AVS/AVSDirective.h>
+#include <AVSCommon/AVS/Attachment/AttachmentManager.h>
+#include <AVSCommon/AVS/Attachment/InProcessAttachmentReader.h>
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
+#include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
+#include <AVSCommon/SDKInterfaces/MessageObserverInterface.h>
+
+#include "Integration/ConnectionStatusObserver.h"
+#include "Integration/LocalAVSServer.h"
+#include "Integration/ObservableMessageRequest.h"
+
+namespace alexaClientSDK {
+namespace integration {
+namespace test {
+
+using namespace acl;
+using namespace avsCommon::avs;
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::avs::initialization;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::sds;
+
+/// Path to the folder of audio inputs.
+static std::string g_inputPath;
+
+/// Number of simulated clients.
+static size_t g_numClients = 4;
+
+/// Gateway of the simulated clients. Only the paths of requests matter to @c LocalAVSServer.
+static const std::string GATEWAY = "https://local-avs.test";
+
+/// Audio of "what's up", sent with Recognize events.
+static const std::string RECOGNIZE_AUDIO_FILE_NAME = "/recognize_whats_up_test.wav";
+
+/// Size of the RIFF header of WAV inputs.
+static const size_t RIFF_HEADER_SIZE = 44;
+
+/// Samples per 10 ms of 16 kHz audio.
+static const size_t SAMPLES_PER_CHUNK = 160;
+
+/// Duration of audio written per chunk.
+static const std::chrono::milliseconds CHUNK_DURATION{10};
+
+/// Number of events each client sends in the throughput test.
+static const size_t EVENTS_PER_CLIENT = 50;
+
+/// Number of events sent in the fault injection test.
+static const size_t FAULT_INJECTION_EVENTS = 20;
+
+/// Number of directives pushed in the downchannel test.
+static const size_t PUSHED_DIRECTIVES = 20;
+
+/// Delay injected in the fault injection test.
+static const std::chrono::milliseconds INJECTED_DELAY{50};
+
+/// Loss rate injected in the fault injection test.
+static const double INJECTED_LOSS_RATE = 0.5;
+
+/// Timeout for connecting and for each exchange.
+static const std::chrono::seconds TIMEOUT{10};
+
+/// Content ID of the Speak audio.
+static const std::string SPEAK_CONTENT_ID = "speakAudio";
+
+/// Size of the Speak audio.
+static const size_t SPEAK_AUDIO_SIZE = 32 * 1024;
+
+/// A Speak directive answering a Recognize event.
+// clang-format off
+static const std::string SPEAK_DIRECTIVE_JSON =
+    "{"
+        "\"directive\":{"
+            "\"header\":{"
+                "\"namespace\":\"SpeechSynthesizer\","
+                "\"name\":\"Speak\","
+                "\"messageId\":\"${messageId}\","
+                "\"dialogRequestId\":\"${dialogRequestId}\""
+            "},"
+            "\"payload\":{"
+                "\"url\":\"cid:" + SPEAK_CONTENT_ID + "\","
+                "\"format\":\"AUDIO_MPEG\","
+                "\"token\":\"speakToken\""
+            "}"
+        "}"
+    "}";
+
+/// A directive pushed on the downchannel.
+static const std::string PUSHED_DIRECTIVE_JSON =
+    "{"
+        "\"directive\":{"
+            "\"header\":{"
+                "\"namespace\":\"Alerts\","
+                "\"name\":\"DeleteAlert\","
+                "\"messageId\":\"${messageId}\""
+            "},"
+            "\"payload\":{"
+                "\"token\":\"alertToken\""
+            "}"
+        "}"
+    "}";
+// clang-format on
+
+/**
+ * Builds a SynchronizeState event.
+ *
+ * @param messageId The message ID of the event.
+ * @return The event JSON.
+ */
+static std::string buildSynchronizeStateEvent(const std::string& messageId) {
+    return "{\"context\":[],\"event\":{\"header\":{\"namespace\":\"System\",\"name\":\"SynchronizeState\","
+           "\"messageId\":\"" +
+           messageId + "\"},\"payload\":{}}}";
+}
+
+/**
+ * Builds a Recognize event.
+ *
+ * @param messageId The message ID of the event.
+ * @param dialogRequestId The dialog request ID of the event.
+ * @return The event JSON.
+ */
+static std::string buildRecognizeEvent(const std::string& messageId, const std::string& dialogRequestId) {
+    return "{\"context\":[],\"event\":{\"header\":{\"namespace\":\"SpeechRecognizer\",\"name\":\"Recognize\","
+           "\"messageId\":\"" +
+           messageId + "\",\"dialogRequestId\":\"" + dialogRequestId +
+           "\"},\"payload\":{\"profile\":\"NEAR_FIELD\",\"format\":\"AUDIO_L16_RATE_16000_CHANNELS_1\"}}}";
+}
+
+/**
+ * Converts a duration to fractional milliseconds.
+ *
+ * @param duration The duration.
+ * @return The duration in milliseconds.
+ */
+static double toMilliseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/// An @c AuthDelegateInterface which is always authorized, since @c LocalAVSServer does not check tokens.
+class StubAuthDelegate : public AuthDelegateInterface {
+public:
+    void addAuthObserver(std::shared_ptr<AuthObserverInterface> observer) override {
+        observer->onAuthStateChange(AuthObserverInterface::State::REFRESHED, AuthObserverInterface::Error::SUCCESS);
+    }
+    void removeAuthObserver(std::shared_ptr<AuthObserverInterface> observer) override {
+    }
+    std::string getAuthToken() override {
+        return "token";
+    }
+    void onAuthFailure(const std::string& token) override {
+    }
+};
+
+/// A @c MessageObserverInterface which records directives and when they arrived.
+class DirectiveRecorder : public MessageObserverInterface {
+public:
+    /// A received directive.
+    struct ReceivedDirective {
+        /// The attachment context ID of the directive.
+        std::string contextId;
+        /// The directive JSON.
+        std::string message;
+        /// When the directive was received.
+        std::chrono::steady_clock::time_point time;
+    };
+
+    void receive(const std::string& contextId, const std::string& message) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_directives.push_back({contextId, message, std::chrono::steady_clock::now()});
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Waits for a directive.
+     *
+     * @param index The index of the directive, in the order of arrival.
+     * @param[out] directive The directive.
+     * @return Whether the directive arrived before @c TIMEOUT.
+     */
+    bool waitForDirective(size_t index, ReceivedDirective* directive) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_wakeTrigger.wait_for(lock, TIMEOUT, [this, index] { return m_directives.size() > index; })) {
+            return false;
+        }
+        *directive = m_directives[index];
+        return true;
+    }
+
+private:
+    /// Serializes access to @c m_directives.
+    std::mutex m_mutex;
+    /// Notified when a directive arrives.
+    std::condition_variable m_wakeTrigger;
+    /// The received directives.
+    std::vector<ReceivedDirective> m_directives;
+};
+
+/// One simulated client: an ACL stack connected to the @c LocalAVSServer.
+class SimulatedClient {
+public:
+    /**
+     * Creates a client and waits until it is connected.
+     *
+     * @param server The server to connect to.
+     * @return The client, or @c nullptr if it failed to connect.
+     */
+    static std::unique_ptr<SimulatedClient> create(std::shared_ptr<LocalAVSServer> server) {
+        std::unique_ptr<SimulatedClient> client(new SimulatedClient());
+        client->m_attachmentManager =
+            std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS);
+        client->m_connectionStatusObserver = std::make_shared<ConnectionStatusObserver>();
+        client->m_directiveRecorder = std::make_shared<DirectiveRecorder>();
+        // No post-connect operations, so the clients are connected as soon as their downchannels are open.
+        auto postConnectFactory =
+            PostConnectSequencerFactory::create(std::vector<std::shared_ptr<PostConnectOperationProviderInterface>>());
+        auto transportFactory = std::make_shared<HTTP2TransportFactory>(server, postConnectFactory);
+        client->m_messageRouter = std::make_shared<MessageRouter>(
+            std::make_shared<StubAuthDelegate>(), client->m_attachmentManager, transportFactory, GATEWAY);
+        client->m_connectionManager = AVSConnectionManager::create(
+            client->m_messageRouter, false, {client->m_connectionStatusObserver}, {client->m_directiveRecorder});
+        if (!client->m_connectionManager) {
+            return nullptr;
+        }
+        client->m_connectionManager->enable();
+        if (!client->m_connectionStatusObserver->waitFor(
+                ConnectionStatusObserverInterface::Status::CONNECTED, TIMEOUT)) {
+            client->shutdown();
+            return nullptr;
+        }
+        return client;
+    }
+
+    /// Destructor.
+    ~SimulatedClient() {
+        shutdown();
+    }
+
+    /**
+     * Sends an event and waits until it completes.
+     *
+     * @param json The event JSON.
+     * @param reader Reader of the event attachment, if any.
+     * @param[out] status The completion status of the event.
+     * @return Whether the event completed before @c TIMEOUT.
+     */
+    bool sendEvent(
+        const std::string& json,
+        std::shared_ptr<AttachmentReader> reader,
+        MessageRequestObserverInterface::Status* status) {
+        auto request = std::make_shared<ObservableMessageRequest>(json, reader);
+        m_connectionManager->sendMessage(request);
+        auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+        while (!request->hasSendCompleted()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        *status = request->getSendMessageStatus();
+        return true;
+    }
+
+    /// The attachment manager of the client.
+    std::shared_ptr<AttachmentManager> m_attachmentManager;
+
+    /// Records directives received by the client.
+    std::shared_ptr<DirectiveRecorder> m_directiveRecorder;
+
+private:
+    /// Constructor.
+    SimulatedClient() = default;
+
+    /// Disconnects and releases the ACL stack.
+    void shutdown() {
+        if (m_connectionManager) {
+            m_connectionManager->disable();
+            m_connectionManager->shutdown();
+            m_connectionManager.reset();
+        }
+        if (m_messageRouter) {
+            m_messageRouter->shutdown();
+            m_messageRouter.reset();
+        }
+    }
+
+    /// Observes the connection status.
+    std::shared_ptr<ConnectionStatusObserver> m_connectionStatusObserver;
+
+    /// The message router.
+    std::shared_ptr<MessageRouter> m_messageRouter;
+
+    /// The connection manager.
+    std::shared_ptr<AVSConnectionManager> m_connectionManager;
+};
+
+class LocalAVSLatencyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto configuration = std::make_shared<std::stringstream>("{}");
+        ASSERT_TRUE(AlexaClientSDKInit::initialize({configuration}));
+        m_server = LocalAVSServer::create();
+        for (size_t i = 0; i < g_numClients; ++i) {
+            auto client = SimulatedClient::create(m_server);
+            ASSERT_TRUE(client);
+            m_clients.push_back(std::move(client));
+        }
+        ASSERT_TRUE(m_server->waitForDownchannels(g_numClients, TIMEOUT));
+    }
+
+    void TearDown() override {
+        m_clients.clear();
+        m_server.reset();
+        AlexaClientSDKInit::uninitialize();
+    }
+
+    /**
+     * Reports percentiles of latencies as test properties.
+     *
+     * @param name The name of the measurement.
+     * @param latencies The latencies in milliseconds.
+     */
+    void reportLatencies(const std::string& name, std::vector<double> latencies) {
+        ASSERT_FALSE(latencies.empty());
+        std::sort(latencies.begin(), latencies.end());
+        RecordProperty(name + "Samples", static_cast<int>(latencies.size()));
+        for (auto percentile : {50, 90, 99}) {
+            auto index = std::min(latencies.size() - 1, latencies.size() * percentile / 100);
+            auto key = name + "P" + std::to_string(percentile) + "Us";
+            RecordProperty(key, static_cast<int>(latencies[index] * 1000));
+        }
+    }
+
+    /// The server.
+    std::shared_ptr<LocalAVSServer> m_server;
+
+    /// The simulated clients.
+    std::vector<std::unique_ptr<SimulatedClient>> m_clients;
+};
+
+/**
+ * Measure event latency and throughput with every client sending events concurrently. This is a benchmark, so it only
+ * runs when disabled tests are requested.
+ */
+TEST_F(LocalAVSLatencyTest, DISABLED_test_eventThroughput) {
+    std::mutex mutex;
+    std::vector<double> latencies;
+    std::atomic<size_t> failures{0};
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < m_clients.size(); ++i) {
+        threads.emplace_back([this, i, &mutex, &latencies, &failures] {
+            for (size_t j = 0; j < EVENTS_PER_CLIENT; ++j) {
+                auto messageId = "throughput-" + std::to_string(i) + "-" + std::to_string(j);
+                auto sendTime = std::chrono::steady_clock::now();
+                MessageRequestObserverInterface::Status status;
+                if (!m_clients[i]->sendEvent(buildSynchronizeStateEvent(messageId), nullptr, &status) ||
+                    MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT != status) {
+                    ++failures;
+                    continue;
+                }
+                auto latency = toMilliseconds(std::chrono::steady_clock::now() - sendTime);
+                std::lock_guard<std::mutex> lock(mutex);
+                latencies.push_back(latency);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = toMilliseconds(std::chrono::steady_clock::now() - start);
+
+    ASSERT_EQ(0u, failures.load());
+    reportLatencies("eventLatency", latencies);
+    auto eventsPerSecond = static_cast<int>(latencies.size() * 1000 / elapsed);
+    RecordProperty("clients", static_cast<int>(m_clients.size()));
+    RecordProperty("eventsPerSecond", eventsPerSecond);
+}
+
+/**
+ * Test wake-to-first-byte and directive-to-first-audio latency of a voice interaction.
+ *
+ * Audio is written to an @c AudioInputStream in real time, starting at the simulated wake word. The Recognize event
+ * streams it to the server, which answers with a Speak directive and its audio attachment.
+ */
+TEST_F(LocalAVSLatencyTest, test_wakeToFirstByteAndDirectiveToFirstAudio) {
+    std::ifstream file(g_inputPath + RECOGNIZE_AUDIO_FILE_NAME, std::ifstream::binary);
+    ASSERT_TRUE(file.good());
+    file.seekg(RIFF_HEADER_SIZE);
+    std::vector<int16_t> audio;
+    int16_t sample;
+    while (file.read(reinterpret_cast<char*>(&sample), sizeof(sample))) {
+        audio.push_back(sample);
+    }
+    ASSERT_FALSE(audio.empty());
+
+    m_server->setEventResponse(
+        "SpeechRecognizer",
+        "Recognize",
+        {{SPEAK_DIRECTIVE_JSON, {{SPEAK_CONTENT_ID, std::string(SPEAK_AUDIO_SIZE, '\x55')}}}});
+
+    auto& client = m_clients.front();
+    auto bufferSize = AudioInputStream::calculateBufferSize(audio.size(), sizeof(int16_t), 1);
+    std::shared_ptr<AudioInputStream> stream =
+        AudioInputStream::create(std::make_shared<AudioInputStream::Buffer>(bufferSize), sizeof(int16_t), 1);
+    ASSERT_TRUE(stream);
+    std::shared_ptr<AudioInputStream::Writer> writer =
+        stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+    std::shared_ptr<AttachmentReader> reader = InProcessAttachmentReader::create(ReaderPolicy::NONBLOCKING, stream);
+    ASSERT_TRUE(writer);
+    ASSERT_TRUE(reader);
+
+    // Simulate a microphone, in the same way @c FileBasedAudioInjector feeds @c AudioInjectorMicrophone.
+    auto wakeTime = std::chrono::steady_clock::now();
+    std::thread microphone([&audio, writer, wakeTime] {
+        for (size_t offset = 0; offset < audio.size(); offset += SAMPLES_PER_CHUNK) {
+            std::this_thread::sleep_until(wakeTime + CHUNK_DURATION * (offset / SAMPLES_PER_CHUNK));
+            writer->write(audio.data() + offset, std::min(SAMPLES_PER_CHUNK, audio.size() - offset));
+        }
+        writer->close();
+    });
+
+    MessageRequestObserverInterface::Status status;
+    auto sent = client->sendEvent(buildRecognizeEvent("recognize-1", "dialog-1"), reader, &status);
+    microphone.join();
+    ASSERT_TRUE(sent);
+    ASSERT_EQ(MessageRequestObserverInterface::Status::SUCCESS, status);
+
+    LocalAVSServer::EventRecord record;
+    ASSERT_TRUE(m_server->waitForEvent("recognize-1", std::chrono::milliseconds(TIMEOUT), &record));
+    ASSERT_TRUE(record.hasAttachment);
+    EXPECT_EQ("dialog-1", record.dialogRequestId);
+
+    DirectiveRecorder::ReceivedDirective received;
+    ASSERT_TRUE(client->m_directiveRecorder->waitForDirective(0, &received));
+    EXPECT_NE(std::string::npos, received.message.find("dialog-1"));
+    auto directive = AVSDirective::create(received.message, client->m_attachmentManager, received.contextId);
+    ASSERT_TRUE(directive.first);
+    auto audioReader = directive.first->getAttachmentReader(SPEAK_CONTENT_ID, ReaderPolicy::NONBLOCKING);
+    ASSERT_TRUE(audioReader);
+
+    char buffer[1024];
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (0 == audioReader->read(buffer, sizeof(buffer), &readStatus)) {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    auto firstAudioTime = std::chrono::steady_clock::now();
+
+    auto wakeToFirstByte = toMilliseconds(record.firstAttachmentByte - wakeTime);
+    auto directiveToFirstAudio = toMilliseconds(firstAudioTime - record.responseStart);
+    RecordProperty("wakeToFirstByteUs", static_cast<int>(wakeToFirstByte * 1000));
+    RecordProperty("directiveToFirstAudioUs", static_cast<int>(directiveToFirstAudio * 1000));
+}
+
+/**
+ * Test that injected delays and losses reach the client as slow and failed events.
+ */
+TEST_F(LocalAVSLatencyTest, test_faultInjection) {
+    LocalAVSServer::FaultInjection faults;
+    faults.responseDelay = INJECTED_DELAY;
+    faults.eventLossRate = INJECTED_LOSS_RATE;
+    m_server->setFaultInjection(faults);
+
+    auto& client = m_clients.front();
+    std::vector<double> latencies;
+    size_t failures = 0;
+    for (size_t i = 0; i < FAULT_INJECTION_EVENTS; ++i) {
+        auto messageId = "fault-" + std::to_string(i);
+        auto sendTime = std::chrono::steady_clock::now();
+        MessageRequestObserverInterface::Status status;
+        ASSERT_TRUE(client->sendEvent(buildSynchronizeStateEvent(messageId), nullptr, &status));
+        auto latency = toMilliseconds(std::chrono::steady_clock::now() - sendTime);
+
+        LocalAVSServer::EventRecord record;
+        ASSERT_TRUE(m_server->waitForEvent(messageId, std::chrono::milliseconds(TIMEOUT), &record));
+        if (record.lost) {
+            EXPECT_NE(MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT, status);
+            ++failures;
+        } else {
+            EXPECT_EQ(MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT, status);
+            EXPECT_GE(latency, toMilliseconds(INJECTED_DELAY));
+            latencies.push_back(latency);
+        }
+    }
+    m_server->setFaultInjection(LocalAVSServer::FaultInjection());
+
+    EXPECT_GT(failures, 0u);
+    EXPECT_LT(failures, FAULT_INJECTION_EVENTS);
+    RecordProperty("lostEvents", static_cast<int>(failures));
+    reportLatencies("delayedEventLatency", latencies);
+}
+
+/**
+ * Measure the latency of directives pushed on the downchannel of every client. This is a benchmark, so it only runs
+ * when disabled tests are requested.
+ */
+TEST_F(LocalAVSLatencyTest, DISABLED_test_downchannelPushLatency) {
+    std::vector<double> latencies;
+    for (size_t i = 0; i < PUSHED_DIRECTIVES; ++i) {
+        auto pushTime = std::chrono::steady_clock::now();
+        ASSERT_EQ(m_clients.size(), m_server->pushDirective({PUSHED_DIRECTIVE_JSON, {}}));
+        for (auto& client : m_clients) {
+            DirectiveRecorder::ReceivedDirective received;
+            ASSERT_TRUE(client->m_directiveRecorder->waitForDirective(i, &received));
+            latencies.push_back(toMilliseconds(received.time - pushTime));
+        }
+    }
+    reportLatencies("downchannelPushLatency", latencies);
+}
+
+}  // namespace test
+}  // namespace integration
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    if (argc < 2) {
+        std::cerr << "USAGE: " << std::string(argv[0]) << " <path_to_inputs_folder> [number_of_clients]" << std::endl;
+        return 1;
+    }
+    alexaClientSDK::integration::test::g_inputPath = std::string(argv[1]);
+    if (argc > 2) {
+        alexaClientSDK::integration::test::g_numClients = std::max(1, std::stoi(argv[2]));
+    }
+    return RUN_ALL_TESTS();
+}
@@ -19,6 +19,10 @@
 
 #include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <AVSCommon/AVS/ContentType.h>
 #include <AVSCommon/AVS/MixingBehavior.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
@@ -34,6 +38,11 @@ namespace interruptModel {
  * determine the MixingBehavior to be taken by the ChannelObservers
  * corresponding to the lower priority channel being backgrounded when
  * a higher priority channel barges-in.
+ *
+ * The configuration is compiled at creation into a table indexed by
+ * channel and content type, so that looking up a MixingBehavior does not
+ * walk the configuration or allocate. Entries of the configuration which
+ * cannot be compiled are listed in a validation report.
  */
 class InterruptModel {
 public:
@@ -69,6 +78,15 @@ public:
         const std::string& highPriorityChannel,
         avsCommon::avs::ContentType highPriorityContentType) const;
 
+    /**
+     * Get the problems found in the configuration when it was compiled. Each problem is described by the path of
+     * the offending entry in the configuration, followed by the reason it was ignored. Lookups covered by an ignored
+     * entry return MixingBehavior::UNDEFINED.
+     *
+     * @return The list of problems, empty if the whole configuration was valid.
+     */
+    const std::vector<std::string>& getValidationReport() const;
+
 private:
     /**
      * Constructor
@@ -76,8 +94,47 @@ private:
      */
     InterruptModel(avsCommon::utils::configuration::ConfigurationNode interactionConfiguration);
 
-    /// @c ConfigurationNode that contains the @c InterruptModelConfiguration
-    avsCommon::utils::configuration::ConfigurationNode m_interactionConfiguration;
+    /**
+     * Compile the configuration into @c m_channelIndices and @c m_mixingBehaviors, filling @c m_validationReport.
+     *
+     * @param interactionConfiguration interrupt model configuration for device.
+     */
+    void compile(const avsCommon::utils::configuration::ConfigurationNode& interactionConfiguration);
+
+    /**
+     * Get the index of a channel in @c m_mixingBehaviors, adding it if needed. Only used while compiling.
+     *
+     * @param channel The name of the channel.
+     * @return The index of the channel.
+     */
+    size_t addChannel(const std::string& channel);
+
+    /**
+     * Get the position of an entry in @c m_mixingBehaviors.
+     *
+     * @param lowPriorityChannel Index of the lower priority channel.
+     * @param lowPriorityContentType Index of the lower priority content type.
+     * @param highPriorityChannel Index of the channel barging in.
+     * @param highPriorityContentType Index of the content type barging in.
+     * @return The position of the entry.
+     */
+    size_t getTableIndex(
+        size_t lowPriorityChannel,
+        size_t lowPriorityContentType,
+        size_t highPriorityChannel,
+        size_t highPriorityContentType) const;
+
+    /// Index in @c m_mixingBehaviors of every channel named in the configuration.
+    std::unordered_map<std::string, size_t> m_channelIndices;
+
+    /**
+     * The MixingBehavior of every combination of channels and content types, indexed by
+     * [lowPriorityChannel][lowPriorityContentType][highPriorityChannel][highPriorityContentType].
+     */
+    std::vector<avsCommon::avs::MixingBehavior> m_mixingBehaviors;
+
+    /// The problems found when compiling the configuration.
+    std::vector<std::string> m_validationReport;
 };
 }  // namespace interruptModel
 }  // namespace afml
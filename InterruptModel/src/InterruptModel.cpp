@@ -13,6 +13,8 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+#include <rapidjson/document.h>
+
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
@@ -34,6 +36,42 @@ static const std::string CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY = "contentType"
 static const std::string HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY = "incomingChannel";
 static const std::string HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY = "incomingContentType";
 
+/// Separator between the keys of a path in the validation report.
+static const std::string PATH_SEPARATOR = ".";
+
+/// Number of @c ContentType values which can be configured.
+static constexpr size_t NUM_CONTENT_TYPES = static_cast<size_t>(ContentType::NUM_CONTENT_TYPE);
+
+/**
+ * Get the index of a @c ContentType from its name in the configuration.
+ *
+ * @param name The name of the content type.
+ * @return The index of the content type, or @c NUM_CONTENT_TYPES if the name is not a content type.
+ */
+static size_t getContentTypeIndex(const std::string& name) {
+    for (size_t index = 0; index < NUM_CONTENT_TYPES; ++index) {
+        if (contentTypeToString(static_cast<ContentType>(index)) == name) {
+            return index;
+        }
+    }
+    return NUM_CONTENT_TYPES;
+}
+
+/**
+ * Find an object member of a JSON object.
+ *
+ * @param object The JSON object to search.
+ * @param key The key of the member.
+ * @return The member, or nullptr if there is no such member or it is not an object.
+ */
+static const rapidjson::Value* findObject(const rapidjson::Value& object, const std::string& key) {
+    auto it = object.FindMember(key.c_str());
+    if (object.MemberEnd() == it || !it->value.IsObject()) {
+        return nullptr;
+    }
+    return &it->value;
+}
+
 std::shared_ptr<InterruptModel> InterruptModel::createInterruptModel(const std::shared_ptr<ConfigurationNode>& config) {
     if (!config) {
         ACSDK_ERROR(LX("createInterruptModelFailed").m("invalid config"));
@@ -51,77 +89,203 @@ std::shared_ptr<InterruptModel> InterruptModel::create(ConfigurationNode interac
     return std::shared_ptr<InterruptModel>(new InterruptModel(interactionConfiguration));
 }
 
-InterruptModel::InterruptModel(ConfigurationNode interactionConfiguration) :
-        m_interactionConfiguration(interactionConfiguration) {
+InterruptModel::InterruptModel(ConfigurationNode interactionConfiguration) {
+    compile(interactionConfiguration);
 }
 
-MixingBehavior InterruptModel::getMixingBehavior(
-    const std::string& lowPrioChannel,
-    ContentType lowPrioContentType,
-    const std::string& highPrioChannel,
-    ContentType highPrioContentType) const {
-    ACSDK_INFO(LX(__func__)
-                   .d("lowPriochannel", lowPrioChannel)
-                   .d("lowPrioContentType", lowPrioContentType)
-                   .d("highPrioChannel", highPrioChannel)
-                   .d("highPrioContentType", highPrioContentType));
-
-    auto lowPrioChannelConfig = m_interactionConfiguration[lowPrioChannel];
-    if (!lowPrioChannelConfig) {
-        ACSDK_WARN(LX(__func__).d("Channel Not found", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
-    }
+void InterruptModel::compile(const ConfigurationNode& interactionConfiguration) {
+    auto reportProblem = [this](const std::string& path, const std::string& reason) {
+        ACSDK_WARN(LX("compileInterruptModel").d("path", path).d("reason", reason));
+        m_validationReport.push_back(path + ": " + reason);
+    };
 
-    auto lowPrioChannelInteractionConfig = lowPrioChannelConfig[CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY];
-    if (!lowPrioChannelInteractionConfig) {
-        ACSDK_WARN(LX(__func__).d("No InteractionConfig found for ", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
+    rapidjson::Document document;
+    if (document.Parse(interactionConfiguration.serialize().c_str()).HasParseError() || !document.IsObject()) {
+        reportProblem(INTERRUPT_MODEL_CONFIG_KEY, "notAnObject");
+        return;
     }
 
-    auto lowPrioChannelContentTypeConfig = lowPrioChannelInteractionConfig[contentTypeToString(lowPrioContentType)];
-    if (!lowPrioChannelContentTypeConfig) {
-        ACSDK_WARN(LX(__func__)
-                       .m("No ContentType Config found")
-                       .d("channel", lowPrioChannel)
-                       .d("contentType", lowPrioContentType));
-        return MixingBehavior::UNDEFINED;
-    }
+    /// A MixingBehavior found in the configuration, recorded until all the channels are known.
+    struct Entry {
+        size_t lowPrioChannel;
+        size_t lowPrioContentType;
+        size_t highPrioChannel;
+        size_t highPrioContentType;
+        MixingBehavior mixingBehavior;
+    };
+    std::vector<Entry> entries;
 
-    auto highPrioChannelConfigRoot = lowPrioChannelContentTypeConfig[HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY];
-    if (!highPrioChannelConfigRoot) {
-        ACSDK_WARN(LX(__func__)
-                       .m("No Config found for")
-                       .d("highPrioChannel", highPrioChannel)
-                       .d("lowPrioChannel", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
-    }
+    for (auto channel = document.MemberBegin(); channel != document.MemberEnd(); ++channel) {
+        const std::string lowPrioChannel = channel->name.GetString();
+        auto lowPrioChannelIndex = addChannel(lowPrioChannel);
+        if (!channel->value.IsObject()) {
+            reportProblem(lowPrioChannel, "notAnObject");
+            continue;
+        }
+        if (channel->value.ObjectEmpty()) {
+            continue;
+        }
 
-    auto highPrioChannelConfig = highPrioChannelConfigRoot[highPrioChannel];
-    if (!highPrioChannelConfig) {
-        ACSDK_WARN(LX(__func__).m("No Config found for").d("key", highPrioChannel).d("lowPrioChannel", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
+        auto contentTypes = findObject(channel->value, CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY);
+        if (!contentTypes) {
+            reportProblem(lowPrioChannel, "missing " + CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY);
+            continue;
+        }
+
+        for (auto contentType = contentTypes->MemberBegin(); contentType != contentTypes->MemberEnd();
+             ++contentType) {
+            const std::string contentTypeName = contentType->name.GetString();
+            const auto contentTypePath =
+                lowPrioChannel + PATH_SEPARATOR + CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY + PATH_SEPARATOR +
+                contentTypeName;
+            auto lowPrioContentTypeIndex = getContentTypeIndex(contentTypeName);
+            if (NUM_CONTENT_TYPES == lowPrioContentTypeIndex) {
+                reportProblem(contentTypePath, "unknownContentType");
+                continue;
+            }
+            if (!contentType->value.IsObject()) {
+                reportProblem(contentTypePath, "notAnObject");
+                continue;
+            }
+            if (contentType->value.ObjectEmpty()) {
+                continue;
+            }
+
+            auto incomingChannels = findObject(contentType->value, HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY);
+            if (!incomingChannels) {
+                reportProblem(contentTypePath, "missing " + HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY);
+                continue;
+            }
+
+            for (auto incomingChannel = incomingChannels->MemberBegin();
+                 incomingChannel != incomingChannels->MemberEnd();
+                 ++incomingChannel) {
+                const std::string highPrioChannel = incomingChannel->name.GetString();
+                const auto incomingChannelPath =
+                    contentTypePath + PATH_SEPARATOR + HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY + PATH_SEPARATOR +
+                    highPrioChannel;
+                auto highPrioChannelIndex = addChannel(highPrioChannel);
+                if (!incomingChannel->value.IsObject()) {
+                    reportProblem(incomingChannelPath, "notAnObject");
+                    continue;
+                }
+                if (incomingChannel->value.ObjectEmpty()) {
+                    continue;
+                }
+
+                auto incomingContentTypes =
+                    findObject(incomingChannel->value, HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY);
+                if (!incomingContentTypes) {
+                    reportProblem(incomingChannelPath, "missing " + HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY);
+                    continue;
+                }
+
+                for (auto incomingContentType = incomingContentTypes->MemberBegin();
+                     incomingContentType != incomingContentTypes->MemberEnd();
+                     ++incomingContentType) {
+                    const std::string incomingContentTypeName = incomingContentType->name.GetString();
+                    const auto incomingContentTypePath = incomingChannelPath + PATH_SEPARATOR +
+                                                         HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY +
+                                                         PATH_SEPARATOR + incomingContentTypeName;
+                    auto highPrioContentTypeIndex = getContentTypeIndex(incomingContentTypeName);
+                    if (NUM_CONTENT_TYPES == highPrioContentTypeIndex) {
+                        reportProblem(incomingContentTypePath, "unknownContentType");
+                        continue;
+                    }
+                    if (!incomingContentType->value.IsString()) {
+                        reportProblem(incomingContentTypePath, "notAString");
+                        continue;
+                    }
+                    const std::string mixingBehaviorName = incomingContentType->value.GetString();
+                    auto mixingBehavior = avsCommon::avs::getMixingBehavior(mixingBehaviorName);
+                    if (MixingBehavior::UNDEFINED == mixingBehavior) {
+                        reportProblem(incomingContentTypePath, "invalidMixingBehavior " + mixingBehaviorName);
+                        continue;
+                    }
+                    entries.push_back(
+                        {lowPrioChannelIndex,
+                         lowPrioContentTypeIndex,
+                         highPrioChannelIndex,
+                         highPrioContentTypeIndex,
+                         mixingBehavior});
+                }
+            }
+        }
     }
 
-    auto highPrioChannelContentTypeRoot = highPrioChannelConfig[HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY];
-    if (!highPrioChannelContentTypeRoot) {
-        ACSDK_WARN(
-            LX(__func__).m("No Config found for").d("key", highPrioContentType).d("lowPrioChannel", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
+    auto numChannels = m_channelIndices.size();
+    m_mixingBehaviors.assign(
+        numChannels * NUM_CONTENT_TYPES * numChannels * NUM_CONTENT_TYPES, MixingBehavior::UNDEFINED);
+    for (const auto& entry : entries) {
+        m_mixingBehaviors[getTableIndex(
+            entry.lowPrioChannel, entry.lowPrioContentType, entry.highPrioChannel, entry.highPrioContentType)] =
+            entry.mixingBehavior;
     }
 
-    std::string retMixingBehaviorStr;
-    if (!highPrioChannelContentTypeRoot.getString(contentTypeToString(highPrioContentType), &retMixingBehaviorStr)) {
-        ACSDK_WARN(LX(__func__).d("Key Not Found", contentTypeToString(highPrioContentType)));
+    ACSDK_DEBUG5(LX("compileInterruptModel")
+                     .d("channels", numChannels)
+                     .d("mixingBehaviors", entries.size())
+                     .d("problems", m_validationReport.size()));
+}
+
+size_t InterruptModel::addChannel(const std::string& channel) {
+    return m_channelIndices.insert({channel, m_channelIndices.size()}).first->second;
+}
+
+size_t InterruptModel::getTableIndex(
+    size_t lowPrioChannel,
+    size_t lowPrioContentType,
+    size_t highPrioChannel,
+    size_t highPrioContentType) const {
+    auto numChannels = m_channelIndices.size();
+    return ((lowPrioChannel * NUM_CONTENT_TYPES + lowPrioContentType) * numChannels + highPrioChannel) *
+               NUM_CONTENT_TYPES +
+           highPrioContentType;
+}
+
+MixingBehavior InterruptModel::getMixingBehavior(
+    const std::string& lowPrioChannel,
+    ContentType lowPrioContentType,
+    const std::string& highPrioChannel,
+    ContentType highPrioContentType) const {
+    ACSDK_DEBUG5(LX(__func__)
+                     .d("lowPriochannel", lowPrioChannel)
+                     .d("lowPrioContentType", lowPrioContentType)
+                     .d("highPrioChannel", highPrioChannel)
+                     .d("highPrioContentType", highPrioContentType));
+
+    auto lowPrioChannelIt = m_channelIndices.find(lowPrioChannel);
+    auto highPrioChannelIt = m_channelIndices.find(highPrioChannel);
+    auto lowPrioContentTypeIndex = static_cast<size_t>(lowPrioContentType);
+    auto highPrioContentTypeIndex = static_cast<size_t>(highPrioContentType);
+    if (m_channelIndices.end() == lowPrioChannelIt || m_channelIndices.end() == highPrioChannelIt ||
+        lowPrioContentTypeIndex >= NUM_CONTENT_TYPES || highPrioContentTypeIndex >= NUM_CONTENT_TYPES) {
+        ACSDK_WARN(LX(__func__)
+                       .m("No Config found for")
+                       .d("lowPrioChannel", lowPrioChannel)
+                       .d("lowPrioContentType", lowPrioContentType)
+                       .d("highPrioChannel", highPrioChannel)
+                       .d("highPrioContentType", highPrioContentType));
         return MixingBehavior::UNDEFINED;
     }
 
-    MixingBehavior retMixingBehavior = avsCommon::avs::getMixingBehavior(retMixingBehaviorStr);
-    if (MixingBehavior::UNDEFINED == retMixingBehavior) {
-        ACSDK_ERROR(LX(__func__).d("Invalid MixingBehavior specified", retMixingBehaviorStr));
+    auto mixingBehavior = m_mixingBehaviors[getTableIndex(
+        lowPrioChannelIt->second, lowPrioContentTypeIndex, highPrioChannelIt->second, highPrioContentTypeIndex)];
+    if (MixingBehavior::UNDEFINED == mixingBehavior) {
+        ACSDK_WARN(LX(__func__)
+                       .m("No MixingBehavior configured for")
+                       .d("lowPrioChannel", lowPrioChannel)
+                       .d("lowPrioContentType", lowPrioContentType)
+                       .d("highPrioChannel", highPrioChannel)
+                       .d("highPrioContentType", highPrioContentType));
     }
+    return mixingBehavior;
+}
 
-    return retMixingBehavior;
+const std::vector<std::string>& InterruptModel::getValidationReport() const {
+    return m_validationReport;
 }
+
 }  // namespace interruptModel
 }  // namespace afml
 }  // namespace alexaClientSDK
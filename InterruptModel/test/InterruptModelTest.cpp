@@ -34,6 +34,7 @@ using JSONStream = std::vector<std::shared_ptr<std::istream>>;
 static const std::string CONTENT_CHANNEL = "Content";
 static const std::string DIALOG_CHANNEL = "Dialog";
 static const std::string ALERT_CHANNEL = "Alert";
+static const std::string COMMUNICATIONS_CHANNEL = "Communications";
 static const ContentType MIXABLE_CONTENT_TYPE = ContentType::MIXABLE;
 static const ContentType NONMIXABLE_CONTENT_TYPE = ContentType::NONMIXABLE;
 static const ContentType INVALID_CONTENT_TYPE = ContentType::NUM_CONTENT_TYPE;
@@ -264,6 +265,44 @@ TEST_F(InterruptModelTest, test_InvalidIncomingMixingBehaviorReturnsUndefined) {
     ASSERT_EQ(MixingBehavior::UNDEFINED, retMixingBehavior);
 }
 
+TEST_F(InterruptModelTest, test_ConfiguredMixingBehaviorIsReturned) {
+    ASSERT_EQ(
+        MixingBehavior::MUST_PAUSE,
+        m_interruptModel->getMixingBehavior(
+            CONTENT_CHANNEL, MIXABLE_CONTENT_TYPE, COMMUNICATIONS_CHANNEL, NONMIXABLE_CONTENT_TYPE));
+    ASSERT_EQ(
+        MixingBehavior::MAY_DUCK,
+        m_interruptModel->getMixingBehavior(
+            CONTENT_CHANNEL, MIXABLE_CONTENT_TYPE, COMMUNICATIONS_CHANNEL, MIXABLE_CONTENT_TYPE));
+    ASSERT_EQ(
+        MixingBehavior::MAY_DUCK,
+        m_interruptModel->getMixingBehavior(
+            ALERT_CHANNEL, MIXABLE_CONTENT_TYPE, COMMUNICATIONS_CHANNEL, NONMIXABLE_CONTENT_TYPE));
+}
+
+TEST_F(InterruptModelTest, test_ValidationReportListsMalformedEntries) {
+    const std::vector<std::string> expected = {
+        "Communications.contentType.NONMIXABLE.incomingChannel.Dialog.incomingContentType.MIXABLE: "
+        "invalidMixingBehavior MAY_PAUSE",
+        "Content.contentType.MIXABLE.incomingChannel.Alert: missing incomingContentType",
+        "Content.contentType.NONMIXABLE.incomingChannel.Alert: missing incomingContentType",
+        "VirtualChannel1: missing contentType",
+        "VirtualChannel2.contentType.NONMIXABLE.incomingChannel.Alert.incomingContentType.MIXABLE: "
+        "invalidMixingBehavior InvalidMixingBehavior"};
+    ASSERT_EQ(expected, m_interruptModel->getValidationReport());
+}
+
+TEST_F(InterruptModelTest, test_DefaultConfigurationsAreValid) {
+    for (auto supportsDucking : {true, false}) {
+        ConfigurationNode::uninitialize();
+        JSONStream jsonStream({std::shared_ptr<std::istream>(InterruptModelConfiguration::getConfig(supportsDucking))});
+        ASSERT_TRUE(ConfigurationNode::initialize(jsonStream));
+        auto interruptModel = InterruptModel::create(ConfigurationNode::getRoot()[INTERRUPT_MODEL_KEY]);
+        ASSERT_NE(nullptr, interruptModel);
+        ASSERT_TRUE(interruptModel->getValidationReport().empty());
+    }
+}
+
 }  // namespace test
 }  // namespace interruptModel
 }  // namespace afml
@@ -84,6 +84,12 @@ private:
 
     /// Indicates whether to play from the audio source in a loop.
     const bool m_repeat;
+
+    /**
+     * Whether @c m_reader reports when data becomes available.  If it does, reading stops when there is no data
+     * until the reader's callback is made, instead of retrying on a timer.
+     */
+    bool m_hasDataAvailableCallback;
 };
 
 }  // namespace mediaPlayer
@@ -116,6 +116,18 @@ protected:
      */
     void uninstallOnReadDataHandler();
 
+    /**
+     * Stop calling the @c onReadData() handler until @c signalDataAvailable() is called.  Sources which are notified
+     * when data becomes available use this instead of @c updateOnReadDataHandler() when there is no data to read.
+     */
+    void waitForDataAvailable();
+
+    /**
+     * Signal that data may be available to read.  This function may be called from any thread.  If the
+     * @c onReadData() handler was stopped by @c waitForDataAvailable(), it is installed again on the worker thread.
+     */
+    void signalDataAvailable();
+
     /**
      * Clear out the tracking of the @c onReadData() handler callback.  This is used when gstreamer is
      * known to have uninstalled the handler on its own.
@@ -161,6 +173,13 @@ private:
 
     static gboolean onSeekData(GstElement* pipeline, guint64 offset, gpointer source);
 
+    /**
+     * Installs the @c onReadData() handler again if it was stopped by @c waitForDataAvailable().
+     *
+     * @return @c false always.
+     */
+    gboolean handleDataAvailable();
+
     /**
      * The callback for reading data from this instance.
      *
@@ -187,6 +206,12 @@ private:
     /// Function to invoke on the worker thread thread when there is enough data.
     const std::function<gboolean()> m_handleEnoughDataFunction;
 
+    /// Function to invoke on the worker thread when data may be available to read.
+    const std::function<gboolean()> m_handleDataAvailableFunction;
+
+    /// Whether the @c onReadData() handler was stopped by @c waitForDataAvailable().  Only used on the worker thread.
+    bool m_waitingForDataAvailable;
+
     /// ID of the handler installed to receive need data signals.
     guint m_needDataHandlerId;
 
@@ -205,6 +230,9 @@ private:
     /// ID of idle callback to handle enough data.
     guint m_enoughDataCallbackId;
 
+    /// ID of idle callback to handle data becoming available.
+    guint m_dataAvailableCallbackId;
+
     /// Mutex to serialize access to the observers.
     std::mutex m_observersMutex;
 
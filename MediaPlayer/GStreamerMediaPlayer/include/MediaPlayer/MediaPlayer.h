@@ -39,6 +39,7 @@
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
 #include <AVSCommon/Utils/MediaType.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/PlaylistParser/PlaylistParserInterface.h>
 #include <PlaylistParser/UrlContentToAttachmentConverter.h>
 
@@ -73,6 +74,7 @@ public:
      * @param enableEqualizer Flag, indicating whether equalizer should be enabled for this instance.
      * @param name Readable name for the new instance.
      * @param enableLiveMode Flag, indicating if the player is in live mode.
+     * @param metricRecorder The metric recorder used to report transition gaps. May be @c nullptr.
      * @return An instance of the @c MediaPlayer if successful else a @c nullptr.
      */
     static std::shared_ptr<MediaPlayer> create(
@@ -80,7 +82,8 @@ public:
             nullptr,
         bool enableEqualizer = false,
         std::string name = "",
-        bool enableLiveMode = false);
+        bool enableLiveMode = false,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
     /**
      * Destructor.
      */
@@ -123,6 +126,12 @@ public:
      * will reset the pipeline and source, and will not resume playback.
      */
     bool resume(SourceId id) override;
+    /**
+     * Sets the pipeline of the current source to PAUSED, so the transient elements are built, caps are negotiated and
+     * the first buffers are decoded before @c play is called. Once prerolled, @c play only has to move the pipeline
+     * to PLAYING.
+     */
+    bool preroll(SourceId id) override;
     uint64_t getNumBytesBuffered() override;
     std::chrono::milliseconds getOffset(SourceId id) override;
     avsCommon::utils::Optional<avsCommon::utils::mediaPlayer::MediaPlayerState> getMediaPlayerState(
@@ -237,12 +246,14 @@ private:
      * @param enableEqualizer Flag, indicating whether equalizer should be enabled for this instance.
      * @param name Readable name of this instance.
      * @param enableLiveMode Flag, indicating the player is in live mode
+     * @param metricRecorder The metric recorder used to report transition gaps.
      */
     MediaPlayer(
         std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
         bool enableEqualizer,
         std::string name,
-        bool enableLiveMode);
+        bool enableLiveMode,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
 
     /**
      * Handle source configuration.
@@ -472,6 +483,15 @@ private:
      */
     void handleResume(SourceId id, std::promise<bool>* promise);
 
+    /**
+     * Worker thread handler for prerolling the current audio source.
+     *
+     * @param id The @c SourceId that the caller is expecting to be handled.
+     * @param promise A promise to fulfill with a @c bool value once prerolling has been initiated
+     * (or the operation has failed).
+     */
+    void handlePreroll(SourceId id, std::promise<bool>* promise);
+
     /**
      * Worker thread handler for getting the current playback position.
      *
@@ -621,9 +641,22 @@ private:
 
     /**
      * Destructs the @c m_source with proper steps.
+     *
+     * When keeping the pipeline ready is enabled and the pipeline is active, only the transient elements are shut down
+     * and the rest of the pipeline is kept in READY, so the audio sink stays open for the next source.
      */
     void cleanUpSource();
 
+    /**
+     * Record the start of a transition from one source, or one part of a source, to the next.
+     */
+    void startTransition();
+
+    /**
+     * Report the gap of a pending transition once audio is flowing again.
+     */
+    void finishTransition();
+
     /// @name Overridden EqualizerInterface methods.
     /// @{
     void setEqualizerBandLevels(acsdkEqualizerInterfaces::EqualizerBandLevelMap bandLevelMap) override;
@@ -715,6 +748,24 @@ private:
     /// Flag to indicate whether a pause should happen immediately.
     bool m_pauseImmediately;
 
+    /// Flag to indicate whether the pipeline is being prerolled ahead of a @c play call.
+    bool m_isPrerolling;
+
+    /// Flag to indicate whether buffering completed while the pipeline was being prerolled.
+    bool m_isPrerollBuffered;
+
+    /// Flag to indicate whether the pipeline is kept in READY between sources.
+    const bool m_keepPipelineReady;
+
+    /// Flag to indicate whether a transition gap is being measured.
+    bool m_isTransitionPending;
+
+    /// Time at which the pending transition started.
+    std::chrono::steady_clock::time_point m_transitionStartTime;
+
+    /// The metric recorder used to report transition gaps.
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
+
     /// Stream offset before we teardown the pipeline
     std::chrono::milliseconds m_offsetBeforeTeardown;
 
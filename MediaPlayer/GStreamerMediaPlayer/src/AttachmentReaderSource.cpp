@@ -62,7 +62,12 @@ AttachmentReaderSource::AttachmentReaderSource(
     bool repeat) :
         BaseStreamSource{pipeline, "AttachmentReaderSource"},
         m_reader{reader},
-        m_repeat{repeat} {};
+        m_repeat{repeat},
+        m_hasDataAvailableCallback{false} {
+    if (m_reader) {
+        m_hasDataAvailableCallback = m_reader->setDataAvailableCallback([this]() { signalDataAvailable(); });
+    }
+};
 
 bool AttachmentReaderSource::isPlaybackRemote() const {
     return false;
@@ -74,6 +79,9 @@ bool AttachmentReaderSource::isOpen() {
 
 void AttachmentReaderSource::close() {
     if (m_reader) {
+        if (m_hasDataAvailableCallback) {
+            m_reader->setDataAvailableCallback(nullptr);
+        }
         m_reader->close();
     }
     m_reader.reset();
@@ -137,7 +145,11 @@ gboolean AttachmentReaderSource::handleReadData() {
                 }
             } else {
                 gst_buffer_unref(buffer);
-                updateOnReadDataHandler();
+                if (m_hasDataAvailableCallback) {
+                    waitForDataAvailable();
+                } else {
+                    updateOnReadDataHandler();
+                }
             }
             return true;
         case AttachmentReader::ReadStatus::OK_OVERRUN_RESET:  // gstreamer requires stable stream.
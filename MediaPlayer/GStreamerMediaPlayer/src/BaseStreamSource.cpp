@@ -91,11 +91,14 @@ BaseStreamSource::BaseStreamSource(PipelineInterface* pipeline, const std::strin
         m_sourceRetryCount{0},
         m_handleNeedDataFunction{[this]() { return handleNeedData(); }},
         m_handleEnoughDataFunction{[this]() { return handleEnoughData(); }},
+        m_handleDataAvailableFunction{[this]() { return handleDataAvailable(); }},
+        m_waitingForDataAvailable{false},
         m_needDataHandlerId{0},
         m_enoughDataHandlerId{0},
         m_seekDataHandlerId{0},
         m_needDataCallbackId{0},
-        m_enoughDataCallbackId{0} {
+        m_enoughDataCallbackId{0},
+        m_dataAvailableCallbackId{0} {
 }
 
 BaseStreamSource::~BaseStreamSource() {
@@ -122,6 +125,9 @@ BaseStreamSource::~BaseStreamSource() {
         if (m_enoughDataCallbackId && !m_pipeline->removeSource(m_enoughDataCallbackId)) {
             ACSDK_ERROR(LX("gSourceRemove failed for m_enoughDataCallbackId"));
         }
+        if (m_dataAvailableCallbackId && !m_pipeline->removeSource(m_dataAvailableCallbackId)) {
+            ACSDK_ERROR(LX("gSourceRemove failed for m_dataAvailableCallbackId"));
+        }
     }
     uninstallOnReadDataHandler();
 }
@@ -297,6 +303,31 @@ void BaseStreamSource::uninstallOnReadDataHandler() {
     }
 }
 
+void BaseStreamSource::waitForDataAvailable() {
+    ACSDK_DEBUG9(LX("waitForDataAvailable"));
+    uninstallOnReadDataHandler();
+    m_waitingForDataAvailable = true;
+}
+
+void BaseStreamSource::signalDataAvailable() {
+    std::lock_guard<std::mutex> lock(m_callbackIdMutex);
+    if (m_dataAvailableCallbackId) {
+        return;
+    }
+    m_dataAvailableCallbackId = m_pipeline->queueCallback(&m_handleDataAvailableFunction);
+}
+
+gboolean BaseStreamSource::handleDataAvailable() {
+    ACSDK_DEBUG9(LX("handleDataAvailableCalled").d("waitingForDataAvailable", m_waitingForDataAvailable));
+    std::lock_guard<std::mutex> lock(m_callbackIdMutex);
+    m_dataAvailableCallbackId = 0;
+    if (m_waitingForDataAvailable) {
+        m_waitingForDataAvailable = false;
+        installOnReadDataHandler();
+    }
+    return false;
+}
+
 void BaseStreamSource::clearOnReadDataHandler() {
     ACSDK_DEBUG9(LX("clearOnReadDataHandlerCalled").d("sourceId", m_sourceId));
     m_sourceRetryCount = 0;
@@ -318,6 +349,7 @@ gboolean BaseStreamSource::handleNeedData() {
     ACSDK_DEBUG9(LX("handleNeedDataCalled"));
     std::lock_guard<std::mutex> lock(m_callbackIdMutex);
     m_needDataCallbackId = 0;
+    m_waitingForDataAvailable = false;
     installOnReadDataHandler();
     return false;
 }
@@ -337,6 +369,7 @@ gboolean BaseStreamSource::handleEnoughData() {
     ACSDK_DEBUG9(LX("handleEnoughDataCalled"));
     std::lock_guard<std::mutex> lock(m_callbackIdMutex);
     m_enoughDataCallbackId = 0;
+    m_waitingForDataAvailable = false;
     uninstallOnReadDataHandler();
     return false;
 }
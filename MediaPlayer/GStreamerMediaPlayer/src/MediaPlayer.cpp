@@ -25,6 +25,9 @@
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
+#include <AVSCommon/Utils/Metrics.h>
+#include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 #include <PlaylistParser/PlaylistParser.h>
 #include <PlaylistParser/UrlContentToAttachmentConverter.h>
 
@@ -45,6 +48,7 @@ using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils;
 using namespace avsCommon::utils::mediaPlayer;
 using namespace avsCommon::utils::memory;
+using namespace avsCommon::utils::metrics;
 using namespace avsCommon::utils::configuration;
 using MediaPlayerState = avsCommon::utils::mediaPlayer::MediaPlayerState;
 
@@ -56,6 +60,33 @@ static const std::string MEDIAPLAYER_CONFIGURATION_ROOT_KEY = "gstreamerMediaPla
 static const std::string MEDIAPLAYER_AUDIO_SINK_KEY = "audioSink";
 /// The key in our config file to find the output conversion type.
 static const std::string MEDIAPLAYER_OUTPUT_CONVERSION_ROOT_KEY = "outputConversion";
+
+/**
+ * Key under the MediaPlayer configuration root which keeps the pipeline in READY rather than NULL between sources, so
+ * the audio sink is not reopened for every source. The decoder is still rebuilt for each source.
+ */
+static const std::string MEDIAPLAYER_KEEP_PIPELINE_READY_KEY = "keepPipelineReady";
+
+/// Metric activity name for transitions between sources.
+static const std::string TRANSITION_METRIC_ACTIVITY_NAME = "MEDIA_PLAYER-TRANSITION";
+
+/// Metric data point name for the silence between the end of a source and the start of the next one.
+static const std::string TRANSITION_GAP = "TRANSITION_GAP";
+
+/// Gaps longer than this are not back-to-back transitions and are not reported.
+static const std::chrono::milliseconds MAX_TRANSITION_GAP{2000};
+
+/**
+ * Read whether the pipeline is kept in READY between sources from the MediaPlayer configuration.
+ *
+ * @return Whether the pipeline should be kept in READY between sources.
+ */
+static bool isKeepPipelineReadyEnabled() {
+    bool enabled = false;
+    ConfigurationNode::getRoot()[MEDIAPLAYER_CONFIGURATION_ROOT_KEY].getBool(
+        MEDIAPLAYER_KEEP_PIPELINE_READY_KEY, &enabled, false);
+    return enabled;
+}
 /// The acceptable conversion keys to find in the config file
 /// Key strings are mapped to gstreamer capabilities documented here:
 /// https://gstreamer.freedesktop.org/documentation/design/mediatype-audio-raw.html
@@ -168,10 +199,11 @@ std::shared_ptr<MediaPlayer> MediaPlayer::create(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     bool enableEqualizer,
     std::string name,
-    bool enableLiveMode) {
+    bool enableLiveMode,
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) {
     ACSDK_DEBUG9(LX("createCalled").d("name", name));
     std::shared_ptr<MediaPlayer> mediaPlayer(
-        new MediaPlayer(contentFetcherFactory, enableEqualizer, name, enableLiveMode));
+        new MediaPlayer(contentFetcherFactory, enableEqualizer, name, enableLiveMode, metricRecorder));
     if (mediaPlayer->init()) {
         return mediaPlayer;
     } else {
@@ -186,6 +218,7 @@ MediaPlayer::~MediaPlayer() {
     if (m_mainLoopThread.joinable()) {
         m_mainLoopThread.join();
     }
+    gst_element_set_state(m_pipeline.pipeline, GST_STATE_NULL);
     gst_object_unref(m_pipeline.pipeline);
     resetPipeline();
 
@@ -303,6 +336,28 @@ bool MediaPlayer::play(MediaPlayer::SourceId id) {
     return false;
 }
 
+bool MediaPlayer::preroll(MediaPlayer::SourceId id) {
+    ACSDK_DEBUG9(LX("prerollCalled").d("name", RequiresShutdown::name()));
+    if (!m_source) {
+        ACSDK_ERROR(LX("prerollFailed").d("name", RequiresShutdown::name()).d("reason", "sourceNotSet"));
+        return false;
+    }
+
+    m_source->preprocess();
+
+    std::promise<bool> promise;
+    auto future = promise.get_future();
+    std::function<gboolean()> callback = [this, id, &promise]() {
+        handlePreroll(id, &promise);
+        return false;
+    };
+
+    if (queueCallback(&callback) != UNQUEUED_CALLBACK) {
+        return future.get();
+    }
+    return false;
+}
+
 bool MediaPlayer::stop(MediaPlayer::SourceId id) {
     ACSDK_DEBUG9(LX("stopCalled").d("name", RequiresShutdown::name()));
     std::promise<bool> promise;
@@ -579,7 +634,8 @@ MediaPlayer::MediaPlayer(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     bool enableEqualizer,
     std::string name,
-    bool enableLiveMode) :
+    bool enableLiveMode,
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) :
         RequiresShutdown{name},
         m_lastVolume{GST_SET_VOLUME_MAX},
         m_isMuted{false},
@@ -595,6 +651,11 @@ MediaPlayer::MediaPlayer(
         m_pausePending{false},
         m_resumePending{false},
         m_pauseImmediately{false},
+        m_isPrerolling{false},
+        m_isPrerollBuffered{false},
+        m_keepPipelineReady{isKeepPipelineReadyEnabled()},
+        m_isTransitionPending{false},
+        m_metricRecorder{metricRecorder},
         m_isLiveMode{enableLiveMode},
         m_offsetAdjustment{std::chrono::milliseconds::zero()} {
 }
@@ -836,6 +897,8 @@ void MediaPlayer::tearDownTransientPipelineElements(bool notifyStop) {
     m_pausePending = false;
     m_resumePending = false;
     m_pauseImmediately = false;
+    m_isPrerolling = false;
+    m_isPrerollBuffered = false;
     m_playbackStartedSent = false;
     m_playbackFinishedSent = false;
     m_isPaused = false;
@@ -1044,7 +1107,10 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
 
                 // Continue playback if there is additional data.
                 if (m_source->hasAdditionalData()) {
-                    if (GST_STATE_CHANGE_FAILURE == gst_element_set_state(m_pipeline.pipeline, GST_STATE_NULL)) {
+                    startTransition();
+                    // Going through READY resets the source elements without closing the audio sink.
+                    auto resetState = m_keepPipelineReady ? GST_STATE_READY : GST_STATE_NULL;
+                    if (GST_STATE_CHANGE_FAILURE == gst_element_set_state(m_pipeline.pipeline, resetState)) {
                         const std::string errorMessage{"reason=setPipelineToNullFailed"};
                         ACSDK_ERROR(LX("continuingPlaybackFailed").d("name", RequiresShutdown::name()).m(errorMessage));
                         sendPlaybackError(ErrorType::MEDIA_ERROR_INTERNAL_DEVICE_ERROR, errorMessage);
@@ -1058,6 +1124,7 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
                         break;
                     }
                 } else {
+                    startTransition();
                     sendPlaybackFinished();
                 }
             }
@@ -1124,6 +1191,7 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
                         }
                     }
                 } else if (newState == GST_STATE_PLAYING) {
+                    finishTransition();
                     if (!m_playbackStartedSent) {
                         sendPlaybackStarted();
                     } else {
@@ -1203,6 +1271,11 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
                     // To avoid starting to play if a pause() was called immediately after calling a play()
                     break;
                 }
+                if (m_isPrerolling) {
+                    // Stay in PAUSED until play() is called.
+                    m_isPrerollBuffered = true;
+                    break;
+                }
                 bool isSeekable = false;
                 if (queryIsSeekable(&isSeekable)) {
                     m_offsetManager.setIsSeekable(isSeekable);
@@ -1429,8 +1502,15 @@ void MediaPlayer::handlePlay(SourceId id, std::promise<bool>* promise) {
     m_pauseImmediately = false;
     promise->set_value(true);
 
+    bool isPrerollBuffered = m_isPrerolling && m_isPrerollBuffered;
+    m_isPrerolling = false;
+    m_isPrerollBuffered = false;
+
     GstState startingState = GST_STATE_PAUSED;
-    if (!m_isLiveMode) {
+    if (isPrerollBuffered) {
+        // The pipeline was prerolled and has already buffered enough data to start.
+        startingState = GST_STATE_PLAYING;
+    } else if (!m_isLiveMode) {
         /*
          * If the pipeline is completely buffered, then go straight to PLAY otherwise,
          * set pipeline to PAUSED state to attempt buffering.  The pipeline will be set to PLAY upon receiving buffer
@@ -1472,6 +1552,45 @@ void MediaPlayer::handlePlay(SourceId id, std::promise<bool>* promise) {
     }
 }
 
+void MediaPlayer::handlePreroll(SourceId id, std::promise<bool>* promise) {
+    ACSDK_DEBUG(
+        LX("handlePrerollCalled").d("name", RequiresShutdown::name()).d("idPassed", id).d("currentId", (m_currentId)));
+    if (!validateSourceAndId(id)) {
+        ACSDK_ERROR(LX("handlePrerollFailed").d("name", RequiresShutdown::name()));
+        promise->set_value(false);
+        return;
+    }
+
+    GstState curState;
+    auto stateChange = gst_element_get_state(m_pipeline.pipeline, &curState, NULL, TIMEOUT_ZERO_NANOSECONDS);
+    if (stateChange == GST_STATE_CHANGE_FAILURE) {
+        ACSDK_ERROR(
+            LX("handlePrerollFailed").d("name", RequiresShutdown::name()).d("reason", "gstElementGetStateFailed"));
+        promise->set_value(false);
+        return;
+    }
+    if (GST_STATE_PAUSED == curState || GST_STATE_PLAYING == curState || m_playPending) {
+        ACSDK_DEBUG(LX("handlePrerollFailed").d("name", RequiresShutdown::name()).d("reason", "alreadyStarted"));
+        promise->set_value(false);
+        return;
+    }
+
+    m_isPrerolling = true;
+    m_isPrerollBuffered = false;
+    stateChange = gst_element_set_state(m_pipeline.pipeline, GST_STATE_PAUSED);
+    ACSDK_DEBUG(LX("handlePreroll")
+                    .d("name", RequiresShutdown::name())
+                    .d("stateReturn", gst_element_state_change_return_get_name(stateChange)));
+    if (GST_STATE_CHANGE_FAILURE == stateChange) {
+        ACSDK_ERROR(
+            LX("handlePrerollFailed").d("name", RequiresShutdown::name()).d("reason", "gstElementSetStateFailure"));
+        m_isPrerolling = false;
+        promise->set_value(false);
+        return;
+    }
+    promise->set_value(true);
+}
+
 void MediaPlayer::handleStop(MediaPlayer::SourceId id, std::promise<bool>* promise) {
     ACSDK_DEBUG(
         LX("handleStopCalled").d("name", RequiresShutdown::name()).d("idPassed", id).d("currentId", (m_currentId)));
@@ -1817,6 +1936,7 @@ void MediaPlayer::sendPlaybackStopped() {
         return;
     }
     ACSDK_DEBUG(LX("callingOnPlaybackStopped").d("name", RequiresShutdown::name()).d("currentId", m_currentId));
+    m_isTransitionPending = false;
     if (ERROR_SOURCE_ID != m_currentId) {
         const MediaPlayerState state = getMediaPlayerStateInternal(m_currentId);
         for (const auto& observer : m_playerObservers) {
@@ -1846,11 +1966,16 @@ void MediaPlayer::sendPlaybackError(const ErrorType& type, const std::string& er
     m_pausePending = false;
     m_resumePending = false;
     m_pauseImmediately = false;
+    m_isTransitionPending = false;
     const MediaPlayerState state = getMediaPlayerStateInternal(m_currentId);
     for (const auto& observer : m_playerObservers) {
         observer->onPlaybackError(m_currentId, type, error, state);
     }
     tearDownTransientPipelineElements(false);
+    if (m_keepPipelineReady) {
+        // Do not keep a pipeline which failed open.
+        gst_element_set_state(m_pipeline.pipeline, GST_STATE_NULL);
+    }
     if (m_urlConverter) {
         m_urlConverter->shutdown();
     }
@@ -1925,7 +2050,22 @@ gboolean MediaPlayer::onWriteCompleteCallback(gpointer pointer) {
 
 void MediaPlayer::cleanUpSource() {
     if (m_pipeline.pipeline) {
-        gst_element_set_state(m_pipeline.pipeline, GST_STATE_NULL);
+        GstState curState = GST_STATE_NULL;
+        if (m_keepPipelineReady) {
+            gst_element_get_state(m_pipeline.pipeline, &curState, NULL, TIMEOUT_ZERO_NANOSECONDS);
+        }
+        if (curState >= GST_STATE_READY) {
+            // Keep the converter chain and the audio sink open, and only shut down the elements of this source.
+            gst_element_set_state(m_pipeline.pipeline, GST_STATE_READY);
+            if (m_pipeline.appsrc) {
+                gst_element_set_state(GST_ELEMENT(m_pipeline.appsrc), GST_STATE_NULL);
+            }
+            if (m_pipeline.decoder) {
+                gst_element_set_state(m_pipeline.decoder, GST_STATE_NULL);
+            }
+        } else {
+            gst_element_set_state(m_pipeline.pipeline, GST_STATE_NULL);
+        }
     }
     if (m_source) {
         m_source->shutdown();
@@ -1934,6 +2074,35 @@ void MediaPlayer::cleanUpSource() {
     m_parkedReader.reset();
 }
 
+void MediaPlayer::startTransition() {
+    m_isTransitionPending = true;
+    m_transitionStartTime = std::chrono::steady_clock::now();
+}
+
+void MediaPlayer::finishTransition() {
+    if (!m_isTransitionPending) {
+        return;
+    }
+    m_isTransitionPending = false;
+
+    auto gap = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - m_transitionStartTime);
+    ACSDK_DEBUG5(LX(__func__).d("name", RequiresShutdown::name()).d("gapMs", gap.count()));
+    if (!m_metricRecorder || gap > MAX_TRANSITION_GAP) {
+        return;
+    }
+
+    auto metricEvent = MetricEventBuilder{}
+                           .setActivityName(TRANSITION_METRIC_ACTIVITY_NAME)
+                           .addDataPoint(DataPointDurationBuilder{gap}.setName(TRANSITION_GAP).build())
+                           .build();
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("finishTransitionFailed").d("reason", "invalidMetricEvent"));
+        return;
+    }
+    recordMetric(m_metricRecorder, metricEvent);
+}
+
 int MediaPlayer::clampEqualizerLevel(int level) {
     return std::min(std::max(level, MIN_EQUALIZER_LEVEL), MAX_EQUALIZER_LEVEL);
 }
@@ -20,6 +20,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <thread>
 #include <unordered_map>
 
@@ -1469,6 +1470,88 @@ TEST_P(MediaPlayerTest, testSlow_repeatPlayForUrl) {
     ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
 }
 
+/// Configuration keeping the pipeline in READY between sources.
+static const std::string KEEP_PIPELINE_READY_CONFIG = R"({
+"gstreamerMediaPlayer":{
+        "keepPipelineReady":true
+    }
+})";
+
+/// Test harness running @c MediaPlayer with the pipeline kept in READY between sources.
+class MediaPlayerKeepPipelineReadyTest : public MediaPlayerTest {
+public:
+    void SetUp() override {
+        auto inString = std::shared_ptr<std::istringstream>(new std::istringstream(KEEP_PIPELINE_READY_CONFIG));
+        ASSERT_TRUE(avsCommon::utils::configuration::ConfigurationNode::initialize({inString}));
+        MediaPlayerTest::SetUp();
+    }
+
+    void TearDown() override {
+        MediaPlayerTest::TearDown();
+        avsCommon::utils::configuration::ConfigurationNode::uninitialize();
+    }
+};
+
+INSTANTIATE_TEST_CASE_P(Parameterized, MediaPlayerKeepPipelineReadyTest, ::testing::Bool());
+
+/**
+ * Play sources of each type one after the other while the pipeline is kept in READY between them, and check that
+ * each one starts and finishes.
+ */
+TEST_P(MediaPlayerKeepPipelineReadyTest, testSlow_playConsecutiveSources) {
+    MediaPlayer::SourceId sourceId;
+    setAttachmentReaderSource(&sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+
+    setIStreamSource(&sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+
+    sourceId = m_mediaPlayer->setSource(FILE_PREFIX + inputsDirPath + MP3_FILE_PATH);
+    ASSERT_NE(ERROR_SOURCE_ID, sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+}
+
+/**
+ * Stop a source while the pipeline is kept in READY, then check that the next source plays from its start.
+ */
+TEST_P(MediaPlayerKeepPipelineReadyTest, testSlow_playAfterStop) {
+    MediaPlayer::SourceId sourceId;
+    setIStreamSource(&sourceId, true);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_TRUE(m_mediaPlayer->stop(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
+
+    setAttachmentReaderSource(&sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    auto offset = m_mediaPlayer->getOffset(sourceId);
+    ASSERT_NE(MEDIA_PLAYER_INVALID_OFFSET, offset);
+    ASSERT_LE(offset.count(), (std::chrono::milliseconds(1000) + TOLERANCE).count());
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+}
+
+/**
+ * Play a playlist, whose entries go through the READY state of the kept pipeline, and check that it is reported as a
+ * single source.
+ */
+TEST_P(MediaPlayerKeepPipelineReadyTest, testSlow_playPlaylist) {
+    MediaPlayer::SourceId sourceId = m_mediaPlayer->setSource(TEST_M3U_PLAYLIST_URL);
+    ASSERT_NE(ERROR_SOURCE_ID, sourceId);
+    ASSERT_TRUE(m_mediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId, std::chrono::milliseconds(10000)));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId, std::chrono::milliseconds(10000)));
+    ASSERT_EQ(m_playerObserver->getOnPlaybackStartedCallCount(), 1);
+    ASSERT_EQ(m_playerObserver->getOnPlaybackFinishedCallCount(), 1);
+}
+
 }  // namespace test
 }  // namespace mediaPlayer
 }  // namespace alexaClientSDK
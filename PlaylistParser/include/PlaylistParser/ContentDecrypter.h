@@ -54,7 +54,8 @@ public:
     void setMediaInitToDecryptedContent(const ByteVector& mediaInitSection, std::chrono::milliseconds totalDuration);
 
     /**
-     * Decrypts contents and writes to stream.
+     * Decrypts contents and writes to stream.  Writes block until space is available; a write which is blocked is
+     * interrupted by closing @c streamWriter.
      *
      * @param encryptedContent The content that needs to be decrypted.
      * @param key The encryption key.
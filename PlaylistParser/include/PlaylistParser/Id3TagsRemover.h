@@ -19,6 +19,7 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
@@ -52,6 +53,9 @@ public:
      * A function that read from an attachment and remove ID3 tags from the stream and write the stream back to the
      * @c streamWriter.
      *
+     * Reads and writes block until data or space is available.  A read is interrupted by @c shutdown(); a write which
+     * is blocked waiting for space is interrupted by closing @c streamWriter.
+     *
      * @param attachment The attachment that contains the stream content.
      * @param streamWriter The writer to write to the attachment after ID3 tags are removed.
      * @return @c true if succeeds and @c false otherwise.
@@ -84,6 +88,18 @@ private:
         Context() : remainingBytesToStrip{0}, isBufferComplete{false} {};
     };
 
+    /**
+     * A helper function that reads from @c reader until it closes, and writes the content without ID3 tags to
+     * @c streamWriter.
+     *
+     * @param reader The reader of the attachment that contains the stream content.
+     * @param streamWriter The writer to write to the attachment after ID3 tags are removed.
+     * @return @c true if succeeds and @c false otherwise.
+     */
+    bool readAndWrite(
+        const std::shared_ptr<avsCommon::avs::attachment::AttachmentReader>& reader,
+        const std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter>& streamWriter);
+
     /**
      * A function that removes any ID3 tags from the buffer.
      *
@@ -105,6 +121,12 @@ private:
 
     /// Flag to indicate if a shutdown is occurring.
     std::atomic<bool> m_shuttingDown;
+
+    /// Serializes access to @c m_reader.
+    std::mutex m_readerMutex;
+
+    /// The reader used by @c removeTagsAndWrite(), which is closed on shutdown to interrupt a blocked read.
+    std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> m_reader;
 };
 
 }  // namespace playlistParser
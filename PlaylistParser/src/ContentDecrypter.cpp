@@ -62,9 +62,6 @@ static const int AES_BLOCK_SIZE = 16;
 /// Length of initilization vector as hex string.
 static const int IV_HEX_STRING_LENGTH = 2 * AES_BLOCK_SIZE;
 
-/// Timeout for write to stream.
-static const std::chrono::milliseconds WRITE_TO_STREAM_TIMEOUT(100);
-
 #ifdef ENABLE_SAMPLE_AES
 /// Invalid location if mdat is not found.
 static const int INVALID_MDAT_LOCATION = -1;
@@ -645,13 +642,13 @@ bool ContentDecrypter::writeToStream(
     size_t totalBytesWritten = 0;
     auto writeStatus = AttachmentWriter::WriteStatus::OK;
     while (totalBytesWritten < size && !m_shuttingDown) {
-        auto bytesWritten = streamWriter->write(
-            buffer + totalBytesWritten, size - totalBytesWritten, &writeStatus, WRITE_TO_STREAM_TIMEOUT);
+        auto bytesWritten = streamWriter->write(buffer + totalBytesWritten, size - totalBytesWritten, &writeStatus);
         totalBytesWritten += bytesWritten;
 
         switch (writeStatus) {
             case AttachmentWriter::WriteStatus::CLOSED:
-                break;
+                ACSDK_WARN(LX("writeToStreamFailed").d("reason", "streamClosed"));
+                return false;
             case AttachmentWriter::WriteStatus::TIMEDOUT:
             case AttachmentWriter::WriteStatus::OK:
                 continue;
@@ -13,8 +13,6 @@
  * permissions and limitations under the License.
  */
 
-#include <chrono>
-
 #include "PlaylistParser/Id3TagsRemover.h"
 
 #include <AVSCommon/Utils/ID3Tags/ID3v2Tags.h>
@@ -39,9 +37,6 @@ static const std::string TAG("Id3TagsRemover");
 /// The number of bytes read from the attachment with each read in the read loop.
 static const std::size_t CHUNK_SIZE(1024);
 
-/// Timeout for polling loops that check activity between read or write.
-static const std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT{100};
-
 Id3TagsRemover::Id3TagsRemover() : RequiresShutdown{"Id3TagsRemover"}, m_shuttingDown{false} {
 }
 
@@ -58,18 +53,37 @@ bool Id3TagsRemover::removeTagsAndWrite(
         return false;
     }
 
-    auto reader = attachment->createReader(ReaderPolicy::BLOCKING);
+    std::shared_ptr<AttachmentReader> reader = attachment->createReader(ReaderPolicy::BLOCKING);
     if (!reader) {
         ACSDK_ERROR(LX("removeTagsAndWriteFailed").d("reason", "nullReader"));
         return false;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(m_readerMutex);
+        if (m_shuttingDown) {
+            return true;
+        }
+        m_reader = reader;
+    }
+    bool result = readAndWrite(reader, streamWriter);
+    {
+        std::lock_guard<std::mutex> lock(m_readerMutex);
+        m_reader.reset();
+    }
+    return result;
+}
+
+bool Id3TagsRemover::readAndWrite(
+    const std::shared_ptr<AttachmentReader>& reader,
+    const std::shared_ptr<AttachmentWriter>& streamWriter) {
+
     auto readStatus = AttachmentReader::ReadStatus::OK;
     bool streamClosed = false;
     Context context;
     while (!streamClosed && !m_shuttingDown) {
         ByteVector buffer(CHUNK_SIZE, 0);
-        auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus, WAIT_FOR_ACTIVITY_TIMEOUT);
+        auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus);
         buffer.resize(bytesRead);
 
         switch (readStatus) {
@@ -212,8 +226,7 @@ bool Id3TagsRemover::writeBufferToWriter(
     while ((totalBytesWritten < targetNumBytes) && !m_shuttingDown) {
         auto writeStatus = avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK;
 
-        std::size_t numBytesWritten =
-            writer->write(data, targetNumBytes - totalBytesWritten, &writeStatus, WAIT_FOR_ACTIVITY_TIMEOUT);
+        std::size_t numBytesWritten = writer->write(data, targetNumBytes - totalBytesWritten, &writeStatus);
         totalBytesWritten += numBytesWritten;
         data += numBytesWritten;
 
@@ -237,7 +250,11 @@ bool Id3TagsRemover::writeBufferToWriter(
 }
 
 void Id3TagsRemover::doShutdown() {
+    std::lock_guard<std::mutex> lock(m_readerMutex);
     m_shuttingDown = true;
+    if (m_reader) {
+        m_reader->close(AttachmentReader::ClosePoint::IMMEDIATELY);
+    }
 }
 
 }  // namespace playlistParser
@@ -402,12 +402,13 @@ void UrlContentToAttachmentConverter::doShutdown() {
     m_shuttingDown = true;
     m_contentDecrypter->shutdown();
     m_id3TagsRemover->shutdown();
+    // Closing the writer interrupts a write blocked waiting for the stream to be read, so the executor can finish.
+    m_streamWriter->close();
     m_executor.shutdown();
     m_contentDecrypter.reset();
     m_id3TagsRemover.reset();
     m_playlistParser->shutdown();
     m_playlistParser.reset();
-    m_streamWriter->close();
     m_streamWriter.reset();
     if (!m_startedStreaming) {
         m_startStreamingPointPromise.set_value(std::chrono::seconds::zero());
@@ -1203,7 +1203,9 @@ bool SampleApplication::initialize(
         return false;
     }
 
-    auto synchronizeStateSenderFactory = synchronizeStateSender::SynchronizeStateSenderFactory::create(contextManager);
+    auto synchronizeStateSenderFactory =
+        synchronizeStateSender::SynchronizeStateSenderFactory::create(
+            contextManager, nullptr, avsGatewayManager, configPtr);
     if (!synchronizeStateSenderFactory) {
         ACSDK_CRITICAL(LX("Creation of SynchronizeStateSenderFactory failed"));
         return false;
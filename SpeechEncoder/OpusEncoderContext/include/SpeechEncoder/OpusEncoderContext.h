@@ -16,7 +16,9 @@
 #ifndef ALEXA_CLIENT_SDK_SPEECHENCODER_OPUSENCODERCONTEXT_INCLUDE_SPEECHENCODER_OPUSENCODERCONTEXT_H_
 #define ALEXA_CLIENT_SDK_SPEECHENCODER_OPUSENCODERCONTEXT_INCLUDE_SPEECHENCODER_OPUSENCODERCONTEXT_H_
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "SpeechEncoder/EncoderContext.h"
 
@@ -104,7 +106,8 @@ public:
     std::string getAVSFormatName() override;
 
     /**
-     * This will allocate new libopus encoder state and perform CTL functions.
+     * This will allocate new libopus encoder state and perform CTL functions on the first session.  Later sessions
+     * with the same sample rate and number of channels reuse the encoder and only reset its state.
      *
      * @return true when success.
      */
@@ -123,11 +126,16 @@ public:
     ssize_t processSamples(void* samples, size_t numberOfWords, uint8_t* buffer) override;
 
     /**
-     * Destroy current libopus encoder state.
+     * End the session.  The libopus encoder is kept so that the next session can start without allocating it.
      */
     void close() override;
 
 private:
+    /**
+     * Destroy current libopus encoder state.
+     */
+    void destroyEncoder();
+
     /**
      * Perform @c opus_encoder_ctl() calls.
      *
@@ -143,6 +151,12 @@ private:
 
     /// @c AudioFormat to describe input format
     alexaClientSDK::avsCommon::utils::AudioFormat m_inputFormat;
+
+    /// Whether the input samples need to be byteswapped to machine endianness.
+    bool m_byteswap;
+
+    /// Buffer for byteswapped samples, which is only allocated when @c m_byteswap is true.
+    std::vector<int16_t> m_byteswapBuffer;
 };
 
 }  // namespace speechencoder
@@ -64,15 +64,33 @@ inline uint16_t Reverse16(uint16_t value) {
     return (((value & 0x00FF) << 8) | ((value & 0xFF00) >> 8));
 }
 
+/**
+ * Byteswap samples.  The loop has no branches or dependencies between iterations, so the compiler can vectorize it.
+ *
+ * @param in The samples to byteswap.
+ * @param out Where to write the byteswapped samples.
+ * @param count The number of samples.
+ */
+static void byteswapSamples(const uint16_t* in, uint16_t* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = Reverse16(in[i]);
+    }
+}
+
 std::shared_ptr<EncoderContext> OpusEncoderContext::createEncoderContext() {
     return std::make_shared<OpusEncoderContext>();
 }
 
 OpusEncoderContext::~OpusEncoderContext() {
-    close();
+    destroyEncoder();
 }
 
 bool OpusEncoderContext::init(AudioFormat inputFormat) {
+    if (m_encoder && (inputFormat.sampleRateHz != m_inputFormat.sampleRateHz ||
+                      inputFormat.numChannels != m_inputFormat.numChannels)) {
+        // The warm encoder was created for a different format.
+        destroyEncoder();
+    }
     m_inputFormat = inputFormat;
 
     if (inputFormat.sampleRateHz != SAMPLE_RATE) {
@@ -90,6 +108,16 @@ bool OpusEncoderContext::init(AudioFormat inputFormat) {
     }
 
     m_outputFormat.numChannels = inputFormat.numChannels;
+
+    // Choose the endianness conversion once per session rather than per sample.
+    bool isInputLittleEndian = inputFormat.endianness == AudioFormat::Endianness::LITTLE;
+    m_byteswap = isInputLittleEndian != littleEndianMachine();
+    if (m_byteswap) {
+        m_byteswapBuffer.resize(FRAME_SIZE * inputFormat.numChannels);
+    } else {
+        m_byteswapBuffer.clear();
+        m_byteswapBuffer.shrink_to_fit();
+    }
     return true;
 }
 
@@ -144,8 +172,13 @@ bool OpusEncoderContext::start() {
     int err;
 
     if (m_encoder) {
-        ACSDK_ERROR(LX("startFailed").d("reason", "OpusEncoder is not null"));
-        return false;
+        // Reuse the encoder from the previous session.  Resetting the state keeps the settings from configureEncoder().
+        err = opus_encoder_ctl(m_encoder, OPUS_RESET_STATE);
+        if (err == OPUS_OK) {
+            return true;
+        }
+        ACSDK_WARN(LX("startWarning").d("reason", "Failed to reset OpusEncoder, recreating it").d("err", err));
+        destroyEncoder();
     }
 
     m_encoder = opus_encoder_create(m_inputFormat.sampleRateHz, m_inputFormat.numChannels, OPUS_APPLICATION_VOIP, &err);
@@ -162,7 +195,7 @@ bool OpusEncoderContext::start() {
 
     if (!configureEncoder()) {
         // Destroy previously created encoder
-        opus_encoder_destroy(m_encoder);
+        destroyEncoder();
         return false;
     }
 
@@ -170,21 +203,25 @@ bool OpusEncoderContext::start() {
 }
 
 ssize_t OpusEncoderContext::processSamples(void* samples, size_t numberOfWords, uint8_t* buffer) {
-    uint16_t* in = static_cast<uint16_t*>(samples);
-    opus_int16 pcm[FRAME_SIZE];
-
-    for (unsigned int i = 0; i < numberOfWords; i++) {
-        if (m_inputFormat.endianness == AudioFormat::Endianness::LITTLE) {
-            pcm[i] = littleEndianMachine() ? in[i] : Reverse16(in[i]);
-        } else {
-            pcm[i] = littleEndianMachine() ? Reverse16(in[i]) : in[i];
-        }
+    if (!m_byteswap) {
+        // The samples are already in machine endianness, so encode them where they are.
+        return opus_encode(m_encoder, static_cast<const opus_int16*>(samples), numberOfWords, buffer, MAX_PACKET_SIZE);
     }
 
-    return opus_encode(m_encoder, pcm, numberOfWords, buffer, MAX_PACKET_SIZE);
+    if (numberOfWords > m_byteswapBuffer.size()) {
+        ACSDK_ERROR(LX("processSamplesFailed").d("reason", "tooManySamples").d("numberOfWords", numberOfWords));
+        return OPUS_BAD_ARG;
+    }
+    byteswapSamples(
+        static_cast<const uint16_t*>(samples), reinterpret_cast<uint16_t*>(m_byteswapBuffer.data()), numberOfWords);
+    return opus_encode(m_encoder, m_byteswapBuffer.data(), numberOfWords, buffer, MAX_PACKET_SIZE);
 }
 
 void OpusEncoderContext::close() {
+    // Keep the encoder state so the next session only needs to reset it.
+}
+
+void OpusEncoderContext::destroyEncoder() {
     if (m_encoder) {
         opus_encoder_destroy(m_encoder);
         m_encoder = NULL;
@@ -200,7 +237,8 @@ OpusEncoderContext::OpusEncoderContext() :
             0,
             false,
             AudioFormat::Layout::INTERLEAVED,
-        } {
+        },
+        m_byteswap{false} {
 }
 
 }  // namespace speechencoder
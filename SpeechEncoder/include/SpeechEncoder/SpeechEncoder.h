@@ -17,11 +17,13 @@
 #define ALEXA_CLIENT_SDK_SPEECHENCODER_INCLUDE_SPEECHENCODER_SPEECHENCODER_H_
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 
 #include <AVSCommon/AVS/AudioInputStream.h>
 #include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
 
 #include "EncoderContext.h"
@@ -43,12 +45,27 @@ public:
      */
     static std::shared_ptr<SpeechEncoder> createSpeechEncoder(const std::shared_ptr<EncoderContext>& encoder);
 
+    /**
+     * Factory method.
+     *
+     * @param encoder The backend encoder implmentation.
+     * @param metricRecorder The metric recorder used to report the latency of the first encoded packet of each
+     * session, measured from the capture of the audio at the index where encoding begins.
+     */
+    static std::shared_ptr<SpeechEncoder> create(
+        const std::shared_ptr<EncoderContext>& encoder,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder);
+
     /**
      * Constructor.
      *
      * @param encoder The backend encoder implmentation.
+     * @param metricRecorder The metric recorder used to report the latency of the first encoded packet of each
+     * session, or @c nullptr to not report it.
      */
-    SpeechEncoder(const std::shared_ptr<EncoderContext>& encoder);
+    SpeechEncoder(
+        const std::shared_ptr<EncoderContext>& encoder,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder = nullptr);
 
     /**
      * Destructor.
@@ -110,9 +127,20 @@ private:
         avsCommon::avs::AudioInputStream::Index begin,
         avsCommon::avs::AudioInputStream::Reader::Reference reference);
 
+    /**
+     * Report how long after the audio at the session's begin index was captured the first encoded packet of the
+     * session was written.  For a wake word initiated session the begin index is the start of the wake word.
+     *
+     * @param latency The time from the capture of the audio at the begin index to the first encoded packet.
+     */
+    void submitFirstPacketMetric(std::chrono::milliseconds latency);
+
     /// Backend implementation
     std::shared_ptr<EncoderContext> m_encoder;
 
+    /// The metric recorder, which may be null.
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
+
     /// Input AudioFormat (PCM)
     alexaClientSDK::avsCommon::utils::AudioFormat m_inputAudioFormat;
 
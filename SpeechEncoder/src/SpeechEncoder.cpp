@@ -13,11 +13,14 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <climits>
 #include <fstream>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 
 #include "SpeechEncoder/SpeechEncoder.h"
 
@@ -27,6 +30,7 @@ namespace speechencoder {
 using namespace avsCommon;
 using namespace avsCommon::avs;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::metrics;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("SpeechEncoder");
@@ -50,12 +54,27 @@ static const auto WRITE_TIMEOUT_MS = std::chrono::milliseconds(100);
 /// The maximum number of packets to be buffered to the output stream.
 static constexpr unsigned int MAX_OUTPUT_PACKETS = 20;
 
+/// Metric activity name for the first encoded packet of a session.
+static const std::string FIRST_PACKET_ACTIVITY_NAME = "SPEECH_ENCODER-firstPacket";
+
+/// Metric data point for the time from the capture of the audio at the begin index to the first encoded packet.
+static const std::string FIRST_PACKET_LATENCY_KEY = "FIRST_PACKET_LATENCY";
+
 std::shared_ptr<SpeechEncoder> SpeechEncoder::createSpeechEncoder(const std::shared_ptr<EncoderContext>& encoder) {
     return std::make_shared<speechencoder::SpeechEncoder>(encoder);
 }
 
-SpeechEncoder::SpeechEncoder(const std::shared_ptr<EncoderContext>& encoder) :
+std::shared_ptr<SpeechEncoder> SpeechEncoder::create(
+    const std::shared_ptr<EncoderContext>& encoder,
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder) {
+    return std::make_shared<speechencoder::SpeechEncoder>(encoder, metricRecorder);
+}
+
+SpeechEncoder::SpeechEncoder(
+    const std::shared_ptr<EncoderContext>& encoder,
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder) :
         m_encoder{encoder},
+        m_metricRecorder{metricRecorder},
         m_isEncoding{false},
         m_stopRequested{false} {
 }
@@ -138,7 +157,17 @@ void SpeechEncoder::encodeLoop(AudioInputStream::Index begin, AudioInputStream::
 
     reader->seek(begin, reference);
 
+    // The audio between the begin index (e.g. the start of the wake word) and the writer was captured before the
+    // session started, so the first packet latency is measured from when that audio was captured.
+    auto wordsPerSecond = m_inputAudioFormat.sampleRateHz * std::max(m_inputAudioFormat.numChannels, 1u);
+    auto bufferedWords = reader->tell(AudioInputStream::Reader::Reference::BEFORE_WRITER);
+    auto captureTime = std::chrono::steady_clock::now();
+    if (wordsPerSecond > 0) {
+        captureTime -= std::chrono::milliseconds(bufferedWords * 1000 / wordsPerSecond);
+    }
+
     size_t currentRead = 0;
+    bool isFirstPacket = true;
     std::vector<uint8_t> readBuf(m_maxFrameSize * wordSize);
     std::vector<uint8_t> writeBuf(m_encoder->getOutputFrameSize());
 
@@ -178,6 +207,11 @@ void SpeechEncoder::encodeLoop(AudioInputStream::Index begin, AudioInputStream::
 
                         if (wordsSent == totalWordsToSend) {
                             // We are done sending everything.
+                            if (isFirstPacket) {
+                                isFirstPacket = false;
+                                submitFirstPacketMetric(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    std::chrono::steady_clock::now() - captureTime));
+                            }
                             break;
                         }
 
@@ -244,5 +278,21 @@ void SpeechEncoder::encodeLoop(AudioInputStream::Index begin, AudioInputStream::
     m_isEncoding = false;
 }
 
+void SpeechEncoder::submitFirstPacketMetric(std::chrono::milliseconds latency) {
+    ACSDK_DEBUG5(LX("firstPacketEncoded").d("latencyMs", latency.count()));
+    if (!m_metricRecorder) {
+        return;
+    }
+    auto metricEvent = MetricEventBuilder{}
+                           .setActivityName(FIRST_PACKET_ACTIVITY_NAME)
+                           .addDataPoint(DataPointDurationBuilder{latency}.setName(FIRST_PACKET_LATENCY_KEY).build())
+                           .build();
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("submitFirstPacketMetricFailed").d("reason", "invalidMetricEvent"));
+        return;
+    }
+    recordMetric(m_metricRecorder, metricEvent);
+}
+
 }  // namespace speechencoder
 }  // namespace alexaClientSDK
@@ -22,6 +22,7 @@
 #include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
 #include <AVSCommon/AVS/AudioInputStream.h>
 #include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
 #include <AVSCommon/Utils/PromiseFuturePair.h>
 
 #include "SpeechEncoder/SpeechEncoder.h"
@@ -33,6 +34,7 @@ namespace test {
 using namespace avsCommon;
 using namespace avsCommon::avs;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::metrics;
 
 /// Word size per PCM frame = 2byte (16bit)
 static constexpr size_t FRAME_WORDSIZE = 2;
@@ -270,6 +272,72 @@ TEST_F(SpeechEncoderTest, test_stopAndStartEncoder) {
     }
 }
 
+/**
+ * Test that the latency of the first encoded packet of a session is reported, and only once per session.  The latency
+ * is measured from the capture of the audio at the begin index, so audio buffered before the session started counts.
+ */
+TEST_F(SpeechEncoderTest, test_firstPacketLatencyIsReported) {
+    // One second of audio is written before the session starts.
+    const unsigned int bufferedWords = MOCK_ENCODER_INPUT_FRAME_SIZE * 2;
+    const AudioFormat audioFormat = {
+        AudioFormat::Encoding::LPCM,
+        AudioFormat::Endianness::LITTLE,
+        bufferedWords,
+        FRAME_WORDSIZE * CHAR_BIT,
+        1,
+        false,
+        AudioFormat::Layout::INTERLEAVED,
+    };
+
+    auto metricRecorder = std::make_shared<NiceMock<metrics::test::MockMetricRecorder>>();
+    m_encoder = SpeechEncoder::create(m_encoderCtx, metricRecorder);
+
+    auto inputBufferSize = AudioInputStream::calculateBufferSize(INPUT_WORD_COUNT, FRAME_WORDSIZE, 1);
+    auto buffer = std::make_shared<AudioInputStream::Buffer>(inputBufferSize);
+    std::shared_ptr<AudioInputStream> inputStream = AudioInputStream::create(buffer, FRAME_WORDSIZE, 1);
+    ASSERT_TRUE(inputStream);
+
+    EXPECT_CALL(*m_encoderCtx, init(_)).WillOnce(Return(true));
+    EXPECT_CALL(*m_encoderCtx, requiresFullyRead()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_encoderCtx, start()).WillOnce(Return(true));
+    EXPECT_CALL(*m_encoderCtx, close()).Times(1);
+    PromiseFuturePair<bool> frameEncoded;
+    EXPECT_CALL(*m_encoderCtx, processSamples(_, MOCK_ENCODER_INPUT_FRAME_SIZE, _))
+        .WillOnce(Invoke([&frameEncoded](void*, size_t, uint8_t*) -> ssize_t {
+            frameEncoded.setValue(true);
+            return MOCK_ENCODER_OUTPUT_FRAME_SIZE;
+        }))
+        .WillRepeatedly(Return(MOCK_ENCODER_OUTPUT_FRAME_SIZE));
+
+    std::shared_ptr<MetricEvent> recordedMetric;
+    PromiseFuturePair<bool> metricRecorded;
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    EXPECT_CALL(*metricRecorder, recordMetric(_))
+        .WillOnce(Invoke([&recordedMetric, &metricRecorded](std::shared_ptr<MetricEvent> event) {
+            recordedMetric = event;
+            metricRecorded.setValue(true);
+        }));
+#endif
+
+    std::shared_ptr<AudioInputStream::Writer> writer =
+        inputStream->createWriter(AudioInputStream::Writer::Policy::BLOCKING);
+    uint8_t dummy[FRAME_WORDSIZE * bufferedWords] = {};
+    writer->write(dummy, bufferedWords);
+    ASSERT_TRUE(m_encoder->startEncoding(inputStream, audioFormat, 0, AudioInputStream::Reader::Reference::ABSOLUTE));
+
+    ASSERT_TRUE(frameEncoded.waitFor(std::chrono::seconds(5)));
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    ASSERT_TRUE(metricRecorded.waitFor(std::chrono::seconds(5)));
+    ASSERT_NE(recordedMetric, nullptr);
+    EXPECT_EQ("SPEECH_ENCODER-firstPacket", recordedMetric->getActivityName());
+    auto latency = recordedMetric->getDataPoint("FIRST_PACKET_LATENCY", DataType::DURATION);
+    ASSERT_TRUE(latency.hasValue());
+    EXPECT_GE(std::stoll(latency.value().getValue()), 1000);
+#endif
+
+    m_encoder->stopEncoding(true);
+}
+
 }  // namespace test
 }  // namespace speechencoder
 }  // namespace alexaClientSDK
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sqlite3.h>
@@ -162,6 +163,20 @@ public:
      */
     std::unique_ptr<SQLiteStatement> createStatement(const std::string& sqlString);
 
+    /**
+     * Get a prepared statement for the provided string from the statement cache of this database. The statement is
+     * compiled on the first call for a given string, and reused by later calls. The statement returned is reset, and
+     * has no bound parameters.
+     *
+     * Callers should @c reset the statement once they are done stepping through it, so it does not keep a read
+     * transaction open while it is idle in the cache.
+     *
+     * @param sqlString The SQL command to execute.
+     * @return The cached statement, or @c nullptr if the statement could not be created. The statement is owned by
+     * this database and is finalized by @c close.
+     */
+    SQLiteStatement* getCachedStatement(const std::string& sqlString);
+
     /**
      * Checks if the database is ready to be acted upon.
      *
@@ -199,6 +214,9 @@ private:
     /// The sqlite database handle.
     sqlite3* m_dbHandle;
 
+    /// Prepared statements returned by @c getCachedStatement, keyed by their SQL string.
+    std::unordered_map<std::string, std::unique_ptr<SQLiteStatement>> m_statementCache;
+
     /**
      * A shared_ptr to this that is used to manage viability of weak_ptrs to this.  This shared_ptr has a no-op deleter,
      * and does not manage the lifecycle of this instance.  Instead, ~SQLiteDatabase() resets this shared_ptr to signal
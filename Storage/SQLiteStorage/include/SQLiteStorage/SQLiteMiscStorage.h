@@ -97,6 +97,10 @@ public:
         const std::string& tableName,
         const std::string& key,
         const std::string& value) override;
+    bool putBatch(
+        const std::string& componentName,
+        const std::string& tableName,
+        const std::unordered_map<std::string, std::string>& entries) override;
     bool remove(const std::string& componentName, const std::string& tableName, const std::string& key) override;
     bool tableEntryExists(
         const std::string& componentName,
@@ -71,6 +71,14 @@ public:
      */
     bool reset();
 
+    /**
+     * Clears the values bound to the parameters of the statement, and releases the strings kept alive for them.
+     * This should be called after @c reset when a statement is reused with different bound parameters.
+     *
+     * @return Whether the bindings were cleared successfully.
+     */
+    bool clearBindings();
+
     /**
      * Binds an integer to an index within a query.
      * NOTE: The left-most index for SQLite bind operations begins at 1, not 0.
@@ -136,6 +136,12 @@ void SQLiteDatabase::close() {
             rollbackTransaction();
         }
 
+        // Cached statements must be finalized before the database handle can be closed.
+        for (auto& entry : m_statementCache) {
+            entry.second->finalize();
+        }
+        m_statementCache.clear();
+
         closeSQLiteDatabase(m_dbHandle);
         m_dbHandle = nullptr;
     }
@@ -153,6 +159,29 @@ std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> SQLiteD
     return statement;
 }
 
+SQLiteStatement* SQLiteDatabase::getCachedStatement(const std::string& sqlString) {
+    auto it = m_statementCache.find(sqlString);
+    if (it == m_statementCache.end()) {
+        auto statement = createStatement(sqlString);
+        if (!statement) {
+            ACSDK_ERROR(LX("getCachedStatementFailed").d("reason", "createStatementFailed"));
+            return nullptr;
+        }
+        it = m_statementCache.emplace(sqlString, std::move(statement)).first;
+        return it->second.get();
+    }
+
+    auto statement = it->second.get();
+    // A failed reset only reports the error of the previous step, the statement is reset regardless.
+    statement->reset();
+    if (!statement->clearBindings()) {
+        ACSDK_ERROR(LX("getCachedStatementFailed").d("reason", "clearBindingsFailed"));
+        m_statementCache.erase(it);
+        return nullptr;
+    }
+    return statement;
+}
+
 std::unique_ptr<SQLiteDatabase::Transaction> SQLiteDatabase::beginTransaction() {
     if (m_transactionIsInProgress) {
         ACSDK_ERROR(LX("beginTransactionFailed").d("reason", "Only one transaction at a time is allowed"));
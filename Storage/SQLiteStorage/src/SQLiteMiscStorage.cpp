@@ -915,6 +915,30 @@ bool SQLiteMiscStorage::putLocked(
     return true;
 }
 
+bool SQLiteMiscStorage::putBatch(
+    const std::string& componentName,
+    const std::string& tableName,
+    const std::unordered_map<std::string, std::string>& entries) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Apply all entries in a single transaction, so the batch is committed at once.
+    auto transaction = m_db.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("putBatchFailed").d("reason", "Could not begin transaction"));
+        return false;
+    }
+
+    for (const auto& entry : entries) {
+        if (!putLocked(componentName, tableName, entry.first, entry.second)) {
+            ACSDK_ERROR(LX("putBatchFailed").d("reason", "Could not put entry").d("key", entry.first));
+            transaction->rollback();
+            return false;
+        }
+    }
+
+    return transaction->commit();
+}
+
 bool SQLiteMiscStorage::remove(const std::string& componentName, const std::string& tableName, const std::string& key) {
     std::lock_guard<std::mutex> lock(m_mutex);
     return removeLocked(componentName, tableName, key);
@@ -84,6 +84,16 @@ bool SQLiteStatement::reset() {
     return true;
 }
 
+bool SQLiteStatement::clearBindings() {
+    int rcode = sqlite3_clear_bindings(m_handle);
+    if (rcode != SQLITE_OK) {
+        ACSDK_ERROR(LX("SQLiteStatement::clearBindingsFailed").m("Could not clear the bindings.").d("rcode", rcode));
+        return false;
+    }
+    m_boundValues.clear();
+    return true;
+}
+
 bool SQLiteStatement::bindIntParameter(int index, int value) {
     if (index < SQLITE_BIND_PARAMETER_LEFT_MOST_INDEX) {
         ACSDK_ERROR(LX("SQLiteStatement::bindIntParameterFailed").d("invalid position", index));
@@ -239,6 +239,51 @@ TEST(SQLiteDatabaseTest, test_createDeleteTable) {
     db1.close();
 }
 
+/// Test that cached statements are reused, and are returned reset and without bindings.
+TEST(SQLiteDatabaseTest, test_cachedStatementReuse) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(db.performQuery("CREATE TABLE " + TEST_TABLE_NAME + " (key TEXT PRIMARY KEY NOT NULL);"));
+
+    const std::string insertSql = "INSERT INTO " + TEST_TABLE_NAME + " (key) VALUES (?);";
+    const std::string selectSql = "SELECT key FROM " + TEST_TABLE_NAME + " ORDER BY key;";
+
+    auto insertStatement = db.getCachedStatement(insertSql);
+    ASSERT_NE(insertStatement, nullptr);
+    ASSERT_TRUE(insertStatement->bindStringParameter(1, "a"));
+    ASSERT_TRUE(insertStatement->step());
+
+    ASSERT_EQ(db.getCachedStatement(insertSql), insertStatement);
+    ASSERT_TRUE(insertStatement->bindStringParameter(1, "b"));
+    ASSERT_TRUE(insertStatement->step());
+
+    // Without bindings the key is NULL, which the table rejects.
+    ASSERT_EQ(db.getCachedStatement(insertSql), insertStatement);
+    ASSERT_FALSE(insertStatement->step());
+
+    auto selectStatement = db.getCachedStatement(selectSql);
+    ASSERT_NE(selectStatement, nullptr);
+    ASSERT_TRUE(selectStatement->step());
+    ASSERT_EQ(selectStatement->getStepResult(), SQLITE_ROW);
+    ASSERT_EQ(selectStatement->getColumnText(0), "a");
+
+    // Fetching the statement again starts over from the first row.
+    ASSERT_EQ(db.getCachedStatement(selectSql), selectStatement);
+    ASSERT_TRUE(selectStatement->step());
+    ASSERT_EQ(selectStatement->getColumnText(0), "a");
+    ASSERT_TRUE(selectStatement->step());
+    ASSERT_EQ(selectStatement->getColumnText(0), "b");
+    ASSERT_TRUE(selectStatement->step());
+    ASSERT_EQ(selectStatement->getStepResult(), SQLITE_DONE);
+
+    // Closing finalizes the cached statements, so the database can be closed and opened again.
+    db.close();
+    ASSERT_TRUE(db.open());
+    ASSERT_NE(db.getCachedStatement(selectSql), nullptr);
+    db.close();
+}
+
 }  // namespace test
 }  // namespace sqliteStorage
 }  // namespace storage
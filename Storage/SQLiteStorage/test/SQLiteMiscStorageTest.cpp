@@ -383,6 +383,31 @@ TEST_F(SQLiteMiscStorageTest, test_loadAndClear) {
     deleteTestTable(tableName);
 }
 
+/// Tests putting several entries at once
+TEST_F(SQLiteMiscStorageTest, test_putBatch) {
+    const std::string tableName = "SQLiteMiscStoragePutBatchTest";
+    std::unordered_map<std::string, std::string> valuesContainer;
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+
+    ASSERT_TRUE(m_miscStorage->add(COMPONENT_NAME, tableName, "key1", "oldValue1"));
+
+    /// Ensure that existing entries are updated and new entries are added
+    std::unordered_map<std::string, std::string> batch = {{"key1", "value1"}, {"key2", "value2"}, {"key3", "value3"}};
+    ASSERT_TRUE(m_miscStorage->putBatch(COMPONENT_NAME, tableName, batch));
+    ASSERT_TRUE(m_miscStorage->load(COMPONENT_NAME, tableName, &valuesContainer));
+    ASSERT_EQ(valuesContainer, batch);
+
+    /// Ensure that a batch for a missing table fails without touching other tables
+    ASSERT_FALSE(m_miscStorage->putBatch(COMPONENT_NAME, "SQLiteMiscStorageMissingTable", batch));
+    valuesContainer.clear();
+    ASSERT_TRUE(m_miscStorage->load(COMPONENT_NAME, tableName, &valuesContainer));
+    ASSERT_EQ(valuesContainer, batch);
+
+    deleteTestTable(tableName);
+}
+
 /// Tests with creating and deleting tables
 TEST_F(SQLiteMiscStorageTest, test_createDeleteTable) {
     const std::string tableName = "SQLiteMiscStorageCreateDeleteTest";
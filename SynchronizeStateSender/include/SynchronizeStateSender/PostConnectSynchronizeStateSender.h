@@ -38,16 +38,47 @@ class PostConnectSynchronizeStateSender
         , public avsCommon::sdkInterfaces::PostConnectOperationInterface
         , public std::enable_shared_from_this<PostConnectSynchronizeStateSender> {
 public:
+    /**
+     * Remembers the context last synchronized with AVS and the gateway it was synchronized with, so that a later
+     * connection to the same gateway can skip sending the same context again. Shared by the senders created for
+     * successive connections.
+     */
+    struct SynchronizedStateCache {
+        /**
+         * Constructor.
+         */
+        SynchronizedStateCache() : hasContextHash{false}, contextHash{0} {
+        }
+
+        /// Serializes access to the members below.
+        std::mutex mutex;
+
+        /// Whether a context has been synchronized.
+        bool hasContextHash;
+
+        /// The URL of the AVS gateway the last context was synchronized with.
+        std::string avsGateway;
+
+        /// The hash of the last context synchronized.
+        size_t contextHash;
+    };
+
     /**
      * Creates a new instance of the @c PostConnectSynchronizeStateSender.
      *
      * @param contextManager The @c ContextManager to request the context from.
      * @param metricRecorder The object used for metric recording.
+     * @param synchronizedStateCache If not @c nullptr, the event is skipped when the context and gateway equal the ones
+     * last synchronized through this cache, and the cache is updated after each successful synchronization.
+     * @param avsGateway The URL of the AVS gateway of the connection this operation runs on. Only used with a
+     * @c synchronizedStateCache.
      * @return a new instance of the @c PostConnectSynchronizeStateSender.
      */
     static std::shared_ptr<PostConnectSynchronizeStateSender> create(
         std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr,
+        std::shared_ptr<SynchronizedStateCache> synchronizedStateCache = nullptr,
+        const std::string& avsGateway = "");
 
     /// ContextRequesterInterface Methods.
     /// @{
@@ -67,10 +98,14 @@ private:
      * Constructor.
      * @param contextManager
      * @param metricRecorder
+     * @param synchronizedStateCache
+     * @param avsGateway
      */
     PostConnectSynchronizeStateSender(
         std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+        std::shared_ptr<SynchronizedStateCache> synchronizedStateCache,
+        const std::string& avsGateway);
 
     /**
      * A method to fetch the context and store it in @c m_contextString.
@@ -91,6 +126,12 @@ private:
     /// The @c MetricRecorderInterface to record metrics with.
     std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 
+    /// The context last synchronized on a previous connection, or @c nullptr to always send the event.
+    std::shared_ptr<SynchronizedStateCache> m_synchronizedStateCache;
+
+    /// The URL of the AVS gateway of the connection this operation runs on.
+    const std::string m_avsGateway;
+
     /// Flag to indicate the PostConnectOperation is stopping.
     bool m_isStopping;
 
@@ -19,15 +19,25 @@
 #include <memory>
 
 #include <acsdkPostConnectOperationProviderRegistrarInterfaces/PostConnectOperationProviderRegistrarInterface.h>
+#include <AVSCommon/SDKInterfaces/AVSGatewayManagerInterface.h>
 #include <AVSCommon/SDKInterfaces/ContextManagerInterface.h>
 #include <AVSCommon/SDKInterfaces/PostConnectOperationProviderInterface.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 
+#include "SynchronizeStateSender/PostConnectSynchronizeStateSender.h"
+
 namespace alexaClientSDK {
 namespace synchronizeStateSender {
 
 /**
  * Factory class to generate new instances of @c PostConnectSynchronizeStateSender.
+ *
+ * When @c "skipUnchangedStateOnReconnect" is set to @c true under the @c "synchronizeStateSender" configuration root,
+ * the senders created for a reconnection skip the SynchronizeState event if the context did not change since it was
+ * last synchronized successfully with the same AVS gateway. This is off by default, and requires the configuration root
+ * and an @c AVSGatewayManagerInterface to tell which gateway each connection is made to. Without either, the factory
+ * still creates senders, which always send the event.
  */
 class SynchronizeStateSenderFactory : public avsCommon::sdkInterfaces::PostConnectOperationProviderInterface {
 public:
@@ -36,6 +46,10 @@ public:
      *
      * @param contextManager The @c ContextManager used to construct the synchronize state sender.
      * @param metricRecorder The object used for metric recording.
+     * @param avsGatewayManager The @c AVSGatewayManagerInterface providing the gateway of each connection. Unchanged
+     * state is never skipped without it.
+     * @param configurationRoot The root of the configuration, read once for @c "skipUnchangedStateOnReconnect".
+     * Unchanged state is never skipped without it.
      * @return a new instance of the @c SynchronizeStateSenderFactory.
      */
     static std::shared_ptr<avsCommon::sdkInterfaces::PostConnectOperationProviderInterface>
@@ -44,18 +58,27 @@ public:
             acsdkPostConnectOperationProviderRegistrarInterfaces::PostConnectOperationProviderRegistrarInterface>&
             providerRegistrar,
         const std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface>& contextManager,
-        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder = nullptr);
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder = nullptr,
+        const std::shared_ptr<avsCommon::sdkInterfaces::AVSGatewayManagerInterface>& avsGatewayManager = nullptr,
+        const std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode>& configurationRoot = nullptr);
 
     /**
      * Creates a new instance of the @c SynchronizeStateSenderFactory.
      *
      * @deprecated
      * @param contextManager The @c ContextManager used to construct the synchronize state sender.
+     * @param metricRecorder The object used for metric recording.
+     * @param avsGatewayManager The @c AVSGatewayManagerInterface providing the gateway of each connection. Unchanged
+     * state is never skipped without it.
+     * @param configurationRoot The root of the configuration, read once for @c "skipUnchangedStateOnReconnect".
+     * Unchanged state is never skipped without it.
      * @return a new instance of the @c SynchronizeStateSenderFactory.
      */
     static std::shared_ptr<SynchronizeStateSenderFactory> create(
         std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr,
+        std::shared_ptr<avsCommon::sdkInterfaces::AVSGatewayManagerInterface> avsGatewayManager = nullptr,
+        std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode> configurationRoot = nullptr);
 
     /// ContextRequesterInterface Methods.
     /// @{
@@ -68,16 +91,26 @@ private:
      *
      * @param contextManager The @c ContextManager used to construct the synchronize state sender.
      * @param metricRecorder The object used for metric recording.
+     * @param avsGatewayManager The @c AVSGatewayManagerInterface providing the gateway of each connection.
+     * @param configurationRoot The root of the configuration.
      */
     SynchronizeStateSenderFactory(
         std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+        std::shared_ptr<avsCommon::sdkInterfaces::AVSGatewayManagerInterface> avsGatewayManager,
+        const std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode>& configurationRoot);
 
     /// The @c ContextManager used in the construction of the @c PostConnectSynchronizeStateSender.
     std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> m_contextManager;
 
     /// @param metricRecorder The object used for metric recording.
     std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
+
+    /// The @c AVSGatewayManagerInterface providing the gateway of each connection.
+    std::shared_ptr<avsCommon::sdkInterfaces::AVSGatewayManagerInterface> m_avsGatewayManager;
+
+    /// The context last synchronized, shared by the senders. @c nullptr unless skipping unchanged state is enabled.
+    std::shared_ptr<PostConnectSynchronizeStateSender::SynchronizedStateCache> m_synchronizedStateCache;
 };
 
 }  // namespace synchronizeStateSender
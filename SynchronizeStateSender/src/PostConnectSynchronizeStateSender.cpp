@@ -15,6 +15,8 @@
 
 #include "SynchronizeStateSender/PostConnectSynchronizeStateSender.h"
 
+#include <functional>
+
 #include <AVSCommon/AVS/EventBuilder.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/RetryTimer.h>
@@ -99,23 +101,29 @@ std::chrono::milliseconds CONTEXT_FETCH_TIMEOUT = std::chrono::milliseconds(2000
 
 std::shared_ptr<PostConnectSynchronizeStateSender> PostConnectSynchronizeStateSender::create(
     std::shared_ptr<ContextManagerInterface> contextManager,
-    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) {
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+    std::shared_ptr<SynchronizedStateCache> synchronizedStateCache,
+    const std::string& avsGateway) {
     ACSDK_DEBUG5(LX(__func__));
 
     if (!contextManager) {
         ACSDK_ERROR(LX("createFailed").d("reason", "nullContextManager"));
     } else {
         return std::shared_ptr<PostConnectSynchronizeStateSender>(
-            new PostConnectSynchronizeStateSender(contextManager, metricRecorder));
+            new PostConnectSynchronizeStateSender(contextManager, metricRecorder, synchronizedStateCache, avsGateway));
     }
     return nullptr;
 }
 
 PostConnectSynchronizeStateSender::PostConnectSynchronizeStateSender(
     std::shared_ptr<ContextManagerInterface> contextManager,
-    std::shared_ptr<MetricRecorderInterface> metricRecorder) :
+    std::shared_ptr<MetricRecorderInterface> metricRecorder,
+    std::shared_ptr<SynchronizedStateCache> synchronizedStateCache,
+    const std::string& avsGateway) :
         m_contextManager{contextManager},
         m_metricRecorder{metricRecorder},
+        m_synchronizedStateCache{synchronizedStateCache},
+        m_avsGateway{avsGateway},
         m_isStopping{false} {
 }
 
@@ -179,6 +187,17 @@ bool PostConnectSynchronizeStateSender::performOperation(const std::shared_ptr<M
                 return false;
             }
 
+            auto contextHash = std::hash<std::string>{}(m_contextString);
+            if (m_synchronizedStateCache) {
+                std::lock_guard<std::mutex> cacheLock{m_synchronizedStateCache->mutex};
+                if (m_synchronizedStateCache->hasContextHash && m_synchronizedStateCache->avsGateway == m_avsGateway &&
+                    m_synchronizedStateCache->contextHash == contextHash) {
+                    ACSDK_DEBUG5(LX(__func__).m("context unchanged since last synchronization, skipping event"));
+                    submitMetric(m_metricRecorder, "skipSynchronizeStateEvent", "CONTEXT_UNCHANGED");
+                    return true;
+                }
+            }
+
             auto event =
                 buildJsonEventString(SYNCHRONIZE_STATE_NAMESPACE, SYNCHRONIZE_STATE_NAME, "", "{}", m_contextString);
             m_postConnectRequest = std::make_shared<WaitableMessageRequest>(event.second);
@@ -191,6 +210,12 @@ bool PostConnectSynchronizeStateSender::performOperation(const std::shared_ptr<M
 
             if (status == MessageRequestObserverInterface::Status::SUCCESS ||
                 status == MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT) {
+                if (m_synchronizedStateCache) {
+                    std::lock_guard<std::mutex> cacheLock{m_synchronizedStateCache->mutex};
+                    m_synchronizedStateCache->hasContextHash = true;
+                    m_synchronizedStateCache->avsGateway = m_avsGateway;
+                    m_synchronizedStateCache->contextHash = contextHash;
+                }
                 return true;
             } else if (status == MessageRequestObserverInterface::Status::CANCELED) {
                 return false;
@@ -16,6 +16,7 @@
 #include "SynchronizeStateSender/PostConnectSynchronizeStateSender.h"
 #include "SynchronizeStateSender/SynchronizeStateSenderFactory.h"
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 namespace alexaClientSDK {
@@ -33,13 +34,21 @@ static const std::string TAG("SynchronizeStateSenderFactory");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The root key for the @c SynchronizeStateSender configuration.
+static const std::string SYNCHRONIZE_STATE_SENDER_CONFIGURATION_ROOT_KEY = "synchronizeStateSender";
+
+/// The key to enable skipping the SynchronizeState event when the context is unchanged since the last connection.
+static const std::string SKIP_UNCHANGED_STATE_ON_RECONNECT_KEY = "skipUnchangedStateOnReconnect";
+
 std::shared_ptr<avsCommon::sdkInterfaces::PostConnectOperationProviderInterface> SynchronizeStateSenderFactory::
     createPostConnectOperationProviderInterface(
         const std::shared_ptr<
             acsdkPostConnectOperationProviderRegistrarInterfaces::PostConnectOperationProviderRegistrarInterface>&
             providerRegistrar,
         const std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface>& contextManager,
-        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder) {
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder,
+        const std::shared_ptr<avsCommon::sdkInterfaces::AVSGatewayManagerInterface>& avsGatewayManager,
+        const std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode>& configurationRoot) {
     ACSDK_DEBUG5(LX(__func__));
     if (!providerRegistrar) {
         ACSDK_ERROR(LX("createFailed").d("reason", "nullProviderRegistrar"));
@@ -50,7 +59,7 @@ std::shared_ptr<avsCommon::sdkInterfaces::PostConnectOperationProviderInterface>
         return nullptr;
     }
     std::shared_ptr<SynchronizeStateSenderFactory> provider(
-        new SynchronizeStateSenderFactory(contextManager, metricRecorder));
+        new SynchronizeStateSenderFactory(contextManager, metricRecorder, avsGatewayManager, configurationRoot));
     if (!providerRegistrar->registerProvider(provider)) {
         return nullptr;
     }
@@ -59,27 +68,47 @@ std::shared_ptr<avsCommon::sdkInterfaces::PostConnectOperationProviderInterface>
 
 std::shared_ptr<SynchronizeStateSenderFactory> SynchronizeStateSenderFactory::create(
     std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) {
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+    std::shared_ptr<avsCommon::sdkInterfaces::AVSGatewayManagerInterface> avsGatewayManager,
+    std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode> configurationRoot) {
     ACSDK_DEBUG5(LX(__func__));
     if (!contextManager) {
         ACSDK_ERROR(LX("createFailed").d("reason", "nullContextManager"));
     } else {
         return std::shared_ptr<SynchronizeStateSenderFactory>(
-            new SynchronizeStateSenderFactory(contextManager, metricRecorder));
+            new SynchronizeStateSenderFactory(contextManager, metricRecorder, avsGatewayManager, configurationRoot));
     }
     return nullptr;
 }
 
 SynchronizeStateSenderFactory::SynchronizeStateSenderFactory(
     std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
-    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) :
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+    std::shared_ptr<avsCommon::sdkInterfaces::AVSGatewayManagerInterface> avsGatewayManager,
+    const std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode>& configurationRoot) :
         m_contextManager{contextManager},
-        m_metricRecorder{metricRecorder} {
+        m_metricRecorder{metricRecorder},
+        m_avsGatewayManager{avsGatewayManager} {
+    bool skipUnchangedState = false;
+    if (configurationRoot) {
+        (*configurationRoot)[SYNCHRONIZE_STATE_SENDER_CONFIGURATION_ROOT_KEY].getBool(
+            SKIP_UNCHANGED_STATE_ON_RECONNECT_KEY, &skipUnchangedState, false);
+    }
+    if (skipUnchangedState && !m_avsGatewayManager) {
+        ACSDK_WARN(LX(__func__).d("reason", "nullAVSGatewayManager").m("not skipping unchanged state on reconnect"));
+    } else if (skipUnchangedState) {
+        ACSDK_INFO(LX(__func__).m("skipping unchanged state on reconnect"));
+        m_synchronizedStateCache = std::make_shared<PostConnectSynchronizeStateSender::SynchronizedStateCache>();
+    }
 }
 
 std::shared_ptr<PostConnectOperationInterface> SynchronizeStateSenderFactory::createPostConnectOperation() {
     ACSDK_DEBUG5(LX(__func__));
-    return PostConnectSynchronizeStateSender::create(m_contextManager, m_metricRecorder);
+    if (!m_synchronizedStateCache) {
+        return PostConnectSynchronizeStateSender::create(m_contextManager, m_metricRecorder);
+    }
+    return PostConnectSynchronizeStateSender::create(
+        m_contextManager, m_metricRecorder, m_synchronizedStateCache, m_avsGatewayManager->getGatewayURL());
 }
 
 }  // namespace synchronizeStateSender
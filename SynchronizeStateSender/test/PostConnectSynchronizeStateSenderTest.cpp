@@ -52,6 +52,13 @@ static const ContextRequestToken MOCK_CONTEXT_REQUEST_TOKEN = 1;
 
 /// Number of retries used in tests.
 static const int TEST_RETRY_COUNT = 3;
+
+/// The AVS gateway of a connection.
+static const std::string TEST_AVS_GATEWAY = "https://avs.gateway.test";
+
+/// Another AVS gateway.
+static const std::string OTHER_TEST_AVS_GATEWAY = "https://other.avs.gateway.test";
+
 /**
  * Test harness for @c PostConnectSynchronizeStateSender class.
  */
@@ -206,6 +213,84 @@ TEST_F(PostConnectSynchronizeStateSenderTest, test_perfromOperationSendsSynchron
     ASSERT_TRUE(m_postConnectSynchronizeStateSender->performOperation(m_mockPostConnectSendMessage));
 }
 
+/**
+ * Test that a sender sharing a @c SynchronizedStateCache skips the event when the context is unchanged since the last
+ * successful synchronization.
+ */
+TEST_F(PostConnectSynchronizeStateSenderTest, test_performOperationSkipsUnchangedContext) {
+    auto getContextLambda = [this](
+                                std::shared_ptr<ContextRequesterInterface> contextRequester,
+                                const std::string& endpointId,
+                                const std::chrono::milliseconds& timeout) {
+        if (m_mockContextManagerThread.joinable()) {
+            m_mockContextManagerThread.join();
+        }
+        m_mockContextManagerThread =
+            std::thread([contextRequester]() { contextRequester->onContextAvailable(TEST_CONTEXT_VALUE); });
+        return MOCK_CONTEXT_REQUEST_TOKEN;
+    };
+    EXPECT_CALL(*m_mockContextManager, getContext(_, _, _)).Times(2).WillRepeatedly(Invoke(getContextLambda));
+
+    auto sendMessageLambda = [this](std::shared_ptr<MessageRequest> request) {
+        if (m_mockPostConnectSenderThread.joinable()) {
+            m_mockPostConnectSenderThread.join();
+        }
+
+        m_mockPostConnectSenderThread = std::thread([request]() {
+            request->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT);
+        });
+    };
+    EXPECT_CALL(*m_mockPostConnectSendMessage, sendMessage(_)).WillOnce(Invoke(sendMessageLambda));
+
+    auto cache = std::make_shared<PostConnectSynchronizeStateSender::SynchronizedStateCache>();
+    auto firstSender =
+        PostConnectSynchronizeStateSender::create(m_mockContextManager, nullptr, cache, TEST_AVS_GATEWAY);
+    ASSERT_TRUE(firstSender->performOperation(m_mockPostConnectSendMessage));
+
+    auto secondSender =
+        PostConnectSynchronizeStateSender::create(m_mockContextManager, nullptr, cache, TEST_AVS_GATEWAY);
+    ASSERT_TRUE(secondSender->performOperation(m_mockPostConnectSendMessage));
+}
+
+/**
+ * Test that a sender sharing a @c SynchronizedStateCache still sends the event when the context is unchanged but the
+ * connection is made to a different AVS gateway.
+ */
+TEST_F(PostConnectSynchronizeStateSenderTest, test_performOperationSendsUnchangedContextToNewGateway) {
+    auto getContextLambda = [this](
+                                std::shared_ptr<ContextRequesterInterface> contextRequester,
+                                const std::string& endpointId,
+                                const std::chrono::milliseconds& timeout) {
+        if (m_mockContextManagerThread.joinable()) {
+            m_mockContextManagerThread.join();
+        }
+        m_mockContextManagerThread =
+            std::thread([contextRequester]() { contextRequester->onContextAvailable(TEST_CONTEXT_VALUE); });
+        return MOCK_CONTEXT_REQUEST_TOKEN;
+    };
+    EXPECT_CALL(*m_mockContextManager, getContext(_, _, _)).Times(2).WillRepeatedly(Invoke(getContextLambda));
+
+    auto sendMessageLambda = [this](std::shared_ptr<MessageRequest> request) {
+        if (m_mockPostConnectSenderThread.joinable()) {
+            m_mockPostConnectSenderThread.join();
+        }
+
+        m_mockPostConnectSenderThread = std::thread([request]() {
+            request->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS_NO_CONTENT);
+        });
+    };
+    EXPECT_CALL(*m_mockPostConnectSendMessage, sendMessage(_)).Times(2).WillRepeatedly(Invoke(sendMessageLambda));
+
+    auto cache = std::make_shared<PostConnectSynchronizeStateSender::SynchronizedStateCache>();
+    auto firstSender =
+        PostConnectSynchronizeStateSender::create(m_mockContextManager, nullptr, cache, TEST_AVS_GATEWAY);
+    ASSERT_TRUE(firstSender->performOperation(m_mockPostConnectSendMessage));
+
+    auto secondSender =
+        PostConnectSynchronizeStateSender::create(m_mockContextManager, nullptr, cache, OTHER_TEST_AVS_GATEWAY);
+    ASSERT_TRUE(secondSender->performOperation(m_mockPostConnectSendMessage));
+}
+
 /**
  * Test performOperation() method retries sending SynchronizeState event on context fetch failure.
  */
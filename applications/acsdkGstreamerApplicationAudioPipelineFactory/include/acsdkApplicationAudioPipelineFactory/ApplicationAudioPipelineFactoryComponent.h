@@ -26,6 +26,7 @@
 #include <AVSCommon/SDKInterfaces/ChannelVolumeFactoryInterface.h>
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
 #include <AVSCommon/SDKInterfaces/SpeakerManagerInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <Captions/CaptionManagerInterface.h>
 
 namespace alexaClientSDK {
@@ -42,7 +43,8 @@ using GstreamerApplicationAudioPipelineFactoryComponent = acsdkManufactory::Comp
     acsdkManufactory::Import<std::shared_ptr<avsCommon::sdkInterfaces::ChannelVolumeFactoryInterface>>,
     acsdkManufactory::Import<std::shared_ptr<avsCommon::sdkInterfaces::SpeakerManagerInterface>>,
     acsdkManufactory::Import<std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>>,
-    acsdkManufactory::Import<std::shared_ptr<captions::CaptionManagerInterface>>>;
+    acsdkManufactory::Import<std::shared_ptr<captions::CaptionManagerInterface>>,
+    acsdkManufactory::Import<std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>>>;
 
 /**
  * Creates an manufactory component that exports @c ApplicationAudioPipelineFactoryInterface.
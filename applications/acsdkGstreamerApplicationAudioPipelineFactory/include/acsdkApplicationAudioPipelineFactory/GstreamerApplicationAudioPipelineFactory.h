@@ -28,6 +28,7 @@
 #include <AVSCommon/SDKInterfaces/SpeakerInterface.h>
 #include <AVSCommon/SDKInterfaces/SpeakerManagerInterface.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <Captions/CaptionManagerInterface.h>
 
 namespace alexaClientSDK {
@@ -48,6 +49,7 @@ public:
      * @param httpContentFetcherFactory The @c HTTPContentFetcherInterfaceFactoryInterface to fetch remote http content.
      * @param shutdownNotifier The @c ShutdownNotifierInterface to notify created media players of shutdown.
      * @param captionManager The @c CaptionManagerInterface to add captionable media sources.
+     * @param metricRecorder The @c MetricRecorderInterface with which media players report metrics.
      * @return A new @c ApplicationAudioPipelineFactoryInterface for Gstreamer media players.
      */
     static std::shared_ptr<acsdkApplicationAudioPipelineFactoryInterfaces::ApplicationAudioPipelineFactoryInterface>
@@ -58,7 +60,8 @@ public:
         const std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>&
             httpContentFetcherFactory,
         const std::shared_ptr<acsdkShutdownManagerInterfaces::ShutdownNotifierInterface>& shutdownNotifier,
-        const std::shared_ptr<captions::CaptionManagerInterface>& captionManager);
+        const std::shared_ptr<captions::CaptionManagerInterface>& captionManager,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder);
 
     /// @name ApplicationAudioPipelineFactoryInterface
     /// @{
@@ -90,6 +93,7 @@ private:
      * @param httpContentFetcherFactory The @c HTTPContentFetcherInterfaceFactoryInterface to fetch remote http content.
      * @param shutdownNotifier The @c ShutdownNotifierInterface to notify created media players of shutdown.
      *  @param captionManager The @c CaptionManagerInterface to add captionable media sources.
+     * @param metricRecorder The @c MetricRecorderInterface with which media players report metrics.
      */
     GstreamerApplicationAudioPipelineFactory(
         const std::shared_ptr<avsCommon::sdkInterfaces::ChannelVolumeFactoryInterface>& channelVolumeFactory,
@@ -98,7 +102,8 @@ private:
         const std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface>&
             httpContentFetcherFactory,
         const std::shared_ptr<acsdkShutdownManagerInterfaces::ShutdownNotifierInterface>& shutdownNotifier,
-        const std::shared_ptr<captions::CaptionManagerInterface>& captionManager);
+        const std::shared_ptr<captions::CaptionManagerInterface>& captionManager,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder);
 
     /// The @c SpeakerManagerInterface with which to register speakers.
     std::shared_ptr<avsCommon::sdkInterfaces::SpeakerManagerInterface> m_speakerManager;
@@ -117,6 +122,9 @@ private:
 
     /// The @c CaptionManagerInterface with which to register captionable media sources.
     std::shared_ptr<captions::CaptionManagerInterface> m_captionManager;
+
+    /// The @c MetricRecorderInterface with which media players report metrics.
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 };
 
 }  // namespace acsdkApplicationAudioPipelineFactory
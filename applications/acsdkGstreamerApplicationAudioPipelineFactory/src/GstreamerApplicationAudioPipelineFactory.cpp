@@ -25,6 +25,7 @@ using namespace acsdkEqualizerInterfaces;
 using namespace acsdkShutdownManagerInterfaces;
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils::mediaPlayer;
+using namespace avsCommon::utils::metrics;
 using namespace captions;
 
 /// String to identify log entries originating from this file.
@@ -44,7 +45,8 @@ GstreamerApplicationAudioPipelineFactory::createApplicationAudioPipelineFactoryI
     const std::shared_ptr<EqualizerRuntimeSetupInterface>& equalizerRuntimeSetup,
     const std::shared_ptr<HTTPContentFetcherInterfaceFactoryInterface>& httpContentFetcherFactory,
     const std::shared_ptr<ShutdownNotifierInterface>& shutdownNotifier,
-    const std::shared_ptr<CaptionManagerInterface>& captionManager) {
+    const std::shared_ptr<CaptionManagerInterface>& captionManager,
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder) {
     ACSDK_DEBUG5(LX(__func__));
     if (!channelVolumeFactory || !speakerManager || !equalizerRuntimeSetup || !httpContentFetcherFactory ||
         !shutdownNotifier) {
@@ -63,7 +65,8 @@ GstreamerApplicationAudioPipelineFactory::createApplicationAudioPipelineFactoryI
         equalizerRuntimeSetup,
         httpContentFetcherFactory,
         shutdownNotifier,
-        captionManager));
+        captionManager,
+        metricRecorder));
 }
 
 std::shared_ptr<avsCommon::sdkInterfaces::ApplicationMediaInterfaces> GstreamerApplicationAudioPipelineFactory::
@@ -77,7 +80,7 @@ std::shared_ptr<avsCommon::sdkInterfaces::ApplicationMediaInterfaces> GstreamerA
     bool enableEqualizer = equalizerAvailable && m_equalizerRuntimeSetup->isEnabled();
 
     auto mediaPlayer = alexaClientSDK::mediaPlayer::MediaPlayer::create(
-        m_httpContentFetcherFactory, enableEqualizer, name, enableLiveMode);
+        m_httpContentFetcherFactory, enableEqualizer, name, enableLiveMode, m_metricRecorder);
     if (!mediaPlayer) {
         ACSDK_ERROR(LX("createApplicationMediaInterfacesFailed").d("name", name));
         return nullptr;
@@ -164,13 +167,15 @@ GstreamerApplicationAudioPipelineFactory::GstreamerApplicationAudioPipelineFacto
     const std::shared_ptr<EqualizerRuntimeSetupInterface>& equalizerRuntimeSetup,
     const std::shared_ptr<HTTPContentFetcherInterfaceFactoryInterface>& httpContentFetcherFactory,
     const std::shared_ptr<ShutdownNotifierInterface>& shutdownNotifier,
-    const std::shared_ptr<CaptionManagerInterface>& captionManager) :
+    const std::shared_ptr<CaptionManagerInterface>& captionManager,
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder) :
         m_speakerManager{speakerManager},
         m_channelVolumeFactory{channelVolumeFactory},
         m_httpContentFetcherFactory{httpContentFetcherFactory},
         m_shutdownNotifier{shutdownNotifier},
         m_equalizerRuntimeSetup{equalizerRuntimeSetup},
-        m_captionManager{captionManager} {
+        m_captionManager{captionManager},
+        m_metricRecorder{metricRecorder} {
 }
 
 }  // namespace acsdkApplicationAudioPipelineFactory
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include <acsdkManufactory/Component.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <SpeechEncoder/SpeechEncoder.h>
 
 namespace alexaClientSDK {
@@ -27,7 +28,9 @@ namespace acsdkSpeechEncoder {
 /**
  * Manufactory Component definition for an Opus @c SpeechEncoder.
  */
-using SpeechEncoderComponent = acsdkManufactory::Component<std::shared_ptr<speechencoder::SpeechEncoder>>;
+using SpeechEncoderComponent = acsdkManufactory::Component<
+    std::shared_ptr<speechencoder::SpeechEncoder>,
+    acsdkManufactory::Import<std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>>>;
 
 /**
  * Get the Manufactory component for creating an Opus @c SpeechEncoder.
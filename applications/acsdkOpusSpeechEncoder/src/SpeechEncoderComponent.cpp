@@ -26,7 +26,7 @@ using namespace speechencoder;
 
 SpeechEncoderComponent getComponent() {
     return ComponentAccumulator<>()
-        .addRetainedFactory(SpeechEncoder::createSpeechEncoder)
+        .addRetainedFactory(SpeechEncoder::create)
         .addRetainedFactory(OpusEncoderContext::createEncoderContext);
 }
 
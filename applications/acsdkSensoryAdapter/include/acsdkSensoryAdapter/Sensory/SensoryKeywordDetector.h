@@ -22,6 +22,8 @@
 #include <unordered_set>
 
 #include <acsdkKWDImplementations/AbstractKeywordDetector.h>
+#include <acsdkKWDImplementations/AudioFrontEnd.h>
+#include <acsdkKWDInterfaces/AudioFrameConsumerInterface.h>
 #include <acsdkKWDInterfaces/KeywordDetectorStateNotifierInterface.h>
 #include <acsdkKWDInterfaces/KeywordNotifierInterface.h>
 #include <AVSCommon/AVS/AudioInputStream.h>
@@ -65,6 +67,24 @@ public:
         const std::string& modelFilePath,
         std::chrono::milliseconds msToPushPerIteration = std::chrono::milliseconds(10));
 
+    /**
+     * Creates a @c SensoryKeywordDetector which is fed by a shared @c AudioFrontEnd instead of reading the stream
+     * itself.  The detector runs on the front-end's thread and only sees the frames the front-end delivers, so with
+     * the default front-end settings the engine is idle during silence.  Requires that the AlexaClientSDKConfig.json
+     * has a modelFilePath value under sampleApp
+     *
+     * @param frontEnd The front-end to take frames from. Its frames should be 16 bit mono LPCM at 16 kHz.
+     * @param keyWordNotifier The object with which to notifiy observers of keyword detections.
+     * @param KeyWordDetectorStateNotifier The object with which to notify observers of state changes in the engine.
+     * @param modelFilePath The path to the model file.
+     * @return A new @c SensoryKeywordDetector, or @c nullptr if the operation failed.
+     */
+    static std::unique_ptr<SensoryKeywordDetector> create(
+        std::shared_ptr<acsdkKWDImplementations::AudioFrontEnd> frontEnd,
+        std::shared_ptr<acsdkKWDInterfaces::KeywordNotifierInterface> keyWordNotifier,
+        std::shared_ptr<acsdkKWDInterfaces::KeywordDetectorStateNotifierInterface> KeyWordDetectorStateNotifier,
+        const std::string& modelFilePath);
+
     /**
      * @deprecated
      * Creates a @c SensoryKeywordDetector. Requires that the AlexaClientSDKConfig.json has a modelFilePath value under
@@ -97,6 +117,27 @@ public:
     ~SensoryKeywordDetector() override;
 
 private:
+    /// Forwards frames from an @c AudioFrontEnd to the detector.
+    class FrameConsumer : public acsdkKWDInterfaces::AudioFrameConsumerInterface {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param detector The detector to forward frames to, which must outlive this consumer's registration.
+         */
+        explicit FrameConsumer(SensoryKeywordDetector* detector);
+
+        /// @name AudioFrameConsumerInterface Functions
+        /// @{
+        void onAudioFrame(const std::shared_ptr<const acsdkKWDInterfaces::AudioFrame>& frame) override;
+        void onFrontEndStopped(KeyWordDetectorStateObserverInterface::KeyWordDetectorState state) override;
+        /// @}
+
+    private:
+        /// The detector to forward frames to.
+        SensoryKeywordDetector* m_detector;
+    };
+
     /**
      * Constructor.
      *
@@ -110,17 +151,20 @@ private:
      * might lead longer delays before receiving keyword detection events. This has been defaulted to 10 milliseconds
      * as it is a good trade off between CPU usage and recognition delay. Additionally, this was the amount used by
      * Sensory in example code.
+     * @param frontEnd If not null, the front-end to take frames from instead of reading @c stream.
      */
     SensoryKeywordDetector(
         std::shared_ptr<AudioInputStream> stream,
         const std::shared_ptr<acsdkKWDInterfaces::KeywordNotifierInterface> keywordNotifier,
         const std::shared_ptr<acsdkKWDInterfaces::KeywordDetectorStateNotifierInterface> KeywordDetectorStateNotifier,
         avsCommon::utils::AudioFormat audioFormat,
-        std::chrono::milliseconds msToPushPerIteration = std::chrono::milliseconds(10));
+        std::chrono::milliseconds msToPushPerIteration = std::chrono::milliseconds(10),
+        std::shared_ptr<acsdkKWDImplementations::AudioFrontEnd> frontEnd = nullptr);
 
     /**
      * Initializes the stream reader, sets up the Sensory engine, and kicks off a thread to begin processing data from
-     * the stream. This function should only be called once with each new @c SensoryKeywordDetector.
+     * the stream, or registers with the front-end if there is one. This function should only be called once with
+     * each new @c SensoryKeywordDetector.
      *
      * @param modelFilePath The path to the model file.
      * @return @c true if the engine was initialized properly and @c false otherwise.
@@ -139,6 +183,22 @@ private:
     /// The main function that reads data and feeds it into the engine.
     void detectionLoop();
 
+    /**
+     * Feeds a frame delivered by the front-end into the engine.
+     *
+     * @param frame The frame.
+     */
+    void processFrame(const std::shared_ptr<const acsdkKWDInterfaces::AudioFrame>& frame);
+
+    /**
+     * Maps a sample index reported by the engine to an index in the stream.
+     *
+     * @param engineIndex The index of the sample among those fed to the current session.
+     * @param[out] streamIndex The index of the same sample in the stream.
+     * @return Whether the index could be mapped.
+     */
+    bool getStreamIndex(double engineIndex, avsCommon::avs::AudioInputStream::Index* streamIndex) const;
+
     /**
      * The callback that Sensory will issue to notify of keyword detections.
      *
@@ -170,6 +230,21 @@ private:
     /// The Sensory handle.
     SnsrSession m_session;
 
+    /// The front-end to take frames from, or @c nullptr if the detector reads the stream itself.
+    const std::shared_ptr<acsdkKWDImplementations::AudioFrontEnd> m_frontEnd;
+
+    /// The consumer registered with @c m_frontEnd.
+    std::shared_ptr<FrameConsumer> m_frameConsumer;
+
+    /// Whether @c m_sessionDeliveredIndex has been set from the first frame fed to the session.
+    bool m_hasSessionDeliveredIndex;
+
+    /**
+     * The @c AudioFrame::deliveredIndex of the first frame fed to the session. Sensory counts samples from this frame,
+     * and the front-end maps that count back to the stream.
+     */
+    avsCommon::avs::AudioInputStream::Index m_sessionDeliveredIndex;
+
     /**
      * The max number of samples to push into the underlying engine per iteration. This will be determined based on the
      * sampling rate of the audio data passed in.
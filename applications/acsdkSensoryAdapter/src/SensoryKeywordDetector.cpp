@@ -155,14 +155,39 @@ SnsrRC SensoryKeywordDetector::keyWordDetectedCallback(SnsrSession s, const char
         return result;
     }
 
-    engine->notifyKeyWordObservers(
-        engine->m_stream,
-        keyword,
-        engine->m_beginIndexOfStreamReader + begin,
-        engine->m_beginIndexOfStreamReader + end);
+    AudioInputStream::Index beginIndex = 0;
+    AudioInputStream::Index endIndex = 0;
+    if (!engine->getStreamIndex(begin, &beginIndex) || !engine->getStreamIndex(end, &endIndex)) {
+        ACSDK_ERROR(LX("keyWordDetectedCallbackFailed").d("reason", "indexMappingFailed").d("keyword", keyword));
+        return SNSR_RC_OK;
+    }
+
+    engine->notifyKeyWordObservers(engine->m_stream, keyword, beginIndex, endIndex);
     return SNSR_RC_OK;
 }
 
+bool SensoryKeywordDetector::getStreamIndex(double engineIndex, AudioInputStream::Index* streamIndex) const {
+    if (!m_frontEnd) {
+        *streamIndex = m_beginIndexOfStreamReader + engineIndex;
+        return true;
+    }
+    return m_frontEnd->getStreamIndex(
+        m_sessionDeliveredIndex + static_cast<AudioInputStream::Index>(engineIndex), streamIndex);
+}
+
+SensoryKeywordDetector::FrameConsumer::FrameConsumer(SensoryKeywordDetector* detector) : m_detector{detector} {
+}
+
+void SensoryKeywordDetector::FrameConsumer::onAudioFrame(
+    const std::shared_ptr<const acsdkKWDInterfaces::AudioFrame>& frame) {
+    m_detector->processFrame(frame);
+}
+
+void SensoryKeywordDetector::FrameConsumer::onFrontEndStopped(
+    KeyWordDetectorStateObserverInterface::KeyWordDetectorState state) {
+    m_detector->notifyKeyWordDetectorStateObservers(state);
+}
+
 // Deprecated create method.
 std::unique_ptr<SensoryKeywordDetector> SensoryKeywordDetector::create(
     std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
@@ -225,8 +250,43 @@ std::unique_ptr<SensoryKeywordDetector> SensoryKeywordDetector::create(
     return detector;
 }
 
+std::unique_ptr<SensoryKeywordDetector> SensoryKeywordDetector::create(
+    std::shared_ptr<acsdkKWDImplementations::AudioFrontEnd> frontEnd,
+    std::shared_ptr<acsdkKWDInterfaces::KeywordNotifierInterface> keywordNotifier,
+    std::shared_ptr<acsdkKWDInterfaces::KeywordDetectorStateNotifierInterface> keywordDetectorStateNotifier,
+    const std::string& modelFilePath) {
+    if (!frontEnd) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullFrontEnd"));
+        return nullptr;
+    }
+
+    // The front-end delivers frames in platform endianness, so no endianness check is needed here.
+    auto audioFormat = frontEnd->getAudioFormat();
+    if (!isAudioFormatCompatibleWithSensory(audioFormat)) {
+        return nullptr;
+    }
+
+    std::unique_ptr<SensoryKeywordDetector> detector(new SensoryKeywordDetector(
+        frontEnd->getStream(),
+        keywordNotifier,
+        keywordDetectorStateNotifier,
+        audioFormat,
+        std::chrono::milliseconds(10),
+        frontEnd));
+    if (!detector->init(modelFilePath)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "initDetectorFailed"));
+        return nullptr;
+    }
+
+    return detector;
+}
+
 SensoryKeywordDetector::~SensoryKeywordDetector() {
     m_isShuttingDown = true;
+    if (m_frontEnd && m_frameConsumer) {
+        // Once this returns the front-end no longer calls into this detector.
+        m_frontEnd->removeConsumer(m_frameConsumer);
+    }
     if (m_detectionThread.joinable()) {
         m_detectionThread.join();
     }
@@ -238,18 +298,25 @@ SensoryKeywordDetector::SensoryKeywordDetector(
     std::shared_ptr<acsdkKWDInterfaces::KeywordNotifierInterface> keywordNotifier,
     std::shared_ptr<acsdkKWDInterfaces::KeywordDetectorStateNotifierInterface> keywordDetectorStateNotifier,
     avsCommon::utils::AudioFormat audioFormat,
-    std::chrono::milliseconds msToPushPerIteration) :
+    std::chrono::milliseconds msToPushPerIteration,
+    std::shared_ptr<acsdkKWDImplementations::AudioFrontEnd> frontEnd) :
         acsdkKWDImplementations::AbstractKeywordDetector(keywordNotifier, keywordDetectorStateNotifier),
         m_stream{stream},
+        m_beginIndexOfStreamReader{0},
         m_session{nullptr},
+        m_frontEnd{frontEnd},
+        m_hasSessionDeliveredIndex{false},
+        m_sessionDeliveredIndex{0},
         m_maxSamplesPerPush((audioFormat.sampleRateHz / HERTZ_PER_KILOHERTZ) * msToPushPerIteration.count()) {
 }
 
 bool SensoryKeywordDetector::init(const std::string& modelFilePath) {
-    m_streamReader = m_stream->createReader(AudioInputStream::Reader::Policy::BLOCKING);
-    if (!m_streamReader) {
-        ACSDK_ERROR(LX("initFailed").d("reason", "createStreamReaderFailed"));
-        return false;
+    if (!m_frontEnd) {
+        m_streamReader = m_stream->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+        if (!m_streamReader) {
+            ACSDK_ERROR(LX("initFailed").d("reason", "createStreamReaderFailed"));
+            return false;
+        }
     }
 
     // Allocate the Sensory library handle
@@ -301,6 +368,16 @@ bool SensoryKeywordDetector::init(const std::string& modelFilePath) {
     }
 
     m_isShuttingDown = false;
+    if (m_frontEnd) {
+        m_frameConsumer = std::make_shared<FrameConsumer>(this);
+        notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
+        if (!m_frontEnd->addConsumer(m_frameConsumer)) {
+            ACSDK_ERROR(LX("initFailed").d("reason", "addConsumerFailed"));
+            m_frameConsumer.reset();
+            return false;
+        }
+        return true;
+    }
     m_detectionThread = std::thread(&SensoryKeywordDetector::detectionLoop, this);
     return true;
 }
@@ -417,5 +494,35 @@ void SensoryKeywordDetector::detectionLoop() {
     m_streamReader->close();
 }
 
+void SensoryKeywordDetector::processFrame(const std::shared_ptr<const acsdkKWDInterfaces::AudioFrame>& frame) {
+    if (m_isShuttingDown) {
+        return;
+    }
+    if (!m_hasSessionDeliveredIndex) {
+        m_sessionDeliveredIndex = frame->deliveredIndex;
+        m_hasSessionDeliveredIndex = true;
+    }
+
+    // The stream is only read from, so the frame is not modified.
+    snsrSetStream(
+        m_session,
+        SNSR_SOURCE_AUDIO_PCM,
+        snsrStreamFromMemory(
+            const_cast<int16_t*>(frame->samples.data()),
+            frame->samples.size() * sizeof(*frame->samples.data()),
+            SNSR_ST_MODE_READ));
+    SnsrRC result = snsrRun(m_session);
+    if (result != SNSR_RC_OK && result != SNSR_RC_STREAM_END) {
+        ACSDK_ERROR(LX("processFrameFailed")
+                        .d("reason", "unexpectedReturn")
+                        .d("error", getSensoryDetails(m_session, result)));
+        notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ERROR);
+        // Stop feeding the engine, as the legacy detection loop does on the same error.
+        m_isShuttingDown = true;
+    }
+    // Reset return code for next frame
+    snsrClearRC(m_session);
+}
+
 }  // namespace kwd
 }  // namespace alexaClientSDK
@@ -27,6 +27,7 @@
 #include <list>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 namespace alexaClientSDK {
 namespace acsdkAlerts {
@@ -295,6 +296,28 @@ private:
      */
     std::shared_ptr<Alert> getAlertLocked(const std::string& token) const;
 
+    /**
+     * A utility function to add an alert to the scheduled alerts and to the token index.  This function requires
+     * @c m_mutex be locked.
+     *
+     * @param alert The alert to be added.
+     */
+    void insertScheduledAlertLocked(const std::shared_ptr<Alert>& alert);
+
+    /**
+     * A utility function to remove an alert from the scheduled alerts and from the token index.  This function
+     * requires @c m_mutex be locked.
+     *
+     * @param alert The alert to be removed.
+     */
+    void eraseScheduledAlertLocked(const std::shared_ptr<Alert>& alert);
+
+    /**
+     * A utility function to remove all the scheduled alerts and clear the token index.  This function requires
+     * @c m_mutex be locked.
+     */
+    void clearScheduledAlertsLocked();
+
     /**
      * A utility function to retreive the currently active alert.  This function requires @c m_mutex be locked.
      *
@@ -347,6 +370,8 @@ private:
     std::shared_ptr<Alert> m_activeAlert;
     /// All alerts which are scheduled to occur, ordered ascending by time.
     std::set<std::shared_ptr<Alert>, acsdkAlerts::TimeComparator> m_scheduledAlerts;
+    /// The alerts in @c m_scheduledAlerts, indexed by token.
+    std::unordered_map<std::string, std::shared_ptr<Alert>> m_scheduledAlertsByToken;
 
     /// The timer for the next alert to go off, if one is not already active.
     avsCommon::utils::timing::Timer m_scheduledAlertTimer;
@@ -233,6 +233,22 @@ private:
      */
     bool storeAlertToV2(const int id, std::shared_ptr<Alert> alert);
 
+    /**
+     * A utility function to store an alert with its assets.  The caller is responsible for the transaction.
+     *
+     * @param alert The alert to be stored.
+     * @return Whether the alert was stored successfully.
+     */
+    bool storeHelper(std::shared_ptr<Alert> alert);
+
+    /**
+     * A utility function to erase an alert with its assets.  The caller is responsible for the transaction.
+     *
+     * @param alert The alert to be erased.
+     * @return Whether the alert was erased successfully.
+     */
+    bool eraseHelper(std::shared_ptr<Alert> alert);
+
     /**
      * Modify an alert in the databse.
      *
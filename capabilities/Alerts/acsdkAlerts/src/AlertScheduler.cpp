@@ -161,7 +161,7 @@ bool AlertScheduler::scheduleAlert(std::shared_ptr<Alert> alert) {
     }
     alert->setRenderer(m_alertRenderer);
     alert->setObserver(this);
-    m_scheduledAlerts.insert(alert);
+    insertScheduledAlertLocked(alert);
 
     if (!m_activeAlert) {
         setTimerForNextAlertLocked();
@@ -215,12 +215,13 @@ bool AlertScheduler::reloadAlertsFromDatabase(
     if (m_scheduledAlertTimer.isActive()) {
         m_scheduledAlertTimer.stop();
     }
-    m_scheduledAlerts.clear();
+    clearScheduledAlertsLocked();
     m_alertStorage->load(&alerts, settingsManager);
 
     if (m_shouldScheduleAlerts) {
         int alertPastDueDuringSchedulingCount = 0;
         int activeAlertReloadedDuringSchedulingCount = 0;
+        std::list<std::shared_ptr<Alert>> pastDueAlerts;
 
         for (auto& alert : alerts) {
             // If the alert is active, we want to avoid modifying it so that it stays active
@@ -236,7 +237,7 @@ bool AlertScheduler::reloadAlertsFromDatabase(
                         alert->getLabel()));
                     ACSDK_DEBUG5(LX(ALERT_PAST_DUE_DURING_SCHEDULING).d("alertId", alert->getToken()));
                     ++alertPastDueDuringSchedulingCount;
-                    eraseAlert(alert);
+                    pastDueAlerts.push_back(alert);
                 } else {
                     // if the alert was active when the system last powered down, then re-init the state to set
                     if (Alert::State::ACTIVE == alert->getState()) {
@@ -249,7 +250,7 @@ bool AlertScheduler::reloadAlertsFromDatabase(
                     alert->setRenderer(m_alertRenderer);
                     alert->setObserver(this);
 
-                    m_scheduledAlerts.insert(alert);
+                    insertScheduledAlertLocked(alert);
                     notifyObserver(AlertInfo(
                         alert->getToken(),
                         alert->getType(),
@@ -261,6 +262,30 @@ bool AlertScheduler::reloadAlertsFromDatabase(
             }
         }
 
+        // Past-due alerts are erased in a single storage transaction, which keeps startup fast with large alert sets.
+        // bulkErase() is all-or-nothing, so if it fails, fall back to erasing them one by one.  That way a single alert
+        // that cannot be erased does not keep every other past-due alert in the database.
+        if (!pastDueAlerts.empty()) {
+            if (m_alertStorage->bulkErase(pastDueAlerts)) {
+                for (auto& alert : pastDueAlerts) {
+                    notifyObserver(AlertInfo(
+                        alert->getToken(),
+                        alert->getType(),
+                        AlertObserverInterface::State::DELETED,
+                        alert->getScheduledTime_Utc_TimePoint(),
+                        alert->getOriginalTime(),
+                        alert->getLabel()));
+                }
+            } else {
+                ACSDK_WARN(LX("reloadAlertsFromDatabase")
+                               .m("Could not bulk erase past-due alerts, erasing them one by one")
+                               .d("count", pastDueAlerts.size()));
+                for (auto& alert : pastDueAlerts) {
+                    eraseAlert(alert);
+                }
+            }
+        }
+
         // If we currently have an active alert, we don't want to set a timer for the next one yet
         if (!m_activeAlert) {
             setTimerForNextAlertLocked();
@@ -272,7 +297,7 @@ bool AlertScheduler::reloadAlertsFromDatabase(
         for (auto& alert : alerts) {
             alert->setRenderer(m_alertRenderer);
             alert->setObserver(this);
-            m_scheduledAlerts.insert(alert);
+            insertScheduledAlertLocked(alert);
         }
     }
 
@@ -285,11 +310,11 @@ bool AlertScheduler::updateAlert(
     const Alert::AssetConfiguration& newAssetConfiguration) {
     ACSDK_DEBUG5(LX(__func__).d("token", alert->getToken()).m("updateAlert"));
     // Remove old alert.
-    m_scheduledAlerts.erase(alert);
+    eraseScheduledAlertLocked(alert);
 
     // Re-insert the alert and update timer before exiting this function.
     FinallyGuard guard{[this, &alert] {
-        m_scheduledAlerts.insert(alert);
+        insertScheduledAlertLocked(alert);
         if (!m_activeAlert) {
             setTimerForNextAlertLocked();
         }
@@ -349,7 +374,7 @@ bool AlertScheduler::deleteAlert(const std::string& alertToken) {
 
     eraseAlert(alert);
 
-    m_scheduledAlerts.erase(alert);
+    eraseScheduledAlertLocked(alert);
 
     setTimerForNextAlertLocked();
 
@@ -402,7 +427,7 @@ bool AlertScheduler::deleteAlerts(const std::list<std::string>& tokenList) {
     }
 
     for (auto& alert : alertsToBeRemoved) {
-        m_scheduledAlerts.erase(alert);
+        eraseScheduledAlertLocked(alert);
         notifyObserver(AlertInfo(
             alert->getToken(),
             alert->getType(),
@@ -524,7 +549,7 @@ void AlertScheduler::clearData(Alert::StopReason reason) {
             alert->getLabel()));
     }
 
-    m_scheduledAlerts.clear();
+    clearScheduledAlertsLocked();
     m_alertStorage->clearDatabase();
 }
 
@@ -543,7 +568,7 @@ void AlertScheduler::shutdown() {
     for (auto& alert : m_scheduledAlerts) {
         alert->setRenderer(nullptr);
     }
-    m_scheduledAlerts.clear();
+    clearScheduledAlertsLocked();
 }
 
 void AlertScheduler::executeOnAlertStateChange(const AlertObserverInterface::AlertInfo& alertInfo) {
@@ -608,7 +633,7 @@ void AlertScheduler::executeOnAlertStateChange(const AlertObserverInterface::Ale
 
         case State::SNOOZED:
             m_alertStorage->modify(m_activeAlert);
-            m_scheduledAlerts.insert(m_activeAlert);
+            insertScheduledAlertLocked(m_activeAlert);
             m_activeAlert.reset();
             notifyObserver(alertInfo);
             setTimerForNextAlertLocked();
@@ -653,7 +678,7 @@ void AlertScheduler::executeOnAlertStateChange(const AlertObserverInterface::Ale
                     ACSDK_DEBUG(
                         (LX("erasing Alert with an error that is no longer active").d("alertToken", alertInfo.token)));
                     eraseAlert(alert);
-                    m_scheduledAlerts.erase(alert);
+                    eraseScheduledAlertLocked(alert);
                     setTimerForNextAlertLocked();
                 }
             }
@@ -768,7 +793,7 @@ void AlertScheduler::activateNextAlertLocked() {
     }
 
     m_activeAlert = *(m_scheduledAlerts.begin());
-    m_scheduledAlerts.erase(m_scheduledAlerts.begin());
+    eraseScheduledAlertLocked(m_activeAlert);
 
     m_activeAlert->setFocusState(m_focusState, m_mixingBehavior);
     m_activeAlert->activate();
@@ -788,13 +813,29 @@ bool AlertScheduler::isAlertActiveLocked(std::shared_ptr<Alert> alert) const {
 }
 
 std::shared_ptr<Alert> AlertScheduler::getAlertLocked(const std::string& token) const {
-    for (auto& alert : m_scheduledAlerts) {
-        if (token == alert->getToken()) {
-            return alert;
-        }
+    auto it = m_scheduledAlertsByToken.find(token);
+    if (it == m_scheduledAlertsByToken.end()) {
+        return nullptr;
     }
 
-    return nullptr;
+    return it->second;
+}
+
+void AlertScheduler::insertScheduledAlertLocked(const std::shared_ptr<Alert>& alert) {
+    // Alerts are loaded from storage in time order, so hinting at the end makes reloads linear.
+    m_scheduledAlerts.insert(m_scheduledAlerts.end(), alert);
+    m_scheduledAlertsByToken[alert->getToken()] = alert;
+}
+
+void AlertScheduler::eraseScheduledAlertLocked(const std::shared_ptr<Alert>& alert) {
+    if (m_scheduledAlerts.erase(alert)) {
+        m_scheduledAlertsByToken.erase(alert->getToken());
+    }
+}
+
+void AlertScheduler::clearScheduledAlertsLocked() {
+    m_scheduledAlerts.clear();
+    m_scheduledAlertsByToken.clear();
 }
 
 std::shared_ptr<Alert> AlertScheduler::getActiveAlertLocked() const {
@@ -200,6 +200,19 @@ static const std::string CREATE_ALERT_ASSET_PLAY_ORDER_ITEMS_TABLE_SQL_STRING =
         "asset_play_order_token TEXT NOT NULL);";
 // clang-format on
 
+/// The SQL strings to create the indexes used to look up alerts by token and time, and their assets by alert id.
+// clang-format off
+static const std::vector<std::string> CREATE_ALERT_INDEXES_SQL_STRINGS = {
+        "CREATE INDEX IF NOT EXISTS " + ALERTS_V3_TABLE_NAME + "_token_index ON " +
+                ALERTS_V3_TABLE_NAME + " (" + DATABASE_COLUMN_TOKEN_NAME + ");",
+        "CREATE INDEX IF NOT EXISTS " + ALERTS_V3_TABLE_NAME + "_scheduled_time_index ON " +
+                ALERTS_V3_TABLE_NAME + " (" + DATABASE_COLUMN_SCHEDULED_TIME_UNIX_NAME + ");",
+        "CREATE INDEX IF NOT EXISTS " + ALERT_ASSETS_TABLE_NAME + "_alert_id_index ON " +
+                ALERT_ASSETS_TABLE_NAME + " (alert_id);",
+        "CREATE INDEX IF NOT EXISTS " + ALERT_ASSET_PLAY_ORDER_ITEMS_TABLE_NAME + "_alert_id_index ON " +
+                ALERT_ASSET_PLAY_ORDER_ITEMS_TABLE_NAME + " (alert_id);"};
+// clang-format on
+
 /// The prefix for alert metrics.
 static const std::string ALERT_METRIC_PREFIX = "ALERT-";
 
@@ -511,6 +524,29 @@ static bool createAlertAssetPlayOrderItemsTable(SQLiteDatabase* db) {
     return true;
 }
 
+/**
+ * Utility function to create the indexes of the alerts, alertAssets and alertAssetPlayOrderItems tables.  The tables
+ * must already exist.
+ *
+ * @param db The SQLiteDatabase object.
+ * @return Whether the indexes were successfully created.
+ */
+static bool createAlertIndexes(SQLiteDatabase* db) {
+    if (!db) {
+        ACSDK_ERROR(LX("createAlertIndexesFailed").m("null db"));
+        return false;
+    }
+
+    for (auto& sqlString : CREATE_ALERT_INDEXES_SQL_STRINGS) {
+        if (!db->performQuery(sqlString)) {
+            ACSDK_ERROR(LX("createAlertIndexesFailed").m("Index could not be created."));
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool SQLiteAlertStorage::createDatabase() {
     if (!m_db.initialize()) {
         ACSDK_ERROR(LX("createDatabaseFailed"));
@@ -550,6 +586,10 @@ bool SQLiteAlertStorage::createDatabase() {
         return false;
     }
 
+    if (!createAlertIndexes(&m_db)) {
+        ACSDK_WARN(LX("createDatabase").m("Alert indexes could not be created."));
+    }
+
     submitMetric(m_metricRecorder, CREATE_DATABASE_FAILED, 0);
     return true;
 }
@@ -584,6 +624,11 @@ bool SQLiteAlertStorage::open() {
         }
     }
 
+    /// Databases created by older versions have no indexes.  Lookups still work without them, only slower.
+    if (!createAlertIndexes(&m_db)) {
+        ACSDK_WARN(LX("open").m("Alert indexes could not be created."));
+    }
+
     /// Offline alerts table will be created during migration if it does not exist yet.
     if (!migrateOfflineAlertsDbFromV1ToV2()) {
         ACSDK_ERROR(LX("openFailed").m("migrateOfflineAlertsDbFromV1ToV2 failed."));
@@ -1019,6 +1064,30 @@ bool SQLiteAlertStorage::store(std::shared_ptr<Alert> alert) {
         return false;
     }
 
+    // Store the alert with its assets in a single transaction, so a burst of SetAlert directives costs one commit per
+    // alert rather than one per row, and a failure half way does not leave orphaned rows behind.
+    auto transaction = m_db.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("storeFailed").d("reason", "Failed to begin transaction."));
+        return false;
+    }
+
+    if (!storeHelper(alert)) {
+        if (!transaction->rollback()) {
+            ACSDK_ERROR(LX("storeFailed").d("reason", "Failed to rollback alerts storage changes"));
+        }
+        return false;
+    }
+
+    if (!transaction->commit()) {
+        ACSDK_ERROR(LX("storeFailed").d("reason", "Failed to commit alerts storage changes"));
+        return false;
+    }
+    return true;
+}
+
+bool SQLiteAlertStorage::storeHelper(std::shared_ptr<Alert> alert) {
+
     if (alertExists(ALERTS_DATABASE_VERSION_THREE, alert->getToken())) {
         ACSDK_ERROR(LX("storeAlertFailed").m("Alert already exists.").d("token", alert->getToken()));
         return false;
@@ -1451,7 +1520,9 @@ bool SQLiteAlertStorage::loadHelper(
         alertsTableName = ALERTS_V2_TABLE_NAME;
     }
 
-    const std::string sqlString = "SELECT * FROM " + alertsTableName + ";";
+    // Loading in time order lets the scheduler append alerts to its queue rather than search for their position.
+    const std::string sqlString =
+        "SELECT * FROM " + alertsTableName + " ORDER BY " + DATABASE_COLUMN_SCHEDULED_TIME_UNIX_NAME + ";";
 
     auto statement = m_db.createStatement(sqlString);
 
@@ -1918,6 +1989,27 @@ static bool eraseAlertByAlertId(SQLiteDatabase* db, int alertId) {
 }
 
 bool SQLiteAlertStorage::erase(std::shared_ptr<Alert> alert) {
+    auto transaction = m_db.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("eraseFailed").d("reason", "Failed to begin transaction."));
+        return false;
+    }
+
+    if (!eraseHelper(alert)) {
+        if (!transaction->rollback()) {
+            ACSDK_ERROR(LX("eraseFailed").d("reason", "Failed to rollback alerts storage changes"));
+        }
+        return false;
+    }
+
+    if (!transaction->commit()) {
+        ACSDK_ERROR(LX("eraseFailed").d("reason", "Failed to commit alerts storage changes"));
+        return false;
+    }
+    return true;
+}
+
+bool SQLiteAlertStorage::eraseHelper(std::shared_ptr<Alert> alert) {
     if (!alert) {
         ACSDK_ERROR(LX("eraseFailed").m("Alert parameter is nullptr."));
         return false;
@@ -1970,7 +2062,7 @@ bool SQLiteAlertStorage::bulkErase(const std::list<std::shared_ptr<Alert>>& aler
     }
 
     for (auto& alert : alertList) {
-        if (!erase(alert)) {
+        if (!eraseHelper(alert)) {
             ACSDK_ERROR(LX("bulkEraseFailed").d("reason", "Failed to erase alert"));
             if (!transaction->rollback()) {
                 ACSDK_ERROR(LX("bulkEraseFailed").d("reason", "Failed to rollback alerts storage changes"));
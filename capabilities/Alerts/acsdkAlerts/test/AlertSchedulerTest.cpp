@@ -13,10 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <list>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <gmock/gmock-actions.h>
 
+#include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
 #include <AVSCommon/Utils/Timing/TimeUtils.h>
@@ -33,6 +36,16 @@ using namespace acsdkAlertsInterfaces;
 using namespace testing;
 using namespace rapidjson;
 
+/// String to identify log entries originating from this file.
+static const std::string TAG("AlertSchedulerTest");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
 /// Tokens for alerts.
 static const std::string ALERT1_TOKEN = "token1";
 static const std::string ALERT2_TOKEN = "token2";
@@ -55,6 +68,9 @@ static const std::chrono::milliseconds TEST_TIMEOUT{100};
 /// Alert past due time limit.
 static const std::chrono::seconds ALERT_PAST_DUE_TIME_LIMIT{10};
 
+/// Number of alerts used to measure the scheduler with a large alert set.
+static const int LARGE_ALERT_SET_SIZE = 10000;
+
 class MockRenderer : public renderer::RendererInterface {
 public:
     MOCK_METHOD7(
@@ -291,6 +307,13 @@ static std::string getFutureInstant(int yearsPlus) {
     return std::to_string(utc_tm.tm_year + 1900 + yearsPlus) + FUTURE_INSTANT_SUFFIX;
 }
 
+static std::string getFutureInstant(std::chrono::minutes minutesPlus) {
+    std::string timeStr;
+    avsCommon::utils::timing::TimeUtils().convertTimeToUtcIso8601Rfc3339(
+        std::chrono::system_clock::now() + minutesPlus, &timeStr);
+    return timeStr;
+}
+
 static std::string getTimeNow() {
     std::string timeNowStr;
     auto timeNow = std::chrono::system_clock::now();
@@ -442,7 +465,7 @@ TEST_F(AlertSchedulerTest, DISABLED_test_reloadAlertsFromDatabaseWithScheduling)
     m_alertStorage->setAlerts(alertsToAdd);
 
     /// past alert should get removed
-    EXPECT_CALL(*(m_alertStorage.get()), erase(testing::_)).Times(1);
+    EXPECT_CALL(*(m_alertStorage.get()), bulkErase(SizeIs(1))).WillOnce(Return(true));
 
     /// active alert should get modified
     EXPECT_CALL(*(m_alertStorage.get()), modify(testing::_)).Times(1);
@@ -457,6 +480,28 @@ TEST_F(AlertSchedulerTest, DISABLED_test_reloadAlertsFromDatabaseWithScheduling)
     ASSERT_EQ(m_alertScheduler->getContextInfo().scheduledAlerts.size(), expectedRemainingAlerts);
 }
 
+/**
+ * Test that past-due alerts are erased one by one if erasing them in bulk fails, so that an alert that cannot be
+ * erased does not keep the others in the database.
+ */
+TEST_F(AlertSchedulerTest, test_reloadAlertsFromDatabaseFallsBackWhenBulkEraseFails) {
+    std::vector<std::shared_ptr<TestAlert>> alertsToAdd;
+    auto pastAlert1 = std::make_shared<TestAlert>(ALERT1_TOKEN, PAST_INSTANT);
+    auto pastAlert2 = std::make_shared<TestAlert>(ALERT2_TOKEN, PAST_INSTANT);
+    auto futureAlert = std::make_shared<TestAlert>(ALERT3_TOKEN, getFutureInstant(1));
+    alertsToAdd.push_back(pastAlert1);
+    alertsToAdd.push_back(pastAlert2);
+    alertsToAdd.push_back(futureAlert);
+    m_alertStorage->setAlerts(alertsToAdd);
+
+    EXPECT_CALL(*(m_alertStorage.get()), bulkErase(SizeIs(2))).WillOnce(Return(false));
+    EXPECT_CALL(*(m_alertStorage.get()), erase(std::static_pointer_cast<Alert>(pastAlert1))).WillOnce(Return(false));
+    EXPECT_CALL(*(m_alertStorage.get()), erase(std::static_pointer_cast<Alert>(pastAlert2))).WillOnce(Return(true));
+
+    ASSERT_TRUE(m_alertScheduler->initialize(m_testAlertObserver, m_settingsManager));
+    EXPECT_EQ(m_alertScheduler->getAllAlerts().size(), 1u);
+}
+
 /**
  * Test reloading alerts from the database without scheduling.
  */
@@ -605,6 +650,48 @@ TEST_F(AlertSchedulerTest, test_rescheduleAlertFails) {
     EXPECT_EQ(oldAlert->getScheduledTime_ISO_8601(), oldScheduledTime);
 }
 
+/**
+ * Measure reloading and deleting a large set of alerts.
+ */
+TEST_F(AlertSchedulerTest, testTimer_reloadAndDeleteLargeAlertSet) {
+    std::vector<std::shared_ptr<TestAlert>> alertsToAdd;
+    std::list<std::string> tokens;
+    for (int i = 0; i < LARGE_ALERT_SET_SIZE; ++i) {
+        auto token = "token-" + std::to_string(i);
+        alertsToAdd.push_back(std::make_shared<TestAlert>(token, getFutureInstant(std::chrono::minutes(60 + i))));
+        // Even alerts are deleted one by one, odd ones in bulk.
+        if (i % 2) {
+            tokens.push_back(token);
+        }
+    }
+    m_alertStorage->setAlerts(alertsToAdd);
+    EXPECT_CALL(*m_alertStorage.get(), erase(_)).Times(LARGE_ALERT_SET_SIZE / 2).WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_alertStorage.get(), bulkErase(SizeIs(LARGE_ALERT_SET_SIZE / 2))).WillOnce(Return(true));
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_alertScheduler->initialize(m_testAlertObserver, m_settingsManager));
+    auto reloadTime = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(m_alertScheduler->getAllAlerts().size(), static_cast<size_t>(LARGE_ALERT_SET_SIZE));
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < LARGE_ALERT_SET_SIZE; i += 2) {
+        ASSERT_TRUE(m_alertScheduler->deleteAlert("token-" + std::to_string(i)));
+    }
+    auto deleteTime = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(m_alertScheduler->getAllAlerts().size(), static_cast<size_t>(LARGE_ALERT_SET_SIZE / 2));
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_alertScheduler->deleteAlerts(tokens));
+    auto bulkDeleteTime = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(m_alertScheduler->getAllAlerts().empty());
+
+    ACSDK_INFO(LX("testTimer_reloadAndDeleteLargeAlertSet")
+                   .d("alerts", LARGE_ALERT_SET_SIZE)
+                   .d("reloadMs", std::chrono::duration_cast<std::chrono::milliseconds>(reloadTime).count())
+                   .d("deleteMs", std::chrono::duration_cast<std::chrono::milliseconds>(deleteTime).count())
+                   .d("bulkDeleteMs", std::chrono::duration_cast<std::chrono::milliseconds>(bulkDeleteTime).count()));
+}
+
 /**
  * Test snoozing alerts
  */
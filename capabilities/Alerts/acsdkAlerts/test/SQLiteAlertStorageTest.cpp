@@ -13,7 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <ctime>
 #include <fstream>
+#include <list>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -189,6 +192,12 @@ static const std::string ORIGINAL_TIME_REMINDER = "18:00:00.000";
 static const std::string LABEL_TIMER = "coffee";
 static const std::string LABEL_REMINDER = "walk the dog";
 
+/// Number of alerts used to measure the storage with a large alert set.
+static const int LARGE_ALERT_SET_SIZE = 10000;
+
+/// Unix time of the first alert of the large alert set (2020-08-08T08:00:00+0000).
+static const std::time_t LARGE_ALERT_SET_START_TIME = 1596873600;
+
 /**
  * Mock class for @c Alert.
  */
@@ -234,6 +243,9 @@ public:
     /// Utility function to create the alert;
     std::shared_ptr<MockAlert> createAlert(const std::string& alertType);
 
+    /// Utility function to create a reminder with the given token, scheduled at the given unix time.
+    std::shared_ptr<MockAlert> createReminder(const std::string& token, std::time_t scheduledTime);
+
     /// Utility function to check if the alert exists in a specific table.
     bool alertExists(SQLiteDatabase* db, const std::string& tableName, const std::string& token);
 
@@ -322,6 +334,31 @@ std::shared_ptr<MockAlert> SQLiteAlertStorageTest::createAlert(const std::string
     return alert;
 }
 
+/**
+ * Utility function to format a unix time the way alerts are stored.
+ *
+ * @param unixTime The unix time to format.
+ * @return The ISO 8601 representation of @c unixTime.
+ */
+static std::string toIso8601(std::time_t unixTime) {
+    char iso8601[sizeof("YYYY-MM-DDTHH:MM:SS+0000")];
+    std::tm utcTime;
+    gmtime_r(&unixTime, &utcTime);
+    std::strftime(iso8601, sizeof(iso8601), "%Y-%m-%dT%H:%M:%S+0000", &utcTime);
+    return iso8601;
+}
+
+std::shared_ptr<MockAlert> SQLiteAlertStorageTest::createReminder(const std::string& token, std::time_t scheduledTime) {
+    auto alert = std::make_shared<MockAlert>(TEST_ALERT_TYPE_REMINDER);
+    Alert::StaticData staticData;
+    Alert::DynamicData dynamicData;
+    staticData.token = token;
+    dynamicData.timePoint.setTime_ISO_8601(toIso8601(scheduledTime));
+    dynamicData.loopCount = 1;
+    alert->setAlertData(&staticData, &dynamicData);
+    return alert;
+}
+
 bool SQLiteAlertStorageTest::alertExists(SQLiteDatabase* db, const std::string& tableName, const std::string& token) {
     const std::string sqlString = "SELECT COUNT(*) FROM " + tableName + " WHERE token=?;";
     auto statement = db->createStatement(sqlString);
@@ -823,6 +860,99 @@ TEST_F(SQLiteAlertStorageTest, test_eraseOfflineAlerts) {
     ASSERT_TRUE(alertContainer.GetArray().Empty());
 }
 
+/**
+ * Test that alerts are loaded in ascending scheduled time, regardless of the order they were stored in.
+ */
+TEST_F(SQLiteAlertStorageTest, test_loadAlertsOrderedByScheduledTime) {
+    setUpDatabase();
+    ASSERT_TRUE(m_alertStorage->store(createAlert(TEST_ALERT_TYPE_REMINDER)));
+    ASSERT_TRUE(m_alertStorage->store(createAlert(TEST_ALERT_TYPE_ALARM)));
+    ASSERT_TRUE(m_alertStorage->store(createAlert(TEST_ALERT_TYPE_TIMER)));
+
+    std::vector<std::shared_ptr<Alert>> alerts;
+    m_alertStorage->load(&alerts, nullptr);
+    ASSERT_EQ(static_cast<int>(alerts.size()), 3);
+    EXPECT_EQ(alerts[0]->getToken(), TOKEN_ALARM);
+    EXPECT_EQ(alerts[1]->getToken(), TOKEN_TIMER);
+    EXPECT_EQ(alerts[2]->getToken(), TOKEN_REMINDER);
+}
+
+/**
+ * Test that storing an alert twice fails and leaves a single copy behind, which can be erased once.
+ */
+TEST_F(SQLiteAlertStorageTest, test_storeDuplicateAlertFails) {
+    setUpDatabase();
+    auto alarm = createAlert(TEST_ALERT_TYPE_ALARM);
+    ASSERT_TRUE(m_alertStorage->store(alarm));
+    ASSERT_FALSE(m_alertStorage->store(createAlert(TEST_ALERT_TYPE_ALARM)));
+
+    std::vector<std::shared_ptr<Alert>> alerts;
+    m_alertStorage->load(&alerts, nullptr);
+    ASSERT_EQ(static_cast<int>(alerts.size()), 1);
+
+    ASSERT_TRUE(m_alertStorage->erase(alarm));
+    ASSERT_FALSE(m_alertStorage->erase(alarm));
+}
+
+/**
+ * Measure loading and erasing a large set of alerts, and storing one more alert on top of it.
+ */
+TEST_F(SQLiteAlertStorageTest, testTimer_loadAndEraseLargeAlertSet) {
+    setUpDatabase();
+
+    // Seed the alerts directly in a single transaction, latest first so loading has to order them.
+    alexaClientSDK::storage::sqliteStorage::SQLiteDatabase db(TEST_DATABASE_FILE_NAME);
+    ASSERT_TRUE(db.open());
+    {
+        auto transaction = db.beginTransaction();
+        ASSERT_TRUE(transaction);
+        auto statement = db.createStatement(
+            "INSERT INTO " + ALERTS_V3_TABLE_NAME + " VALUES (?, ?, 3, 2, ?, ?, 1, 0, '', '', '', '');");
+        ASSERT_TRUE(statement);
+        for (int i = LARGE_ALERT_SET_SIZE - 1; i >= 0; --i) {
+            std::time_t scheduledTime = LARGE_ALERT_SET_START_TIME + i * 60;
+            ASSERT_TRUE(statement->bindIntParameter(1, LARGE_ALERT_SET_SIZE - i));
+            ASSERT_TRUE(statement->bindStringParameter(2, "token-" + std::to_string(i)));
+            ASSERT_TRUE(statement->bindInt64Parameter(3, scheduledTime));
+            ASSERT_TRUE(statement->bindStringParameter(4, toIso8601(scheduledTime)));
+            ASSERT_TRUE(statement->step());
+            ASSERT_TRUE(statement->reset());
+        }
+        ASSERT_TRUE(transaction->commit());
+    }
+    db.close();
+
+    std::vector<std::shared_ptr<Alert>> alerts;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_alertStorage->load(&alerts, nullptr));
+    auto loadTime = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(static_cast<int>(alerts.size()), LARGE_ALERT_SET_SIZE);
+    for (size_t i = 1; i < alerts.size(); ++i) {
+        ASSERT_LE(alerts[i - 1]->getScheduledTime_Unix(), alerts[i]->getScheduledTime_Unix());
+    }
+
+    auto reminder = createReminder("token-new", LARGE_ALERT_SET_START_TIME);
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_alertStorage->store(reminder));
+    auto storeTime = std::chrono::steady_clock::now() - start;
+    alerts.push_back(reminder);
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_alertStorage->bulkErase({alerts.begin(), alerts.end()}));
+    auto eraseTime = std::chrono::steady_clock::now() - start;
+
+    alerts.clear();
+    ASSERT_TRUE(m_alertStorage->load(&alerts, nullptr));
+    ASSERT_TRUE(alerts.empty());
+
+    ACSDK_INFO(LX("testTimer_loadAndEraseLargeAlertSet")
+                   .d("alerts", LARGE_ALERT_SET_SIZE)
+                   .d("loadMs", std::chrono::duration_cast<std::chrono::milliseconds>(loadTime).count())
+                   .d("storeMs", std::chrono::duration_cast<std::chrono::milliseconds>(storeTime).count())
+                   .d("bulkEraseMs", std::chrono::duration_cast<std::chrono::milliseconds>(eraseTime).count()));
+}
+
 /**
  * Test clear databse.
  */
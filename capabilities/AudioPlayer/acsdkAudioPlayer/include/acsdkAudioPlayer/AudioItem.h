@@ -25,6 +25,7 @@
 #include <Captions/CaptionData.h>
 
 #include "StreamFormat.h"
+#include "StreamMetadataFilter.h"
 
 namespace alexaClientSDK {
 namespace acsdkAudioPlayer {
@@ -103,11 +104,8 @@ struct AudioItem {
     /// The caption content that goes with the audio.
     captions::CaptionData captionData;
 
-    /// Metadata cache for duplicate removal.
-    alexaClientSDK::avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface::VectorOfTags cachedMetadata;
-
-    /// Time of last Metadata event (used to rate limit metadata events).
-    std::chrono::time_point<std::chrono::steady_clock> lastMetadataEvent;
+    /// Filter removing duplicate metadata and rate limiting metadata events.
+    StreamMetadataFilter metadataFilter;
 
     /// Playback Context
     alexaClientSDK::avsCommon::utils::mediaPlayer::PlaybackContext playbackContext;
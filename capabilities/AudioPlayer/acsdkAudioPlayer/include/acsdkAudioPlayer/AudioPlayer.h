@@ -633,6 +633,13 @@ private:
         std::shared_ptr<const VectorOfTags> vectorOfTags,
         const avsCommon::utils::mediaPlayer::MediaPlayerState& state);
 
+    /**
+     * Report stream metadata changes that were held back by the event rate limit, if the source is still playing.
+     *
+     * @param id The id of the source whose metadata was held back.
+     */
+    void executeFlushStreamMetadata(SourceId id);
+
     /**
      * Executes onReadyToProvideNextPlayer callback function
      */
@@ -1092,6 +1099,9 @@ private:
     /// Drives periodically reporting playback progress.
     ProgressTimer m_progressTimer;
 
+    /// Reports rate limited stream metadata once @c StreamMetadataExtracted events are allowed again.
+    avsCommon::utils::timing::Timer m_metadataFlushTimer;
+
     /**
      * This keeps track of the current offset in the audio stream.  Reading the offset from @c MediaPlayer is
      * insufficient because @c MediaPlayer only returns a valid offset when it is actively playing, but @c AudioPlayer
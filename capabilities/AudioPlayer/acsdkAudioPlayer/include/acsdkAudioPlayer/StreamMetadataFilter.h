@@ -0,0 +1,152 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKAUDIOPLAYER_STREAMMETADATAFILTER_H_
+#define ACSDKAUDIOPLAYER_STREAMMETADATAFILTER_H_
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
+
+namespace alexaClientSDK {
+namespace acsdkAudioPlayer {
+
+/**
+ * Decides which stream tags of an audio item are reported in @c StreamMetadataExtracted events.
+ *
+ * Streams such as internet radio repeat their in-band metadata for every track, often several times.  Each update is
+ * reduced to the allowlisted fields whose value differs from the one last reported, and events are limited to one per
+ * @c minEventInterval.  Changes that arrive while events are limited are held back and reported with the next event,
+ * unless a later update restores the reported value.
+ *
+ * Tags are not copied: the filter keeps references into the @c VectorOfTags blocks it is given, which are immutable and
+ * shared with the media player that produced them.
+ *
+ * This class is not thread safe.
+ */
+class StreamMetadataFilter {
+public:
+    /// @name Aliases to improve readability.
+    /// @{
+    using TagKeyValueType = avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface::TagKeyValueType;
+    using VectorOfTags = avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface::VectorOfTags;
+    /// @}
+
+    /// The outcome of filtering an update.
+    enum class Result {
+        /// No allowlisted field differs from the reported values.
+        NO_CHANGES,
+        /// Some fields changed, but an event was reported too recently.  The changes are held back.
+        RATE_LIMITED,
+        /// The changed fields should be reported now.
+        SEND
+    };
+
+    /**
+     * Constructor using the allowlist and event rate of the @c StreamMetadataExtracted event.
+     */
+    StreamMetadataFilter();
+
+    /**
+     * Constructor.
+     *
+     * @param allowlist Lower case keys of the tags that may be reported.  Keys of incoming tags are compared
+     * case-insensitively.
+     * @param minEventInterval The minimum time between two reports.
+     */
+    StreamMetadataFilter(std::unordered_set<std::string> allowlist, std::chrono::milliseconds minEventInterval);
+
+    /**
+     * Filter an update.
+     *
+     * @param tags The tags of the update.
+     * @param now The current time.
+     * @param[out] tagsToSend Set to the tags to report if @c Result::SEND is returned, in the order they first changed.
+     * @return The outcome.
+     */
+    Result filter(
+        const std::shared_ptr<const VectorOfTags>& tags,
+        std::chrono::steady_clock::time_point now,
+        std::vector<std::shared_ptr<const TagKeyValueType>>* tagsToSend);
+
+    /**
+     * Get how long held back changes must wait before they may be reported.  Calling @c filter with no tags after this
+     * time reports them.
+     *
+     * @param now The current time.
+     * @return The time until the next report is allowed, or zero if it is allowed now.
+     */
+    std::chrono::steady_clock::duration getTimeUntilNextReport(std::chrono::steady_clock::time_point now) const;
+
+private:
+    /**
+     * Check whether a tag may be reported.
+     *
+     * @param tag The tag.
+     * @return Whether its key is allowlisted and its value is not empty.  On return @c m_lowerCaseKey holds the lower
+     * case key of a tag with a value.
+     */
+    bool isAllowlisted(const TagKeyValueType& tag);
+
+    /// Lower case keys of the tags that may be reported.
+    std::unordered_set<std::string> m_allowlist;
+
+    /// The minimum time between two reports.
+    std::chrono::milliseconds m_minEventInterval;
+
+    /// The last reported tag of each lower case key.
+    std::unordered_map<std::string, std::shared_ptr<const TagKeyValueType>> m_reported;
+
+    /// Changed tags that have not been reported yet with their lower case key, in the order they first changed.  At
+    /// most one per key.
+    std::vector<std::pair<std::string, std::shared_ptr<const TagKeyValueType>>> m_pending;
+
+    /// The time of the last report, or the epoch if none was made.
+    std::chrono::steady_clock::time_point m_lastEventTime;
+
+    /// Buffer reused to lower case tag keys.
+    std::string m_lowerCaseKey;
+};
+
+/**
+ * Write a @c StreamMetadataFilter::Result value to an @c ostream as a string.
+ *
+ * @param stream The stream to write the value to.
+ * @param result The value to write to the @c ostream as a string.
+ * @return The @c ostream that was passed in and written to.
+ */
+inline std::ostream& operator<<(std::ostream& stream, StreamMetadataFilter::Result result) {
+    switch (result) {
+        case StreamMetadataFilter::Result::NO_CHANGES:
+            return stream << "NO_CHANGES";
+        case StreamMetadataFilter::Result::RATE_LIMITED:
+            return stream << "RATE_LIMITED";
+        case StreamMetadataFilter::Result::SEND:
+            return stream << "SEND";
+    }
+    return stream << "UNKNOWN";
+}
+
+}  // namespace acsdkAudioPlayer
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKAUDIOPLAYER_STREAMMETADATAFILTER_H_
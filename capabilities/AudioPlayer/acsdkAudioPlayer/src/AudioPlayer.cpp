@@ -99,6 +99,9 @@ static const NamespaceAndName STOP{NAMESPACE, "Stop"};
 /// The @c ClearQueue directive signature.
 static const NamespaceAndName CLEAR_QUEUE{NAMESPACE, "ClearQueue"};
 
+/// The common prefix of the names of the progress report events.
+static const std::string PROGRESS_REPORT_EVENT_PREFIX = "ProgressReport";
+
 /// The @c UpdateProgressReportInterval directive signature.
 static const NamespaceAndName UPDATE_PROGRESS_REPORT_INTERVAL{NAMESPACE, "UpdateProgressReportInterval"};
 
@@ -235,13 +238,6 @@ static const std::string MALICIOUS_HEADER_RECEIVED = "MaliciousHeaderReceived";
 /// Message sent failed metric
 static const std::string MESSAGE_SENT_FAILED = "MessageSentFailed";
 
-/// allowlisted metadata to send to server.  This is done to avoid excessive traffic
-/// must be all lower-case
-static const std::vector<std::string> METADATA_ALLOWLIST = {"title"};
-
-/// Min time between metadata events
-static const std::chrono::seconds METADATA_EVENT_RATE{1};
-
 /// Time to keep the pipeline open after a local pause.
 static const std::chrono::seconds LOCAL_STOP_DEFAULT_PIPELINE_OPEN_TIME(900);  // 15min
 
@@ -1055,6 +1051,7 @@ std::shared_ptr<CapabilityConfiguration> getAudioPlayerCapabilityConfiguration(F
 
 void AudioPlayer::doShutdown() {
     m_progressTimer.stop();
+    m_metadataFlushTimer.stop();
     m_executor.shutdown();
     executeStop();
     releaseMediaPlayer(m_currentlyPlaying);
@@ -2351,6 +2348,17 @@ void AudioPlayer::executeOnTags(
     sendStreamMetadataExtractedEvent(m_currentlyPlaying->audioItem, vectorOfTags, state);
 }
 
+void AudioPlayer::executeFlushStreamMetadata(SourceId id) {
+    ACSDK_DEBUG1(LX("executeFlushStreamMetadata").d("id", id));
+
+    if (id != m_currentlyPlaying->sourceId) {
+        ACSDK_DEBUG1(LX("executeFlushStreamMetadata").d("reason", "sourceNoLongerPlaying"));
+        return;
+    }
+
+    sendStreamMetadataExtractedEvent(m_currentlyPlaying->audioItem, nullptr, getMediaPlayerState());
+}
+
 void AudioPlayer::clearPlayQueue(const bool stopCurrentPlayer) {
     // release all MediaPlayers on the play queue
     for (auto& it : m_audioPlayQueue) {
@@ -3248,52 +3256,9 @@ void AudioPlayer::sendStreamMetadataExtractedEvent(
     rapidjson::Document payload(rapidjson::kObjectType);
     payload.AddMember(TOKEN_KEY, token, payload.GetAllocator());
 
-    rapidjson::Value metadata(rapidjson::kObjectType);
-    bool passFilter = false;
-    // Make a copy of the duplicate cache
-    VectorOfTags newCache(audioItem.cachedMetadata.begin(), audioItem.cachedMetadata.end());
-    for (auto& tag : *vectorOfTags) {
-        // Filter metadata against allowlist
-        std::string lowerTag = tag.key;
-        std::transform(lowerTag.begin(), lowerTag.end(), lowerTag.begin(), ::tolower);
-        if (std::find(std::begin(METADATA_ALLOWLIST), std::end(METADATA_ALLOWLIST), lowerTag) !=
-                std::end(METADATA_ALLOWLIST) &&
-            !tag.value.empty()) {
-            // Check for duplicates
-            bool dupFound = false;
-            for (auto iter = newCache.begin(); iter != newCache.end(); ++iter) {
-                if (iter->key == tag.key) {
-                    if (iter->value == tag.value && iter->type == tag.type) {
-                        // duplicate, don't send
-                        dupFound = true;
-                    } else {
-                        newCache.erase(iter);
-                    }
-                    break;
-                }
-            }
-            if (dupFound) {
-                continue;
-            }
-            passFilter = true;
-            newCache.push_back(tag);
-            rapidjson::Value tagKey(tag.key.c_str(), payload.GetAllocator());
-            if (TagType::BOOLEAN == tag.type) {
-                std::string value = tag.value;
-                std::transform(value.begin(), value.end(), value.begin(), ::tolower);
-                if (value == "true") {
-                    metadata.AddMember(tagKey, true, payload.GetAllocator());
-                } else {
-                    metadata.AddMember(tagKey, false, payload.GetAllocator());
-                }
-            } else {
-                rapidjson::Value tagValue(tag.value.c_str(), payload.GetAllocator());
-                metadata.AddMember(tagKey, tagValue, payload.GetAllocator());
-            }
-        }
-    }
-
-    if (!passFilter) {
+    std::vector<std::shared_ptr<const TagKeyValueType>> tagsToSend;
+    auto result = audioItem.metadataFilter.filter(vectorOfTags, std::chrono::steady_clock::now(), &tagsToSend);
+    if (StreamMetadataFilter::Result::NO_CHANGES == result) {
         submitMetric(
             m_metricRecorder,
             AUDIO_PLAYER_METRIC_PREFIX + METADATA_UNFILTERED_ENCOUNTERED,
@@ -3302,26 +3267,43 @@ void AudioPlayer::sendStreamMetadataExtractedEvent(
             token);
         ACSDK_DEBUG(LX("sendStreamMetadataExtractedEvent").d("eventNotSent", "noAllowlistedData"));
         return;
-    } else {
-        submitMetric(
-            m_metricRecorder,
-            AUDIO_PLAYER_METRIC_PREFIX + METADATA_FILTERED_ENCOUNTERED,
-            DataPointCounterBuilder{}.setName(METADATA_FILTERED_ENCOUNTERED).increment(1).build(),
-            "",
-            token);
     }
 
-    std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now();
-    if (audioItem.lastMetadataEvent.time_since_epoch().count() == 0 ||
-        now - audioItem.lastMetadataEvent > METADATA_EVENT_RATE) {
-        audioItem.lastMetadataEvent = now;
-        // Only keep the updated cache if we actually send the event.
-        audioItem.cachedMetadata = newCache;
-    } else {
+    submitMetric(
+        m_metricRecorder,
+        AUDIO_PLAYER_METRIC_PREFIX + METADATA_FILTERED_ENCOUNTERED,
+        DataPointCounterBuilder{}.setName(METADATA_FILTERED_ENCOUNTERED).increment(1).build(),
+        "",
+        token);
+    if (StreamMetadataFilter::Result::RATE_LIMITED == result) {
         ACSDK_DEBUG(LX("sendStreamMetadataExtractedEvent").d("eventNotSent", "tooFrequent"));
+        // Report the held back changes once allowed, even if the stream sends no further metadata.
+        auto id = m_currentlyPlaying->sourceId;
+        m_metadataFlushTimer.stop();
+        m_metadataFlushTimer.start(
+            audioItem.metadataFilter.getTimeUntilNextReport(std::chrono::steady_clock::now()), [this, id] {
+                m_executor.submit([this, id] { executeFlushStreamMetadata(id); });
+            });
         return;
     }
 
+    rapidjson::Value metadata(rapidjson::kObjectType);
+    for (const auto& tag : tagsToSend) {
+        rapidjson::Value tagKey(tag->key.c_str(), payload.GetAllocator());
+        if (TagType::BOOLEAN == tag->type) {
+            std::string value = tag->value;
+            std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+            if (value == "true") {
+                metadata.AddMember(tagKey, true, payload.GetAllocator());
+            } else {
+                metadata.AddMember(tagKey, false, payload.GetAllocator());
+            }
+        } else {
+            rapidjson::Value tagValue(tag->value.c_str(), payload.GetAllocator());
+            metadata.AddMember(tagKey, tagValue, payload.GetAllocator());
+        }
+    }
+
     payload.AddMember("metadata", metadata, payload.GetAllocator());
 
     rapidjson::StringBuffer buffer;
@@ -3416,6 +3398,10 @@ void AudioPlayer::sendEvent(
     jsonGenerator.finishObject();
 
     auto request = std::make_shared<MessageRequestObserver>(m_metricRecorder, jsonGenerator.toString(), "");
+    // Periodic progress reports may be delayed behind any other traffic.
+    if (0 == eventName.compare(0, PROGRESS_REPORT_EVENT_PREFIX.size(), PROGRESS_REPORT_EVENT_PREFIX)) {
+        request->setPriority(MessageRequest::Priority::BACKGROUND);
+    }
     m_messageSender->sendMessage(request);
 }
 
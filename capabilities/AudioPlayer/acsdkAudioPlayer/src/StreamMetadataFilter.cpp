@@ -0,0 +1,124 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cctype>
+
+#include "acsdkAudioPlayer/StreamMetadataFilter.h"
+
+namespace alexaClientSDK {
+namespace acsdkAudioPlayer {
+
+/// allowlisted metadata to send to server.  This is done to avoid excessive traffic
+/// must be all lower-case
+static const std::unordered_set<std::string> METADATA_ALLOWLIST = {"title"};
+
+/// Min time between metadata events
+static const std::chrono::seconds METADATA_EVENT_RATE{1};
+
+StreamMetadataFilter::StreamMetadataFilter() : StreamMetadataFilter(METADATA_ALLOWLIST, METADATA_EVENT_RATE) {
+}
+
+StreamMetadataFilter::StreamMetadataFilter(
+    std::unordered_set<std::string> allowlist,
+    std::chrono::milliseconds minEventInterval) :
+        m_allowlist{std::move(allowlist)},
+        m_minEventInterval{minEventInterval} {
+}
+
+StreamMetadataFilter::Result StreamMetadataFilter::filter(
+    const std::shared_ptr<const VectorOfTags>& tags,
+    std::chrono::steady_clock::time_point now,
+    std::vector<std::shared_ptr<const TagKeyValueType>>* tagsToSend) {
+    if (tags) {
+        for (const auto& tag : *tags) {
+            if (!isAllowlisted(tag)) {
+                continue;
+            }
+
+            // Keys are matched by their lower case form, so a stream that changes the case of a key neither repeats
+            // nor loses a report.
+            auto pending = std::find_if(
+                m_pending.begin(),
+                m_pending.end(),
+                [this](const std::pair<std::string, std::shared_ptr<const TagKeyValueType>>& pendingTag) {
+                    return pendingTag.first == m_lowerCaseKey;
+                });
+            auto reported = m_reported.find(m_lowerCaseKey);
+            if (m_reported.end() != reported && reported->second->value == tag.value &&
+                reported->second->type == tag.type) {
+                // The field is back to its reported value, so a held back change no longer needs reporting.
+                if (m_pending.end() != pending) {
+                    m_pending.erase(pending);
+                }
+                continue;
+            }
+
+            // Share the caller's block rather than copying the tag.
+            std::shared_ptr<const TagKeyValueType> changed(tags, &tag);
+            if (m_pending.end() != pending) {
+                pending->second = std::move(changed);
+            } else {
+                m_pending.emplace_back(m_lowerCaseKey, std::move(changed));
+            }
+        }
+    }
+
+    if (m_pending.empty()) {
+        return Result::NO_CHANGES;
+    }
+
+    if (getTimeUntilNextReport(now) != std::chrono::steady_clock::duration::zero()) {
+        return Result::RATE_LIMITED;
+    }
+
+    m_lastEventTime = now;
+    if (tagsToSend) {
+        tagsToSend->clear();
+    }
+    for (auto& tag : m_pending) {
+        if (tagsToSend) {
+            tagsToSend->push_back(tag.second);
+        }
+        m_reported[tag.first] = std::move(tag.second);
+    }
+    m_pending.clear();
+    return Result::SEND;
+}
+
+std::chrono::steady_clock::duration StreamMetadataFilter::getTimeUntilNextReport(
+    std::chrono::steady_clock::time_point now) const {
+    if (m_lastEventTime.time_since_epoch().count() == 0) {
+        return std::chrono::steady_clock::duration::zero();
+    }
+    auto elapsed = now - m_lastEventTime;
+    if (elapsed > m_minEventInterval) {
+        return std::chrono::steady_clock::duration::zero();
+    }
+    // Reports are allowed once strictly more than the interval has elapsed.
+    return m_minEventInterval - elapsed + std::chrono::steady_clock::duration(1);
+}
+
+bool StreamMetadataFilter::isAllowlisted(const TagKeyValueType& tag) {
+    if (tag.value.empty()) {
+        return false;
+    }
+    m_lowerCaseKey.assign(tag.key);
+    std::transform(m_lowerCaseKey.begin(), m_lowerCaseKey.end(), m_lowerCaseKey.begin(), ::tolower);
+    return m_allowlist.count(m_lowerCaseKey) != 0;
+}
+
+}  // namespace acsdkAudioPlayer
+}  // namespace alexaClientSDK
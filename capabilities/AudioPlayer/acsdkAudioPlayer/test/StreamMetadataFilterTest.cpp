@@ -0,0 +1,186 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "acsdkAudioPlayer/StreamMetadataFilter.h"
+
+namespace alexaClientSDK {
+namespace acsdkAudioPlayer {
+namespace test {
+
+using namespace testing;
+using TagType = avsCommon::utils::mediaPlayer::MediaPlayerObserverInterface::TagType;
+using Result = StreamMetadataFilter::Result;
+using TagList = std::vector<std::shared_ptr<const StreamMetadataFilter::TagKeyValueType>>;
+
+/// The minimum time between two reports used by the tests.
+static const std::chrono::milliseconds EVENT_INTERVAL{1000};
+
+/// A time shorter than @c EVENT_INTERVAL.
+static const std::chrono::milliseconds SHORT_DELAY{100};
+
+/// A time longer than @c EVENT_INTERVAL.
+static const std::chrono::milliseconds LONG_DELAY{1100};
+
+/**
+ * Build an update from key and value pairs of string tags.
+ *
+ * @param tags The key and value of each tag.
+ * @return The update.
+ */
+static std::shared_ptr<const StreamMetadataFilter::VectorOfTags> makeTags(
+    const std::vector<std::pair<std::string, std::string>>& tags) {
+    auto vectorOfTags = std::make_shared<StreamMetadataFilter::VectorOfTags>();
+    for (const auto& tag : tags) {
+        vectorOfTags->push_back({tag.first, tag.second, TagType::STRING});
+    }
+    return vectorOfTags;
+}
+
+/// Test harness for @c StreamMetadataFilter.
+class StreamMetadataFilterTest : public Test {
+protected:
+    /// Constructor.
+    StreamMetadataFilterTest() : m_filter{{"title", "artist"}, EVENT_INTERVAL}, m_now{std::chrono::seconds(1)} {
+    }
+
+    /// The filter under test.
+    StreamMetadataFilter m_filter;
+
+    /// The time passed to the filter.
+    std::chrono::steady_clock::time_point m_now;
+};
+
+/**
+ * Verify that only allowlisted, non empty tags are reported, regardless of the case of their keys.
+ */
+TEST_F(StreamMetadataFilterTest, test_reportsOnlyAllowlistedTags) {
+    TagList tagsToSend;
+    auto tags = makeTags({{"Title", "Song"}, {"genre", "Pop"}, {"artist", ""}});
+    ASSERT_EQ(m_filter.filter(tags, m_now, &tagsToSend), Result::SEND);
+    ASSERT_EQ(tagsToSend.size(), 1u);
+    EXPECT_EQ(tagsToSend[0]->key, "Title");
+    EXPECT_EQ(tagsToSend[0]->value, "Song");
+
+    // The reported tag is shared with the update rather than copied.
+    EXPECT_EQ(tagsToSend[0].get(), &(*tags)[0]);
+
+    EXPECT_EQ(m_filter.filter(makeTags({{"genre", "Rock"}}), m_now + LONG_DELAY, &tagsToSend), Result::NO_CHANGES);
+}
+
+/**
+ * Verify that repeated updates only report the fields that changed.
+ */
+TEST_F(StreamMetadataFilterTest, test_reportsOnlyChangedFields) {
+    TagList tagsToSend;
+    ASSERT_EQ(m_filter.filter(makeTags({{"title", "Song"}, {"artist", "Band"}}), m_now, &tagsToSend), Result::SEND);
+    EXPECT_EQ(tagsToSend.size(), 2u);
+
+    m_now += LONG_DELAY;
+    EXPECT_EQ(
+        m_filter.filter(makeTags({{"title", "Song"}, {"artist", "Band"}}), m_now, &tagsToSend), Result::NO_CHANGES);
+
+    ASSERT_EQ(
+        m_filter.filter(makeTags({{"title", "Other Song"}, {"artist", "Band"}}), m_now, &tagsToSend), Result::SEND);
+    ASSERT_EQ(tagsToSend.size(), 1u);
+    EXPECT_EQ(tagsToSend[0]->value, "Other Song");
+}
+
+/**
+ * Verify that changes arriving too soon after a report are held back and reported with the next report.
+ */
+TEST_F(StreamMetadataFilterTest, test_rateLimitedChangesAreHeldBack) {
+    TagList tagsToSend;
+    ASSERT_EQ(m_filter.filter(makeTags({{"title", "Song"}, {"artist", "Band"}}), m_now, &tagsToSend), Result::SEND);
+
+    m_now += SHORT_DELAY;
+    EXPECT_EQ(m_filter.filter(makeTags({{"artist", "Other Band"}}), m_now, &tagsToSend), Result::RATE_LIMITED);
+
+    m_now += LONG_DELAY;
+    ASSERT_EQ(m_filter.filter(makeTags({{"title", "Other Song"}}), m_now, &tagsToSend), Result::SEND);
+    ASSERT_EQ(tagsToSend.size(), 2u);
+    EXPECT_EQ(tagsToSend[0]->value, "Other Band");
+    EXPECT_EQ(tagsToSend[1]->value, "Other Song");
+}
+
+/**
+ * Verify that a held back change is dropped if a later update restores the reported value.
+ */
+TEST_F(StreamMetadataFilterTest, test_revertedChangeIsNotReported) {
+    TagList tagsToSend;
+    ASSERT_EQ(m_filter.filter(makeTags({{"title", "Song"}}), m_now, &tagsToSend), Result::SEND);
+
+    m_now += SHORT_DELAY;
+    EXPECT_EQ(m_filter.filter(makeTags({{"title", "Other Song"}}), m_now, &tagsToSend), Result::RATE_LIMITED);
+
+    m_now += LONG_DELAY;
+    EXPECT_EQ(m_filter.filter(makeTags({{"title", "Song"}}), m_now, &tagsToSend), Result::NO_CHANGES);
+}
+
+/**
+ * Verify that keys differing only in case are treated as the same field.
+ */
+TEST_F(StreamMetadataFilterTest, test_keysAreMatchedCaseInsensitively) {
+    TagList tagsToSend;
+    ASSERT_EQ(m_filter.filter(makeTags({{"Title", "Song"}}), m_now, &tagsToSend), Result::SEND);
+
+    m_now += LONG_DELAY;
+    EXPECT_EQ(m_filter.filter(makeTags({{"TITLE", "Song"}}), m_now, &tagsToSend), Result::NO_CHANGES);
+
+    m_now += LONG_DELAY;
+    ASSERT_EQ(m_filter.filter(makeTags({{"title", "Other Song"}}), m_now, &tagsToSend), Result::SEND);
+
+    m_now += SHORT_DELAY;
+    EXPECT_EQ(m_filter.filter(makeTags({{"Title", "Song"}}), m_now, &tagsToSend), Result::RATE_LIMITED);
+    EXPECT_EQ(m_filter.filter(makeTags({{"TITLE", "Next Song"}}), m_now, &tagsToSend), Result::RATE_LIMITED);
+
+    // Only the latest value of the field is reported.
+    m_now += LONG_DELAY;
+    ASSERT_EQ(m_filter.filter(nullptr, m_now, &tagsToSend), Result::SEND);
+    ASSERT_EQ(tagsToSend.size(), 1u);
+    EXPECT_EQ(tagsToSend[0]->value, "Next Song");
+}
+
+/**
+ * Verify that held back changes are reported by an update without tags once the interval has elapsed.
+ */
+TEST_F(StreamMetadataFilterTest, test_heldBackChangesAreFlushedAfterInterval) {
+    TagList tagsToSend;
+    EXPECT_EQ(m_filter.getTimeUntilNextReport(m_now), std::chrono::steady_clock::duration::zero());
+    ASSERT_EQ(m_filter.filter(makeTags({{"title", "Song"}}), m_now, &tagsToSend), Result::SEND);
+
+    m_now += SHORT_DELAY;
+    EXPECT_EQ(m_filter.filter(makeTags({{"title", "Other Song"}}), m_now, &tagsToSend), Result::RATE_LIMITED);
+
+    auto wait = m_filter.getTimeUntilNextReport(m_now);
+    EXPECT_GT(wait, EVENT_INTERVAL - SHORT_DELAY);
+    EXPECT_LT(wait, EVENT_INTERVAL);
+    EXPECT_EQ(
+        m_filter.filter(nullptr, m_now + wait - std::chrono::steady_clock::duration(1), &tagsToSend),
+        Result::RATE_LIMITED);
+
+    m_now += wait;
+    EXPECT_EQ(m_filter.getTimeUntilNextReport(m_now), std::chrono::steady_clock::duration::zero());
+    ASSERT_EQ(m_filter.filter(nullptr, m_now, &tagsToSend), Result::SEND);
+    ASSERT_EQ(tagsToSend.size(), 1u);
+    EXPECT_EQ(tagsToSend[0]->value, "Other Song");
+
+    EXPECT_EQ(m_filter.filter(nullptr, m_now + LONG_DELAY, &tagsToSend), Result::NO_CHANGES);
+}
+
+}  // namespace test
+}  // namespace acsdkAudioPlayer
+}  // namespace alexaClientSDK
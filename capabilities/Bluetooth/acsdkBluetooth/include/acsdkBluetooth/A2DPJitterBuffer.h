@@ -0,0 +1,314 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKBLUETOOTH_A2DPJITTERBUFFER_H_
+#define ACSDKBLUETOOTH_A2DPJITTERBUFFER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <AVSCommon/AVS/Attachment/AttachmentReader.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/Utils/Bluetooth/FormattedAudioStreamAdapterListener.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
+
+namespace alexaClientSDK {
+namespace acsdkBluetooth {
+
+/**
+ * A bounded jitter buffer sitting between an A2DP @c FormattedAudioStreamAdapter and the Bluetooth @c MediaPlayer.
+ *
+ * PCM received from the A2DP stream is queued in a fixed-size ring buffer. The @c MediaPlayer consumes it through
+ * the @c AttachmentReader interface implemented by this class. The buffer:
+ *
+ * @li Adapts its target depth to the observed inter-arrival jitter of the incoming packets, within configured bounds.
+ * @li Holds back playback (priming) until the target depth is reached, both at start and after an underrun.
+ * @li Compensates clock drift between the source and the sink by dropping or repeating single frames whenever the
+ * buffered depth drifts outside of a tolerance window around the target.
+ * @li Drops the oldest audio rather than the newest on overrun, so the end-to-end latency stays bounded.
+ * @li Counts underruns, overruns, and inserted/dropped frames, and reports them with the current latency through the
+ * @c MetricRecorderInterface.
+ *
+ * Only interleaved LPCM with 8, 16, 24 or 32 bit samples is supported.
+ *
+ * This class is thread safe.
+ */
+class A2DPJitterBuffer
+        : public avsCommon::avs::attachment::AttachmentReader
+        , public avsCommon::utils::bluetooth::FormattedAudioStreamAdapterListener {
+public:
+    /**
+     * Tuning parameters of the @c A2DPJitterBuffer.
+     */
+    struct Config {
+        /**
+         * Constructor. Initializes every parameter to its default value.
+         */
+        Config();
+
+        /// Lower bound of the adaptive target depth.
+        std::chrono::milliseconds minTargetLatency{40};
+
+        /// Upper bound of the adaptive target depth.
+        std::chrono::milliseconds maxTargetLatency{200};
+
+        /// Total capacity of the buffer. Audio beyond this is dropped as an overrun.
+        std::chrono::milliseconds capacity{500};
+
+        /// Maximum distance between the buffered depth and the target before drift compensation kicks in.
+        std::chrono::milliseconds driftTolerance{20};
+
+        /// Interval between two metric reports while audio is flowing.
+        std::chrono::milliseconds metricReportInterval{10000};
+    };
+
+    /**
+     * Snapshot of the counters kept by the @c A2DPJitterBuffer.
+     */
+    struct Statistics {
+        /// Number of times the buffer ran empty while playing.
+        uint64_t underruns;
+
+        /// Number of times incoming audio did not fit and old audio was discarded.
+        uint64_t overruns;
+
+        /// Number of frames repeated to compensate for a source slower than the sink.
+        uint64_t framesInserted;
+
+        /// Number of frames skipped to compensate for a source faster than the sink.
+        uint64_t framesDropped;
+
+        /// Duration of the audio currently buffered.
+        std::chrono::milliseconds currentLatency;
+
+        /// Current adaptive target depth.
+        std::chrono::milliseconds targetLatency;
+
+        /// Current smoothed inter-arrival jitter estimate.
+        std::chrono::microseconds jitter;
+    };
+
+    /**
+     * Creates an instance of the @c A2DPJitterBuffer.
+     *
+     * @param audioFormat The format of the audio which will be written into the buffer.
+     * @param metricRecorder The metric recorder used to report buffer health. May be @c nullptr.
+     * @param config The tuning parameters of the buffer.
+     * @return An instance if successful else a nullptr.
+     */
+    static std::shared_ptr<A2DPJitterBuffer> create(
+        const avsCommon::utils::AudioFormat& audioFormat,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr,
+        const Config& config = Config());
+
+    /**
+     * Queue audio into the buffer.
+     *
+     * @param buffer The audio to queue.
+     * @param size The size of @c buffer in bytes.
+     * @param arrivalTime The time at which the audio was received. Used for the jitter estimation.
+     */
+    void write(
+        const unsigned char* buffer,
+        size_t size,
+        std::chrono::steady_clock::time_point arrivalTime = std::chrono::steady_clock::now());
+
+    /**
+     * Get a snapshot of the buffer's counters.
+     *
+     * @return The current @c Statistics.
+     */
+    Statistics getStatistics();
+
+    /// @name AttachmentReader Functions
+    /// @{
+    std::size_t read(
+        void* buf,
+        std::size_t numBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0)) override;
+    bool seek(uint64_t offset) override;
+    uint64_t getNumUnreadBytes() override;
+    void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) override;
+    /// @}
+
+    /// @name FormattedAudioStreamAdapterListener Functions
+    /// @{
+    void onFormattedAudioStreamAdapterData(
+        avsCommon::utils::AudioFormat audioFormat,
+        const unsigned char* buffer,
+        size_t size) override;
+    /// @}
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param frameSize The size in bytes of one frame (one sample for every channel).
+     * @param bytesPerSecond The byte rate of the audio stream.
+     * @param metricRecorder The metric recorder used to report buffer health.
+     * @param config The tuning parameters of the buffer.
+     */
+    A2DPJitterBuffer(
+        size_t frameSize,
+        size_t bytesPerSecond,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+        const Config& config);
+
+    /**
+     * Convert a duration into a frame aligned number of bytes.
+     *
+     * @param duration The duration to convert.
+     * @return The number of bytes holding @c duration of audio.
+     */
+    size_t durationToBytes(std::chrono::microseconds duration) const;
+
+    /**
+     * Convert a number of bytes into the duration of audio they hold.
+     *
+     * @param bytes The number of bytes to convert.
+     * @return The duration of audio held in @c bytes.
+     */
+    std::chrono::microseconds bytesToDuration(size_t bytes) const;
+
+    /**
+     * Update the jitter estimate and the adaptive target depth for a packet that just arrived.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param size The size in bytes of the packet.
+     * @param arrivalTime The time at which the packet arrived.
+     */
+    void updateTargetLocked(size_t size, std::chrono::steady_clock::time_point arrivalTime);
+
+    /**
+     * Copy bytes out of the ring buffer and advance the read position.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param out The destination of the copy.
+     * @param size The number of bytes to copy. Must not exceed @c m_size.
+     */
+    void popLocked(unsigned char* out, size_t size);
+
+    /**
+     * Discard bytes from the head of the ring buffer.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param size The number of bytes to discard. Must not exceed @c m_size.
+     */
+    void discardLocked(size_t size);
+
+    /**
+     * Build a metric event out of the counters accumulated since the last report, if a report is due.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param force Whether to build the event even if the report interval did not elapse.
+     * @return The metric event to submit once the lock is released, or @c nullptr.
+     */
+    std::shared_ptr<avsCommon::utils::metrics::MetricEvent> buildMetricLocked(bool force);
+
+    /**
+     * Submit a metric event built by @c buildMetricLocked.
+     *
+     * @param metricEvent The event to submit. May be @c nullptr.
+     */
+    void submitMetric(const std::shared_ptr<avsCommon::utils::metrics::MetricEvent>& metricEvent);
+
+    /// The size in bytes of one frame.
+    const size_t m_frameSize;
+
+    /// The byte rate of the audio stream.
+    const size_t m_bytesPerSecond;
+
+    /// The metric recorder used to report buffer health.
+    const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
+
+    /// The tuning parameters of the buffer.
+    const Config m_config;
+
+    /// Lower bound of the target depth in bytes.
+    const size_t m_minTargetBytes;
+
+    /// Upper bound of the target depth in bytes.
+    const size_t m_maxTargetBytes;
+
+    /// Drift tolerance window in bytes.
+    const size_t m_driftToleranceBytes;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// The ring buffer storage. Its size is the capacity of the buffer.
+    std::vector<unsigned char> m_ring;
+
+    /// The offset of the oldest unread byte within @c m_ring.
+    size_t m_head;
+
+    /// The number of unread bytes in @c m_ring.
+    size_t m_size;
+
+    /// The current adaptive target depth in bytes.
+    size_t m_targetBytes;
+
+    /// Whether playback is held back until the target depth is reached.
+    bool m_priming;
+
+    /// Whether @c close() has been called.
+    bool m_closed;
+
+    /// Whether the arrival time of the previous packet is known.
+    bool m_hasPreviousArrival;
+
+    /// Arrival time of the previous packet.
+    std::chrono::steady_clock::time_point m_previousArrival;
+
+    /// Duration of audio carried by the previous packet.
+    std::chrono::microseconds m_previousDuration;
+
+    /// Smoothed inter-arrival jitter in microseconds.
+    double m_jitterUs;
+
+    /// Number of underruns since creation.
+    uint64_t m_underruns;
+
+    /// Number of overruns since creation.
+    uint64_t m_overruns;
+
+    /// Number of frames repeated by drift compensation since creation.
+    uint64_t m_framesInserted;
+
+    /// Number of frames skipped by drift compensation since creation.
+    uint64_t m_framesDropped;
+
+    /// Value of the underrun counter at the time of the last metric report.
+    uint64_t m_reportedUnderruns;
+
+    /// Value of the overrun counter at the time of the last metric report.
+    uint64_t m_reportedOverruns;
+
+    /// Time of the last metric report.
+    std::chrono::steady_clock::time_point m_lastReport;
+};
+
+}  // namespace acsdkBluetooth
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKBLUETOOTH_A2DPJITTERBUFFER_H_
@@ -32,7 +32,6 @@
 #include <acsdkBluetoothInterfaces/BluetoothStorageInterface.h>
 #include <acsdkManufactory/Annotated.h>
 #include <acsdkShutdownManagerInterfaces/ShutdownNotifierInterface.h>
-#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
 #include <AVSCommon/AVS/AVSDirective.h>
 #include <AVSCommon/AVS/CapabilityAgent.h>
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
@@ -57,6 +56,7 @@
 #include <AVSCommon/Utils/Bluetooth/DeviceCategory.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Optional.h>
 #include <AVSCommon/Utils/RequiresShutdown.h>
 #include <AVSCommon/Utils/Bluetooth/FormattedAudioStreamAdapter.h>
@@ -64,6 +64,7 @@
 #include <RegistrationManager/CustomerDataHandler.h>
 #include <RegistrationManager/CustomerDataManagerInterface.h>
 
+#include "acsdkBluetooth/A2DPJitterBuffer.h"
 #include "acsdkBluetooth/BluetoothEventState.h"
 #include "acsdkBluetooth/BluetoothMediaInputTransformer.h"
 #include "acsdkBluetoothInterfaces/BluetoothLocalInterface.h"
@@ -225,6 +226,7 @@ public:
      * @param mediaInputTransformer Transforms incoming Media commands if supported.
      * @param bluetoothNotifier The object with which to notify observers of Bluetooth device connections or
      * disconnects.
+     * @param metricRecorder The metric recorder used to report A2DP streaming health.
      */
     static std::shared_ptr<Bluetooth> createBluetoothCapabilityAgent(
         std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
@@ -246,7 +248,8 @@ public:
         std::shared_ptr<acsdkBluetoothInterfaces::BluetoothDeviceConnectionRulesProviderInterface>
             connectionRulesProvider,
         std::shared_ptr<BluetoothMediaInputTransformer> mediaInputTransformer,
-        std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier);
+        std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
 
     /// @name CapabilityAgent Functions
     /// @{
@@ -335,6 +338,7 @@ private:
      * @param mediaInputTransformer Transforms incoming Media commands.
      * @param bluetoothNotifier The object with which to notify observers of Bluetooth device connections or
      * disconnects.
+     * @param metricRecorder The metric recorder used to report A2DP streaming health.
      */
     Bluetooth(
         std::shared_ptr<avsCommon::sdkInterfaces::ContextManagerInterface> contextManager,
@@ -350,7 +354,8 @@ private:
             enabledConnectionRules,
         std::shared_ptr<avsCommon::sdkInterfaces::ChannelVolumeInterface> bluetoothChannelVolumeInterface,
         std::shared_ptr<BluetoothMediaInputTransformer> mediaInputTransformer,
-        std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier);
+        std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
 
     /**
      * Initializes the agent.
@@ -667,6 +672,19 @@ private:
      */
     bool retrieveUuid(const std::string& mac, std::string* uuid);
 
+    /**
+     * Retrieve the UUIDs of several devices by their MAC addresses. UUIDs which are not found are generated, and
+     * inserted together in a single batch.
+     *
+     * @param devices The devices.
+     * @param[out] macToUuid The UUID of each device, keyed by MAC address.
+     *
+     * @return Whether an UUID is successfully obtained for every device either by retrieval or generation.
+     */
+    bool retrieveUuids(
+        const std::list<std::shared_ptr<avsCommon::sdkInterfaces::bluetooth::BluetoothDeviceInterface>>& devices,
+        std::unordered_map<std::string, std::string>* macToUuid);
+
     /**
      * Retrieve a set of UUIDs from the payload.
      *
@@ -1075,14 +1093,11 @@ private:
     /// The A2DP media stream.
     std::shared_ptr<avsCommon::utils::bluetooth::FormattedAudioStreamAdapter> m_mediaStream;
 
-    /// An InProcessAttachment used to feed A2DP stream data into the MediaPlayer.
-    std::shared_ptr<avsCommon::avs::attachment::InProcessAttachment> m_mediaAttachment;
-
-    /// A writer to write the A2DP stream buffers into the InProcessAttachment.
-    std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> m_mediaAttachmentWriter;
+    /// The jitter buffer feeding A2DP stream data into the MediaPlayer.
+    std::shared_ptr<A2DPJitterBuffer> m_mediaJitterBuffer;
 
-    /// A reader that reads the InProcessAttachment.
-    std::shared_ptr<avsCommon::avs::attachment::AttachmentReader> m_mediaAttachmentReader;
+    /// The metric recorder used to report A2DP streaming health.
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 
     /// Map of <DeviceCategory, BluetoothDeviceConnectionRuleInterface> device connection rules
     std::map<
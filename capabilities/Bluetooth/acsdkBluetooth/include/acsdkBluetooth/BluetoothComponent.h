@@ -36,6 +36,7 @@
 #include <AVSCommon/SDKInterfaces/Bluetooth/BluetoothDeviceManagerInterface.h>
 #include <AVSCommon/SDKInterfaces/Endpoints/DefaultEndpointAnnotation.h>
 #include <AVSCommon/SDKInterfaces/Endpoints/EndpointCapabilitiesRegistrarInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <RegistrationManager/CustomerDataManagerInterface.h>
 
 namespace alexaClientSDK {
@@ -65,6 +66,7 @@ using BluetoothComponent = acsdkManufactory::Component<
         avsCommon::sdkInterfaces::endpoints::DefaultEndpointAnnotation,
         avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface>>,
     acsdkManufactory::Import<std::shared_ptr<avsCommon::utils::bluetooth::BluetoothEventBus>>,
+    acsdkManufactory::Import<std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>>,
     acsdkManufactory::Import<std::shared_ptr<registrationManager::CustomerDataManagerInterface>>>;
 /**
  * Get the @c Manufactory component for creating an instance of @c BluetoothNotifierInterface.
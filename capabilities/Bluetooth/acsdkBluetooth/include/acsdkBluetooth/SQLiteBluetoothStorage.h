@@ -15,6 +15,7 @@
 #ifndef ACSDKBLUETOOTH_SQLITEBLUETOOTHSTORAGE_H_
 #define ACSDKBLUETOOTH_SQLITEBLUETOOTHSTORAGE_H_
 
+#include <list>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
@@ -29,7 +30,13 @@
 namespace alexaClientSDK {
 namespace acsdkBluetooth {
 
-/// A concrete implementation of @c BluetoothStorageInterface using SQLite.
+/**
+ * A concrete implementation of @c BluetoothStorageInterface using SQLite.
+ *
+ * Statements are prepared once and reused for the lifetime of the open database. Unless disabled in the
+ * configuration with "bluetooth" : { "inMemoryIndex" : false }, the content of the table is also mirrored in memory
+ * when the database is opened, so reads do not hit the database.
+ */
 class SQLiteBluetoothStorage : public acsdkBluetoothInterfaces::BluetoothStorageInterface {
 public:
     /**
@@ -37,7 +44,8 @@ public:
      *
      * @param configurationRoot A shared pointer to a ConfigurationNode containing the location of the .db file.
      * Should take the form:
-     * "bluetooth" : { "databaseFilePath" : "<filePath>" }
+     * "bluetooth" : { "databaseFilePath" : "<filePath>", "inMemoryIndex" : <true|false> }
+     * where "inMemoryIndex" is optional and defaults to true.
      */
     static std::shared_ptr<BluetoothStorageInterface> createBluetoothStorageInterface(
         const std::shared_ptr<avsCommon::utils::configuration::ConfigurationNode>& configurationRoot);
@@ -48,7 +56,8 @@ public:
      * @deprecated
      * @param configurationRoot A ConfigurationNode containing the location of the .db file.
      * Should take the form:
-     * "bluetooth" : { "databaseFilePath" : "<filePath>" }
+     * "bluetooth" : { "databaseFilePath" : "<filePath>", "inMemoryIndex" : <true|false> }
+     * where "inMemoryIndex" is optional and defaults to true.
      */
     static std::unique_ptr<SQLiteBluetoothStorage> create(
         const avsCommon::utils::configuration::ConfigurationNode& configurationRoot);
@@ -68,7 +77,9 @@ public:
     bool getUuidToCategory(std::unordered_map<std::string, std::string>* uuidToCategory) override;
     bool getOrderedMac(bool ascending, std::list<std::string>* macs) override;
     bool insertByMac(const std::string& mac, const std::string& uuid, bool overwrite = true) override;
+    bool insertByMacBatch(const std::vector<std::pair<std::string, std::string>>& macToUuid, bool overwrite) override;
     bool updateByCategory(const std::string& uuid, const std::string& category) override;
+    bool updateByCategoryBatch(const std::unordered_map<std::string, std::string>& uuidToCategory) override;
     bool remove(const std::string& mac) override;
     /// @}
 
@@ -77,8 +88,9 @@ private:
      * Constructor.
      *
      * @param filepath The filepath of the sqlite file.
+     * @param useInMemoryIndex Whether to mirror the content of the table in memory.
      */
-    SQLiteBluetoothStorage(const std::string& filepath);
+    SQLiteBluetoothStorage(const std::string& filepath, bool useInMemoryIndex);
 
     /**
      * Closes the SQLiteDatabase instance. This must be called with @c m_mutex obtained.
@@ -95,7 +107,7 @@ private:
      * @return A bool indicating success.
      */
     bool getSingleRowLocked(
-        std::unique_ptr<storage::sqliteStorage::SQLiteStatement>& statement,
+        storage::sqliteStorage::SQLiteStatement* statement,
         std::unordered_map<std::string, std::string>* row);
 
     /**
@@ -161,6 +173,73 @@ private:
         const std::string& mac,
         const std::string& category);
 
+    /**
+     * Utility that inserts a MAC and UUID row, keeping the category already associated with the UUID, and updates
+     * the in-memory index. The lock must be obtained before calling this function.
+     *
+     * @param mac mac of device to add.
+     * @param uuid uuid of device to add.
+     * @param overwrite Whether or not to overwrite an existing entry with the same MAC address.
+     * @return A bool indicating success.
+     */
+    bool insertByMacLocked(const std::string& mac, const std::string& uuid, bool overwrite);
+
+    /**
+     * Utility that updates the category of an existing entry and updates the in-memory index. The lock must be
+     * obtained before calling this function.
+     *
+     * @param uuid The UUID.
+     * @param category The category.
+     * @return A bool indicating success.
+     */
+    bool updateByCategoryLocked(const std::string& uuid, const std::string& category);
+
+    /**
+     * Utility that loads the in-memory index from the database, if the index is in use. The lock must be obtained
+     * before calling this function.
+     *
+     * @return A bool indicating success. If loading fails, reads fall back to the database.
+     */
+    bool loadIndexLocked();
+
+    /**
+     * Utility that clears the in-memory index and marks it as not loaded. The lock must be obtained before calling
+     * this function.
+     */
+    void unloadIndexLocked();
+
+    /**
+     * Utility that adds a row to the in-memory index, replacing any row with the same MAC or UUID as the database
+     * does. The lock must be obtained before calling this function.
+     *
+     * @param uuid uuid of the row.
+     * @param mac mac of the row.
+     * @param category category of the row.
+     */
+    void indexEntryLocked(const std::string& uuid, const std::string& mac, const std::string& category);
+
+    /**
+     * Utility that removes the row with the given MAC from the in-memory index. The lock must be obtained before
+     * calling this function.
+     *
+     * @param mac mac of the row.
+     */
+    void unindexMacLocked(const std::string& mac);
+
+    /**
+     * Utility that gets a row from the in-memory index based on a unique key. The lock must be obtained before
+     * calling this function.
+     *
+     * @param key The key to filter against. Must be @c uuid or @c mac.
+     * @param value The value to filter against.
+     * @param[out] row The row found.
+     * @return Whether the row was found.
+     */
+    bool getIndexedRowLocked(
+        const std::string& key,
+        const std::string& value,
+        std::unordered_map<std::string, std::string>* row);
+
     /**
      * Utility that checks if database has been migrated. The lock must be obtained before calling this function.
      *
@@ -181,6 +260,24 @@ private:
 
     /// The underlying SQLite database.
     alexaClientSDK::storage::sqliteStorage::SQLiteDatabase m_db;
+
+    /// Whether the in-memory index is used.
+    const bool m_useInMemoryIndex;
+
+    /// Whether the in-memory index below mirrors the database.
+    bool m_isIndexLoaded;
+
+    /// MAC to UUID mappings of the in-memory index.
+    std::unordered_map<std::string, std::string> m_macToUuid;
+
+    /// UUID to MAC mappings of the in-memory index.
+    std::unordered_map<std::string, std::string> m_uuidToMac;
+
+    /// UUID to category mappings of the in-memory index.
+    std::unordered_map<std::string, std::string> m_uuidToCategory;
+
+    /// MACs of the in-memory index, in insertion order.
+    std::list<std::string> m_orderedMacs;
 };
 
 }  // namespace acsdkBluetooth
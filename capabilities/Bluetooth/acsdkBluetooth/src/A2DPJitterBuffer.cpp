@@ -0,0 +1,405 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/DataPointDurationBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+
+#include "acsdkBluetooth/A2DPJitterBuffer.h"
+
+namespace alexaClientSDK {
+namespace acsdkBluetooth {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::metrics;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("A2DPJitterBuffer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Metric activity name for the jitter buffer health report.
+static const std::string JITTER_BUFFER_METRIC_ACTIVITY_NAME = "BLUETOOTH-a2dpJitterBuffer";
+
+/// Metric data point counting underruns since the previous report.
+static const std::string UNDERRUN_METRIC = "underrun";
+
+/// Metric data point counting overruns since the previous report.
+static const std::string OVERRUN_METRIC = "overrun";
+
+/// Metric data point holding the buffered audio duration at report time.
+static const std::string CURRENT_LATENCY_METRIC = "currentLatency";
+
+/// Metric data point holding the adaptive target depth at report time.
+static const std::string TARGET_LATENCY_METRIC = "targetLatency";
+
+/// Smoothing factor of the inter-arrival jitter estimate, as used by RFC 3550.
+static constexpr double JITTER_SMOOTHING_FACTOR = 16.0;
+
+/// The target depth aims at this many times the smoothed jitter.
+static constexpr double JITTER_TARGET_MULTIPLIER = 4.0;
+
+/// The target depth shrinks by 1/TARGET_DECAY_FACTOR of the excess per packet when jitter goes down.
+static constexpr size_t TARGET_DECAY_FACTOR = 64;
+
+/// Number of microseconds per second.
+static constexpr uint64_t MICROSECONDS_PER_SECOND = 1000000;
+
+A2DPJitterBuffer::Config::Config() = default;
+
+std::shared_ptr<A2DPJitterBuffer> A2DPJitterBuffer::create(
+    const AudioFormat& audioFormat,
+    std::shared_ptr<MetricRecorderInterface> metricRecorder,
+    const Config& config) {
+    if (AudioFormat::Encoding::LPCM != audioFormat.encoding) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "unsupportedEncoding").d("encoding", audioFormat.encoding));
+        return nullptr;
+    }
+    if (audioFormat.numChannels > 1 && AudioFormat::Layout::INTERLEAVED != audioFormat.layout) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "unsupportedLayout").d("layout", static_cast<int>(audioFormat.layout)));
+        return nullptr;
+    }
+    if (0 == audioFormat.numChannels || 0 == audioFormat.sampleRateHz || 0 != audioFormat.sampleSizeInBits % 8 ||
+        0 == audioFormat.sampleSizeInBits || audioFormat.sampleSizeInBits > 32) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "invalidAudioFormat")
+                        .d("numChannels", audioFormat.numChannels)
+                        .d("sampleRateHz", audioFormat.sampleRateHz)
+                        .d("sampleSizeInBits", audioFormat.sampleSizeInBits));
+        return nullptr;
+    }
+    if (config.minTargetLatency.count() <= 0 || config.minTargetLatency > config.maxTargetLatency ||
+        config.maxTargetLatency + config.driftTolerance >= config.capacity) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "invalidConfig")
+                        .d("minTargetLatencyMs", config.minTargetLatency.count())
+                        .d("maxTargetLatencyMs", config.maxTargetLatency.count())
+                        .d("driftToleranceMs", config.driftTolerance.count())
+                        .d("capacityMs", config.capacity.count()));
+        return nullptr;
+    }
+
+    size_t frameSize = (audioFormat.sampleSizeInBits / 8) * audioFormat.numChannels;
+    size_t bytesPerSecond = frameSize * audioFormat.sampleRateHz;
+
+    return std::shared_ptr<A2DPJitterBuffer>(new A2DPJitterBuffer(frameSize, bytesPerSecond, metricRecorder, config));
+}
+
+A2DPJitterBuffer::A2DPJitterBuffer(
+    size_t frameSize,
+    size_t bytesPerSecond,
+    std::shared_ptr<MetricRecorderInterface> metricRecorder,
+    const Config& config) :
+        m_frameSize{frameSize},
+        m_bytesPerSecond{bytesPerSecond},
+        m_metricRecorder{std::move(metricRecorder)},
+        m_config(config),
+        m_minTargetBytes{durationToBytes(config.minTargetLatency)},
+        m_maxTargetBytes{durationToBytes(config.maxTargetLatency)},
+        m_driftToleranceBytes{durationToBytes(config.driftTolerance)},
+        m_ring(durationToBytes(config.capacity)),
+        m_head{0},
+        m_size{0},
+        m_targetBytes{m_minTargetBytes},
+        m_priming{true},
+        m_closed{false},
+        m_hasPreviousArrival{false},
+        m_previousDuration{0},
+        m_jitterUs{0},
+        m_underruns{0},
+        m_overruns{0},
+        m_framesInserted{0},
+        m_framesDropped{0},
+        m_reportedUnderruns{0},
+        m_reportedOverruns{0},
+        m_lastReport{std::chrono::steady_clock::now()} {
+}
+
+size_t A2DPJitterBuffer::durationToBytes(std::chrono::microseconds duration) const {
+    auto bytes = static_cast<uint64_t>(duration.count()) * m_bytesPerSecond / MICROSECONDS_PER_SECOND;
+    return static_cast<size_t>(bytes - bytes % m_frameSize);
+}
+
+std::chrono::microseconds A2DPJitterBuffer::bytesToDuration(size_t bytes) const {
+    return std::chrono::microseconds(static_cast<uint64_t>(bytes) * MICROSECONDS_PER_SECOND / m_bytesPerSecond);
+}
+
+void A2DPJitterBuffer::write(
+    const unsigned char* buffer,
+    size_t size,
+    std::chrono::steady_clock::time_point arrivalTime) {
+    if (!buffer || 0 == size) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "emptyBuffer"));
+        return;
+    }
+
+    std::shared_ptr<MetricEvent> metricEvent;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed) {
+            ACSDK_DEBUG9(LX("writeIgnored").d("reason", "closed"));
+            return;
+        }
+
+        updateTargetLocked(size, arrivalTime);
+
+        auto capacity = m_ring.size();
+        if (size > capacity) {
+            // Only the newest audio can be kept.
+            auto skip = size - capacity;
+            buffer += skip;
+            size = capacity;
+        }
+
+        if (m_size + size > capacity) {
+            auto excess = m_size + size - capacity;
+            excess = std::min(m_size, ((excess + m_frameSize - 1) / m_frameSize) * m_frameSize);
+            discardLocked(excess);
+            ++m_overruns;
+            ACSDK_DEBUG5(LX("overrun").d("droppedBytes", excess).d("overruns", m_overruns));
+        }
+
+        auto tail = (m_head + m_size) % capacity;
+        auto firstPart = std::min(size, capacity - tail);
+        std::memcpy(m_ring.data() + tail, buffer, firstPart);
+        if (firstPart < size) {
+            std::memcpy(m_ring.data(), buffer + firstPart, size - firstPart);
+        }
+        m_size += size;
+
+        metricEvent = buildMetricLocked(false);
+    }
+    submitMetric(metricEvent);
+}
+
+void A2DPJitterBuffer::updateTargetLocked(size_t size, std::chrono::steady_clock::time_point arrivalTime) {
+    auto duration = bytesToDuration(size);
+    if (m_hasPreviousArrival) {
+        auto interval = std::chrono::duration_cast<std::chrono::microseconds>(arrivalTime - m_previousArrival);
+        double deviation = std::fabs(static_cast<double>((interval - m_previousDuration).count()));
+        m_jitterUs += (deviation - m_jitterUs) / JITTER_SMOOTHING_FACTOR;
+
+        auto desired =
+            durationToBytes(std::chrono::microseconds(static_cast<int64_t>(JITTER_TARGET_MULTIPLIER * m_jitterUs)));
+        desired = std::max(m_minTargetBytes, std::min(m_maxTargetBytes, desired));
+        if (desired > m_targetBytes) {
+            // Grow immediately: late packets are about to cause an underrun.
+            m_targetBytes = desired;
+        } else {
+            // Shrink slowly so that a single calm period does not undo the adaptation.
+            auto decay = (m_targetBytes - desired) / TARGET_DECAY_FACTOR;
+            m_targetBytes -= decay - decay % m_frameSize;
+        }
+    }
+    m_hasPreviousArrival = true;
+    m_previousArrival = arrivalTime;
+    m_previousDuration = duration;
+}
+
+void A2DPJitterBuffer::popLocked(unsigned char* out, size_t size) {
+    auto capacity = m_ring.size();
+    auto firstPart = std::min(size, capacity - m_head);
+    std::memcpy(out, m_ring.data() + m_head, firstPart);
+    if (firstPart < size) {
+        std::memcpy(out + firstPart, m_ring.data(), size - firstPart);
+    }
+    discardLocked(size);
+}
+
+void A2DPJitterBuffer::discardLocked(size_t size) {
+    m_head = (m_head + size) % m_ring.size();
+    m_size -= size;
+    if (0 == m_size) {
+        m_head = 0;
+    }
+}
+
+std::size_t A2DPJitterBuffer::read(
+    void* buf,
+    std::size_t numBytes,
+    ReadStatus* readStatus,
+    std::chrono::milliseconds timeoutMs) {
+    if (!readStatus) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "nullReadStatus"));
+        return 0;
+    }
+    if (!buf) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "nullBuffer"));
+        *readStatus = ReadStatus::ERROR_INTERNAL;
+        return 0;
+    }
+
+    std::shared_ptr<MetricEvent> metricEvent;
+    size_t bytesRead = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_closed && 0 == m_size) {
+            *readStatus = ReadStatus::CLOSED;
+            return 0;
+        }
+        if (numBytes < m_frameSize) {
+            *readStatus = ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE;
+            return 0;
+        }
+
+        if (!m_closed) {
+            if (m_priming) {
+                if (m_size < m_targetBytes) {
+                    *readStatus = ReadStatus::OK_WOULDBLOCK;
+                    return 0;
+                }
+                m_priming = false;
+                ACSDK_DEBUG9(LX("primed").d("bufferedBytes", m_size).d("targetBytes", m_targetBytes));
+            } else if (0 == m_size) {
+                ++m_underruns;
+                m_priming = true;
+                ACSDK_DEBUG5(LX("underrun").d("underruns", m_underruns).d("targetBytes", m_targetBytes));
+                *readStatus = ReadStatus::OK_WOULDBLOCK;
+                return 0;
+            }
+        }
+
+        auto out = static_cast<unsigned char*>(buf);
+        numBytes -= numBytes % m_frameSize;
+
+        if (!m_closed) {
+            if (m_size > m_targetBytes + m_driftToleranceBytes && m_size >= 2 * m_frameSize) {
+                // The source runs faster than the sink. Skip one frame to pull the depth back to the target.
+                discardLocked(m_frameSize);
+                ++m_framesDropped;
+            } else if (
+                m_size + m_driftToleranceBytes < m_targetBytes && m_size >= m_frameSize && numBytes >= 2 * m_frameSize) {
+                // The source runs slower than the sink. Repeat one frame to let the depth recover.
+                std::memcpy(out, m_ring.data() + m_head, m_frameSize);
+                bytesRead += m_frameSize;
+                ++m_framesInserted;
+            }
+        }
+
+        auto available = std::min(m_size, numBytes - bytesRead);
+        available -= available % m_frameSize;
+        if (0 == available && m_size > 0 && m_closed) {
+            // Let a trailing partial frame out when draining a closed buffer.
+            available = std::min(m_size, numBytes - bytesRead);
+        }
+        popLocked(out + bytesRead, available);
+        bytesRead += available;
+
+        *readStatus = bytesRead < numBytes ? ReadStatus::OK_WOULDBLOCK : ReadStatus::OK;
+        metricEvent = buildMetricLocked(false);
+    }
+    submitMetric(metricEvent);
+
+    return bytesRead;
+}
+
+bool A2DPJitterBuffer::seek(uint64_t offset) {
+    ACSDK_WARN(LX("seekFailed").d("reason", "unsupported").d("offset", offset));
+    return false;
+}
+
+uint64_t A2DPJitterBuffer::getNumUnreadBytes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size;
+}
+
+void A2DPJitterBuffer::close(ClosePoint closePoint) {
+    std::shared_ptr<MetricEvent> metricEvent;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_closed && ClosePoint::AFTER_DRAINING_CURRENT_BUFFER == closePoint) {
+            return;
+        }
+        if (ClosePoint::IMMEDIATELY == closePoint) {
+            m_head = 0;
+            m_size = 0;
+        }
+        if (!m_closed) {
+            m_closed = true;
+            metricEvent = buildMetricLocked(true);
+        }
+    }
+    submitMetric(metricEvent);
+}
+
+void A2DPJitterBuffer::onFormattedAudioStreamAdapterData(
+    AudioFormat audioFormat,
+    const unsigned char* buffer,
+    size_t size) {
+    write(buffer, size);
+}
+
+A2DPJitterBuffer::Statistics A2DPJitterBuffer::getStatistics() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {m_underruns,
+            m_overruns,
+            m_framesInserted,
+            m_framesDropped,
+            std::chrono::duration_cast<std::chrono::milliseconds>(bytesToDuration(m_size)),
+            std::chrono::duration_cast<std::chrono::milliseconds>(bytesToDuration(m_targetBytes)),
+            std::chrono::microseconds(static_cast<int64_t>(m_jitterUs))};
+}
+
+std::shared_ptr<MetricEvent> A2DPJitterBuffer::buildMetricLocked(bool force) {
+    if (!m_metricRecorder) {
+        return nullptr;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (!force && now - m_lastReport < m_config.metricReportInterval) {
+        return nullptr;
+    }
+    m_lastReport = now;
+
+    auto underruns = m_underruns - m_reportedUnderruns;
+    auto overruns = m_overruns - m_reportedOverruns;
+    m_reportedUnderruns = m_underruns;
+    m_reportedOverruns = m_overruns;
+
+    return MetricEventBuilder{}
+        .setActivityName(JITTER_BUFFER_METRIC_ACTIVITY_NAME)
+        .addDataPoint(DataPointCounterBuilder{}.setName(UNDERRUN_METRIC).increment(underruns).build())
+        .addDataPoint(DataPointCounterBuilder{}.setName(OVERRUN_METRIC).increment(overruns).build())
+        .addDataPoint(DataPointDurationBuilder{std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                   bytesToDuration(m_size))}
+                          .setName(CURRENT_LATENCY_METRIC)
+                          .build())
+        .addDataPoint(DataPointDurationBuilder{std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                   bytesToDuration(m_targetBytes))}
+                          .setName(TARGET_LATENCY_METRIC)
+                          .build())
+        .build();
+}
+
+void A2DPJitterBuffer::submitMetric(const std::shared_ptr<MetricEvent>& metricEvent) {
+    if (!metricEvent) {
+        return;
+    }
+    recordMetric(m_metricRecorder, metricEvent);
+}
+
+}  // namespace acsdkBluetooth
+}  // namespace alexaClientSDK
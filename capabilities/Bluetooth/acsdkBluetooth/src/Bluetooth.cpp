@@ -571,7 +571,8 @@ std::shared_ptr<Bluetooth> Bluetooth::createBluetoothCapabilityAgent(
         avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface> endpointCapabilitiesRegistrar,
     std::shared_ptr<acsdkBluetoothInterfaces::BluetoothDeviceConnectionRulesProviderInterface> connectionRulesProvider,
     std::shared_ptr<BluetoothMediaInputTransformer> mediaInputTransformer,
-    std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier) {
+    std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier,
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) {
     ACSDK_DEBUG5(LX(__func__));
 
     if (!contextManager || !messageSender || !exceptionEncounteredSender || !bluetoothStorage || !deviceManager ||
@@ -632,7 +633,8 @@ std::shared_ptr<Bluetooth> Bluetooth::createBluetoothCapabilityAgent(
         enabledConnectionRules,
         channelVolume,
         mediaInputTransformer,
-        bluetoothNotifier));
+        bluetoothNotifier,
+        metricRecorder));
 
     if (!bluetooth->init()) {
         ACSDK_ERROR(LX(__func__).d("reason", "initFailed"));
@@ -714,7 +716,8 @@ Bluetooth::Bluetooth(
         enabledConnectionRules,
     std::shared_ptr<ChannelVolumeInterface> bluetoothChannelVolumeInterface,
     std::shared_ptr<BluetoothMediaInputTransformer> mediaInputTransformer,
-    std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier) :
+    std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier,
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) :
         CapabilityAgent{NAMESPACE, exceptionEncounteredSender},
         RequiresShutdown{"Bluetooth"},
         CustomerDataHandler{customerDataManager},
@@ -732,6 +735,7 @@ Bluetooth::Bluetooth(
         m_eventBus{eventBus},
         m_mediaInputTransformer{mediaInputTransformer},
         m_mediaStream{nullptr},
+        m_metricRecorder{metricRecorder},
         m_bluetoothChannelVolumeInterface{bluetoothChannelVolumeInterface},
         m_bluetoothNotifier{bluetoothNotifier},
         m_pendingFocusTransitions{0} {
@@ -780,8 +784,10 @@ void Bluetooth::doShutdown() {
 
     // Media Stream
     m_mediaStream.reset();
-    m_mediaAttachment.reset();
-    m_mediaAttachmentWriter.reset();
+    if (m_mediaJitterBuffer) {
+        m_mediaJitterBuffer->close(avsCommon::avs::attachment::AttachmentReader::ClosePoint::IMMEDIATELY);
+        m_mediaJitterBuffer.reset();
+    }
 
     // MediaPlayer
     m_mediaPlayer->removeObserver(shared_from_this());
@@ -902,6 +908,40 @@ bool Bluetooth::retrieveUuid(const std::string& mac, std::string* uuid) {
     return true;
 }
 
+bool Bluetooth::retrieveUuids(
+    const std::list<std::shared_ptr<BluetoothDeviceInterface>>& devices,
+    std::unordered_map<std::string, std::string>* macToUuid) {
+    ACSDK_DEBUG5(LX(__func__));
+
+    if (!macToUuid) {
+        ACSDK_ERROR(LX(__func__).d("reason", "nullMacToUuid"));
+        return false;
+    }
+
+    std::vector<std::pair<std::string, std::string>> newEntries;
+    for (const auto& device : devices) {
+        const auto& mac = device->getMac();
+        if (macToUuid->count(mac) > 0) {
+            continue;
+        }
+
+        std::string uuid;
+        if (!m_db->getUuid(mac, &uuid)) {
+            ACSDK_INFO(LX(__func__).d("reason", "noMatchingUUID").d("mac", mac));
+            uuid = uuidGeneration::generateUUID();
+            newEntries.emplace_back(mac, uuid);
+        }
+        (*macToUuid)[mac] = uuid;
+    }
+
+    if (!newEntries.empty() && !m_db->insertByMacBatch(newEntries, false)) {
+        ACSDK_ERROR(LX(__func__).d("reason", "insertingToDBFailed").d("count", newEntries.size()));
+        return false;
+    }
+
+    return true;
+}
+
 bool Bluetooth::retrieveDeviceCategoryByUuid(const std::string& uuid, DeviceCategory* category) {
     ACSDK_DEBUG5(LX(__func__));
 
@@ -2402,14 +2442,17 @@ void Bluetooth::executeSendScanDevicesReport(
     rapidjson::Value devicesArray(rapidjson::kArrayType);
     ACSDK_DEBUG5(LX(__func__).d("count", devices.size()));
 
+    // Newly discovered devices are stored together, rather than with one database write each.
+    std::unordered_map<std::string, std::string> macToUuid;
+    if (!retrieveUuids(devices, &macToUuid)) {
+        ACSDK_ERROR(LX("executeSendScanDevicesReportFailed").d("reason", "retrieveUuidFailed"));
+        return;
+    }
+
     for (const auto& device : devices) {
         std::string truncatedMac = truncateWithDefault(device->getMac());
         ACSDK_DEBUG(LX("foundDevice").d("deviceMac", truncatedMac));
-        std::string uuid;
-        if (!retrieveUuid(device->getMac(), &uuid)) {
-            ACSDK_ERROR(LX("executeSendScanDevicesReportFailed").d("reason", "retrieveUuidFailed"));
-            return;
-        }
+        std::string uuid = macToUuid[device->getMac()];
 
         if (device->isPaired()) {
             ACSDK_DEBUG(LX(__func__)
@@ -2979,13 +3022,12 @@ void Bluetooth::executeReleaseFocus(const std::string& callingMethodName) {
  * The BTCA should not be responsible for this conversion.
  */
 void Bluetooth::onFormattedAudioStreamAdapterData(AudioFormat audioFormat, const unsigned char* buffer, size_t size) {
-    avsCommon::avs::attachment::AttachmentWriter::WriteStatus writeStatus;
     /*
-     * We may ignore the write status since in case of possible overrun (or any other kind of errors)
-     * we may safely drop the packet.
+     * The jitter buffer accounts for overruns itself, dropping the oldest audio so that latency stays bounded.
      */
-    if (m_mediaAttachment) {
-        m_mediaAttachmentWriter->write(buffer, size, &writeStatus);
+    auto jitterBuffer = m_mediaJitterBuffer;
+    if (jitterBuffer) {
+        jitterBuffer->write(buffer, size);
     }
 }
 
@@ -3018,13 +3060,9 @@ void Bluetooth::setCurrentStream(std::shared_ptr<avsCommon::utils::bluetooth::Fo
         return;
     }
 
-    if (m_mediaAttachmentReader) {
-        m_mediaAttachmentReader->close();
-        m_mediaAttachmentReader.reset();
-    }
-    if (m_mediaAttachmentWriter) {
-        m_mediaAttachmentWriter->close();
-        m_mediaAttachmentWriter.reset();
+    if (m_mediaJitterBuffer) {
+        m_mediaJitterBuffer->close();
+        m_mediaJitterBuffer.reset();
     }
 
     if (m_mediaStream) {
@@ -3034,20 +3072,21 @@ void Bluetooth::setCurrentStream(std::shared_ptr<avsCommon::utils::bluetooth::Fo
     m_mediaStream = stream;
 
     if (m_mediaStream) {
-        m_mediaAttachment = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>("Bluetooth");
-
-        m_mediaAttachmentReader = m_mediaAttachment->createReader(avsCommon::utils::sds::ReaderPolicy::NONBLOCKING);
-
-        m_mediaAttachmentWriter = m_mediaAttachment->createWriter(avsCommon::utils::sds::WriterPolicy::ALL_OR_NOTHING);
+        auto audioFormat = m_mediaStream->getAudioFormat();
+        m_mediaJitterBuffer = A2DPJitterBuffer::create(audioFormat, m_metricRecorder);
+        if (!m_mediaJitterBuffer) {
+            ACSDK_ERROR(LX(__func__).d("reason", "createJitterBufferFailed"));
+            m_mediaStream.reset();
+            return;
+        }
 
         m_mediaStream->setListener(shared_from_this());
 
-        auto audioFormat = m_mediaStream->getAudioFormat();
-        m_sourceId = m_mediaPlayer->setSource(m_mediaAttachmentReader, &audioFormat);
+        m_sourceId = m_mediaPlayer->setSource(m_mediaJitterBuffer, &audioFormat);
         if (MediaPlayerInterface::ERROR == m_sourceId) {
             ACSDK_ERROR(LX(__func__).d("reason", "setSourceFailed"));
-            m_mediaAttachment.reset();
-            m_mediaAttachmentWriter.reset();
+            m_mediaStream->setListener(nullptr);
+            m_mediaJitterBuffer.reset();
             m_mediaStream.reset();
         }
     }
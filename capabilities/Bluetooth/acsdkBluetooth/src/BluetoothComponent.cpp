@@ -42,7 +42,8 @@ std::shared_ptr<acsdkBluetoothInterfaces::BluetoothLocalInterface> createBluetoo
         avsCommon::sdkInterfaces::endpoints::EndpointCapabilitiesRegistrarInterface> endpointCapabilitiesRegistrar,
     std::shared_ptr<acsdkBluetoothInterfaces::BluetoothDeviceConnectionRulesProviderInterface> connectionRulesProvider,
     std::shared_ptr<BluetoothMediaInputTransformer> mediaInputTransformer,
-    std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier) {
+    std::shared_ptr<acsdkBluetoothInterfaces::BluetoothNotifierInterface> bluetoothNotifier,
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) {
     return std::shared_ptr<acsdkBluetoothInterfaces::BluetoothLocalInterface>(Bluetooth::createBluetoothCapabilityAgent(
         contextManager,
         messageSender,
@@ -57,7 +58,8 @@ std::shared_ptr<acsdkBluetoothInterfaces::BluetoothLocalInterface> createBluetoo
         endpointCapabilitiesRegistrar,
         connectionRulesProvider,
         mediaInputTransformer,
-        bluetoothNotifier));
+        bluetoothNotifier,
+        metricRecorder));
 }
 
 BluetoothComponent getComponent() {
@@ -40,6 +40,12 @@ static const std::string BLUETOOTH_CONFIGURATION_ROOT_KEY = "bluetooth";
 /// The node identifying the database.
 static const std::string BLUETOOTH_DB_FILE_PATH_KEY = "databaseFilePath";
 
+/// The node identifying whether the in-memory index is used.
+static const std::string BLUETOOTH_IN_MEMORY_INDEX_KEY = "inMemoryIndex";
+
+/// Whether the in-memory index is used if the configuration does not specify it.
+static const bool DEFAULT_IN_MEMORY_INDEX = true;
+
 /// Table name.
 static const std::string UUID_TABLE_NAME = "uuidMapping";
 
@@ -89,7 +95,10 @@ std::unique_ptr<SQLiteBluetoothStorage> SQLiteBluetoothStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteBluetoothStorage>(new SQLiteBluetoothStorage(filePath));
+    bool useInMemoryIndex = DEFAULT_IN_MEMORY_INDEX;
+    bluetoothConfigurationRoot.getBool(BLUETOOTH_IN_MEMORY_INDEX_KEY, &useInMemoryIndex, DEFAULT_IN_MEMORY_INDEX);
+
+    return std::unique_ptr<SQLiteBluetoothStorage>(new SQLiteBluetoothStorage(filePath, useInMemoryIndex));
 }
 
 bool SQLiteBluetoothStorage::createDatabase() {
@@ -107,6 +116,7 @@ bool SQLiteBluetoothStorage::createDatabase() {
         return false;
     }
 
+    loadIndexLocked();
     return true;
 }
 
@@ -137,6 +147,7 @@ bool SQLiteBluetoothStorage::open() {
         }
     }
 
+    loadIndexLocked();
     return true;
 }
 
@@ -153,7 +164,7 @@ bool SQLiteBluetoothStorage::clear() {
     const std::string sqlString = "DELETE FROM " + UUID_TABLE_NAME + ";";
 
     std::lock_guard<std::mutex> lock(m_databaseMutex);
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(sqlString);
 
     if (!statement) {
         ACSDK_ERROR(LX(__func__).d("reason", "createStatementFailed"));
@@ -165,11 +176,18 @@ bool SQLiteBluetoothStorage::clear() {
         return false;
     }
 
+    if (m_isIndexLoaded) {
+        m_macToUuid.clear();
+        m_uuidToMac.clear();
+        m_uuidToCategory.clear();
+        m_orderedMacs.clear();
+    }
+
     return true;
 }
 
 bool SQLiteBluetoothStorage::getSingleRowLocked(
-    std::unique_ptr<storage::sqliteStorage::SQLiteStatement>& statement,
+    storage::sqliteStorage::SQLiteStatement* statement,
     std::unordered_map<std::string, std::string>* row) {
     ACSDK_DEBUG9(LX(__func__));
     if (!statement) {
@@ -239,9 +257,18 @@ bool SQLiteBluetoothStorage::getAssociatedDataLocked(
         return false;
     }
 
+    if (m_isIndexLoaded && (COLUMN_UUID == constraintKey || COLUMN_MAC == constraintKey)) {
+        std::unordered_map<std::string, std::string> row;
+        if (getIndexedRowLocked(constraintKey, constraintVal, &row) && row.count(resultKey) > 0) {
+            *resultVal = row.at(resultKey);
+            return true;
+        }
+        return false;
+    }
+
     const std::string sqlString =
         "SELECT " + resultKey + " FROM " + UUID_TABLE_NAME + " WHERE " + constraintKey + " IS ?;";
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(sqlString);
 
     if (!statement) {
         ACSDK_ERROR(LX(__func__).d("reason", "createStatementFailed"));
@@ -256,8 +283,10 @@ bool SQLiteBluetoothStorage::getAssociatedDataLocked(
     }
 
     std::unordered_map<std::string, std::string> row;
+    bool found = getSingleRowLocked(statement, &row) && row.count(resultKey) > 0;
+    statement->reset();
 
-    if (getSingleRowLocked(statement, &row) && row.count(resultKey) > 0) {
+    if (found) {
         *resultVal = row.at(resultKey);
         return true;
     }
@@ -286,8 +315,18 @@ bool SQLiteBluetoothStorage::getMappingsLocked(
         return false;
     }
 
+    if (m_isIndexLoaded) {
+        for (const auto& entry : m_uuidToMac) {
+            std::unordered_map<std::string, std::string> row;
+            if (getIndexedRowLocked(COLUMN_UUID, entry.first, &row)) {
+                mappings->insert({row.at(key), row.at(value)});
+            }
+        }
+        return true;
+    }
+
     const std::string sqlString = "SELECT * FROM " + UUID_TABLE_NAME + ";";
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(sqlString);
 
     if (!statement) {
         ACSDK_ERROR(LX(__func__).d("reason", "createStatementFailed"));
@@ -329,7 +368,7 @@ bool SQLiteBluetoothStorage::updateValueLocked(
     const std::string sqlString =
         "UPDATE " + UUID_TABLE_NAME + " SET " + updateKey + "=? WHERE " + constraintKey + "=?;";
 
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(sqlString);
     if (!statement) {
         ACSDK_ERROR(LX(__func__).d("reason", "createStatementFailed"));
         return false;
@@ -368,7 +407,7 @@ bool SQLiteBluetoothStorage::insertEntryLocked(
                                   " (" + COLUMN_UUID + "," + COLUMN_MAC + "," + COLUMN_CATEGORY + ") VALUES (?,?,?);";
     // clang-format on
 
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(sqlString);
     if (!statement) {
         ACSDK_ERROR(LX(__func__).d("reason", "createStatementFailed"));
         return false;
@@ -496,7 +535,16 @@ bool SQLiteBluetoothStorage::getOrderedMac(bool ascending, std::list<std::string
 
     std::lock_guard<std::mutex> lock(m_databaseMutex);
 
-    auto statement = m_db.createStatement(sqlString);
+    if (m_isIndexLoaded) {
+        if (ascending) {
+            macs->insert(macs->end(), m_orderedMacs.begin(), m_orderedMacs.end());
+        } else {
+            macs->insert(macs->end(), m_orderedMacs.rbegin(), m_orderedMacs.rend());
+        }
+        return true;
+    }
+
+    auto statement = m_db.getCachedStatement(sqlString);
 
     if (!statement) {
         ACSDK_ERROR(LX(__func__).d("reason", "createStatementFailed"));
@@ -516,23 +564,116 @@ bool SQLiteBluetoothStorage::getOrderedMac(bool ascending, std::list<std::string
 
 bool SQLiteBluetoothStorage::insertByMac(const std::string& mac, const std::string& uuid, bool overwrite) {
     ACSDK_DEBUG5(LX(__func__));
+
+    std::lock_guard<std::mutex> lock(m_databaseMutex);
+    return insertByMacLocked(mac, uuid, overwrite);
+}
+
+bool SQLiteBluetoothStorage::insertByMacBatch(
+    const std::vector<std::pair<std::string, std::string>>& macToUuid,
+    bool overwrite) {
+    ACSDK_DEBUG5(LX(__func__).d("count", macToUuid.size()));
+    if (macToUuid.empty()) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_databaseMutex);
+    {
+        auto transaction = m_db.beginTransaction();
+        if (!transaction) {
+            ACSDK_ERROR(LX("insertByMacBatchFailed").d("reason", "beginTransactionFailed"));
+            return false;
+        }
+
+        for (const auto& entry : macToUuid) {
+            if (!insertByMacLocked(entry.first, entry.second, overwrite)) {
+                ACSDK_ERROR(LX("insertByMacBatchFailed").d("reason", "insertFailed"));
+                transaction->rollback();
+                loadIndexLocked();
+                return false;
+            }
+        }
+
+        if (!transaction->commit()) {
+            ACSDK_ERROR(LX("insertByMacBatchFailed").d("reason", "commitFailed"));
+            loadIndexLocked();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SQLiteBluetoothStorage::insertByMacLocked(const std::string& mac, const std::string& uuid, bool overwrite) {
     const std::string operation = overwrite ? "REPLACE" : "INSERT";
     std::string category = deviceCategoryToString(DeviceCategory::UNKNOWN);
 
-    std::lock_guard<std::mutex> lock(m_databaseMutex);
     getAssociatedDataLocked(COLUMN_UUID, uuid, COLUMN_CATEGORY, &category);
 
-    return insertEntryLocked(operation, uuid, mac, category);
+    if (!insertEntryLocked(operation, uuid, mac, category)) {
+        return false;
+    }
+
+    if (m_isIndexLoaded) {
+        indexEntryLocked(uuid, mac, category);
+    }
+    return true;
 }
 
 bool SQLiteBluetoothStorage::updateByCategory(const std::string& uuid, const std::string& category) {
     ACSDK_DEBUG5(LX(__func__));
-    std::string mac = deviceCategoryToString(DeviceCategory::UNKNOWN);
 
     std::lock_guard<std::mutex> lock(m_databaseMutex);
+    return updateByCategoryLocked(uuid, category);
+}
+
+bool SQLiteBluetoothStorage::updateByCategoryBatch(
+    const std::unordered_map<std::string, std::string>& uuidToCategory) {
+    ACSDK_DEBUG5(LX(__func__).d("count", uuidToCategory.size()));
+    if (uuidToCategory.empty()) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_databaseMutex);
+    {
+        auto transaction = m_db.beginTransaction();
+        if (!transaction) {
+            ACSDK_ERROR(LX("updateByCategoryBatchFailed").d("reason", "beginTransactionFailed"));
+            return false;
+        }
+
+        for (const auto& entry : uuidToCategory) {
+            if (!updateByCategoryLocked(entry.first, entry.second)) {
+                ACSDK_ERROR(LX("updateByCategoryBatchFailed").d("reason", "updateFailed"));
+                transaction->rollback();
+                loadIndexLocked();
+                return false;
+            }
+        }
+
+        if (!transaction->commit()) {
+            ACSDK_ERROR(LX("updateByCategoryBatchFailed").d("reason", "commitFailed"));
+            loadIndexLocked();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SQLiteBluetoothStorage::updateByCategoryLocked(const std::string& uuid, const std::string& category) {
+    std::string mac = deviceCategoryToString(DeviceCategory::UNKNOWN);
+
     if (getAssociatedDataLocked(COLUMN_UUID, uuid, COLUMN_MAC, &mac)) {
         // Do not overwrite & found existing uuid entry, update value
-        return updateValueLocked(COLUMN_UUID, uuid, COLUMN_CATEGORY, category);
+        if (!updateValueLocked(COLUMN_UUID, uuid, COLUMN_CATEGORY, category)) {
+            return false;
+        }
+
+        if (m_isIndexLoaded) {
+            m_uuidToCategory[uuid] = category;
+        }
+        return true;
     }
 
     ACSDK_ERROR(LX("updateByCategoryFailed").d("reason", "UUID not found in database."));
@@ -545,7 +686,7 @@ bool SQLiteBluetoothStorage::remove(const std::string& mac) {
 
     std::lock_guard<std::mutex> lock(m_databaseMutex);
 
-    auto statement = m_db.createStatement(sqlString);
+    auto statement = m_db.getCachedStatement(sqlString);
 
     if (!statement) {
         ACSDK_ERROR(LX("removeFailed").d("reason", "createStatementFailed"));
@@ -564,16 +705,132 @@ bool SQLiteBluetoothStorage::remove(const std::string& mac) {
         return false;
     }
 
+    if (m_isIndexLoaded) {
+        unindexMacLocked(mac);
+    }
+
+    return true;
+}
+
+bool SQLiteBluetoothStorage::loadIndexLocked() {
+    unloadIndexLocked();
+    if (!m_useInMemoryIndex) {
+        return true;
+    }
+
+    const std::string sqlString =
+        "SELECT " + COLUMN_UUID + "," + COLUMN_MAC + "," + COLUMN_CATEGORY + " FROM " + UUID_TABLE_NAME +
+        " ORDER BY rowid ASC;";
+    auto statement = m_db.getCachedStatement(sqlString);
+
+    if (!statement) {
+        ACSDK_ERROR(LX("loadIndexFailed").d("reason", "createStatementFailed"));
+        return false;
+    }
+
+    std::unordered_map<std::string, std::string> row;
+    while (getSingleRowLocked(statement, &row)) {
+        if (0 == row.count(COLUMN_UUID) || 0 == row.count(COLUMN_MAC) || 0 == row.count(COLUMN_CATEGORY)) {
+            ACSDK_ERROR(LX("loadIndexFailed").d("reason", "missingData"));
+            statement->reset();
+            unloadIndexLocked();
+            return false;
+        }
+        indexEntryLocked(row.at(COLUMN_UUID), row.at(COLUMN_MAC), row.at(COLUMN_CATEGORY));
+        row.clear();
+    }
+
+    if (SQLITE_DONE != statement->getStepResult()) {
+        ACSDK_ERROR(LX("loadIndexFailed").d("reason", "stepFailed"));
+        unloadIndexLocked();
+        return false;
+    }
+
+    m_isIndexLoaded = true;
+    return true;
+}
+
+void SQLiteBluetoothStorage::unloadIndexLocked() {
+    m_isIndexLoaded = false;
+    m_macToUuid.clear();
+    m_uuidToMac.clear();
+    m_uuidToCategory.clear();
+    m_orderedMacs.clear();
+}
+
+void SQLiteBluetoothStorage::indexEntryLocked(
+    const std::string& uuid,
+    const std::string& mac,
+    const std::string& category) {
+    // Like REPLACE, drop the rows which conflict on either unique column.
+    unindexMacLocked(mac);
+    auto uuidIt = m_uuidToMac.find(uuid);
+    if (m_uuidToMac.end() != uuidIt) {
+        // Copy the MAC, as the entry holding it is erased by unindexMacLocked.
+        const std::string conflictingMac = uuidIt->second;
+        unindexMacLocked(conflictingMac);
+    }
+
+    m_macToUuid[mac] = uuid;
+    m_uuidToMac[uuid] = mac;
+    m_uuidToCategory[uuid] = category;
+    m_orderedMacs.push_back(mac);
+}
+
+void SQLiteBluetoothStorage::unindexMacLocked(const std::string& mac) {
+    auto macIt = m_macToUuid.find(mac);
+    if (m_macToUuid.end() == macIt) {
+        return;
+    }
+
+    m_uuidToMac.erase(macIt->second);
+    m_uuidToCategory.erase(macIt->second);
+    m_orderedMacs.remove(mac);
+    m_macToUuid.erase(macIt);
+}
+
+bool SQLiteBluetoothStorage::getIndexedRowLocked(
+    const std::string& key,
+    const std::string& value,
+    std::unordered_map<std::string, std::string>* row) {
+    std::string uuid;
+    std::string mac;
+    if (COLUMN_UUID == key) {
+        auto it = m_uuidToMac.find(value);
+        if (m_uuidToMac.end() == it) {
+            return false;
+        }
+        uuid = value;
+        mac = it->second;
+    } else if (COLUMN_MAC == key) {
+        auto it = m_macToUuid.find(value);
+        if (m_macToUuid.end() == it) {
+            return false;
+        }
+        uuid = it->second;
+        mac = value;
+    } else {
+        ACSDK_ERROR(LX("getIndexedRowLockedFailed").d("reason", "invalidKey").d("key", key));
+        return false;
+    }
+
+    row->insert({COLUMN_UUID, uuid});
+    row->insert({COLUMN_MAC, mac});
+    row->insert({COLUMN_CATEGORY, m_uuidToCategory[uuid]});
     return true;
 }
 
 void SQLiteBluetoothStorage::closeLocked() {
     ACSDK_DEBUG5(LX(__func__));
 
+    unloadIndexLocked();
     m_db.close();
 }
 
-SQLiteBluetoothStorage::SQLiteBluetoothStorage(const std::string& filePath) : m_db{filePath} {
+SQLiteBluetoothStorage::SQLiteBluetoothStorage(const std::string& filePath, bool useInMemoryIndex) :
+        m_db{filePath},
+        m_useInMemoryIndex{useInMemoryIndex},
+        m_isIndexLoaded{false} {
 }
 
 }  // namespace acsdkBluetooth
@@ -0,0 +1,254 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Bluetooth/FormattedAudioStreamAdapter.h>
+
+#include "acsdkBluetooth/A2DPJitterBuffer.h"
+
+namespace alexaClientSDK {
+namespace acsdkBluetooth {
+namespace test {
+
+using namespace ::testing;
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils;
+using namespace avsCommon::utils::bluetooth;
+
+/// Sample rate used by the tests.
+static constexpr unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// Number of 16 bit mono samples in one millisecond of audio.
+static constexpr size_t SAMPLES_PER_MS = SAMPLE_RATE_HZ / 1000;
+
+/// Duration of the synthetic packets.
+static constexpr std::chrono::milliseconds PACKET_DURATION{10};
+
+class A2DPJitterBufferTest : public ::testing::Test {
+public:
+    /// SetUp before each test case.
+    void SetUp() override;
+
+protected:
+    /**
+     * Write a packet of sequentially numbered samples into the jitter buffer.
+     *
+     * @param duration Duration of the packet.
+     * @param arrivalTime Arrival time of the packet.
+     */
+    void writeSamples(
+        std::chrono::milliseconds duration,
+        std::chrono::steady_clock::time_point arrivalTime = std::chrono::steady_clock::now());
+
+    /**
+     * Read samples from the jitter buffer.
+     *
+     * @param duration Duration of audio to request.
+     * @param[out] status The status of the read.
+     * @return The samples read.
+     */
+    std::vector<int16_t> readSamples(std::chrono::milliseconds duration, AttachmentReader::ReadStatus* status);
+
+    /// The 16 bit mono LPCM format used by the tests.
+    AudioFormat m_format;
+
+    /// The @c A2DPJitterBuffer instance under test.
+    std::shared_ptr<A2DPJitterBuffer> m_jitterBuffer;
+
+    /// The value of the next synthetic sample.
+    int16_t m_nextSample;
+};
+
+void A2DPJitterBufferTest::SetUp() {
+    m_format.encoding = AudioFormat::Encoding::LPCM;
+    m_format.endianness = AudioFormat::Endianness::LITTLE;
+    m_format.sampleRateHz = SAMPLE_RATE_HZ;
+    m_format.sampleSizeInBits = 16;
+    m_format.numChannels = 1;
+    m_format.dataSigned = true;
+    m_format.layout = AudioFormat::Layout::INTERLEAVED;
+
+    m_jitterBuffer = A2DPJitterBuffer::create(m_format);
+    ASSERT_THAT(m_jitterBuffer, NotNull());
+    m_nextSample = 0;
+}
+
+void A2DPJitterBufferTest::writeSamples(
+    std::chrono::milliseconds duration,
+    std::chrono::steady_clock::time_point arrivalTime) {
+    std::vector<int16_t> samples(duration.count() * SAMPLES_PER_MS);
+    for (auto& sample : samples) {
+        sample = m_nextSample++;
+    }
+    m_jitterBuffer->write(
+        reinterpret_cast<const unsigned char*>(samples.data()), samples.size() * sizeof(int16_t), arrivalTime);
+}
+
+std::vector<int16_t> A2DPJitterBufferTest::readSamples(
+    std::chrono::milliseconds duration,
+    AttachmentReader::ReadStatus* status) {
+    std::vector<int16_t> samples(duration.count() * SAMPLES_PER_MS);
+    auto bytesRead = m_jitterBuffer->read(samples.data(), samples.size() * sizeof(int16_t), status);
+    samples.resize(bytesRead / sizeof(int16_t));
+    return samples;
+}
+
+/// Test that create() rejects formats and configurations the buffer can not handle.
+TEST_F(A2DPJitterBufferTest, test_createWithInvalidParams) {
+    auto opusFormat = m_format;
+    opusFormat.encoding = AudioFormat::Encoding::OPUS;
+    EXPECT_THAT(A2DPJitterBuffer::create(opusFormat), IsNull());
+
+    auto oddSampleSize = m_format;
+    oddSampleSize.sampleSizeInBits = 12;
+    EXPECT_THAT(A2DPJitterBuffer::create(oddSampleSize), IsNull());
+
+    A2DPJitterBuffer::Config config;
+    config.minTargetLatency = config.maxTargetLatency + std::chrono::milliseconds(1);
+    EXPECT_THAT(A2DPJitterBuffer::create(m_format, nullptr, config), IsNull());
+
+    config = A2DPJitterBuffer::Config();
+    config.capacity = config.maxTargetLatency;
+    EXPECT_THAT(A2DPJitterBuffer::create(m_format, nullptr, config), IsNull());
+}
+
+/// Test that no audio is released until the target depth is buffered.
+TEST_F(A2DPJitterBufferTest, test_readBlocksUntilPrimed) {
+    AttachmentReader::ReadStatus status;
+    writeSamples(std::chrono::milliseconds(20));
+    EXPECT_TRUE(readSamples(std::chrono::milliseconds(40), &status).empty());
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK_WOULDBLOCK);
+
+    writeSamples(std::chrono::milliseconds(20));
+    auto samples = readSamples(std::chrono::milliseconds(40), &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK);
+    ASSERT_EQ(samples.size(), 40 * SAMPLES_PER_MS);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        ASSERT_EQ(samples[i], static_cast<int16_t>(i));
+    }
+}
+
+/// Test that PCM published through a @c FormattedAudioStreamAdapter reaches the reader unchanged.
+TEST_F(A2DPJitterBufferTest, test_dataSentThroughStreamAdapter) {
+    FormattedAudioStreamAdapter adapter(m_format);
+    adapter.setListener(m_jitterBuffer);
+
+    std::vector<int16_t> sent(40 * SAMPLES_PER_MS);
+    for (size_t i = 0; i < sent.size(); ++i) {
+        sent[i] = static_cast<int16_t>(i * 3);
+    }
+    auto bytes = sent.size() * sizeof(int16_t);
+    EXPECT_EQ(adapter.send(reinterpret_cast<const unsigned char*>(sent.data()), bytes), bytes);
+
+    AttachmentReader::ReadStatus status;
+    auto received = readSamples(std::chrono::milliseconds(40), &status);
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK);
+    EXPECT_EQ(received, sent);
+}
+
+/// Test that running dry while playing counts an underrun and holds playback back until the buffer refills.
+TEST_F(A2DPJitterBufferTest, test_underrunCountedAndBufferReprimes) {
+    AttachmentReader::ReadStatus status;
+    writeSamples(std::chrono::milliseconds(40));
+    EXPECT_EQ(readSamples(std::chrono::milliseconds(40), &status).size(), 40 * SAMPLES_PER_MS);
+
+    EXPECT_TRUE(readSamples(std::chrono::milliseconds(10), &status).empty());
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::OK_WOULDBLOCK);
+    EXPECT_EQ(m_jitterBuffer->getStatistics().underruns, 1u);
+
+    writeSamples(std::chrono::milliseconds(20));
+    EXPECT_TRUE(readSamples(std::chrono::milliseconds(10), &status).empty());
+    EXPECT_EQ(m_jitterBuffer->getStatistics().underruns, 1u);
+
+    writeSamples(std::chrono::milliseconds(20));
+    EXPECT_FALSE(readSamples(std::chrono::milliseconds(10), &status).empty());
+}
+
+/// Test that an overrun discards the oldest audio and keeps the latency bounded to the capacity.
+TEST_F(A2DPJitterBufferTest, test_overrunDropsOldestAudio) {
+    A2DPJitterBuffer::Config config;
+    auto start = std::chrono::steady_clock::now();
+    auto packets = (config.capacity + std::chrono::milliseconds(20)) / PACKET_DURATION;
+    for (int i = 0; i < packets; ++i) {
+        writeSamples(PACKET_DURATION, start + i * PACKET_DURATION);
+    }
+
+    auto statistics = m_jitterBuffer->getStatistics();
+    EXPECT_GT(statistics.overruns, 0u);
+    EXPECT_EQ(statistics.currentLatency, config.capacity);
+
+    // The buffer is far above its target, so drift compensation also skips one frame.
+    AttachmentReader::ReadStatus status;
+    auto samples = readSamples(std::chrono::milliseconds(10), &status);
+    ASSERT_FALSE(samples.empty());
+    EXPECT_EQ(samples.front(), static_cast<int16_t>(20 * SAMPLES_PER_MS + 1));
+    EXPECT_EQ(m_jitterBuffer->getStatistics().framesDropped, 1u);
+}
+
+/// Test that a depth below the drift tolerance window is compensated by repeating a frame.
+TEST_F(A2DPJitterBufferTest, test_lowDepthInsertsFrame) {
+    AttachmentReader::ReadStatus status;
+    writeSamples(std::chrono::milliseconds(40));
+    EXPECT_EQ(readSamples(std::chrono::milliseconds(30), &status).size(), 30 * SAMPLES_PER_MS);
+
+    auto samples = readSamples(std::chrono::milliseconds(5), &status);
+    ASSERT_GE(samples.size(), 2u);
+    EXPECT_EQ(samples[0], static_cast<int16_t>(30 * SAMPLES_PER_MS));
+    EXPECT_EQ(samples[1], samples[0]);
+    EXPECT_EQ(m_jitterBuffer->getStatistics().framesInserted, 1u);
+}
+
+/// Test that irregular packet arrival grows the target depth within its bounds.
+TEST_F(A2DPJitterBufferTest, test_targetAdaptsToJitter) {
+    A2DPJitterBuffer::Config config;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 50; ++i) {
+        auto lateness = (i % 2) ? std::chrono::milliseconds(15) : std::chrono::milliseconds(0);
+        writeSamples(PACKET_DURATION, start + i * PACKET_DURATION + lateness);
+
+        AttachmentReader::ReadStatus status;
+        readSamples(PACKET_DURATION, &status);
+    }
+
+    auto statistics = m_jitterBuffer->getStatistics();
+    EXPECT_GT(statistics.jitter.count(), 0);
+    EXPECT_GT(statistics.targetLatency, config.minTargetLatency);
+    EXPECT_LE(statistics.targetLatency, config.maxTargetLatency);
+}
+
+/// Test that closing lets the remaining audio drain before reporting @c CLOSED.
+TEST_F(A2DPJitterBufferTest, test_closeAfterDraining) {
+    AttachmentReader::ReadStatus status;
+    writeSamples(std::chrono::milliseconds(10));
+    m_jitterBuffer->close();
+
+    EXPECT_EQ(readSamples(std::chrono::milliseconds(20), &status).size(), 10 * SAMPLES_PER_MS);
+    EXPECT_TRUE(readSamples(std::chrono::milliseconds(20), &status).empty());
+    EXPECT_EQ(status, AttachmentReader::ReadStatus::CLOSED);
+
+    writeSamples(std::chrono::milliseconds(10));
+    EXPECT_EQ(m_jitterBuffer->getNumUnreadBytes(), 0u);
+}
+
+}  // namespace test
+}  // namespace acsdkBluetooth
+}  // namespace alexaClientSDK
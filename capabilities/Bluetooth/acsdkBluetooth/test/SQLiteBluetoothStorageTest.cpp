@@ -808,6 +808,91 @@ TEST_P(SQLiteBluetoothStorageParameterizedTests, test_removeNonExistingSucceeds)
     ASSERT_THAT(rows.size(), Eq(0U));
 }
 
+/// Test insertByMacBatch inserts every row in order.
+TEST_P(SQLiteBluetoothStorageParameterizedTests, test_insertByMacBatchSucceeds) {
+    ASSERT_TRUE(setupDatabase(GetParam()));
+    const std::unordered_map<std::string, std::string> expected{{TEST_MAC, TEST_UUID}, {TEST_MAC_2, TEST_UUID_2}};
+
+    ASSERT_TRUE(m_db->insertByMacBatch({{TEST_MAC, TEST_UUID}, {TEST_MAC_2, TEST_UUID_2}}, false));
+
+    std::unordered_map<std::string, std::string> rows;
+    ASSERT_TRUE(m_db->getMacToUuid(&rows));
+    ASSERT_THAT(rows, Eq(expected));
+
+    std::list<std::string> macs;
+    ASSERT_TRUE(m_db->getOrderedMac(true, &macs));
+    ASSERT_THAT(macs, Eq(std::list<std::string>{TEST_MAC, TEST_MAC_2}));
+}
+
+/// Test insertByMacBatch leaves the database unchanged if one of the rows cannot be inserted.
+TEST_P(SQLiteBluetoothStorageParameterizedTests, test_insertByMacBatchDuplicateRollsBack) {
+    ASSERT_TRUE(setupDatabase(GetParam()));
+    const std::unordered_map<std::string, std::string> expected{{TEST_MAC, TEST_UUID}};
+
+    ASSERT_TRUE(m_db->insertByMac(TEST_MAC, TEST_UUID));
+    ASSERT_FALSE(m_db->insertByMacBatch({{TEST_MAC_2, TEST_UUID_2}, {TEST_MAC, TEST_UUID}}, false));
+
+    std::unordered_map<std::string, std::string> rows;
+    ASSERT_TRUE(m_db->getMacToUuid(&rows));
+    ASSERT_THAT(rows, Eq(expected));
+
+    std::string uuid;
+    ASSERT_FALSE(m_db->getUuid(TEST_MAC_2, &uuid));
+}
+
+/// Test updateByCategoryBatch updates every row, and fails as a whole if a UUID is not found.
+TEST_P(SQLiteBluetoothStorageParameterizedTests, updateByCategoryBatchSucceeds) {
+    ASSERT_TRUE(setupDatabase(GetParam()));
+    ASSERT_TRUE(m_db->insertByMacBatch({{TEST_MAC, TEST_UUID}, {TEST_MAC_2, TEST_UUID_2}}, false));
+
+    ASSERT_TRUE(m_db->updateByCategoryBatch({{TEST_UUID, TEST_PHONE}, {TEST_UUID_2, TEST_OTHER}}));
+    ASSERT_FALSE(m_db->updateByCategoryBatch({{TEST_UUID, TEST_UNKNOWN}, {TEST_UNKNOWN, TEST_UNKNOWN}}));
+
+    const std::unordered_map<std::string, std::string> expected{{TEST_UUID, TEST_PHONE}, {TEST_UUID_2, TEST_OTHER}};
+    std::unordered_map<std::string, std::string> rows;
+    ASSERT_TRUE(m_db->getUuidToCategory(&rows));
+    ASSERT_THAT(rows, Eq(expected));
+}
+
+/// Test the rows served after overwrites and removals match the rows read back from the database file.
+TEST_P(SQLiteBluetoothStorageParameterizedTests, test_readsMatchDatabaseAfterReopen) {
+    ASSERT_TRUE(setupDatabase(GetParam()));
+    ASSERT_TRUE(m_db->insertByMacBatch({{TEST_MAC, TEST_UUID}, {TEST_MAC_2, TEST_UUID_2}}, false));
+    ASSERT_TRUE(m_db->updateByCategory(TEST_UUID, TEST_PHONE));
+    // Overwriting moves the row to the end, and drops the row which had the same UUID.
+    ASSERT_TRUE(m_db->insertByMac(TEST_MAC_2, TEST_UUID));
+    ASSERT_TRUE(m_db->insertByMac(TEST_MAC, TEST_UUID_2));
+    ASSERT_TRUE(m_db->remove(TEST_UNKNOWN));
+
+    std::unordered_map<std::string, std::string> macToUuid;
+    std::unordered_map<std::string, std::string> uuidToCategory;
+    std::list<std::string> macs;
+    ASSERT_TRUE(m_db->getMacToUuid(&macToUuid));
+    ASSERT_TRUE(m_db->getUuidToCategory(&uuidToCategory));
+    ASSERT_TRUE(m_db->getOrderedMac(false, &macs));
+
+    m_db->close();
+    ASSERT_TRUE(m_db->open());
+
+    std::unordered_map<std::string, std::string> reopenedMacToUuid;
+    std::unordered_map<std::string, std::string> reopenedUuidToCategory;
+    std::list<std::string> reopenedMacs;
+    ASSERT_TRUE(m_db->getMacToUuid(&reopenedMacToUuid));
+    ASSERT_TRUE(m_db->getUuidToCategory(&reopenedUuidToCategory));
+    ASSERT_TRUE(m_db->getOrderedMac(false, &reopenedMacs));
+
+    const std::unordered_map<std::string, std::string> expectedMacToUuid{
+        {TEST_MAC, TEST_UUID_2}, {TEST_MAC_2, TEST_UUID}};
+    const std::unordered_map<std::string, std::string> expectedUuidToCategory{
+        {TEST_UUID, TEST_PHONE}, {TEST_UUID_2, TEST_UNKNOWN}};
+    ASSERT_THAT(macToUuid, Eq(expectedMacToUuid));
+    ASSERT_THAT(uuidToCategory, Eq(expectedUuidToCategory));
+    ASSERT_THAT(macs, Eq(std::list<std::string>{TEST_MAC, TEST_MAC_2}));
+    ASSERT_THAT(reopenedMacToUuid, Eq(macToUuid));
+    ASSERT_THAT(reopenedUuidToCategory, Eq(uuidToCategory));
+    ASSERT_THAT(reopenedMacs, Eq(macs));
+}
+
 }  // namespace test
 }  // namespace acsdkBluetooth
 }  // namespace alexaClientSDK
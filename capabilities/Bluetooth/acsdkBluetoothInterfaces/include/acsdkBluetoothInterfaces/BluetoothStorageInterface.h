@@ -18,6 +18,9 @@
 
 #include <unordered_map>
 #include <list>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace alexaClientSDK {
 namespace acsdkBluetoothInterfaces {
@@ -132,6 +135,18 @@ public:
      */
     virtual bool insertByMac(const std::string& mac, const std::string& uuid, bool overwrite) = 0;
 
+    /**
+     * Insert into the database several MAC and UUID rows, in order, as @c insertByMac would.
+     *
+     * Implementations should insert the whole batch atomically. The default implementation inserts the rows one at a
+     * time, and stops at the first failure.
+     *
+     * @param macToUuid The MAC address and UUID of each row.
+     * @param overwrite Whether or not to overwrite an existing entry with the same MAC address.
+     * @return A bool indicating success.
+     */
+    virtual bool insertByMacBatch(const std::vector<std::pair<std::string, std::string>>& macToUuid, bool overwrite);
+
     /**
      * Update an existing entry with category given a UUID. If there is no existing entry,
      * the operation should fail.
@@ -142,6 +157,17 @@ public:
      */
     virtual bool updateByCategory(const std::string& uuid, const std::string& category) = 0;
 
+    /**
+     * Update several existing entries with categories, as @c updateByCategory would.
+     *
+     * Implementations should update the whole batch atomically. The default implementation updates the entries one at
+     * a time, and stops at the first failure.
+     *
+     * @param uuidToCategory The category of each UUID.
+     * @return A bool indicating success.
+     */
+    virtual bool updateByCategoryBatch(const std::unordered_map<std::string, std::string>& uuidToCategory);
+
     /**
      * Remove the entry by the MAC address. The operation is considered successful if the entry
      * no longer exists after this call, including the case where the entry did not exist prior.
@@ -152,6 +178,27 @@ public:
     virtual bool remove(const std::string& mac) = 0;
 };
 
+inline bool BluetoothStorageInterface::insertByMacBatch(
+    const std::vector<std::pair<std::string, std::string>>& macToUuid,
+    bool overwrite) {
+    for (const auto& entry : macToUuid) {
+        if (!insertByMac(entry.first, entry.second, overwrite)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool BluetoothStorageInterface::updateByCategoryBatch(
+    const std::unordered_map<std::string, std::string>& uuidToCategory) {
+    for (const auto& entry : uuidToCategory) {
+        if (!updateByCategory(entry.first, entry.second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // namespace acsdkBluetoothInterfaces
 }  // namespace alexaClientSDK
 
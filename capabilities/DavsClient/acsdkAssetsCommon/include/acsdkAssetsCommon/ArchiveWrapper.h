@@ -19,6 +19,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <AVSCommon/Utils/FileSystem/FileSystemUtils.h>
 
@@ -29,8 +30,8 @@ namespace acsdkAssets {
 namespace common {
 
 /**
- * Wraps the libarchive library as libarchive is not thread-safe.
- * One one libarchive operation could happen at a given time.
+ * Wraps the libarchive library. A libarchive object must only be used by one thread at a time, but separate objects
+ * can be used concurrently, so archives unpack concurrently as long as they unpack into different folders.
  */
 class ArchiveWrapper {
 public:
@@ -93,8 +94,18 @@ private:
     /// instance of this object
     static std::shared_ptr<ArchiveWrapper> m_instance;
 
-    /// mutex to serialize API calls as libArchive is not thread-safe
+    /**
+     * Get the mutex serializing unpacks into the given folder.
+     * @param destFolder folder to unpack into
+     * @return the mutex for this folder, shared with any unpack into the same folder in progress
+     */
+    std::shared_ptr<std::mutex> getDestinationMutex(const std::string& destFolder);
+
+    /// mutex to protect m_destinationMutexes
     std::mutex m_mutex;
+
+    /// mutexes serializing unpacks into the same folder, kept while an unpack into that folder is in progress
+    std::unordered_map<std::string, std::weak_ptr<std::mutex>> m_destinationMutexes;
 };
 
 }  // namespace common
@@ -76,6 +76,8 @@ public:
      * @param unpack whether unpack is needed during download, size must be specified or download would fail.
      * @param size size of the file to be downloaded, if not specified or set to 0, size check will be skipped. (except
      * when unpack=1)
+     * @param sha256 expected SHA-256 of the downloaded data as a hex string, if not specified the digest is not
+     * verified. The digest is computed while the data is streamed.
      * @return SUCCESS if successfully downloaded
      * Note: if return value is false, the file may be partially written to.
      */
@@ -84,7 +86,8 @@ public:
             const std::string& path,
             const std::weak_ptr<CurlProgressCallbackInterface>& callbackObj,
             bool unpack = false,
-            size_t size = 0);
+            size_t size = 0,
+            const std::string& sha256 = "");
 
     /// Return status for header APIs
     using HeaderResults = avsCommon::utils::error::Result<commonInterfaces::ResultCode, std::string>;
@@ -154,6 +157,7 @@ private:
      * @param downloadUrl the URL to download via GET
      * @param filePath file path for the downloaded file
      * @param size expected size of the file to be downloaded
+     * @param sha256 expected SHA-256 of the file to be downloaded, empty if it should not be verified
      * @param callbackObj object that implements CurlProgressCallbackInterface
      * @return SUCCESS if the data transfer completed successfully
      * Note: if return value is false, the stream may be partially written to.
@@ -162,6 +166,7 @@ private:
             const std::string& downloadUrl,
             const std::string& filePath,
             size_t size,
+            const std::string& sha256,
             const std::weak_ptr<CurlProgressCallbackInterface>& callbackObj);
 
     /**
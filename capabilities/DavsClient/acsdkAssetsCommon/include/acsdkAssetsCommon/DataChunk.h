@@ -23,7 +23,8 @@ namespace acsdkAssets {
 namespace common {
 
 /**
- * Represent a binary data chunk
+ * Represent a binary data chunk. The buffer backing a chunk can be refilled with @c assign, so that a chunk can be
+ * recycled rather than allocating a new buffer for every piece of downloaded data.
  */
 class DataChunk {
 public:
@@ -34,16 +35,39 @@ public:
      */
     DataChunk(char* data, size_t size);
 
+    /**
+     * Constructor to an empty DataChunk object with a preallocated buffer
+     * @param capacity number of bytes to preallocate
+     */
+    explicit DataChunk(size_t capacity);
+
     ~DataChunk();
 
+    /// Not copyable, as the chunk owns its buffer
+    DataChunk(const DataChunk&) = delete;
+    DataChunk& operator=(const DataChunk&) = delete;
+
+    /**
+     * Replace the content of the chunk, reusing the current buffer when it is large enough
+     * @param data binary data to copy from
+     * @param size number of bytes
+     * @return false if data is null or size is 0, in which case the chunk is left empty
+     */
+    bool assign(const char* data, size_t size);
+
     /// number of bytes in the data chunk
     size_t size() const;
 
+    /// number of bytes the data chunk can hold without reallocating
+    size_t capacity() const;
+
     char* data() const;
 
 private:
     // number of bytes in the data chunk
     size_t m_size;
+    /// number of bytes allocated for m_data
+    size_t m_capacity;
     /// pointer to the binary data
     char* m_data;
 };
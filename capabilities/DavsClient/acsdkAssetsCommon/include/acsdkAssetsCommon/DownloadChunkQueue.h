@@ -20,8 +20,11 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
+#include <vector>
 
 #include "DataChunk.h"
+#include "Sha256Digest.h"
 
 namespace alexaClientSDK {
 namespace acsdkAssets {
@@ -38,12 +41,22 @@ enum class StreamingStatus { INPROGRESS, COMPLETED, ABORTED };
  */
 class DownloadChunkQueue {
 public:
+    /// Default maximum number of chunks waiting to be consumed. Each chunk is usually up to 16k.
+    static constexpr size_t DEFAULT_MAX_QUEUED_CHUNKS = 100;
+
     /**
      * Constructing a new queue to hold downloaded data chunks
      * @param expectedSize expected download size. Pushing more or less data before completion signals error
      *                     unless the user has signaled no size check with the expected size of 0.
+     * @param expectedSha256 OPTIONAL, expected SHA-256 of the download as a hex string. When set, the digest is
+     *                       computed as data is pushed and a mismatch on completion signals error.
+     * @param maxQueuedChunks OPTIONAL, maximum number of chunks waiting to be consumed. Once reached, push blocks
+     *                        until the consumer catches up.
      */
-    explicit DownloadChunkQueue(size_t expectedSize);
+    explicit DownloadChunkQueue(
+            size_t expectedSize,
+            const std::string& expectedSha256 = "",
+            size_t maxQueuedChunks = DEFAULT_MAX_QUEUED_CHUNKS);
 
     virtual ~DownloadChunkQueue();
 
@@ -54,10 +67,12 @@ public:
     size_t size();
 
     /**
-     * Producer pushes new data chunk into download queue
+     * Producer pushes new data chunk into download queue. The data is copied into a recycled chunk when one is
+     * available. If the queue is full, this blocks until the consumer pops a chunk or stops unpacking.
      * @param data pointer for data chunk
      * @param size number of bytes in the data chunk
-     * @return true when successful, false for invalid argument or if accumulated size exceeds expectedSize
+     * @return true when successful, false for invalid argument, if accumulated size exceeds expectedSize, or if the
+     * consumer stalled for too long
      */
     bool push(char* data, size_t size);
 
@@ -70,6 +85,7 @@ public:
 
     /**
      * Blocking wait and get the next data chunk from queue.
+     * The chunk returned by the previous call is recycled if the caller no longer holds it.
      * @return next data chunk from the front of the queue, or nullptr if error has been detected or no more data.
      * The last waitAndPop should be followed by popComplte()
      */
@@ -91,6 +107,20 @@ private:
         return m_expectedSize > 0;
     }
 
+    /**
+     * Get an empty chunk to hold the next pushed data, reusing a recycled chunk if possible.
+     * Must be called with m_mutex held.
+     * @param size number of bytes the chunk is about to hold
+     * @return an empty data chunk
+     */
+    std::shared_ptr<DataChunk> acquireChunkLocked(size_t size);
+
+    /**
+     * Keep a chunk for reuse if nobody else holds it. Must be called with m_mutex held.
+     * @param chunk the chunk to recycle
+     */
+    void recycleChunkLocked(std::shared_ptr<DataChunk> chunk);
+
 private:
     /// condition variable to signal blocking pop function new chunks available
     std::condition_variable m_cond;
@@ -104,6 +134,18 @@ private:
     /// expected file size for the artifact to be downloaded
     size_t m_expectedSize;
 
+    /// expected SHA-256 of the artifact to be downloaded, empty if not verified
+    const std::string m_expectedSha256;
+
+    /// digest of the data pushed so far, null if not verified
+    std::unique_ptr<Sha256Digest> m_digest;
+
+    /// maximum number of chunks waiting in m_queue
+    const size_t m_maxQueuedChunks;
+
+    /// consumed chunks kept to hold future pushed data
+    std::vector<std::shared_ptr<DataChunk>> m_freeChunks;
+
     /// size downloaded so far (pushed into queue)
     size_t m_downloadedSize;
 
@@ -21,6 +21,8 @@
 #include <mutex>
 #include <string>
 
+#include "Sha256Digest.h"
+
 namespace alexaClientSDK {
 namespace acsdkAssets {
 namespace common {
@@ -35,9 +37,13 @@ public:
      * Create download file object with expected size
      * @param path file path to write to
      * @param expectedSize expected download file size
+     * @param expectedSha256 OPTIONAL, expected SHA-256 of the file as a hex string, computed as data is written
      * @return downloadStream object or null if file path invalid
      */
-    static std::shared_ptr<DownloadStream> create(const std::string& path, size_t expectedSize);
+    static std::shared_ptr<DownloadStream> create(
+            const std::string& path,
+            size_t expectedSize,
+            const std::string& expectedSha256 = "");
 
     virtual ~DownloadStream();
 
@@ -49,15 +55,21 @@ public:
      */
     bool write(const char* data, size_t size);
 
-    bool downloadSucceeded() const;
+    /**
+     * Whether the whole file has been written, with the expected size and SHA-256 if those were specified.
+     * The SHA-256 is only verified on the first call, which must happen after the last write.
+     * @return true if the download succeeded
+     */
+    bool downloadSucceeded();
 
 private:
     /**
      * Constructing a new object to hold download outputstream and its expected size
      * @param @outputStream ostream object where downloaded data will be written into
      * @param expectedSize expected download size.
+     * @param expectedSha256 expected SHA-256 of the download, empty if not verified.
      */
-    explicit DownloadStream(const std::string& path, size_t expectedSize);
+    DownloadStream(const std::string& path, size_t expectedSize, const std::string& expectedSha256);
 
     /**
      * Whether the previous stream operation is good (no error)
@@ -76,6 +88,15 @@ private:
 
     /// size downloaded so far
     size_t m_downloadedSize;
+
+    /// expected SHA-256 of the artifact to be downloaded, empty if not verified
+    const std::string m_expectedSha256;
+
+    /// digest of the data written so far, null if not verified or once verified
+    std::unique_ptr<Sha256Digest> m_digest;
+
+    /// whether the SHA-256 did not match the expected one
+    bool m_digestMismatch;
 };
 
 }  // namespace common
@@ -0,0 +1,76 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKASSETSCOMMON_SHA256DIGEST_H_
+#define ACSDKASSETSCOMMON_SHA256DIGEST_H_
+
+#include <cstddef>
+#include <string>
+
+struct evp_md_ctx_st;
+
+namespace alexaClientSDK {
+namespace acsdkAssets {
+namespace common {
+
+/**
+ * Computes a SHA-256 digest incrementally, so that downloaded data can be verified as it streams in rather than by
+ * reading the artifact back once it is on disk.
+ */
+class Sha256Digest {
+public:
+    Sha256Digest();
+
+    ~Sha256Digest();
+
+    /// Not copyable, as the digest owns its OpenSSL context
+    Sha256Digest(const Sha256Digest&) = delete;
+    Sha256Digest& operator=(const Sha256Digest&) = delete;
+
+    /**
+     * Add data to the digest
+     * @param data pointer to the data to add
+     * @param size number of bytes to add
+     * @return false if the digest is no longer usable, either after an error or after @c finish
+     */
+    bool update(const char* data, size_t size);
+
+    /**
+     * Complete the digest. No more data can be added afterwards.
+     * @return the digest as a lowercase hex string, or an empty string if an error occurred
+     */
+    std::string finish();
+
+    /**
+     * Compare a finished digest with an expected value
+     * @param expected expected digest as a hex string, in any case
+     * @param actual digest returned by @c finish
+     * @return true if both digests are equal and not empty
+     */
+    static bool matches(const std::string& expected, const std::string& actual);
+
+private:
+    /// OpenSSL digest context, null if it could not be initialized
+    struct evp_md_ctx_st* m_context;
+
+    /// whether data can still be added to the digest
+    bool m_good;
+};
+
+}  // namespace common
+}  // namespace acsdkAssets
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKASSETSCOMMON_SHA256DIGEST_H_
@@ -197,7 +197,8 @@ bool ArchiveWrapper::unpack(
         const string& destFolder,
         const filesystem::Permissions directoryPermission,
         const filesystem::Permissions filePermission) {
-    unique_lock<mutex> lock(m_mutex);
+    auto destinationMutex = getDestinationMutex(destFolder);
+    unique_lock<mutex> lock(*destinationMutex);
     ACSDK_INFO(LX("unpack").m("start unpacking").d("source", fileName).d("destination", destFolder));
 
     auto readArchive = unique_ptr<archive, decltype(&archive_read_free)>(archive_read_new(), archive_read_free);
@@ -229,10 +230,30 @@ bool ArchiveWrapper::unpack(
         return false;
     }
 
-    unique_lock<mutex> lock(m_mutex);
+    auto destinationMutex = getDestinationMutex(destFolder);
+    unique_lock<mutex> lock(*destinationMutex);
     return unpackLocked(reader, writer, destFolder, directoryPermission, filePermission);
 }
 
+shared_ptr<mutex> ArchiveWrapper::getDestinationMutex(const string& destFolder) {
+    lock_guard<mutex> lock(m_mutex);
+    for (auto it = m_destinationMutexes.begin(); it != m_destinationMutexes.end();) {
+        if (it->second.expired()) {
+            it = m_destinationMutexes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto& weakMutex = m_destinationMutexes[destFolder];
+    auto destinationMutex = weakMutex.lock();
+    if (destinationMutex == nullptr) {
+        destinationMutex = make_shared<mutex>();
+        weakMutex = destinationMutex;
+    }
+    return destinationMutex;
+}
+
 }  // namespace common
 }  // namespace acsdkAssets
 }  // namespace alexaClientSDK
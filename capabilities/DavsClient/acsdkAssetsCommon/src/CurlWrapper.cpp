@@ -49,9 +49,6 @@ static const long HTTP_SERVER_ERROR = 500;
 
 static const curl_off_t THROTTLED_SPEED_KB = 256 * 1024 / 8;  // 256 Kbits;
 
-/// Number of data chunks in download (buffering) queue before we attempt to slow down download
-static const size_t DOWNLOAD_QUEUE_SIZE_THRESHOLD = 50;
-
 /// String to identify log entries originating from this file.
 static const std::string TAG{"CurlWrapper"};
 
@@ -351,8 +348,9 @@ ResultCode CurlWrapper::streamToFile(
         const std::string& fullUrl,
         const std::string& path,
         size_t size,
+        const std::string& sha256,
         const weak_ptr<CurlProgressCallbackInterface>&) {
-    auto downloadStream = DownloadStream::create(path, size);
+    auto downloadStream = DownloadStream::create(path, size, sha256);
     if (downloadStream == nullptr) {
         ACSDK_ERROR(LX("streamToFile").m("fileStream is evil").d("path", path.c_str()));
         s_metrics().addCounter("evilFileStream");
@@ -414,24 +412,8 @@ ResultCode CurlWrapper::streamToQueue(
         if (queuePtr == nullptr) {
             return 0;
         }
-        auto numBytes = size * nmemb;
-        if (queuePtr->push(ptr, numBytes)) {
-            auto queueSize = queuePtr->size();
-            if (queueSize > DOWNLOAD_QUEUE_SIZE_THRESHOLD * 2) {
-                ACSDK_ERROR(LX("curlWriteCallback").m("QueueSize too big, abort download.").d("QueueSize", queueSize));
-                s_metrics().addCounter("UnpackingStalled");
-                return 0;
-            } else if (queueSize > DOWNLOAD_QUEUE_SIZE_THRESHOLD) {
-                // usually download speed is slower than unpack speed, when this is no longer the case,
-                // we slow down the download so as not to increase RAM consumption unnecessarily.
-                // Each dataChunk is up to 16k.
-                ACSDK_INFO(LX("curlWriteCallback").m("Slowing down download").d("queue size", queueSize));
-                this_thread::sleep_for(milliseconds(10) * queueSize);
-            }
-            return nmemb;
-        } else {
-            return 0;
-        }
+        // push blocks while the queue is full, which holds the download back until unpacking catches up
+        return queuePtr->push(ptr, size * nmemb) ? nmemb : 0;
     };
 
     if ((m_code = curl_easy_setopt(m_handle, CURLOPT_WRITEDATA, downloadChunkQueue.get()))) {
@@ -582,7 +564,8 @@ ResultCode CurlWrapper::download(
         const std::string& path,
         const weak_ptr<CurlProgressCallbackInterface>& callbackObj,
         bool unpack,
-        size_t size) {
+        size_t size,
+        const std::string& sha256) {
     ACSDK_INFO(LX("download")
                        .sensitive("URL for download", url.c_str())
                        .d("Local path to download", path.c_str())
@@ -621,14 +604,12 @@ ResultCode CurlWrapper::download(
     }
 
     if (!unpack) {
-        return streamToFile(url, path, size, callbackObj);
+        return streamToFile(url, path, size, sha256, callbackObj);
     }
 
-    // it seems for now that we can only handle one unpack task at a time, so only allow one download+unpack
-    static mutex s_downloadUnpackMutex;
-    lock_guard<mutex> lock(s_downloadUnpackMutex);
-
-    auto downloadChunkQueue = make_shared<DownloadChunkQueue>(size);
+    // Each download unpacks with its own libarchive objects, so downloads into different paths run concurrently.
+    // ArchiveWrapper serializes unpacks into the same path.
+    auto downloadChunkQueue = make_shared<DownloadChunkQueue>(size, sha256);
 
     // Download to queue in separate thread (producer)
     // Before streamToQueue exit, it must call downloadChunkQueue->pushComplete to indicate success or failure
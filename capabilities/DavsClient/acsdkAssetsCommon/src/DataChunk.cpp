@@ -22,14 +22,14 @@ namespace alexaClientSDK {
 namespace acsdkAssets {
 namespace common {
 
-DataChunk::DataChunk(char* data, size_t size) {
-    if (data != nullptr && size > 0) {
-        m_data = static_cast<char*>(operator new(size));
-        memcpy(m_data, data, size);
-        m_size = size;
-    } else {
-        m_data = nullptr;
-        m_size = 0;
+DataChunk::DataChunk(char* data, size_t size) : m_size(0), m_capacity(0), m_data(nullptr) {
+    assign(data, size);
+}
+
+DataChunk::DataChunk(size_t capacity) : m_size(0), m_capacity(0), m_data(nullptr) {
+    if (capacity > 0) {
+        m_data = static_cast<char*>(operator new(capacity));
+        m_capacity = capacity;
     }
 }
 
@@ -38,13 +38,35 @@ DataChunk::~DataChunk() {
         operator delete(m_data);
         m_data = nullptr;
         m_size = 0;
+        m_capacity = 0;
+    }
+}
+
+bool DataChunk::assign(const char* data, size_t size) {
+    m_size = 0;
+    if (data == nullptr || size == 0) {
+        return false;
+    }
+    if (size > m_capacity) {
+        if (m_data != nullptr) {
+            operator delete(m_data);
+        }
+        m_data = static_cast<char*>(operator new(size));
+        m_capacity = size;
     }
+    memcpy(m_data, data, size);
+    m_size = size;
+    return true;
 }
 
 size_t DataChunk::size() const {
     return m_size;
 }
 
+size_t DataChunk::capacity() const {
+    return m_capacity;
+}
+
 char* DataChunk::data() const {
     return m_data;
 }
@@ -15,6 +15,7 @@
 
 #include "acsdkAssetsCommon/DownloadChunkQueue.h"
 
+#include <AVSCommon/Utils/Error/FinallyGuard.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include <algorithm>
@@ -27,11 +28,14 @@ namespace common {
 
 using namespace std;
 using namespace chrono;
+using namespace alexaClientSDK::avsCommon::utils::error;
 
 static const auto s_metrics = AmdMetricsWrapper::creator("DownloadChunkQueue");
 static const auto DOWNLOAD_CHUNK_MAX_WAIT_TIME = seconds(60);
 static const auto DOWNLOAD_REPORT_MINIMAL_BYTES = 100000;
 
+constexpr size_t DownloadChunkQueue::DEFAULT_MAX_QUEUED_CHUNKS;
+
 /// String to identify log entries originating from this file.
 static const std::string TAG{"DownloadChunkQueue"};
 
@@ -42,8 +46,14 @@ static const std::string TAG{"DownloadChunkQueue"};
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-DownloadChunkQueue::DownloadChunkQueue(size_t expectedSize) :
+DownloadChunkQueue::DownloadChunkQueue(
+        size_t expectedSize,
+        const string& expectedSha256,
+        size_t maxQueuedChunks) :
         m_expectedSize(expectedSize),
+        m_expectedSha256(expectedSha256),
+        m_digest(expectedSha256.empty() ? nullptr : new Sha256Digest()),
+        m_maxQueuedChunks(max<size_t>(1, maxQueuedChunks)),
         m_downloadedSize(0),
         m_downloadStatus(StreamingStatus::INPROGRESS),
         m_unpackStatus(StreamingStatus::INPROGRESS),
@@ -52,7 +62,10 @@ DownloadChunkQueue::DownloadChunkQueue(size_t expectedSize) :
         m_reportIncrement(
                 m_expectedSize ? max<size_t>(DOWNLOAD_REPORT_MINIMAL_BYTES, m_expectedSize / 8)
                                : DOWNLOAD_REPORT_MINIMAL_BYTES) {
-    ACSDK_INFO(LX("DownloadChunkQueue").m("Created DownloadChunkQueue").d("expectedSize", expectedSize));
+    ACSDK_INFO(LX("DownloadChunkQueue")
+                       .m("Created DownloadChunkQueue")
+                       .d("expectedSize", expectedSize)
+                       .d("verifySha256", !m_expectedSha256.empty()));
 }
 
 DownloadChunkQueue::~DownloadChunkQueue() {
@@ -60,6 +73,23 @@ DownloadChunkQueue::~DownloadChunkQueue() {
     while (!m_queue.empty()) {
         m_queue.pop();
     }
+    m_freeChunks.clear();
+}
+
+shared_ptr<DataChunk> DownloadChunkQueue::acquireChunkLocked(size_t size) {
+    if (m_freeChunks.empty()) {
+        return make_shared<DataChunk>(size);
+    }
+    auto dataChunk = move(m_freeChunks.back());
+    m_freeChunks.pop_back();
+    return dataChunk;
+}
+
+void DownloadChunkQueue::recycleChunkLocked(shared_ptr<DataChunk> chunk) {
+    // a chunk still referenced elsewhere may still be read, so it can only be reused once we hold the last reference
+    if (chunk != nullptr && chunk.use_count() == 1 && m_freeChunks.size() < m_maxQueuedChunks) {
+        m_freeChunks.push_back(move(chunk));
+    }
 }
 
 bool DownloadChunkQueue::push(char* data, size_t size) {
@@ -68,6 +98,18 @@ bool DownloadChunkQueue::push(char* data, size_t size) {
     {
         unique_lock<mutex> lock(m_mutex);
 
+        // usually download speed is slower than unpack speed, when this is no longer the case, hold the download
+        // back until the consumer catches up so as not to increase RAM consumption unnecessarily.
+        while (m_queue.size() >= m_maxQueuedChunks && m_unpackStatus == StreamingStatus::INPROGRESS &&
+               m_downloadStatus == StreamingStatus::INPROGRESS) {
+            if (m_cond.wait_for(lock, DOWNLOAD_CHUNK_MAX_WAIT_TIME) == cv_status::timeout &&
+                m_queue.size() >= m_maxQueuedChunks) {
+                ACSDK_ERROR(LX("push").m("Queue full for too long, abort download.").d("QueueSize", m_queue.size()));
+                s_metrics().addCounter("UnpackingStalled");
+                m_downloadStatus = StreamingStatus::ABORTED;
+            }
+        }
+
         if (m_unpackStatus != StreamingStatus::INPROGRESS) {
             ACSDK_ERROR(LX("push").m("push failed, unpack no longer in progress").d("Number of bytes", size));
             return false;
@@ -85,9 +127,13 @@ bool DownloadChunkQueue::push(char* data, size_t size) {
                                             .d("Downloaded size", m_downloadedSize)
                                             .d("Expected Size", m_expectedSize));
                         m_downloadStatus = StreamingStatus::ABORTED;
+                    } else if (m_digest != nullptr && !m_digest->update(data, size)) {
+                        ACSDK_ERROR(LX("push").m("Failed to update digest"));
+                        m_downloadStatus = StreamingStatus::ABORTED;
                     } else {
-                        auto dataChunk = make_shared<DataChunk>(data, size);
-                        m_queue.push(dataChunk);
+                        auto dataChunk = acquireChunkLocked(size);
+                        dataChunk->assign(data, size);
+                        m_queue.push(move(dataChunk));
                         auto currentQueueSize = m_queue.size();
                         if (currentQueueSize > m_maxQueueSizeReached) {
                             m_maxQueueSizeReached = currentQueueSize;
@@ -152,7 +198,14 @@ bool DownloadChunkQueue::pushComplete(bool succeeded) {
                                             .d("downoload size", m_downloadedSize)
                                             .d("exepected size", m_expectedSize));
                         m_downloadStatus = StreamingStatus::ABORTED;
+                    } else if (m_digest != nullptr && !Sha256Digest::matches(m_expectedSha256, m_digest->finish())) {
+                        ACSDK_ERROR(LX("pushComplete")
+                                            .m("download SHA-256 mismatch expected SHA-256")
+                                            .d("expected SHA-256", m_expectedSha256));
+                        m_downloadStatus = StreamingStatus::ABORTED;
                     } else {
+                        // the digest has been verified, a repeated pushComplete must not verify it again
+                        m_digest.reset();
                         ACSDK_INFO(LX("pushComplete")
                                            .d("Pushed bytes", m_downloadedSize)
                                            .d("m_maxQueueSizeReached ", m_maxQueueSizeReached));
@@ -173,6 +226,8 @@ bool DownloadChunkQueue::pushComplete(bool succeeded) {
 shared_ptr<DataChunk> DownloadChunkQueue::waitAndPop() {
     shared_ptr<DataChunk> dataChunk;
     unique_lock<mutex> lock(m_mutex);
+    // The previously popped chunk has been fully processed by the consumer by the time it asks for the next one
+    recycleChunkLocked(move(m_activeChunk));
     switch (m_unpackStatus) {
         case StreamingStatus::COMPLETED:
             ACSDK_ERROR(LX("waitAndPop").m("waitAndPop invoked after unpack Completed"));
@@ -211,10 +266,15 @@ shared_ptr<DataChunk> DownloadChunkQueue::waitAndPop() {
     // the data is still valid. When pop is called again, the previous dataChunk has already finished processing
     // by unpack function
     m_activeChunk = dataChunk;
+    lock.unlock();
+    // wake up the producer if it is waiting for room in the queue
+    m_cond.notify_all();
     return dataChunk;
 }
 
 bool DownloadChunkQueue::popComplete(bool succeeded) {
+    // wake up the producer if it is waiting for room in the queue, as there will be no more pops
+    FinallyGuard notifyProducer([this]() { m_cond.notify_all(); });
     unique_lock<mutex> lock(m_mutex);
     switch (m_unpackStatus) {
         case StreamingStatus::ABORTED:
@@ -33,15 +33,21 @@ static const std::string TAG{"DownloadStream"};
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-shared_ptr<DownloadStream> DownloadStream::create(const string& path, size_t expectedSize) {
-    shared_ptr<DownloadStream> downloadStream(new DownloadStream(path, expectedSize));
+shared_ptr<DownloadStream> DownloadStream::create(
+        const string& path,
+        size_t expectedSize,
+        const string& expectedSha256) {
+    shared_ptr<DownloadStream> downloadStream(new DownloadStream(path, expectedSize, expectedSha256));
     return (downloadStream->good()) ? downloadStream : nullptr;
 }
 
-DownloadStream::DownloadStream(const std::string& path, size_t expectedSize) :
+DownloadStream::DownloadStream(const std::string& path, size_t expectedSize, const std::string& expectedSha256) :
         m_ostream(path),
         m_expectedSize(expectedSize),
-        m_downloadedSize(0) {
+        m_downloadedSize(0),
+        m_expectedSha256(expectedSha256),
+        m_digest(expectedSha256.empty() ? nullptr : new Sha256Digest()),
+        m_digestMismatch(false) {
 }
 
 bool DownloadStream::good() const {
@@ -64,6 +70,10 @@ bool DownloadStream::write(const char* data, size_t size) {
         ACSDK_ERROR(LX("write").m("Downloaded size exceeds expected size").d("expected size", m_expectedSize));
         return false;
     }
+    if (m_digest != nullptr && !m_digest->update(data, size)) {
+        ACSDK_ERROR(LX("write").m("Failed to update digest"));
+        return false;
+    }
     m_ostream.write(data, size);
     auto ret = m_ostream.good();
     if (ret) {
@@ -72,7 +82,7 @@ bool DownloadStream::write(const char* data, size_t size) {
     return ret;
 }
 
-bool DownloadStream::downloadSucceeded() const {
+bool DownloadStream::downloadSucceeded() {
     unique_lock<mutex> lock(m_mutex);
     if (m_expectedSize != 0 && m_downloadedSize != m_expectedSize) {
         ACSDK_ERROR(LX("downloadSucceeded")
@@ -81,7 +91,16 @@ bool DownloadStream::downloadSucceeded() const {
                             .d("expected size", m_expectedSize));
         return false;
     }
-    return true;
+    if (m_digest != nullptr) {
+        m_digestMismatch = !Sha256Digest::matches(m_expectedSha256, m_digest->finish());
+        m_digest.reset();
+        if (m_digestMismatch) {
+            ACSDK_ERROR(LX("downloadSucceeded")
+                                .m("Downloaded SHA-256 mismatch expected SHA-256")
+                                .d("expected SHA-256", m_expectedSha256));
+        }
+    }
+    return !m_digestMismatch;
 }
 
 }  // namespace common
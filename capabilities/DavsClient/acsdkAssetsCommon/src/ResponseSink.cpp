@@ -152,8 +152,12 @@ bool ResponseSink::parser(std::shared_ptr<DownloadChunkQueue>& downloadChunkQueu
         parser.feed(dataChunk->data(), dataChunk->size());
         if (parser.hasError()) {
             ACSDK_ERROR(LX("parser").m("Multipart Parser Error").d("error message", parser.getErrorMessage()));
+            // stop the download, which may be waiting for room in the queue
+            downloadChunkQueue->popComplete(false);
             return false;
         }
+        // release the chunk before asking for the next one so that the queue can reuse its buffer
+        dataChunk.reset();
         dataChunk = downloadChunkQueue->waitAndPop();
     }
     if (!downloadChunkQueue->popComplete(true)) {
@@ -0,0 +1,124 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "acsdkAssetsCommon/Sha256Digest.h"
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <openssl/evp.h>
+
+#include <algorithm>
+#include <cctype>
+
+namespace alexaClientSDK {
+namespace acsdkAssets {
+namespace common {
+
+using namespace std;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG{"Sha256Digest"};
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Return value of OpenSSL functions on success
+static constexpr int OPENSSL_OK = 1;
+
+/// OpenSSL version which renamed the digest context create and destroy functions
+#define OPENSSL_VERSION_NUMBER_1_1_0 0x10100000L
+
+Sha256Digest::Sha256Digest() : m_context(nullptr), m_good(false) {
+#if OPENSSL_VERSION_NUMBER >= OPENSSL_VERSION_NUMBER_1_1_0
+    m_context = EVP_MD_CTX_new();
+#else
+    m_context = EVP_MD_CTX_create();
+#endif
+    if (m_context == nullptr) {
+        ACSDK_ERROR(LX("Sha256Digest").m("Failed to create digest context"));
+        return;
+    }
+    m_good = OPENSSL_OK == EVP_DigestInit_ex(m_context, EVP_sha256(), nullptr);
+    if (!m_good) {
+        ACSDK_ERROR(LX("Sha256Digest").m("Failed to initialize digest"));
+    }
+}
+
+Sha256Digest::~Sha256Digest() {
+    if (m_context != nullptr) {
+#if OPENSSL_VERSION_NUMBER >= OPENSSL_VERSION_NUMBER_1_1_0
+        EVP_MD_CTX_free(m_context);
+#else
+        EVP_MD_CTX_destroy(m_context);
+#endif
+        m_context = nullptr;
+    }
+}
+
+bool Sha256Digest::update(const char* data, size_t size) {
+    if (!m_good) {
+        return false;
+    }
+    if (data == nullptr) {
+        ACSDK_ERROR(LX("update").m("Cannot add bytes from nullptr").d("number of bytes", size));
+        m_good = false;
+        return false;
+    }
+    m_good = OPENSSL_OK == EVP_DigestUpdate(m_context, data, size);
+    if (!m_good) {
+        ACSDK_ERROR(LX("update").m("Failed to update digest").d("number of bytes", size));
+    }
+    return m_good;
+}
+
+string Sha256Digest::finish() {
+    if (!m_good) {
+        ACSDK_ERROR(LX("finish").m("Digest is not usable"));
+        return "";
+    }
+    m_good = false;
+
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestSize = 0;
+    if (OPENSSL_OK != EVP_DigestFinal_ex(m_context, digest, &digestSize)) {
+        ACSDK_ERROR(LX("finish").m("Failed to finalize digest"));
+        return "";
+    }
+
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    string hex;
+    hex.reserve(digestSize * 2);
+    for (unsigned int i = 0; i < digestSize; ++i) {
+        hex.push_back(HEX_DIGITS[digest[i] >> 4]);
+        hex.push_back(HEX_DIGITS[digest[i] & 0x0f]);
+    }
+    return hex;
+}
+
+bool Sha256Digest::matches(const string& expected, const string& actual) {
+    if (expected.empty() || expected.size() != actual.size()) {
+        return false;
+    }
+    return equal(expected.begin(), expected.end(), actual.begin(), [](char lhs, char rhs) {
+        return tolower(static_cast<unsigned char>(lhs)) == tolower(static_cast<unsigned char>(rhs));
+    });
+}
+
+}  // namespace common
+}  // namespace acsdkAssets
+}  // namespace alexaClientSDK
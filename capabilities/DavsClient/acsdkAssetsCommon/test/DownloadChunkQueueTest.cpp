@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 
+#include <future>
 #include <memory>
 
 #include "acsdkAssetsCommon/DownloadChunkQueue.h"
@@ -143,4 +144,75 @@ TEST_F(DownloadChunkQueueTest, pushAfterPopAbort) {
     ASSERT_FALSE(queue->popComplete(false));
     ASSERT_FALSE(queue->push(data, 1));
     ASSERT_EQ(1u, queue->size());
-}
\ No newline at end of file
+}
+TEST_F(DownloadChunkQueueTest, pushBlocksWhenFull) {
+    char data[16] = {0};
+    shared_ptr<DownloadChunkQueue> queue(new DownloadChunkQueue(0, "", 2));
+    ASSERT_TRUE(queue->push(data, 1));
+    ASSERT_TRUE(queue->push(data, 1));
+
+    auto pushed = async(launch::async, [&queue, &data]() { return queue->push(data, 1); });
+    ASSERT_EQ(future_status::timeout, pushed.wait_for(chrono::milliseconds(100)));
+    ASSERT_TRUE(nullptr != queue->waitAndPop());
+    ASSERT_TRUE(pushed.get());
+    ASSERT_EQ(2u, queue->size());
+}
+
+TEST_F(DownloadChunkQueueTest, pushUnblocksOnPopAbort) {
+    char data[16] = {0};
+    shared_ptr<DownloadChunkQueue> queue(new DownloadChunkQueue(0, "", 1));
+    ASSERT_TRUE(queue->push(data, 1));
+
+    auto pushed = async(launch::async, [&queue, &data]() { return queue->push(data, 1); });
+    ASSERT_EQ(future_status::timeout, pushed.wait_for(chrono::milliseconds(100)));
+    ASSERT_FALSE(queue->popComplete(false));
+    ASSERT_FALSE(pushed.get());
+}
+
+TEST_F(DownloadChunkQueueTest, chunksAreRecycled) {
+    char data[16] = {0};
+    shared_ptr<DownloadChunkQueue> queue(new DownloadChunkQueue(0));
+    ASSERT_TRUE(queue->push(data, 16));
+    auto buffer = queue->waitAndPop()->data();
+
+    // the popped chunk is released, so the next pop makes it available to the following push
+    ASSERT_TRUE(queue->push(data, 8));
+    ASSERT_TRUE(nullptr != queue->waitAndPop());
+    ASSERT_TRUE(queue->push(data, 4));
+    auto chunk = queue->waitAndPop();
+    ASSERT_EQ(buffer, chunk->data());
+    ASSERT_EQ(4u, chunk->size());
+}
+
+TEST_F(DownloadChunkQueueTest, heldChunksAreNotRecycled) {
+    char data[16] = {0};
+    shared_ptr<DownloadChunkQueue> queue(new DownloadChunkQueue(0));
+    ASSERT_TRUE(queue->push(data, 16));
+    auto held = queue->waitAndPop();
+
+    ASSERT_TRUE(queue->push(data, 8));
+    ASSERT_TRUE(nullptr != queue->waitAndPop());
+    ASSERT_TRUE(queue->push(data, 4));
+    ASSERT_NE(held->data(), queue->waitAndPop()->data());
+    ASSERT_EQ(16u, held->size());
+}
+
+TEST_F(DownloadChunkQueueTest, sha256Match) {
+    char data[16] = {0};
+    shared_ptr<DownloadChunkQueue> queue(
+            new DownloadChunkQueue(8, "af5570f5a1810b7af78caf4bc70a660f0df51e42baf91d4de5b2328de0e83dfc"));
+    ASSERT_TRUE(queue->push(data, 3));
+    ASSERT_TRUE(queue->push(data, 5));
+    ASSERT_TRUE(queue->pushComplete(true));
+    ASSERT_TRUE(queue->pushComplete(true));
+}
+
+TEST_F(DownloadChunkQueueTest, sha256Mismatch) {
+    char data[16] = {1};
+    shared_ptr<DownloadChunkQueue> queue(
+            new DownloadChunkQueue(8, "af5570f5a1810b7af78caf4bc70a660f0df51e42baf91d4de5b2328de0e83dfc"));
+    ASSERT_TRUE(queue->push(data, 3));
+    ASSERT_TRUE(queue->push(data, 5));
+    ASSERT_FALSE(queue->pushComplete(true));
+    ASSERT_EQ(nullptr, queue->waitAndPop());
+}
@@ -81,4 +81,29 @@ TEST_F(DownloadStreamTest, downloadSucceeded) {
     ASSERT_FALSE(downloadStream->downloadSucceeded());
     ASSERT_TRUE(downloadStream->write(tempData, 5));
     ASSERT_TRUE(downloadStream->downloadSucceeded());
-}
\ No newline at end of file
+}
+TEST_F(DownloadStreamTest, sha256Match) {
+    auto tempFile = DOWNLOAD_TEST_DIR + "/temp";
+    auto downloadStream =
+            DownloadStream::create(tempFile, 10, "E4A0A90E5AC07D5435C6F25C4CF7CC565BECB797BB5B83C515BC427EF32A4770");
+    ASSERT_TRUE(nullptr != downloadStream);
+
+    auto tempData = "12345";
+    ASSERT_TRUE(downloadStream->write(tempData, 5));
+    ASSERT_TRUE(downloadStream->write(tempData, 5));
+    ASSERT_TRUE(downloadStream->downloadSucceeded());
+    ASSERT_TRUE(downloadStream->downloadSucceeded());
+}
+
+TEST_F(DownloadStreamTest, sha256Mismatch) {
+    auto tempFile = DOWNLOAD_TEST_DIR + "/temp";
+    auto downloadStream =
+            DownloadStream::create(tempFile, 10, "af5570f5a1810b7af78caf4bc70a660f0df51e42baf91d4de5b2328de0e83dfc");
+    ASSERT_TRUE(nullptr != downloadStream);
+
+    auto tempData = "12345";
+    ASSERT_TRUE(downloadStream->write(tempData, 5));
+    ASSERT_TRUE(downloadStream->write(tempData, 5));
+    ASSERT_FALSE(downloadStream->downloadSucceeded());
+    ASSERT_FALSE(downloadStream->downloadSucceeded());
+}
@@ -39,6 +39,7 @@ public:
      * @param urlExpiry REQUIRED, epoch when the url for the artifact download will expire.
      * @param currentSizeBytes OPTIONAL? TODO: still not sure what this is...
      * @param multipart is the vendable artifact constructed by a multipart response
+     * @param sha256 OPTIONAL, expected SHA-256 of the artifact as a hex string, empty if the download is not verified.
      * @return NULLABLE, a smart pointer to Vendable Artifact if all parameters are valid.
      */
     static std::unique_ptr<VendableArtifact> create(
@@ -49,10 +50,12 @@ public:
             std::string s3Url,
             TimeEpoch urlExpiry,
             size_t currentSizeBytes,
-            bool multipart);
+            bool multipart,
+            std::string sha256 = "");
 
     /**
-     * Creates a Vendable Artifact from JSON string.
+     * Creates a Vendable Artifact from JSON string.  The optional "artifactSha256" member carries the expected
+     * SHA-256 of the artifact; when it is absent the download is not verified.
      *
      * @param request REQUIRED, contains the original request that's parsed by DAVS.
      * @param jsonString REQUIRED, contains the JSON string to parse and read values from.
@@ -100,6 +103,10 @@ public:
         return m_multipart;
     }
 
+    inline const std::string& getSha256() const {
+        return m_sha256;
+    }
+
 private:
     VendableArtifact(
             std::shared_ptr<DavsRequest> request,
@@ -110,7 +117,8 @@ private:
             TimeEpoch urlExpiry,
             size_t currentSizeBytes,
             std::string uuid,
-            bool multipart);
+            bool multipart,
+            std::string sha256);
 
 private:
     const std::shared_ptr<DavsRequest> m_request;
@@ -122,6 +130,7 @@ private:
     const size_t m_currentSizeBytes;
     const std::string m_uuid;
     const bool m_multipart;
+    const std::string m_sha256;
 };
 
 }  // namespace commonInterfaces
@@ -45,7 +45,8 @@ unique_ptr<VendableArtifact> VendableArtifact::create(
         string s3Url,
         TimeEpoch urlExpiry,
         size_t currentSizeBytes,
-        bool multipart) {
+        bool multipart,
+        string sha256) {
     if (request == nullptr) {
         ACSDK_ERROR(LX("create").m("Null request"));
         return nullptr;
@@ -79,7 +80,8 @@ unique_ptr<VendableArtifact> VendableArtifact::create(
             urlExpiry,
             currentSizeBytes,
             move(uuid),
-            multipart));
+            multipart,
+            move(sha256)));
 }
 
 /**
@@ -158,6 +160,9 @@ unique_ptr<VendableArtifact> VendableArtifact::create(
         ACSDK_ERROR(LX("create").m("Failed to parse Artifact Size"));
         return nullptr;
     }
+    // the SHA-256 is optional, the download is not verified without it
+    string sha256;
+    readStringMember(sha256, document, "artifactSha256");
 
     return create(
             move(request),
@@ -167,7 +172,8 @@ unique_ptr<VendableArtifact> VendableArtifact::create(
             s3Url,
             TimeEpoch(chrono::milliseconds(urlExpiry)),
             0,
-            isMultipart);
+            isMultipart,
+            move(sha256));
 }
 
 VendableArtifact::VendableArtifact(
@@ -179,7 +185,8 @@ VendableArtifact::VendableArtifact(
         TimeEpoch urlExpiry,
         size_t currentSizeBytes,
         string uuid,
-        bool multipart) :
+        bool multipart,
+        string sha256) :
         m_request(move(request)),
         m_id(move(id)),
         m_artifactSizeBytes(artifactSizeBytes),
@@ -188,7 +195,8 @@ VendableArtifact::VendableArtifact(
         m_urlExpiry(urlExpiry),
         m_currentSizeBytes(currentSizeBytes),
         m_uuid(move(uuid)),
-        m_multipart(multipart) {
+        m_multipart(multipart),
+        m_sha256(move(sha256)) {
 }
 
 }  // namespace commonInterfaces
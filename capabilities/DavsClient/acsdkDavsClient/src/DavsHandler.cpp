@@ -533,7 +533,12 @@ ResultCode DavsHandler::downloadArtifact(
         filesystem::makeDirectory(path);
     }
     auto downloadResult = wrapper->download(
-            artifact->getS3Url(), path, shared_from_this(), m_unpack, artifact->getArtifactSizeBytes());
+            artifact->getS3Url(),
+            path,
+            shared_from_this(),
+            m_unpack,
+            artifact->getArtifactSizeBytes(),
+            artifact->getSha256());
 
     if (downloadResult != ResultCode::SUCCESS) {
         s_metrics().addCounter(METRIC_PREFIX_ERROR("downloadArtifactFailed"));
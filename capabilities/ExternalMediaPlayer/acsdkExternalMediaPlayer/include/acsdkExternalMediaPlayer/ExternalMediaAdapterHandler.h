@@ -63,9 +63,11 @@ protected:
     /**
      * Constructor
      * @param name The name for this adapter handler
-     * @param externalMediaPlayer The external media player interface
+     * @param reportsAdapterStateChanges Whether the handler calls @c reportAdapterStateChanged for every state change
+     * of its players. The context for such players is built from the last reported state, instead of calling
+     * @c handleGetAdapterState for every context request.
      */
-    ExternalMediaAdapterHandler(const std::string& name);
+    ExternalMediaAdapterHandler(const std::string& name, bool reportsAdapterStateChanges = false);
 
     /**
      * Initialize this ExternalMediaAdapterHandler
@@ -112,6 +114,15 @@ protected:
      */
     bool removeDiscoveredPlayer(const std::string& localPlayerId);
 
+    /**
+     * Reports that the state of a player has changed. Handlers which report state changes must call this whenever the
+     * state returned by @c handleGetAdapterState changes, except for the track offset. It must not be called while
+     * holding a lock that @c handleGetAdapterState acquires.
+     * @param localPlayerId The local player ID
+     * @return true if the state was reported
+     */
+    bool reportAdapterStateChanged(const std::string& localPlayerId);
+
     /// The following functions are to be overriden by implementors
     /// @{
 
@@ -255,6 +266,7 @@ public:
     std::chrono::milliseconds getOffset(const std::string& localPlayerId) override;
     void setExternalMediaPlayer(const std::shared_ptr<acsdkExternalMediaPlayerInterfaces::ExternalMediaPlayerInterface>
                                     externalMediaPlayer) override;
+    bool reportsAdapterStateChanges() override;
     /// @}
 
     /// @name SpeakerManagerObserverInterface Functions
@@ -275,6 +287,15 @@ private:
     /// The current speaker volume
     int8_t m_volume;
 
+    /// Whether this handler reports state changes.
+    const bool m_reportsAdapterStateChanges;
+
+    /// Serializes reading and versioning of reported states, so a newer state always has a higher version.
+    std::mutex m_adapterStateReportMutex;
+
+    /// The version of the last reported state. Versions are shared by all players of this handler.
+    uint64_t m_adapterStateVersion;
+
     /// Serializes generic access. Used for delaying focus state change.
     std::mutex m_mutex;
 
@@ -229,6 +229,10 @@ public:
     virtual void updateDiscoveredPlayers(
         const std::vector<acsdkExternalMediaPlayerInterfaces::DiscoveredPlayerInfo>& addedPlayers,
         const std::unordered_set<std::string>& removedLocalPlayerIds) override;
+    virtual void updateAdapterState(
+        const std::string& localPlayerId,
+        const acsdkExternalMediaPlayerInterfaces::AdapterState& state,
+        uint64_t version) override;
     virtual void addAdapterHandler(
         std::shared_ptr<acsdkExternalMediaPlayerInterfaces::ExternalMediaAdapterHandlerInterface> adapterHandler)
         override;
@@ -289,6 +293,25 @@ private:
         std::shared_ptr<acsdkExternalMediaPlayerInterfaces::ExternalMediaAdapterHandlerInterface> adapterHandler;
     };
 
+    /**
+     * The last state reported by a player whose adapter handler reports state changes, serialized ahead of context
+     * requests. The playback state is split around the track offset, which is queried for every request.
+     */
+    struct ReportedAdapterState {
+        /// The local player ID of the player.
+        std::string localPlayerId;
+        /// The version of the state.
+        uint64_t version;
+        /// The state.
+        acsdkExternalMediaPlayerInterfaces::AdapterState state;
+        /// The session state JSON of the player.
+        std::string sessionStateJson;
+        /// The playback state JSON of the player, up to the track offset value.
+        std::string playbackStatePrefix;
+        /// The playback state JSON of the player, after the track offset value.
+        std::string playbackStateSuffix;
+    };
+
     /**
      * Creates an @c ExternalMediaPlayer. This method contains the shared logic between the new and deprecated public
      * code paths for creating an @c ExternalMediaPlayer.
@@ -371,18 +394,44 @@ private:
     /**
      * This method returns the ExternalMediaPlayer session state registered in the ExternalMediaPlayer namespace.
      *
-     * @param adapterStates The list of adapter states to use when generating the session state
+     * @param adapterStates The list of adapter states, from handlers which do not report state changes, to use in
+     * addition to the reported states when generating the session state
      * @return The session state
      */
-    std::string provideSessionState(std::vector<acsdkExternalMediaPlayerInterfaces::AdapterState> adapterStates);
+    std::string provideSessionState(const std::vector<acsdkExternalMediaPlayerInterfaces::AdapterState>& adapterStates);
 
     /**
      * This method returns the Playback state registered in the Alexa.PlaybackStateReporter state.
      *
-     * @param adapterStates The list of adapter states to use when generating the playback state
+     * @param adapterStates The list of adapter states, from handlers which do not report state changes, to use in
+     * addition to the reported states when generating the playback state
      * @return The playback state
      */
-    std::string providePlaybackState(std::vector<acsdkExternalMediaPlayerInterfaces::AdapterState> adapterStates);
+    std::string providePlaybackState(
+        const std::vector<acsdkExternalMediaPlayerInterfaces::AdapterState>& adapterStates);
+
+    /**
+     * This method stores and serializes a state reported by an adapter handler.
+     *
+     * @param localPlayerId The local player ID of the player whose state has changed
+     * @param state The new state of the player
+     * @param version The version of the state
+     */
+    void executeUpdateAdapterState(
+        const std::string& localPlayerId,
+        const acsdkExternalMediaPlayerInterfaces::AdapterState& state,
+        uint64_t version);
+
+    /**
+     * This method returns the reported states of authorized players, along with the adapter handler of each player.
+     *
+     * @param authorizedAdapters A copy of @c m_authorizedAdapters
+     * @return The reported states
+     */
+    std::vector<std::pair<
+        const ReportedAdapterState*,
+        acsdkExternalMediaPlayerInterfaces::ExternalMediaAdapterHandlerInterface*>>
+    getReportedAdapterStates(const std::unordered_map<std::string, LocalPlayerIdHandler>& authorizedAdapters);
 
     /**
      * This function deserializes a @c Directive's payload into a @c
@@ -600,8 +649,11 @@ private:
     /**
      * Calls observer and provides the supplied changes related to
      * RenderPlayerInfoCards for the active adapter.
+     *
+     * @param adapterStates The list of adapter states from handlers which do not report state changes
      */
-    void notifyRenderPlayerInfoCardsObservers();
+    void notifyRenderPlayerInfoCardsObservers(
+        const std::vector<acsdkExternalMediaPlayerInterfaces::AdapterState>& adapterStates);
 
     /// The EMP Agent String, for server identification
     std::string m_agentString;
@@ -691,6 +743,16 @@ private:
     /// The @c FocusManager used to manage usage of the channel.
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::FocusManagerInterface> m_focusManager;
 
+    /// A map of cloud assigned @c playerId to the last reported state of the player. Only accessed by @c m_executor.
+    std::unordered_map<std::string, ReportedAdapterState> m_reportedAdapterStates;
+
+    /// The last session state built only from reported states, or empty if it is out of date. Only accessed by @c
+    /// m_executor.
+    std::string m_sessionStateJson;
+
+    /// The player in focus when @c m_sessionStateJson was built. Only accessed by @c m_executor.
+    std::string m_sessionStatePlayerInFocus;
+
     /**
      * @c Executor which queues up operations from asynchronous API calls.
      *
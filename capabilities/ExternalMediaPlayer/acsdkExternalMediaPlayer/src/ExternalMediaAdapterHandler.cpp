@@ -42,10 +42,12 @@ static const std::string TAG("ExternalMediaAdapterHandler");
 
 static const uint8_t DEFAULT_SPEAKER_VOLUME = 50;
 
-ExternalMediaAdapterHandler::ExternalMediaAdapterHandler(const std::string& name) :
+ExternalMediaAdapterHandler::ExternalMediaAdapterHandler(const std::string& name, bool reportsAdapterStateChanges) :
         ExternalMediaAdapterHandlerInterface::ExternalMediaAdapterHandlerInterface{name},
         m_muted{false},
-        m_volume{DEFAULT_SPEAKER_VOLUME} {
+        m_volume{DEFAULT_SPEAKER_VOLUME},
+        m_reportsAdapterStateChanges{reportsAdapterStateChanges},
+        m_adapterStateVersion{0} {
 }
 
 bool ExternalMediaAdapterHandler::initializeAdapterHandler(
@@ -78,6 +80,11 @@ std::vector<PlayerInfo> ExternalMediaAdapterHandler::updatePlayerInfo(const std:
 
             // copy the player info into the player info map
             m_playerInfoMap[next.localPlayerId] = next;
+
+            // the player ID may have changed, so the last reported state is out of date
+            if (m_reportsAdapterStateChanges && next.playerSupported) {
+                reportAdapterStateChanged(next.localPlayerId);
+            }
         }
     }
 
@@ -226,6 +233,39 @@ std::chrono::milliseconds ExternalMediaAdapterHandler::getOffset(const std::stri
     return handleGetOffset(localPlayerId);
 }
 
+bool ExternalMediaAdapterHandler::reportsAdapterStateChanges() {
+    return m_reportsAdapterStateChanges;
+}
+
+bool ExternalMediaAdapterHandler::reportAdapterStateChanged(const std::string& localPlayerId) {
+    if (!m_reportsAdapterStateChanges) {
+        ACSDK_ERROR(LX("reportAdapterStateChangedFailed").d("reason", "handler does not report state changes"));
+        return false;
+    }
+
+    if (!validatePlayer(localPlayerId)) {
+        ACSDK_DEBUG5(LX("reportAdapterStateChangedIgnored")
+                         .d("reason", "player is not configured or not authorized")
+                         .d("localPlayerId", localPlayerId));
+        return false;
+    }
+
+    auto externalMediaPlayer = m_externalMediaPlayer.lock();
+    if (externalMediaPlayer == nullptr) {
+        ACSDK_ERROR(LX("reportAdapterStateChangedFailed").d("reason", "unable to retrieve external media player"));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock{m_adapterStateReportMutex};
+    auto state = getAdapterState(localPlayerId);
+    if (state.sessionState.playerId.empty()) {
+        return false;
+    }
+
+    externalMediaPlayer->updateAdapterState(localPlayerId, state, ++m_adapterStateVersion);
+    return true;
+}
+
 void ExternalMediaAdapterHandler::setExternalMediaPlayer(
     const std::shared_ptr<alexaClientSDK::acsdkExternalMediaPlayerInterfaces::ExternalMediaPlayerInterface>
         externalMediaPlayer) {
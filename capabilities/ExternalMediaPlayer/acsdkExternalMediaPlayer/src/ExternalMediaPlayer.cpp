@@ -905,6 +905,7 @@ void ExternalMediaPlayer::handleAuthorizeDiscoveredPlayers(std::shared_ptr<Direc
                 m_authorizedAdapters[authorizedAdapter.first] = authorizedAdapter.second;
             }
         }
+        m_sessionStateJson.clear();
 
         // Update the sender.
         m_authorizedSender->updateAuthorizedPlayers(newAuthorizedAdaptersKeys);
@@ -1533,8 +1534,10 @@ void ExternalMediaPlayer::updateDiscoveredPlayers(
 
             for (const auto& cloudPlayerId : cloudPlayerIdsToRemove) {
                 m_authorizedAdapters.erase(cloudPlayerId);
+                m_reportedAdapterStates.erase(cloudPlayerId);
             }
         }
+        m_sessionStateJson.clear();
 
         // Report any newly added players
         std::vector<acsdkExternalMediaPlayerInterfaces::DiscoveredPlayerInfo> newlyDiscoveredPlayers;
@@ -1625,6 +1628,8 @@ void ExternalMediaPlayer::doShutdown() {
     m_adapterHandlers.clear();
     m_staticAdapters.clear();
     m_authorizedAdapters.clear();
+    m_reportedAdapterStates.clear();
+    m_sessionStateJson.clear();
     m_directiveToHandlerMap.clear();
 
     // Check result too, to catch cases where DirectiveInfo was created locally, without a nullptr result.
@@ -1676,8 +1681,12 @@ void ExternalMediaPlayer::executeProvideState(
     ACSDK_DEBUG(LX("executeProvideState").d("sendToken", sendToken).d("stateRequestToken", stateRequestToken));
     std::string state;
 
+    // Handlers which report state changes are served from their reported states.
     std::vector<AdapterState> adapterStates;
     for (auto adapterHandler : m_adapterHandlers) {
+        if (adapterHandler->reportsAdapterStateChanges()) {
+            continue;
+        }
         auto handlerAdapterStates = adapterHandler->getAdapterStates();
         adapterStates.insert(adapterStates.end(), handlerAdapterStates.begin(), handlerAdapterStates.end());
     }
@@ -1704,46 +1713,204 @@ void ExternalMediaPlayer::executeProvideState(
     }
 }
 
-// adapter handler specific code
-std::string ExternalMediaPlayer::provideSessionState(std::vector<AdapterState> adapterStates) {
-    rapidjson::Document state(rapidjson::kObjectType);
-    rapidjson::Document::AllocatorType& stateAlloc = state.GetAllocator();
+/**
+ * Serializes a JSON value.
+ *
+ * @param value The value to serialize.
+ * @return The JSON string, or an empty string if the value could not be serialized.
+ */
+static std::string serializeJson(const rapidjson::Value& value) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    if (!value.Accept(writer)) {
+        return "";
+    }
+    return buffer.GetString();
+}
 
-    state.AddMember(rapidjson::StringRef(AGENT_KEY), std::string(m_agentString), stateAlloc);
-    state.AddMember(rapidjson::StringRef(SPI_VERSION_KEY), std::string(ExternalMediaPlayer::SPI_VERSION), stateAlloc);
-    state.AddMember(rapidjson::StringRef(PLAYER_IN_FOCUS), m_playerInFocus, stateAlloc);
+/**
+ * Serializes a state object, adding a "players" array made of serialized player objects.
+ *
+ * @param state The state object, without the players.
+ * @param players The serialized player objects.
+ * @return The JSON string, or an empty string if the state could not be serialized.
+ */
+static std::string serializeStateWithPlayers(const rapidjson::Value& state, const std::vector<std::string>& players) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
-    rapidjson::Value players(rapidjson::kArrayType);
+    writer.StartObject();
+    for (const auto& member : state.GetObject()) {
+        writer.Key(member.name.GetString(), member.name.GetStringLength());
+        if (!member.value.Accept(writer)) {
+            return "";
+        }
+    }
+    writer.Key(PLAYERS);
+    writer.StartArray();
+    for (const auto& player : players) {
+        writer.RawValue(player.c_str(), player.length(), rapidjson::kObjectType);
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    return buffer.GetString();
+}
+
+void ExternalMediaPlayer::updateAdapterState(
+    const std::string& localPlayerId,
+    const AdapterState& state,
+    uint64_t version) {
+    ACSDK_DEBUG5(LX(__func__).d("localPlayerId", localPlayerId).d("version", version));
+    m_executor.submit(
+        [this, localPlayerId, state, version]() { executeUpdateAdapterState(localPlayerId, state, version); });
+}
+
+void ExternalMediaPlayer::executeUpdateAdapterState(
+    const std::string& localPlayerId,
+    const AdapterState& state,
+    uint64_t version) {
+    const auto& playerId = state.sessionState.playerId;
+    if (playerId.empty()) {
+        ACSDK_ERROR(LX("updateAdapterStateFailed").d("reason", "emptyPlayerId").d("localPlayerId", localPlayerId));
+        return;
+    }
+
+    auto it = m_reportedAdapterStates.find(playerId);
+    if (it != m_reportedAdapterStates.end() && it->second.localPlayerId == localPlayerId &&
+        it->second.version >= version) {
+        ACSDK_DEBUG5(LX("updateAdapterStateIgnored")
+                         .d("reason", "staleVersion")
+                         .d("version", version)
+                         .d("currentVersion", it->second.version));
+        return;
+    }
+
+    ReportedAdapterState reportedState;
+    reportedState.localPlayerId = localPlayerId;
+    reportedState.version = version;
+    reportedState.state = state;
+
+    rapidjson::Document document(rapidjson::kObjectType);
+    auto& allocator = document.GetAllocator();
+    reportedState.sessionStateJson = serializeJson(buildSessionState(state.sessionState, allocator));
+
+    // Split the playback state around the track offset, so it can be filled in for every request without
+    // serializing the rest of the state again.
+    auto playbackState = buildPlaybackState(state.playbackState, allocator);
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    bool foundOffset = false;
+    writer.StartObject();
+    for (const auto& member : playbackState.GetObject()) {
+        writer.Key(member.name.GetString(), member.name.GetStringLength());
+        member.value.Accept(writer);
+        if (member.name == POSITIONINMS && member.value.IsUint64()) {
+            auto offsetLength = std::to_string(member.value.GetUint64()).length();
+            reportedState.playbackStatePrefix.assign(buffer.GetString(), buffer.GetSize() - offsetLength);
+            buffer.Clear();
+            foundOffset = true;
+        }
+    }
+    writer.EndObject();
+    reportedState.playbackStateSuffix.assign(buffer.GetString(), buffer.GetSize());
+
+    if (reportedState.sessionStateJson.empty() || !foundOffset) {
+        ACSDK_ERROR(LX("updateAdapterStateFailed").d("reason", "serializationFailed").d("playerId", playerId));
+        return;
+    }
 
+    m_reportedAdapterStates[playerId] = std::move(reportedState);
+    m_sessionStateJson.clear();
+}
+
+std::vector<std::pair<const ExternalMediaPlayer::ReportedAdapterState*, ExternalMediaAdapterHandlerInterface*>>
+ExternalMediaPlayer::getReportedAdapterStates(
+    const std::unordered_map<std::string, LocalPlayerIdHandler>& authorizedAdapters) {
+    std::vector<std::pair<const ReportedAdapterState*, ExternalMediaAdapterHandlerInterface*>> reportedStates;
+    if (m_reportedAdapterStates.empty()) {
+        return reportedStates;
+    }
+
+    for (const auto& authorizedAdapter : authorizedAdapters) {
+        const auto& adapterHandler = authorizedAdapter.second.adapterHandler;
+        if (!adapterHandler || !adapterHandler->reportsAdapterStateChanges() ||
+            m_adapterHandlers.find(adapterHandler) == m_adapterHandlers.end()) {
+            continue;
+        }
+        auto it = m_reportedAdapterStates.find(authorizedAdapter.first);
+        if (it != m_reportedAdapterStates.end() && it->second.localPlayerId == authorizedAdapter.second.localPlayerId) {
+            reportedStates.emplace_back(&it->second, adapterHandler.get());
+        }
+    }
+
+    return reportedStates;
+}
+
+// adapter handler specific code
+std::string ExternalMediaPlayer::provideSessionState(const std::vector<AdapterState>& adapterStates) {
     std::unordered_map<std::string, LocalPlayerIdHandler> authorizedAdaptersCopy;
     {
         std::lock_guard<std::mutex> lock(m_authorizedMutex);
         authorizedAdaptersCopy = m_authorizedAdapters;
     }
 
-    for (auto adapterState : adapterStates) {
+    std::string playerInFocus;
+    {
+        std::lock_guard<std::mutex> lock{m_inFocusAdapterMutex};
+        playerInFocus = m_playerInFocus;
+    }
+
+    auto reportedStates = getReportedAdapterStates(authorizedAdaptersCopy);
+    for (const auto& reportedState : reportedStates) {
+        const auto& sessionState = reportedState.first->state.sessionState;
+        ObservableSessionProperties update{sessionState.loggedIn, sessionState.userName};
+        notifyObservers(sessionState.playerId, &update);
+    }
+
+    std::vector<std::string> players;
+    for (const auto& adapterState : adapterStates) {
         if (authorizedAdaptersCopy.find(adapterState.sessionState.playerId) != authorizedAdaptersCopy.end()) {
-            rapidjson::Value playerJson = buildSessionState(adapterState.sessionState, stateAlloc);
-            players.PushBack(playerJson, stateAlloc);
+            rapidjson::Document playerJson(rapidjson::kObjectType);
+            players.push_back(serializeJson(buildSessionState(adapterState.sessionState, playerJson.GetAllocator())));
             ObservableSessionProperties update{adapterState.sessionState.loggedIn, adapterState.sessionState.userName};
             notifyObservers(adapterState.sessionState.playerId, &update);
         }
     }
 
-    state.AddMember(rapidjson::StringRef(PLAYERS), players, stateAlloc);
+    // The state only depends on reported states, which have not changed since it was built.
+    if (players.empty() && !m_sessionStateJson.empty() && m_sessionStatePlayerInFocus == playerInFocus) {
+        return m_sessionStateJson;
+    }
 
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    if (!state.Accept(writer)) {
+    bool onlyReportedStates = players.empty();
+    for (const auto& reportedState : reportedStates) {
+        players.push_back(reportedState.first->sessionStateJson);
+    }
+
+    rapidjson::Document state(rapidjson::kObjectType);
+    rapidjson::Document::AllocatorType& stateAlloc = state.GetAllocator();
+
+    state.AddMember(rapidjson::StringRef(AGENT_KEY), std::string(m_agentString), stateAlloc);
+    state.AddMember(rapidjson::StringRef(SPI_VERSION_KEY), std::string(ExternalMediaPlayer::SPI_VERSION), stateAlloc);
+    state.AddMember(rapidjson::StringRef(PLAYER_IN_FOCUS), playerInFocus, stateAlloc);
+
+    auto stateJson = serializeStateWithPlayers(state, players);
+    if (stateJson.empty()) {
         ACSDK_ERROR(LX(__func__).m("provideSessionStateFailed").d("reason", "writerRefusedJsonObject"));
         return "";
     }
 
-    return buffer.GetString();
+    if (onlyReportedStates) {
+        m_sessionStateJson = stateJson;
+        m_sessionStatePlayerInFocus = playerInFocus;
+    }
+
+    return stateJson;
 }
 
 // adapter handler playback states
-std::string ExternalMediaPlayer::providePlaybackState(std::vector<AdapterState> adapterStates) {
+std::string ExternalMediaPlayer::providePlaybackState(const std::vector<AdapterState>& adapterStates) {
     rapidjson::Document state(rapidjson::kObjectType);
     rapidjson::Document::AllocatorType& stateAlloc = state.GetAllocator();
 
@@ -1754,7 +1921,7 @@ std::string ExternalMediaPlayer::providePlaybackState(std::vector<AdapterState>
 
     // Fetch actual PlaybackState from every player supported by the
     // ExternalMediaPlayer.
-    rapidjson::Value players(rapidjson::kArrayType);
+    std::vector<std::string> players;
 
     std::unordered_map<std::string, LocalPlayerIdHandler> authorizedAdaptersCopy;
     {
@@ -1762,31 +1929,39 @@ std::string ExternalMediaPlayer::providePlaybackState(std::vector<AdapterState>
         authorizedAdaptersCopy = m_authorizedAdapters;
     }
 
+    // reported states only need the current track offset
+    for (const auto& reportedState : getReportedAdapterStates(authorizedAdaptersCopy)) {
+        const auto& playbackState = reportedState.first->state.playbackState;
+        auto offset = reportedState.second->getOffset(reportedState.first->localPlayerId);
+        players.push_back(
+            reportedState.first->playbackStatePrefix + std::to_string(static_cast<uint64_t>(offset.count())) +
+            reportedState.first->playbackStateSuffix);
+        ObservablePlaybackStateProperties update{
+            playbackState.state, playbackState.trackName, playbackState.playRequestor};
+        notifyObservers(reportedState.first->state.sessionState.playerId, &update);
+    }
+
     // adapter handlers
-    for (auto adapterState : adapterStates) {
+    for (const auto& adapterState : adapterStates) {
         if (authorizedAdaptersCopy.find(adapterState.sessionState.playerId) != authorizedAdaptersCopy.end()) {
             const auto& playbackState = adapterState.playbackState;
-            rapidjson::Value playerJson = buildPlaybackState(playbackState, stateAlloc);
-            players.PushBack(playerJson, stateAlloc);
+            rapidjson::Document playerJson(rapidjson::kObjectType);
+            players.push_back(serializeJson(buildPlaybackState(playbackState, playerJson.GetAllocator())));
             ObservablePlaybackStateProperties update{
                 playbackState.state, playbackState.trackName, playbackState.playRequestor};
             notifyObservers(adapterState.sessionState.playerId, &update);
         }
     }
 
-    notifyRenderPlayerInfoCardsObservers();
-
-    state.AddMember(PLAYERS, players, stateAlloc);
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    notifyRenderPlayerInfoCardsObservers(adapterStates);
 
-    if (!state.Accept(writer)) {
+    auto stateJson = serializeStateWithPlayers(state, players);
+    if (stateJson.empty()) {
         ACSDK_ERROR(LX("providePlaybackState").d("reason", "writerRefusedJsonObject"));
         return "";
     }
 
-    return buffer.GetString();
+    return stateJson;
 }
 
 void ExternalMediaPlayer::sendReportDiscoveredPlayersEvent(const std::vector<DiscoveredPlayerInfo>& discoveredPlayers) {
@@ -1907,35 +2082,42 @@ void ExternalMediaPlayer::notifyObservers(
     }
 }
 
-void ExternalMediaPlayer::notifyRenderPlayerInfoCardsObservers() {
+void ExternalMediaPlayer::notifyRenderPlayerInfoCardsObservers(const std::vector<AdapterState>& adapterStates) {
     ACSDK_DEBUG5(LX(__func__));
 
-    for (auto adapterHandler : m_adapterHandlers) {
-        // check against currently known playback state, not already paused
-        auto adapterStates = adapterHandler->getAdapterStates();
-        for (auto adapterState : adapterStates) {
-            if (adapterState.sessionState.playerId.compare(m_playerInFocus) == 0) {  // match playerId
-                std::stringstream ss{adapterState.playbackState.state};
-                alexaClientSDK::avsCommon::avs::PlayerActivity playerActivity =
-                    alexaClientSDK::avsCommon::avs::PlayerActivity::IDLE;
-                ss >> playerActivity;
-                ACSDK_ERROR(LX(__func__).d("playerActivity", adapterState.playbackState.state));
-                if (ss.fail()) {
-                    ACSDK_ERROR(LX(__func__)
-                                    .m("notifyRenderPlayerInfoCardsFailed")
-                                    .d("reason", "invalidState")
-                                    .d("state", adapterState.playbackState.state));
-                    return;
-                }
-                RenderPlayerInfoCardsObserverInterface::Context context;
-                context.audioItemId = adapterState.playbackState.trackId;
-                context.offset = getAudioItemOffset();
-                context.mediaProperties = shared_from_this();
-                {
-                    std::lock_guard<std::mutex> lock{m_observersMutex};
-                    if (m_renderPlayerObserver) {
-                        m_renderPlayerObserver->onRenderPlayerCardsInfoChanged(playerActivity, context);
-                    }
+    // check against currently known playback state, not already paused
+    std::vector<const AdapterState*> currentStates;
+    for (const auto& adapterState : adapterStates) {
+        currentStates.push_back(&adapterState);
+    }
+    auto reportedState = m_reportedAdapterStates.find(m_playerInFocus);
+    if (reportedState != m_reportedAdapterStates.end()) {
+        currentStates.push_back(&reportedState->second.state);
+    }
+
+    for (auto currentState : currentStates) {
+        const auto& adapterState = *currentState;
+        if (adapterState.sessionState.playerId.compare(m_playerInFocus) == 0) {  // match playerId
+            std::stringstream ss{adapterState.playbackState.state};
+            alexaClientSDK::avsCommon::avs::PlayerActivity playerActivity =
+                alexaClientSDK::avsCommon::avs::PlayerActivity::IDLE;
+            ss >> playerActivity;
+            ACSDK_ERROR(LX(__func__).d("playerActivity", adapterState.playbackState.state));
+            if (ss.fail()) {
+                ACSDK_ERROR(LX(__func__)
+                                .m("notifyRenderPlayerInfoCardsFailed")
+                                .d("reason", "invalidState")
+                                .d("state", adapterState.playbackState.state));
+                return;
+            }
+            RenderPlayerInfoCardsObserverInterface::Context context;
+            context.audioItemId = adapterState.playbackState.trackId;
+            context.offset = getAudioItemOffset();
+            context.mediaProperties = shared_from_this();
+            {
+                std::lock_guard<std::mutex> lock{m_observersMutex};
+                if (m_renderPlayerObserver) {
+                    m_renderPlayerObserver->onRenderPlayerCardsInfoChanged(playerActivity, context);
                 }
             }
         }
@@ -1953,6 +2135,7 @@ void ExternalMediaPlayer::addAdapterHandler(std::shared_ptr<ExternalMediaAdapter
             ACSDK_ERROR(LX("addAdapterHandler").d("reason", "duplicateAdapterHandler"));
         } else {
             adapterHandler->setExternalMediaPlayer(shared_from_this());
+            m_sessionStateJson.clear();
         }
     });
 }
@@ -1966,6 +2149,8 @@ void ExternalMediaPlayer::removeAdapterHandler(std::shared_ptr<ExternalMediaAdap
     m_executor.submit([this, adapterHandler]() {
         if (m_adapterHandlers.erase(adapterHandler) == 0) {
             ACSDK_WARN(LX("removeAdapterHandler").d("reason", "adapterHandlerNotFound"));
+        } else {
+            m_sessionStateJson.clear();
         }
     });
 }
@@ -33,6 +33,7 @@ using namespace avsCommon::avs;
 using namespace ::testing;
 
 static const std::string PLAYER_ID = "testPlayerId";
+static const std::string CLOUD_PLAYER_ID = "testCloudPlayerId";
 static const std::string PLAY_CONTEXT_TOKEN = "testContextToken";
 static const std::string SKILL_TOKEN = "testSkillToken";
 static const std::string SESSION_ID = "testSessionId";
@@ -54,6 +55,12 @@ public:
         void(
             const std::vector<acsdkExternalMediaPlayerInterfaces::DiscoveredPlayerInfo>& addedPlayers,
             const std::unordered_set<std::string>& removedPlayers));
+    MOCK_METHOD3(
+        updateAdapterState,
+        void(
+            const std::string& localPlayerId,
+            const acsdkExternalMediaPlayerInterfaces::AdapterState& state,
+            uint64_t version));
     MOCK_METHOD1(
         addAdapterHandler,
         void(std::shared_ptr<acsdkExternalMediaPlayerInterfaces::ExternalMediaAdapterHandlerInterface> adapterHandler));
@@ -104,7 +111,8 @@ public:
     MOCK_METHOD1(handleSetVolume, void(int8_t volume));
     MOCK_METHOD1(handleSetMute, void(bool mute));
     void reportMockPlayers();
-    MockExternalMediaAdapterHandler();
+    using ExternalMediaAdapterHandler::reportAdapterStateChanged;
+    MockExternalMediaAdapterHandler(bool reportsAdapterStateChanges = false);
 };
 
 void MockExternalMediaAdapterHandler::reportMockPlayers() {
@@ -113,7 +121,8 @@ void MockExternalMediaAdapterHandler::reportMockPlayers() {
     reportDiscoveredPlayers({playerInfo});
 };
 
-MockExternalMediaAdapterHandler::MockExternalMediaAdapterHandler() : ExternalMediaAdapterHandler{"mock"} {
+MockExternalMediaAdapterHandler::MockExternalMediaAdapterHandler(bool reportsAdapterStateChanges) :
+        ExternalMediaAdapterHandler{"mock", reportsAdapterStateChanges} {
 }
 
 class ExternalMediaPlayerTest : public ::testing::Test {
@@ -123,6 +132,9 @@ public:
 
     void authorizePlayer();
 
+    /// Replaces the adapter handler with one which reports state changes.
+    void useReportingAdapterHandler();
+
     /// @c ExternalMediaPlayer for testing purposes
     std::shared_ptr<MockExternalMediaPlayer> m_externalMediaPlayer;
 
@@ -144,10 +156,18 @@ void ExternalMediaPlayerTest::TearDown() {
 void ExternalMediaPlayerTest::authorizePlayer() {
     acsdkExternalMediaPlayerInterfaces::PlayerInfo playerInfo;
     playerInfo.localPlayerId = PLAYER_ID;
+    playerInfo.playerId = CLOUD_PLAYER_ID;
     playerInfo.playerSupported = true;
     m_externalMediaPlayerAdapterHandler->updatePlayerInfo({playerInfo});
 }
 
+void ExternalMediaPlayerTest::useReportingAdapterHandler() {
+    m_externalMediaPlayerAdapterHandler->shutdown();
+    m_externalMediaPlayerAdapterHandler = std::make_shared<MockExternalMediaAdapterHandler>(true);
+    m_externalMediaPlayerAdapterHandler->setExternalMediaPlayer(m_externalMediaPlayer);
+    m_externalMediaPlayerAdapterHandler->reportMockPlayers();
+}
+
 /**
  * Test authorization passthrough
  */
@@ -273,6 +293,53 @@ TEST_F(ExternalMediaPlayerTest, testHandleGetAdapterState) {
     m_externalMediaPlayerAdapterHandler->getAdapterState(PLAYER_ID);
 }
 
+/**
+ * Test that a handler which does not report state changes does not push states
+ */
+TEST_F(ExternalMediaPlayerTest, testNoAdapterStateReportsByDefault) {
+    EXPECT_FALSE(m_externalMediaPlayerAdapterHandler->reportsAdapterStateChanges());
+    EXPECT_CALL(*m_externalMediaPlayer, updateAdapterState(_, _, _)).Times(0);
+    authorizePlayer();
+    EXPECT_FALSE(m_externalMediaPlayerAdapterHandler->reportAdapterStateChanged(PLAYER_ID));
+}
+
+/**
+ * Test that a handler which reports state changes pushes the state on authorization and on every change, with
+ * increasing versions
+ */
+TEST_F(ExternalMediaPlayerTest, testReportAdapterStateChanged) {
+    useReportingAdapterHandler();
+    EXPECT_TRUE(m_externalMediaPlayerAdapterHandler->reportsAdapterStateChanges());
+
+    // Players which are not authorized have no state to report.
+    EXPECT_CALL(*m_externalMediaPlayer, updateAdapterState(_, _, _)).Times(0);
+    EXPECT_FALSE(m_externalMediaPlayerAdapterHandler->reportAdapterStateChanged(PLAYER_ID));
+    Mock::VerifyAndClearExpectations(m_externalMediaPlayer.get());
+
+    ON_CALL(*m_externalMediaPlayerAdapterHandler, handleGetAdapterState(PLAYER_ID, _))
+        .WillByDefault(Invoke([](const std::string&, acsdkExternalMediaPlayerInterfaces::AdapterState& state) {
+            state.playbackState.state = "PLAYING";
+            return true;
+        }));
+
+    std::vector<uint64_t> versions;
+    EXPECT_CALL(*m_externalMediaPlayer, updateAdapterState(PLAYER_ID, _, _))
+        .Times(2)
+        .WillRepeatedly(Invoke([&versions](
+                                   const std::string&,
+                                   const acsdkExternalMediaPlayerInterfaces::AdapterState& state,
+                                   uint64_t version) {
+            EXPECT_EQ(state.sessionState.playerId, CLOUD_PLAYER_ID);
+            EXPECT_EQ(state.playbackState.state, "PLAYING");
+            versions.push_back(version);
+        }));
+    authorizePlayer();
+    EXPECT_TRUE(m_externalMediaPlayerAdapterHandler->reportAdapterStateChanged(PLAYER_ID));
+
+    ASSERT_EQ(versions.size(), 2u);
+    EXPECT_LT(versions[0], versions[1]);
+}
+
 /**
  * Test speaker change passthrough
  */
@@ -430,10 +430,12 @@ public:
     MOCK_METHOD2(
         handleGetAdapterState,
         bool(const std::string& localPlayerId, acsdkExternalMediaPlayerInterfaces::AdapterState& state));
+    MOCK_METHOD1(handleGetOffset, std::chrono::milliseconds(const std::string& localPlayerId));
     MOCK_METHOD1(handleSetVolume, void(int8_t volume));
     MOCK_METHOD1(handleSetMute, void(bool mute));
     void reportMockPlayers(const std::string& localPlayerId = MSP2_PLAYER_ID);
-    MockExternalMediaAdapterHandler();
+    using ExternalMediaAdapterHandler::reportAdapterStateChanged;
+    MockExternalMediaAdapterHandler(bool reportsAdapterStateChanges = false);
 };
 
 void MockExternalMediaAdapterHandler::reportMockPlayers(const std::string& localPlayerId) {
@@ -443,7 +445,8 @@ void MockExternalMediaAdapterHandler::reportMockPlayers(const std::string& local
     reportDiscoveredPlayers({playerInfo});
 };
 
-MockExternalMediaAdapterHandler::MockExternalMediaAdapterHandler() : ExternalMediaAdapterHandler{"mock"} {
+MockExternalMediaAdapterHandler::MockExternalMediaAdapterHandler(bool reportsAdapterStateChanges) :
+        ExternalMediaAdapterHandler{"mock", reportsAdapterStateChanges} {
 }
 
 class MockStartupNotifier : public acsdkStartupManagerInterfaces::StartupNotifierInterface {
@@ -2934,6 +2937,102 @@ TEST_F(ExternalMediaPlayerTest, testAddAdapterHandlerDiscoveryAggregatedUntilSta
     ASSERT_TRUE(std::future_status::ready == eventFuture.wait_for(MY_WAIT_TIMEOUT));
 }
 
+/**
+ * Test that the state of players whose handler reports state changes is served from the reported state, with the
+ * current track offset, and without querying the handler for the rest of the state.
+ */
+TEST_F(ExternalMediaPlayerTest, testReportedAdapterStateServedWithoutPolling) {
+    const std::string reportingLocalPlayerId = "reportingLocalPlayerId";
+    const std::string reportingPlayerId = "reportingPlayerId";
+    const std::chrono::milliseconds reportingOffset{1234};
+    std::string trackName = "firstTrack";
+
+    EXPECT_CALL(*(MockExternalMediaPlayerAdapter::m_currentActiveMediaPlayerAdapter), getState())
+        .WillRepeatedly(Return(createAdapterState()));
+
+    auto mockAdapterHandler = std::make_shared<NiceMock<MockExternalMediaAdapterHandler>>(true);
+    mockAdapterHandler->setExternalMediaPlayer(m_externalMediaPlayer);
+    m_externalMediaPlayer->addAdapterHandler(mockAdapterHandler);
+    mockAdapterHandler->reportMockPlayers(reportingLocalPlayerId);
+    ON_CALL(*mockAdapterHandler, handleGetAdapterState(reportingLocalPlayerId, _))
+        .WillByDefault(Invoke([&trackName](const std::string&, AdapterState& state) {
+            state.sessionState.loggedIn = true;
+            state.sessionState.userName = PLAYER_USER_NAME;
+            state.playbackState.state = "PLAYING";
+            state.playbackState.trackName = trackName;
+            return true;
+        }));
+    ON_CALL(*mockAdapterHandler, handleGetOffset(reportingLocalPlayerId)).WillByDefault(Return(reportingOffset));
+
+    // Authorizing the player reports its state.
+    std::promise<void> authorizationCompletePromise;
+    std::future<void> authorizationCompleteFuture = authorizationCompletePromise.get_future();
+    EXPECT_CALL(
+        *m_mockMessageSender, sendMessage(EventNamed(AUTHORIZATION_COMPLETE.nameSpace, AUTHORIZATION_COMPLETE.name)))
+        .WillOnce(InvokeWithoutArgs([&authorizationCompletePromise]() { authorizationCompletePromise.set_value(); }));
+    EXPECT_CALL(*mockAdapterHandler, handleGetAdapterState(reportingLocalPlayerId, _)).Times(1);
+    const std::string playersJson = createPlayerJson(reportingLocalPlayerId, true, reportingPlayerId, MSP1_SKILLTOKEN);
+    sendAuthorizeDiscoveredPlayersDirective(createAuthorizeDiscoveredPlayersPayload({playersJson}));
+    ASSERT_TRUE(std::future_status::ready == authorizationCompleteFuture.wait_for(MY_WAIT_TIMEOUT));
+
+    auto provideState = [this](const NamespaceAndName& stateProviderName) {
+        std::promise<std::string> statePromise;
+        std::future<std::string> stateFuture = statePromise.get_future();
+        EXPECT_CALL(*m_mockContextManager, setState(stateProviderName, _, _, PROVIDE_STATE_TOKEN_TEST))
+            .WillOnce(Invoke([&statePromise](
+                                 const avs::NamespaceAndName& namespaceAndName,
+                                 const std::string& jsonState,
+                                 const avs::StateRefreshPolicy& refreshPolicy,
+                                 const unsigned int stateRequestToken) {
+                statePromise.set_value(jsonState);
+                return SetStateResult::SUCCESS;
+            }));
+        m_externalMediaPlayer->provideState(stateProviderName, PROVIDE_STATE_TOKEN_TEST);
+        EXPECT_TRUE(std::future_status::ready == stateFuture.wait_for(MY_WAIT_TIMEOUT));
+        auto document = std::make_shared<rapidjson::Document>();
+        document->Parse(stateFuture.get());
+        return document;
+    };
+
+    auto findPlayer = [&reportingPlayerId](const rapidjson::Document& document) -> const rapidjson::Value* {
+        if (!document.IsObject() || !document.HasMember("players")) {
+            return nullptr;
+        }
+        for (const auto& player : document["players"].GetArray()) {
+            if (player.HasMember("playerId") && player["playerId"] == reportingPlayerId.c_str()) {
+                return &player;
+            }
+        }
+        return nullptr;
+    };
+
+    // Both states come from the reported state.
+    auto sessionState = provideState(SESSION_STATE);
+    auto sessionPlayer = findPlayer(*sessionState);
+    ASSERT_NE(sessionPlayer, nullptr);
+    EXPECT_TRUE((*sessionPlayer)["loggedIn"].GetBool());
+    EXPECT_EQ(std::string((*sessionPlayer)["username"].GetString()), PLAYER_USER_NAME);
+
+    auto playbackState = provideState(PLAYBACK_STATE);
+    auto playbackPlayer = findPlayer(*playbackState);
+    ASSERT_NE(playbackPlayer, nullptr);
+    EXPECT_EQ(std::string((*playbackPlayer)["state"].GetString()), "PLAYING");
+    EXPECT_EQ((*playbackPlayer)["positionMilliseconds"].GetUint64(), static_cast<uint64_t>(reportingOffset.count()));
+    EXPECT_EQ(std::string((*playbackPlayer)["media"]["value"]["trackName"].GetString()), trackName);
+    Mock::VerifyAndClearExpectations(mockAdapterHandler.get());
+
+    // A reported change is picked up by the next request.
+    trackName = "secondTrack";
+    EXPECT_CALL(*mockAdapterHandler, handleGetAdapterState(reportingLocalPlayerId, _)).Times(1);
+    EXPECT_TRUE(mockAdapterHandler->reportAdapterStateChanged(reportingLocalPlayerId));
+    playbackState = provideState(PLAYBACK_STATE);
+    playbackPlayer = findPlayer(*playbackState);
+    ASSERT_NE(playbackPlayer, nullptr);
+    EXPECT_EQ(std::string((*playbackPlayer)["media"]["value"]["trackName"].GetString()), trackName);
+
+    mockAdapterHandler->shutdown();
+}
+
 }  // namespace test
 }  // namespace acsdkExternalMediaPlayer
 }  // namespace alexaClientSDK
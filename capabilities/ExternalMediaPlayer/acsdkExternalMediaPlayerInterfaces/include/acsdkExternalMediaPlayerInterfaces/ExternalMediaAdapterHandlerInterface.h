@@ -242,12 +242,26 @@ public:
      * @param externalMediaPlayer Pointer to the external media player
      */
     virtual void setExternalMediaPlayer(const std::shared_ptr<ExternalMediaPlayerInterface> externalMediaPlayer) = 0;
+
+    /**
+     * Method to query whether this handler reports every state change of its players with
+     * @c ExternalMediaPlayerInterface::updateAdapterState. The context of such players is built from the states they
+     * last reported, and @c getAdapterStates is not called for context requests. Only the track offset is queried
+     * for every request, with @c getOffset.
+     *
+     * @return Whether this handler reports state changes.
+     */
+    virtual bool reportsAdapterStateChanges();
 };
 
 inline ExternalMediaAdapterHandlerInterface::ExternalMediaAdapterHandlerInterface(const std::string& name) :
         alexaClientSDK::avsCommon::utils::RequiresShutdown{name} {
 }
 
+inline bool ExternalMediaAdapterHandlerInterface::reportsAdapterStateChanges() {
+    return false;
+}
+
 }  // namespace acsdkExternalMediaPlayerInterfaces
 }  // namespace alexaClientSDK
 
@@ -64,6 +64,21 @@ public:
         const std::vector<DiscoveredPlayerInfo>& addedPlayers,
         const std::unordered_set<std::string>& removedLocalPlayerIds) = 0;
 
+    /**
+     * Method used by adapter handlers which report state changes to notify that the state of a player has changed.
+     * States are versioned, and a state whose version is not greater than the version of the last state reported for
+     * the same player is ignored.
+     *
+     * The default implementation ignores the state, so implementations which do not cache adapter states need not
+     * override it.
+     *
+     * @param localPlayerId The local player ID of the player whose state has changed
+     * @param state The new state of the player
+     * @param version The version of the state
+     */
+    virtual void updateAdapterState(const std::string& localPlayerId, const AdapterState& state, uint64_t version) {
+    }
+
     /**
      * Adds a new @name ExternalMediaAdapterHandlerInterface to the list of handlers being managed by the External
      * Media Player Interface.
@@ -30,6 +30,9 @@ namespace acsdkNotifications {
  * An implementation that allows us to store NotificationIndicators using
  * SQLite.
  *
+ * Statements are prepared once and reused for the lifetime of the open database. Unless disabled in the
+ * configuration with "notifications" : { "inMemoryIndex" : false }, the size and head of the queue and the
+ * indicator state are also kept in memory, so reads only hit the database the first time they are needed.
  */
 class SQLiteNotificationsStorage : public acsdkNotificationsInterfaces::NotificationsStorageInterface {
 public:
@@ -57,8 +60,9 @@ public:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param useInMemoryIndex Whether to keep the queue size and head and the indicator state in memory.
      */
-    SQLiteNotificationsStorage(const std::string& databaseFilePath);
+    SQLiteNotificationsStorage(const std::string& databaseFilePath, bool useInMemoryIndex = true);
 
     ~SQLiteNotificationsStorage();
 
@@ -70,6 +74,8 @@ public:
 
     bool enqueue(const NotificationIndicator& notificationIndicator) override;
 
+    bool enqueueBatch(const std::vector<NotificationIndicator>& notificationIndicators) override;
+
     bool dequeue() override;
 
     bool peek(NotificationIndicator* notificationIndicator) override;
@@ -85,6 +91,38 @@ public:
     bool getQueueSize(int* size) override;
 
 private:
+    /**
+     * Utility function to insert a record at the tail of the queue. This method is not thread-safe, and does not
+     * update the in-memory index.
+     *
+     * @param notificationIndicator The record to insert.
+     * @return Whether the insert operation was successful.
+     */
+    bool insertNotificationIndicatorLocked(const NotificationIndicator& notificationIndicator);
+
+    /**
+     * Utility function to get the number of records in the queue, from the in-memory index if possible. This
+     * method is not thread-safe.
+     *
+     * @param [out] size A pointer to receive the size.
+     * @return Whether the size operation was successful.
+     */
+    bool getQueueSizeLocked(int* size);
+
+    /**
+     * Utility function to update the in-memory index after records have been added to the tail of the queue. This
+     * method is not thread-safe.
+     *
+     * @param notificationIndicators The records which have been added, in order.
+     */
+    void onEnqueuedLocked(const std::vector<NotificationIndicator>& notificationIndicators);
+
+    /**
+     * Utility function to forget everything held in the in-memory index, so it is reloaded from the database on
+     * the next read. This method is not thread-safe.
+     */
+    void invalidateIndexLocked();
+
     /**
      * Utility function to get the next record in the database. This method is not
      * thread-safe.
@@ -113,6 +151,27 @@ private:
 
     /// The underlying database class.
     alexaClientSDK::storage::sqliteStorage::SQLiteDatabase m_database;
+
+    /// Whether the in-memory index is used.
+    const bool m_useInMemoryIndex;
+
+    /// Whether @c m_queueSize holds the number of records in the queue.
+    bool m_isQueueSizeCached;
+
+    /// The number of records in the queue.
+    int m_queueSize;
+
+    /// Whether @c m_queueHead holds the next record in the queue.
+    bool m_isQueueHeadCached;
+
+    /// The next record in the queue.
+    NotificationIndicator m_queueHead;
+
+    /// Whether @c m_indicatorState holds the stored indicator state.
+    bool m_isIndicatorStateCached;
+
+    /// The stored indicator state.
+    IndicatorState m_indicatorState;
 };
 
 }  // namespace acsdkNotifications
@@ -13,7 +13,6 @@
  * permissions and limitations under the License.
  */
 
-#include <SQLiteStorage/SQLiteUtils.h>
 #include <SQLiteStorage/SQLiteStatement.h>
 
 #include <AVSCommon/Utils/File/FileUtils.h>
@@ -43,6 +42,12 @@ static const std::string NOTIFICATIONS_CONFIGURATION_ROOT_KEY = "notifications";
 /// The key in our config file to find the database file path.
 static const std::string NOTIFICATIONS_DB_FILE_PATH_KEY = "databaseFilePath";
 
+/// The key in our config file to find whether the in-memory index is used.
+static const std::string NOTIFICATIONS_IN_MEMORY_INDEX_KEY = "inMemoryIndex";
+
+/// Whether the in-memory index is used if the config file does not specify it.
+static const bool DEFAULT_IN_MEMORY_INDEX = true;
+
 static const std::string NOTIFICATION_INDICATOR_TABLE_NAME = "notificationIndicators";
 
 static const std::string DATABASE_COLUMN_PERSIST_VISUAL_INDICATOR_NAME = "persistVisualIndicator";
@@ -53,6 +58,31 @@ static const std::string DATABASE_COLUMN_ASSET_ID_NAME = "assetId";
 
 static const std::string DATABASE_COLUMN_ASSET_URL_NAME = "assetUrl";
 
+/// The SQL string to insert a record at the tail of the queue.
+static const std::string INSERT_NOTIFICATION_INDICATOR_SQL_STRING =
+    "INSERT INTO " + NOTIFICATION_INDICATOR_TABLE_NAME + " (" + DATABASE_COLUMN_PERSIST_VISUAL_INDICATOR_NAME + "," +
+    DATABASE_COLUMN_PLAY_AUDIO_INDICATOR_NAME + "," + DATABASE_COLUMN_ASSET_ID_NAME + "," +
+    DATABASE_COLUMN_ASSET_URL_NAME + ") VALUES (?, ?, ?, ?);";
+
+/// The SQL string to select the head of the queue, which corresponds to the minimum id.
+static const std::string SELECT_NEXT_NOTIFICATION_INDICATOR_SQL_STRING =
+    "SELECT " + DATABASE_COLUMN_PERSIST_VISUAL_INDICATOR_NAME + "," + DATABASE_COLUMN_PLAY_AUDIO_INDICATOR_NAME + "," +
+    DATABASE_COLUMN_ASSET_ID_NAME + "," + DATABASE_COLUMN_ASSET_URL_NAME + " FROM " +
+    NOTIFICATION_INDICATOR_TABLE_NAME + " ORDER BY ROWID ASC LIMIT 1;";
+
+/// The SQL string to delete the head of the queue.
+static const std::string DELETE_NEXT_NOTIFICATION_INDICATOR_SQL_STRING =
+    "DELETE FROM " + NOTIFICATION_INDICATOR_TABLE_NAME + " WHERE ROWID=(SELECT ROWID FROM " +
+    NOTIFICATION_INDICATOR_TABLE_NAME + " order by ROWID limit 1);";
+
+/// The SQL string to delete every record of the queue.
+static const std::string DELETE_ALL_NOTIFICATION_INDICATORS_SQL_STRING =
+    "DELETE FROM " + NOTIFICATION_INDICATOR_TABLE_NAME + ";";
+
+/// The SQL string to count the records of the queue.
+static const std::string COUNT_NOTIFICATION_INDICATORS_SQL_STRING =
+    "SELECT COUNT(*) FROM " + NOTIFICATION_INDICATOR_TABLE_NAME + ";";
+
 static const std::string CREATE_NOTIFICATION_INDICATOR_TABLE_SQL_STRING =
     std::string("CREATE TABLE ") + NOTIFICATION_INDICATOR_TABLE_NAME + " (" +
     DATABASE_COLUMN_PERSIST_VISUAL_INDICATOR_NAME + " INT NOT NULL," + DATABASE_COLUMN_PLAY_AUDIO_INDICATOR_NAME +
@@ -65,6 +95,18 @@ static const std::string INDICATOR_STATE_NAME = "indicatorState";
 static const std::string CREATE_INDICATOR_STATE_TABLE_SQL_STRING =
     std::string("CREATE TABLE ") + INDICATOR_STATE_NAME + " (" + INDICATOR_STATE_NAME + " INT NOT NULL);";
 
+/// The SQL string to delete the indicator state record.
+static const std::string DELETE_INDICATOR_STATE_SQL_STRING = "DELETE FROM " + INDICATOR_STATE_NAME +
+                                                             " WHERE ROWID IN (SELECT ROWID FROM " +
+                                                             INDICATOR_STATE_NAME + " limit 1);";
+
+/// The SQL string to insert the indicator state record.
+static const std::string INSERT_INDICATOR_STATE_SQL_STRING =
+    "INSERT INTO " + INDICATOR_STATE_NAME + " (" + INDICATOR_STATE_NAME + ") VALUES (?);";
+
+/// The SQL string to select the indicator state record.
+static const std::string SELECT_INDICATOR_STATE_SQL_STRING = "SELECT * FROM " + INDICATOR_STATE_NAME;
+
 static const acsdkNotificationsInterfaces::NotificationsStorageInterface::IndicatorState DEFAULT_INDICATOR_STATE =
     acsdkNotificationsInterfaces::NotificationsStorageInterface::IndicatorState::OFF;
 
@@ -94,11 +136,22 @@ std::unique_ptr<SQLiteNotificationsStorage> SQLiteNotificationsStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteNotificationsStorage>(new SQLiteNotificationsStorage(notificationDatabaseFilePath));
+    bool useInMemoryIndex = DEFAULT_IN_MEMORY_INDEX;
+    notificationConfigurationRoot.getBool(
+        NOTIFICATIONS_IN_MEMORY_INDEX_KEY, &useInMemoryIndex, DEFAULT_IN_MEMORY_INDEX);
+
+    return std::unique_ptr<SQLiteNotificationsStorage>(
+        new SQLiteNotificationsStorage(notificationDatabaseFilePath, useInMemoryIndex));
 }
 
-SQLiteNotificationsStorage::SQLiteNotificationsStorage(const std::string& databaseFilePath) :
-        m_database{databaseFilePath} {
+SQLiteNotificationsStorage::SQLiteNotificationsStorage(const std::string& databaseFilePath, bool useInMemoryIndex) :
+        m_database{databaseFilePath},
+        m_useInMemoryIndex{useInMemoryIndex},
+        m_isQueueSizeCached{false},
+        m_queueSize{0},
+        m_isQueueHeadCached{false},
+        m_isIndicatorStateCached{false},
+        m_indicatorState{DEFAULT_INDICATOR_STATE} {
 }
 
 bool SQLiteNotificationsStorage::createDatabase() {
@@ -153,25 +206,65 @@ bool SQLiteNotificationsStorage::open() {
 }
 
 void SQLiteNotificationsStorage::close() {
+    std::lock_guard<std::mutex> lock{m_databaseMutex};
+    invalidateIndexLocked();
     m_database.close();
 }
 
 bool SQLiteNotificationsStorage::enqueue(const NotificationIndicator& notificationIndicator) {
-    // Inserted rows representations of a NotificationIndicator:
-    // | id | persistVisualIndicator | playAudioIndicator | assetId | assetUrl |
+    // lock here to bind the id generation and the enqueue operations
+    std::lock_guard<std::mutex> lock{m_databaseMutex};
 
-    const std::string sqlString = "INSERT INTO " + NOTIFICATION_INDICATOR_TABLE_NAME + " (" +
-                                  DATABASE_COLUMN_PERSIST_VISUAL_INDICATOR_NAME + "," +
-                                  DATABASE_COLUMN_PLAY_AUDIO_INDICATOR_NAME + "," + DATABASE_COLUMN_ASSET_ID_NAME +
-                                  "," + DATABASE_COLUMN_ASSET_URL_NAME + ") VALUES (" + "?, ?, ?, ?);";
+    if (!insertNotificationIndicatorLocked(notificationIndicator)) {
+        ACSDK_ERROR(LX("enqueueFailed").m("Could not insert notificationIndicator"));
+        invalidateIndexLocked();
+        return false;
+    }
+
+    onEnqueuedLocked({notificationIndicator});
+    return true;
+}
+
+bool SQLiteNotificationsStorage::enqueueBatch(const std::vector<NotificationIndicator>& notificationIndicators) {
+    if (notificationIndicators.empty()) {
+        return true;
+    }
 
-    // lock here to bind the id generation and the enqueue operations
     std::lock_guard<std::mutex> lock{m_databaseMutex};
 
-    auto statement = m_database.createStatement(sqlString);
+    {
+        auto transaction = m_database.beginTransaction();
+        if (!transaction) {
+            ACSDK_ERROR(LX("enqueueBatchFailed").m("Could not begin transaction"));
+            return false;
+        }
+
+        for (const auto& notificationIndicator : notificationIndicators) {
+            if (!insertNotificationIndicatorLocked(notificationIndicator)) {
+                ACSDK_ERROR(LX("enqueueBatchFailed").m("Could not insert notificationIndicator"));
+                invalidateIndexLocked();
+                return false;
+            }
+        }
+
+        if (!transaction->commit()) {
+            ACSDK_ERROR(LX("enqueueBatchFailed").m("Could not commit transaction"));
+            invalidateIndexLocked();
+            return false;
+        }
+    }  // Leaving transaction scope making it rollback if error occurred.
+
+    onEnqueuedLocked(notificationIndicators);
+    return true;
+}
+
+bool SQLiteNotificationsStorage::insertNotificationIndicatorLocked(const NotificationIndicator& notificationIndicator) {
+    // Inserted rows representations of a NotificationIndicator:
+    // | id | persistVisualIndicator | playAudioIndicator | assetId | assetUrl |
+    auto statement = m_database.getCachedStatement(INSERT_NOTIFICATION_INDICATOR_SQL_STRING);
 
     if (!statement) {
-        ACSDK_ERROR(LX("enqueueFailed").m("Could not create statement"));
+        ACSDK_ERROR(LX("insertNotificationIndicatorLockedFailed").m("Could not create statement"));
         return false;
     }
     int boundParam = 1;
@@ -179,53 +272,34 @@ bool SQLiteNotificationsStorage::enqueue(const NotificationIndicator& notificati
         !statement->bindIntParameter(boundParam++, notificationIndicator.playAudioIndicator) ||
         !statement->bindStringParameter(boundParam++, notificationIndicator.asset.assetId) ||
         !statement->bindStringParameter(boundParam++, notificationIndicator.asset.url)) {
-        ACSDK_ERROR(LX("enqueueFailed").m("Could not bind parameter"));
+        ACSDK_ERROR(LX("insertNotificationIndicatorLockedFailed").m("Could not bind parameter"));
         return false;
     }
 
     if (!statement->step()) {
-        ACSDK_ERROR(LX("enqueueFailed").m("Could not perform step"));
+        ACSDK_ERROR(LX("insertNotificationIndicatorLockedFailed").m("Could not perform step"));
         return false;
     }
 
-    statement->finalize();
-
     return true;
 }
 
-/**
- * A utility function to pop the next notificationIndicator from the database.
- *
- * @param database Pounter to the database.
- * @return Whether the delete operation was successful.
- * @note This function should only be called when holding m_databaseMutex.
- */
-static bool popNotificationIndicatorLocked(SQLiteDatabase* database) {
-    if (!database) {
-        ACSDK_ERROR(LX("popNotificationIndicatorLockedFailed").m("null database"));
-        return false;
-    }
-
-    // the next notificationIndicator in the queue corresponds to the minimum id
-    const std::string minTableId =
-        "(SELECT ROWID FROM " + NOTIFICATION_INDICATOR_TABLE_NAME + " order by ROWID limit 1)";
-
-    const std::string sqlString =
-        "DELETE FROM " + NOTIFICATION_INDICATOR_TABLE_NAME + " WHERE ROWID=" + minTableId + ";";
-
-    auto statement = database->createStatement(sqlString);
-
-    if (!statement) {
-        ACSDK_ERROR(LX("popNotificationIndicatorLockedFailed").m("Could not create statement."));
-        return false;
+void SQLiteNotificationsStorage::onEnqueuedLocked(const std::vector<NotificationIndicator>& notificationIndicators) {
+    if (!m_useInMemoryIndex || !m_isQueueSizeCached) {
+        return;
     }
 
-    if (!statement->step()) {
-        ACSDK_ERROR(LX("popNotificationIndicatorLockedFailed").m("Could not perform step."));
-        return false;
+    if (0 == m_queueSize && !notificationIndicators.empty()) {
+        m_queueHead = notificationIndicators.front();
+        m_isQueueHeadCached = true;
     }
+    m_queueSize += static_cast<int>(notificationIndicators.size());
+}
 
-    return true;
+void SQLiteNotificationsStorage::invalidateIndexLocked() {
+    m_isQueueSizeCached = false;
+    m_isQueueHeadCached = false;
+    m_isIndicatorStateCached = false;
 }
 
 bool SQLiteNotificationsStorage::dequeue() {
@@ -239,11 +313,20 @@ bool SQLiteNotificationsStorage::dequeue() {
         return false;
     }
 
-    if (!popNotificationIndicatorLocked(&m_database)) {
+    auto statement = m_database.getCachedStatement(DELETE_NEXT_NOTIFICATION_INDICATOR_SQL_STRING);
+
+    if (!statement || !statement->step()) {
         ACSDK_ERROR(LX("dequeueFailed").m("Could not pop notificationIndicator from table"));
+        invalidateIndexLocked();
         return false;
     }
 
+    // The new head is read from the database the next time it is needed.
+    m_isQueueHeadCached = false;
+    if (m_isQueueSizeCached) {
+        m_queueSize--;
+    }
+
     return true;
 }
 
@@ -261,12 +344,13 @@ bool SQLiteNotificationsStorage::setIndicatorState(IndicatorState state) {
 
     {
         auto transaction = m_database.beginTransaction();
+        if (!transaction) {
+            ACSDK_ERROR(LX("setIndicatorStateFailed").m("Could not begin transaction"));
+            return false;
+        }
 
         // first delete the old record, we only need to maintain one record of IndicatorState at a time.
-        std::string sqlString = "DELETE FROM " + INDICATOR_STATE_NAME + " WHERE ROWID IN (SELECT ROWID FROM " +
-                                INDICATOR_STATE_NAME + " limit 1);";
-
-        auto deleteStatement = m_database.createStatement(sqlString);
+        auto deleteStatement = m_database.getCachedStatement(DELETE_INDICATOR_STATE_SQL_STRING);
 
         if (!deleteStatement) {
             ACSDK_ERROR(LX("setIndicatorStateFailed").m("Could not create deleteStatement"));
@@ -278,12 +362,8 @@ bool SQLiteNotificationsStorage::setIndicatorState(IndicatorState state) {
             return false;
         }
 
-        deleteStatement->finalize();
-
         // we should only be storing one record in this table at any given time
-        sqlString = "INSERT INTO " + INDICATOR_STATE_NAME + " (" + INDICATOR_STATE_NAME + ") VALUES (?);";
-
-        auto insertStatement = m_database.createStatement(sqlString);
+        auto insertStatement = m_database.getCachedStatement(INSERT_INDICATOR_STATE_SQL_STRING);
 
         if (!insertStatement) {
             ACSDK_ERROR(LX("setIndicatorStateFailed").m("Could not create insertStatement"));
@@ -300,14 +380,17 @@ bool SQLiteNotificationsStorage::setIndicatorState(IndicatorState state) {
             return false;
         }
 
-        insertStatement->finalize();
-
         if (!transaction->commit()) {
             ACSDK_ERROR(LX("setIndicatorStateFailed").m("Could not commit transaction"));
             return false;
         }
     }  // Leaving transaction scope making it rollback if error occurred.
 
+    if (m_useInMemoryIndex) {
+        m_indicatorState = state;
+        m_isIndicatorStateCached = true;
+    }
+
     return true;
 }
 
@@ -322,15 +405,18 @@ bool SQLiteNotificationsStorage::getIndicatorState(IndicatorState* state) {
         return false;
     }
 
+    if (m_isIndicatorStateCached) {
+        *state = m_indicatorState;
+        return true;
+    }
+
     if (!m_database.tableExists(INDICATOR_STATE_NAME)) {
         ACSDK_ERROR(
             LX("getIndicatorStateFailed").m("Table does not exist").d("table name", INDICATOR_STATE_NAME.c_str()));
         return false;
     }
 
-    std::string sqlString = "SELECT * FROM " + INDICATOR_STATE_NAME;
-
-    auto statement = m_database.createStatement(sqlString);
+    auto statement = m_database.getCachedStatement(SELECT_INDICATOR_STATE_SQL_STRING);
 
     if (!statement) {
         ACSDK_ERROR(LX("getIndicatorStateFailed").m("Could not create statement"));
@@ -353,7 +439,7 @@ bool SQLiteNotificationsStorage::getIndicatorState(IndicatorState* state) {
 
     IndicatorState indicatorState = avsCommon::avs::intToIndicatorState(statement->getColumnInt(0));
 
-    statement->finalize();
+    statement->reset();
 
     if (IndicatorState::UNDEFINED == indicatorState) {
         ACSDK_ERROR(
@@ -364,6 +450,11 @@ bool SQLiteNotificationsStorage::getIndicatorState(IndicatorState* state) {
 
     *state = indicatorState;
 
+    if (m_useInMemoryIndex) {
+        m_indicatorState = indicatorState;
+        m_isIndicatorStateCached = true;
+    }
+
     return true;
 }
 
@@ -373,37 +464,23 @@ bool SQLiteNotificationsStorage::checkForEmptyQueue(bool* empty) {
         return false;
     }
 
-    std::string sqlString = "SELECT * FROM " + NOTIFICATION_INDICATOR_TABLE_NAME;
-
-    auto statement = m_database.createStatement(sqlString);
-
-    if (!statement) {
-        ACSDK_ERROR(LX("checkForEmptyQueueFailed").m("Could not create statement"));
-        return false;
-    }
+    std::lock_guard<std::mutex> lock{m_databaseMutex};
 
-    if (!statement->step()) {
-        ACSDK_ERROR(LX("checkForEmptyQueueFailed").m("Could not perform step"));
+    int size = 0;
+    if (!getQueueSizeLocked(&size)) {
+        ACSDK_ERROR(LX("checkForEmptyQueueFailed").m("Could not get the size of the queue"));
         return false;
     }
 
-    int stepResult = statement->getStepResult();
-
-    if (stepResult != SQLITE_ROW) {
-        *empty = true;
-    } else {
-        *empty = false;
-    }
+    *empty = (0 == size);
 
     return true;
 }
 
 bool SQLiteNotificationsStorage::clearNotificationIndicators() {
-    const std::string sqlString = "DELETE FROM " + NOTIFICATION_INDICATOR_TABLE_NAME;
-
     std::lock_guard<std::mutex> lock{m_databaseMutex};
 
-    auto statement = m_database.createStatement(sqlString);
+    auto statement = m_database.getCachedStatement(DELETE_ALL_NOTIFICATION_INDICATORS_SQL_STRING);
 
     if (!statement) {
         ACSDK_ERROR(LX("clearNotificationIndicatorsFailed").m("Could not create statement."));
@@ -412,8 +489,15 @@ bool SQLiteNotificationsStorage::clearNotificationIndicators() {
 
     if (!statement->step()) {
         ACSDK_ERROR(LX("clearNotificationIndicatorsFailed").m("Could not perform step."));
+        invalidateIndexLocked();
         return false;
     }
+
+    m_isQueueHeadCached = false;
+    if (m_useInMemoryIndex) {
+        m_queueSize = 0;
+        m_isQueueSizeCached = true;
+    }
     return true;
 }
 
@@ -422,10 +506,17 @@ SQLiteNotificationsStorage::~SQLiteNotificationsStorage() {
 }
 
 bool SQLiteNotificationsStorage::getNextNotificationIndicatorLocked(NotificationIndicator* notificationIndicator) {
-    // the minimum id is the next NotificationIndicator in the queue
-    std::string sqlString = "SELECT * FROM " + NOTIFICATION_INDICATOR_TABLE_NAME + " ORDER BY ROWID ASC LIMIT 1;";
+    if (m_isQueueHeadCached) {
+        *notificationIndicator = m_queueHead;
+        return true;
+    }
 
-    auto statement = m_database.createStatement(sqlString);
+    if (m_isQueueSizeCached && 0 == m_queueSize) {
+        ACSDK_ERROR(LX("getNextNotificationIndicatorLockedFailed").m("No records left in table"));
+        return false;
+    }
+
+    auto statement = m_database.getCachedStatement(SELECT_NEXT_NOTIFICATION_INDICATOR_SQL_STRING);
 
     if (!statement) {
         ACSDK_ERROR(LX("getNextNotificationIndicatorLockedFailed").m("Could not create statement"));
@@ -469,8 +560,15 @@ bool SQLiteNotificationsStorage::getNextNotificationIndicatorLocked(Notification
         }
     }
 
+    statement->reset();
+
     // load up the out NotificationIndicator
     *notificationIndicator = NotificationIndicator(persistVisualIndicator, playAudioIndicator, assetId, assetUrl);
+
+    if (m_useInMemoryIndex) {
+        m_queueHead = *notificationIndicator;
+        m_isQueueHeadCached = true;
+    }
     return true;
 }
 
@@ -480,10 +578,35 @@ bool SQLiteNotificationsStorage::getQueueSize(int* size) {
         return false;
     }
 
-    if (!getNumberTableRows(&m_database, NOTIFICATION_INDICATOR_TABLE_NAME, size)) {
+    std::lock_guard<std::mutex> lock{m_databaseMutex};
+    return getQueueSizeLocked(size);
+}
+
+bool SQLiteNotificationsStorage::getQueueSizeLocked(int* size) {
+    if (m_isQueueSizeCached) {
+        *size = m_queueSize;
+        return true;
+    }
+
+    if (!m_database.isDatabaseReady()) {
+        ACSDK_ERROR(LX("getQueueSizeFailed").m("Database not ready"));
+        return false;
+    }
+
+    auto statement = m_database.getCachedStatement(COUNT_NOTIFICATION_INDICATORS_SQL_STRING);
+
+    if (!statement || !statement->step() || SQLITE_ROW != statement->getStepResult()) {
         ACSDK_ERROR(LX("getQueueSizeFailed").m("Failed to count rows in table"));
         return false;
     }
+
+    *size = statement->getColumnInt(0);
+    statement->reset();
+
+    if (m_useInMemoryIndex) {
+        m_queueSize = *size;
+        m_isQueueSizeCached = true;
+    }
     return true;
 }
 
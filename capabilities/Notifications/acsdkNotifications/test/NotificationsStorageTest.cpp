@@ -459,6 +459,77 @@ TEST_F(NotificationsStorageTest, test_size) {
     ASSERT_EQ(size, 0);
 }
 
+/**
+ * Test that enqueueBatch() enqueues every record in order, and that the queue read back from the database file
+ * matches the queue served from memory.
+ */
+TEST_F(NotificationsStorageTest, test_enqueueBatch) {
+    NotificationIndicator firstIndicator(true, false, TEST_ASSET_ID1, TEST_ASSET_URL1);
+    NotificationIndicator secondIndicator(false, true, TEST_ASSET_ID2, TEST_ASSET_URL2);
+
+    // should fail to enqueue if database is not open for business
+    ASSERT_FALSE(m_storage->enqueueBatch({firstIndicator, secondIndicator}));
+
+    createDatabase();
+    ASSERT_TRUE(isOpen(m_storage));
+
+    ASSERT_TRUE(m_storage->enqueueBatch({}));
+    ASSERT_TRUE(m_storage->enqueueBatch({firstIndicator, secondIndicator}));
+
+    int size = 0;
+    ASSERT_TRUE(m_storage->getQueueSize(&size));
+    ASSERT_EQ(size, 2);
+
+    NotificationIndicator peekedAt;
+    ASSERT_TRUE(m_storage->peek(&peekedAt));
+    checkNotificationIndicatorsEquality(peekedAt, firstIndicator);
+
+    m_storage->close();
+    ASSERT_TRUE(m_storage->open());
+
+    ASSERT_TRUE(m_storage->getQueueSize(&size));
+    ASSERT_EQ(size, 2);
+    ASSERT_TRUE(m_storage->peek(&peekedAt));
+    checkNotificationIndicatorsEquality(peekedAt, firstIndicator);
+    ASSERT_TRUE(m_storage->dequeue());
+    ASSERT_TRUE(m_storage->peek(&peekedAt));
+    checkNotificationIndicatorsEquality(peekedAt, secondIndicator);
+    ASSERT_TRUE(m_storage->dequeue());
+
+    bool empty = false;
+    ASSERT_TRUE(m_storage->checkForEmptyQueue(&empty));
+    ASSERT_TRUE(empty);
+}
+
+/**
+ * Test that the queue behaves the same when the in-memory index is disabled.
+ */
+TEST_F(NotificationsStorageTest, test_queueWithoutInMemoryIndex) {
+    m_storage = std::make_shared<SQLiteNotificationsStorage>(TEST_DATABASE_FILE_PATH, false);
+    createDatabase();
+    ASSERT_TRUE(isOpen(m_storage));
+
+    NotificationIndicator firstIndicator(true, false, TEST_ASSET_ID1, TEST_ASSET_URL1);
+    NotificationIndicator secondIndicator(false, true, TEST_ASSET_ID2, TEST_ASSET_URL2);
+    ASSERT_TRUE(m_storage->enqueue(firstIndicator));
+    ASSERT_TRUE(m_storage->enqueueBatch({secondIndicator, firstIndicator}));
+
+    int size = 0;
+    ASSERT_TRUE(m_storage->getQueueSize(&size));
+    ASSERT_EQ(size, 3);
+
+    NotificationIndicator peekedAt;
+    ASSERT_TRUE(m_storage->dequeue());
+    ASSERT_TRUE(m_storage->peek(&peekedAt));
+    checkNotificationIndicatorsEquality(peekedAt, secondIndicator);
+
+    ASSERT_TRUE(m_storage->clearNotificationIndicators());
+    bool empty = false;
+    ASSERT_TRUE(m_storage->checkForEmptyQueue(&empty));
+    ASSERT_TRUE(empty);
+    ASSERT_FALSE(m_storage->peek(&peekedAt));
+}
+
 }  // namespace test
 }  // namespace acsdkNotifications
 }  // namespace alexaClientSDK
@@ -16,6 +16,8 @@
 #ifndef ACSDKNOTIFICATIONSINTERFACES_NOTIFICATIONSSTORAGEINTERFACE_H_
 #define ACSDKNOTIFICATIONSINTERFACES_NOTIFICATIONSSTORAGEINTERFACE_H_
 
+#include <vector>
+
 #include <AVSCommon/AVS/IndicatorState.h>
 #include <acsdkNotifications/NotificationIndicator.h>
 
@@ -69,6 +71,17 @@ public:
      */
     virtual bool enqueue(const acsdkNotifications::NotificationIndicator& notificationIndicator) = 0;
 
+    /**
+     * Enqueues several @c NotificationIndicators in the database, in order.
+     *
+     * Implementations should enqueue the whole batch atomically. The default implementation enqueues the
+     * @c NotificationIndicators one at a time, and stops at the first failure.
+     *
+     * @param notificationIndicators The @c NotificationIndicators to enqueue.
+     * @return Whether all the @c NotificationIndicators were successfully enqueued.
+     */
+    virtual bool enqueueBatch(const std::vector<acsdkNotifications::NotificationIndicator>& notificationIndicators);
+
     /**
      * Dequeues the next @c NotificationIndicator in the database.
      *
@@ -124,6 +137,16 @@ public:
     virtual bool getQueueSize(int* size) = 0;
 };
 
+inline bool NotificationsStorageInterface::enqueueBatch(
+    const std::vector<acsdkNotifications::NotificationIndicator>& notificationIndicators) {
+    for (const auto& notificationIndicator : notificationIndicators) {
+        if (!enqueue(notificationIndicator)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // namespace acsdkNotificationsInterfaces
 }  // namespace alexaClientSDK
 
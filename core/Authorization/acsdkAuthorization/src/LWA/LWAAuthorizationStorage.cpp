@@ -45,6 +45,9 @@ static const std::string CONFIG_KEY_LWA_AUTHORIZATION = "lwaAuthorization";
 /// Name of @c databaseFilePath value in the @c ConfigurationNode.
 static const std::string CONFIG_KEY_DB_FILE_PATH_KEY = "databaseFilePath";
 
+/// Maximum total size of decrypted values kept in memory. Enough for the refresh token and the user id.
+static const size_t DECRYPTED_VALUE_CACHE_CAPACITY = 16 * 1024;
+
 std::shared_ptr<LWAAuthorizationStorageInterface> LWAAuthorizationStorage::createStorage(
     const std::shared_ptr<acsdkPropertiesInterfaces::PropertiesFactoryInterface>& propertiesFactory) {
     if (!propertiesFactory) {
@@ -151,8 +154,8 @@ std::shared_ptr<LWAAuthorizationStorageInterface> LWAAuthorizationStorage::creat
     std::shared_ptr<PropertiesFactoryInterface> propertiesFactory;
     if (useEncryptionAtRest) {
         ACSDK_INFO(LX("createLWAAuthorizationStorageInterface").m("encryptionAtRestEnabled"));
-        propertiesFactory =
-            createEncryptedPropertiesFactory(storage, SimpleMiscStorageUriMapper::create(), cryptoFactory, keyStore);
+        propertiesFactory = createEncryptedPropertiesFactory(
+            storage, SimpleMiscStorageUriMapper::create(), cryptoFactory, keyStore, DECRYPTED_VALUE_CACHE_CAPACITY);
     } else {
         propertiesFactory = createPropertiesFactory(storage, SimpleMiscStorageUriMapper::create());
     }
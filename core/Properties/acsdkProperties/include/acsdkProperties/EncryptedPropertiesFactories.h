@@ -16,6 +16,7 @@
 #ifndef ACSDKPROPERTIES_ENCRYPTEDPROPERTIESFACTORIES_H_
 #define ACSDKPROPERTIES_ENCRYPTEDPROPERTIESFACTORIES_H_
 
+#include <cstddef>
 #include <memory>
 
 #include <acsdkPropertiesInterfaces/PropertiesFactoryInterface.h>
@@ -43,16 +44,23 @@ using alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface;
  * When client code accesses @c PropertiesInterface through encrypted @c PropertiesFactoryInterface, all existing
  * data is automatically converted into encrypted form.
  *
+ * Decrypted values may be cached in memory, so repeatedly read properties are not loaded and decrypted on every access.
+ * The cache is disabled by default.
+ *
  * @param[in] innerFactory  Properties factory without encryption support.
  * @param[in] cryptoFactory Crypto factory reference. This parameter must not be nullptr.
  * @param[in] keyStore      Key store factory reference. This parameter must not be nullptr.
+ * @param[in] cacheCapacity Maximum total size in bytes of cached decrypted values for each properties container. Zero
+ *                          disables the cache. With the cache enabled, the factory returns the same properties
+ *                          instance for each configuration URI.
  *
  * @return Properties factory reference or nullptr on error.
  */
 std::shared_ptr<PropertiesFactoryInterface> createEncryptedPropertiesFactory(
     const std::shared_ptr<PropertiesFactoryInterface>& innerFactory,
     const std::shared_ptr<CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<KeyStoreInterface>& keyStore) noexcept;
+    const std::shared_ptr<KeyStoreInterface>& keyStore,
+    std::size_t cacheCapacity = 0) noexcept;
 
 /**
  * @brief Creates properties factory with encryption support by wrapping a @c MiscStorageInterface.
@@ -73,6 +81,9 @@ std::shared_ptr<PropertiesFactoryInterface> createEncryptedPropertiesFactory(
  * @param[in] uriMapper     URI mapper reference.
  * @param[in] cryptoFactory Crypto factory reference. This parameter must not be nullptr.
  * @param[in] keyStore      Key store factory reference. This parameter must not be nullptr.
+ * @param[in] cacheCapacity Maximum total size in bytes of cached decrypted values for each properties container. Zero
+ *                          disables the cache. With the cache enabled, the factory returns the same properties
+ *                          instance for each configuration URI.
  *
  * @return Properties factory reference or nullptr on error.
  *
@@ -82,7 +93,8 @@ std::shared_ptr<PropertiesFactoryInterface> createEncryptedPropertiesFactory(
     const std::shared_ptr<MiscStorageInterface>& innerStorage,
     const std::shared_ptr<MiscStorageUriMapperInterface>& uriMapper,
     const std::shared_ptr<CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<KeyStoreInterface>& keyStore) noexcept;
+    const std::shared_ptr<KeyStoreInterface>& keyStore,
+    std::size_t cacheCapacity = 0) noexcept;
 
 }  // namespace acsdkProperties
 }  // namespace alexaClientSDK
@@ -0,0 +1,251 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKPROPERTIES_PRIVATE_DECRYPTEDVALUECACHE_H_
+#define ACSDKPROPERTIES_PRIVATE_DECRYPTEDVALUECACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <acsdkPropertiesInterfaces/PropertiesInterface.h>
+
+namespace alexaClientSDK {
+namespace acsdkProperties {
+
+/**
+ * @brief Allocates memory which is locked in RAM.
+ *
+ * The memory is pinned with @c mlock() on a best effort basis, so it is not written to swap. Each allocation is
+ * rounded up to whole pages and shares no page with other memory, because pages are locked as a whole and locks do not
+ * nest: unlocking a shared page would also unlock the memory of other allocations on it.
+ *
+ * @param[in] size Number of bytes to allocate.
+ * @return Pointer to allocated memory.
+ * @throw std::bad_alloc if the memory cannot be allocated.
+ */
+void* allocateLockedMemory(std::size_t size);
+
+/**
+ * @brief Releases memory allocated with @c allocateLockedMemory.
+ *
+ * The memory is zeroed and unlocked before it is released.
+ *
+ * @param[in] ptr Pointer to memory to release.
+ * @param[in] size Number of bytes allocated at @a ptr.
+ */
+void releaseLockedMemory(void* ptr, std::size_t size) noexcept;
+
+/**
+ * @brief Allocator for containers holding sensitive data.
+ *
+ * Memory is locked in RAM while in use, and zeroed before it is released.
+ *
+ * @tparam T Element type.
+ * @ingroup PropertiesIMPL
+ */
+template <typename T>
+struct LockedAllocator {
+    /// Element type.
+    typedef T value_type;
+
+    /// Default constructor.
+    LockedAllocator() noexcept = default;
+
+    /// Rebinding constructor.
+    template <typename U>
+    LockedAllocator(const LockedAllocator<U>&) noexcept {
+    }
+
+    /**
+     * @brief Allocates locked memory for @a n elements.
+     *
+     * @param[in] n Number of elements.
+     * @return Pointer to allocated memory.
+     */
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(allocateLockedMemory(n * sizeof(T)));
+    }
+
+    /**
+     * @brief Zeroes, unlocks, and releases memory for @a n elements.
+     *
+     * @param[in] ptr Pointer to memory to release.
+     * @param[in] n Number of elements.
+     */
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        releaseLockedMemory(ptr, n * sizeof(T));
+    }
+};
+
+/// @private
+template <typename T, typename U>
+bool operator==(const LockedAllocator<T>&, const LockedAllocator<U>&) noexcept {
+    return true;
+}
+
+/// @private
+template <typename T, typename U>
+bool operator!=(const LockedAllocator<T>&, const LockedAllocator<U>&) noexcept {
+    return false;
+}
+
+/**
+ * @brief Bounded cache of decrypted property values.
+ *
+ * The cache keeps plaintext values in locked memory, so they are not swapped out, and zeroes them when they are
+ * evicted or replaced. Each value occupies whole pages of its own, so evicting one value never unlocks another. When the total size of cached values exceeds the capacity, least recently used values are
+ * evicted.
+ *
+ * Every modification increments a generation counter. Readers which load a value from storage without holding a lock
+ * capture the generation before the load and insert the value with #putIfUnchanged, so a value loaded before a
+ * concurrent update never overwrites the newer one.
+ *
+ * A cache with zero capacity is disabled and never stores values.
+ *
+ * This class is thread safe.
+ *
+ * @ingroup PropertiesIMPL
+ */
+class DecryptedValueCache {
+public:
+    /// @brief Bytes data type.
+    typedef acsdkPropertiesInterfaces::PropertiesInterface::Bytes Bytes;
+
+    /**
+     * @brief Constructs the cache.
+     *
+     * @param[in] capacity Maximum total size in bytes of cached values. Zero disables the cache.
+     */
+    explicit DecryptedValueCache(std::size_t capacity) noexcept;
+
+    /**
+     * @brief Returns whether the cache stores values.
+     *
+     * @return True if the capacity is not zero.
+     */
+    bool isEnabled() const noexcept;
+
+    /**
+     * @brief Loads a value from the cache.
+     *
+     * @param[in] key Property key.
+     * @param[out] value Cached value. Unmodified if the key is not cached.
+     * @return True if the value was found.
+     */
+    bool get(const std::string& key, Bytes& value) noexcept;
+
+    /**
+     * @brief Returns the current generation.
+     *
+     * @return Generation counter value.
+     */
+    std::uint64_t getGeneration() noexcept;
+
+    /**
+     * @brief Stores a value written to storage.
+     *
+     * @param[in] key Property key.
+     * @param[in] value Plaintext value.
+     */
+    void put(const std::string& key, const Bytes& value) noexcept;
+
+    /**
+     * @brief Stores a value loaded from storage, unless the cache was modified after the load started.
+     *
+     * @param[in] key Property key.
+     * @param[in] value Plaintext value.
+     * @param[in] generation Generation captured with #getGeneration before the value was loaded.
+     */
+    void putIfUnchanged(const std::string& key, const Bytes& value, std::uint64_t generation) noexcept;
+
+    /**
+     * @brief Drops a value from the cache.
+     *
+     * @param[in] key Property key.
+     */
+    void remove(const std::string& key) noexcept;
+
+    /**
+     * @brief Drops all values from the cache.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Returns the total size of cached values.
+     *
+     * @return Size in bytes.
+     */
+    std::size_t getSize() noexcept;
+
+private:
+    /// @brief Plaintext buffer in locked memory.
+    typedef std::vector<unsigned char, LockedAllocator<unsigned char>> LockedBytes;
+
+    /// @brief Cached value with its key.
+    struct Entry {
+        /// Property key.
+        std::string key;
+        /// Plaintext value.
+        LockedBytes value;
+    };
+
+    /**
+     * @brief Stores a value and evicts least recently used values above the capacity.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param[in] key Property key.
+     * @param[in] value Plaintext value.
+     */
+    void insertLocked(const std::string& key, const Bytes& value) noexcept;
+
+    /**
+     * @brief Drops a value from the cache.
+     *
+     * @note This must be called with @c m_mutex held.
+     *
+     * @param[in] key Property key.
+     */
+    void removeLocked(const std::string& key) noexcept;
+
+    /// Maximum total size of cached values.
+    const std::size_t m_capacity;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Cached values, most recently used first.
+    std::list<Entry> m_entries;
+
+    /// Index of @c m_entries by key.
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+
+    /// Total size of cached values.
+    std::size_t m_size;
+
+    /// Incremented on every modification.
+    std::uint64_t m_generation;
+};
+
+}  // namespace acsdkProperties
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKPROPERTIES_PRIVATE_DECRYPTEDVALUECACHE_H_
@@ -16,11 +16,14 @@
 #ifndef ACSDKPROPERTIES_PRIVATE_ENCRYPTEDPROPERTIES_H_
 #define ACSDKPROPERTIES_PRIVATE_ENCRYPTEDPROPERTIES_H_
 
+#include <mutex>
+
 #include <acsdkCryptoInterfaces/CryptoFactoryInterface.h>
 #include <acsdkCryptoInterfaces/KeyFactoryInterface.h>
 #include <acsdkCryptoInterfaces/KeyStoreInterface.h>
 #include <acsdkPropertiesInterfaces/PropertiesInterface.h>
 #include <acsdkProperties/ErrorCallbackInterface.h>
+#include <acsdkProperties/private/DecryptedValueCache.h>
 #include <acsdkProperties/private/RetryExecutor.h>
 
 namespace alexaClientSDK {
@@ -34,17 +37,32 @@ namespace acsdkProperties {
  * manage encryption key, additional data is stored with '$acsdkEncryption$' property name. This property contains
  * algorithms to use and encrypted data key. The data key itself is encrypted using HSM key store.
  *
+ * Decrypted values can optionally be kept in a bounded in-memory cache, so repeated reads of the same property skip the
+ * storage round trip and the decryption. Cached plaintext is held in locked memory and zeroed when it is evicted.
+ *
  * This class is thread safe and can be shared between multiple consumers.
  *
  * @ingroup PropertiesIMPL
  */
 class EncryptedProperties : public alexaClientSDK::acsdkPropertiesInterfaces::PropertiesInterface {
 public:
+    /**
+     * @brief Creates encrypted properties on top of unencrypted ones.
+     *
+     * @param[in] configUri Configuration URI.
+     * @param[in] innerProperties Underlying properties storing ciphertext.
+     * @param[in] cryptoFactory Cryptography service factory.
+     * @param[in] keyStore HSM key store.
+     * @param[in] cacheCapacity Maximum total size in bytes of cached decrypted values. Zero disables the cache.
+     *
+     * @return Properties reference or nullptr on error.
+     */
     static std::shared_ptr<PropertiesInterface> create(
         const std::string& configUri,
         const std::shared_ptr<PropertiesInterface>& innerProperties,
         const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::CryptoFactoryInterface>& cryptoFactory,
-        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore) noexcept;
+        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore,
+        size_t cacheCapacity = 0) noexcept;
 
     /// @name PropertiesInterface methods.
     /// @{
@@ -52,6 +70,7 @@ public:
     bool putString(const std::string& key, const std::string& value) noexcept override;
     bool getBytes(const std::string& key, Bytes& value) noexcept override;
     bool putBytes(const std::string& key, const Bytes& value) noexcept override;
+    bool putBytesBatch(const std::unordered_map<std::string, Bytes>& values) noexcept override;
     bool remove(const std::string& key) noexcept override;
     bool getKeys(std::unordered_set<std::string>& valueContainer) noexcept override;
     bool clear() noexcept override;
@@ -69,7 +88,8 @@ protected:
         const std::string& configUri,
         const std::shared_ptr<PropertiesInterface>& innerProperties,
         const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::CryptoFactoryInterface>& cryptoFactory,
-        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore) noexcept;
+        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore,
+        size_t cacheCapacity) noexcept;
 
     // Container initialization.
     bool init() noexcept;
@@ -99,7 +119,9 @@ protected:
         RetryExecutor& executor,
         const std::string& key,
         const Bytes& data,
-        bool canDrop) noexcept;
+        bool canDrop,
+        bool* stored = nullptr) noexcept;
+    bool storeValuesWithRetries(RetryExecutor& executor, const std::unordered_map<std::string, Bytes>& data) noexcept;
     bool loadValueWithRetries(RetryExecutor& executor, const std::string& key, Bytes& data) noexcept;
     bool deleteValueWithRetries(RetryExecutor& executor, const std::string& key) noexcept;
     bool clearAllValuesWithRetries(RetryExecutor& executor) noexcept;
@@ -155,6 +177,15 @@ protected:
 
     /// Data key in use
     Key m_dataKey;
+
+    /// Cache of decrypted property values.
+    DecryptedValueCache m_cache;
+
+    /**
+     * Serializes each write to @c m_innerProperties with the matching update of @c m_cache, so concurrent writes of a
+     * key update the storage and the cache in the same order.
+     */
+    std::mutex m_writeMutex;
 };
 
 }  // namespace acsdkProperties
@@ -16,6 +16,9 @@
 #ifndef ACSDKPROPERTIES_PRIVATE_ENCRYPTEDPROPERTIESFACTORY_H_
 #define ACSDKPROPERTIES_PRIVATE_ENCRYPTEDPROPERTIESFACTORY_H_
 
+#include <mutex>
+#include <unordered_map>
+
 #include <acsdkPropertiesInterfaces/PropertiesFactoryInterface.h>
 #include <acsdkCryptoInterfaces/CryptoFactoryInterface.h>
 #include <acsdkCryptoInterfaces/KeyFactoryInterface.h>
@@ -32,6 +35,10 @@ namespace acsdkProperties {
  * This factory works with @name EncryptedProperties class to ensure all property values are stored in encrypted form
  * in the underlying storage.
  *
+ * When the decrypted value cache is enabled, the factory keeps the properties it creates and returns the same instance
+ * for each configuration URI, so the cache is shared by all consumers of a container and survives between calls to
+ * @c getProperties(). This also keeps the caches of different consumers of the same container from going stale.
+ *
  * @ingroup PropertiesIMPL
  */
 class EncryptedPropertiesFactory : public alexaClientSDK::acsdkPropertiesInterfaces::PropertiesFactoryInterface {
@@ -42,13 +49,16 @@ public:
      * @param[in] innerFactory Internal factory for accessing properties in plain text manner.
      * @param[in] cryptoFactory Encryption facilities factory.
      * @param[in] keyStore HSM key store.
+     * @param[in] cacheCapacity Maximum total size in bytes of cached decrypted values for each properties container.
+     * Zero disables the cache.
      *
      * @return Reference to factory or nullptr on error.
      */
     static std::shared_ptr<PropertiesFactoryInterface> create(
         const std::shared_ptr<alexaClientSDK::acsdkPropertiesInterfaces::PropertiesFactoryInterface>& innerFactory,
         const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::CryptoFactoryInterface>& cryptoFactory,
-        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore) noexcept;
+        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore,
+        size_t cacheCapacity = 0) noexcept;
 
     /// @name PropertiesFactoryInterface methods
     ///@{
@@ -63,11 +73,13 @@ private:
      * @param[in] innerFactory Internal factory for accessing properties in plain text manner.
      * @param[in] cryptoFactory Encryption facilities factory.
      * @param[in] keyStore HSM key store.
+     * @param[in] cacheCapacity Maximum total size in bytes of cached decrypted values for each properties container.
      */
     EncryptedPropertiesFactory(
         const std::shared_ptr<PropertiesFactoryInterface>& innerFactory,
         const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::CryptoFactoryInterface>& cryptoFactory,
-        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore) noexcept;
+        const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore,
+        size_t cacheCapacity) noexcept;
 
     bool init() noexcept;
 
@@ -77,6 +89,13 @@ private:
     const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::CryptoFactoryInterface> m_cryptoFactory;
     /// HSM keystore interface.
     const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface> m_keyStore;
+    /// Maximum total size of cached decrypted values for each properties container.
+    const size_t m_cacheCapacity;
+    /// Serializes access to @c m_properties.
+    std::mutex m_mutex;
+    /// Properties created for each configuration URI. Only used when @c m_cacheCapacity is not zero.
+    std::unordered_map<std::string, std::shared_ptr<alexaClientSDK::acsdkPropertiesInterfaces::PropertiesInterface>>
+        m_properties;
 };
 
 }  // namespace acsdkProperties
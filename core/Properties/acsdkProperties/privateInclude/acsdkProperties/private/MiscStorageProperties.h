@@ -63,6 +63,7 @@ public:
     bool putString(const std::string& key, const std::string& value) noexcept override;
     bool getBytes(const std::string& key, Bytes& value) noexcept override;
     bool putBytes(const std::string& key, const Bytes& value) noexcept override;
+    bool putBytesBatch(const std::unordered_map<std::string, Bytes>& values) noexcept override;
     bool remove(const std::string& key) noexcept override;
     bool getKeys(std::unordered_set<std::string>& valueContainer) noexcept override;
     bool clear() noexcept override;
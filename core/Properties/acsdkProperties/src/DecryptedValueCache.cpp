@@ -0,0 +1,207 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <new>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <acsdkProperties/private/DecryptedValueCache.h>
+#include <acsdkProperties/private/Logging.h>
+
+namespace alexaClientSDK {
+namespace acsdkProperties {
+
+/// String to identify log entries originating from this file.
+/// @private
+static const std::string TAG{"DecryptedValueCache"};
+
+#ifndef _WIN32
+/**
+ * @brief Returns the size of the pages mapped for locked memory.
+ *
+ * @param[in] size Number of bytes requested.
+ * @return @a size rounded up to whole pages, and at least one page.
+ * @private
+ */
+static std::size_t getMappedSize(std::size_t size) noexcept {
+    static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    if (!size) {
+        return pageSize;
+    }
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+#endif
+
+void* allocateLockedMemory(std::size_t size) {
+#ifdef _WIN32
+    return ::operator new(size);
+#else
+    auto mappedSize = getMappedSize(size);
+    if (mappedSize < size) {
+        throw std::bad_alloc();
+    }
+    // A private mapping of whole pages, so locking and unlocking it never affects other memory.
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == ptr) {
+        ACSDK_ERROR(LX("allocateLockedMemoryFailed").d("reason", "mmapFailed").d("size", size));
+        throw std::bad_alloc();
+    }
+    if (mlock(ptr, mappedSize) != 0) {
+        // Locking is best effort, as it is limited by RLIMIT_MEMLOCK.
+        ACSDK_DEBUG9(LX("allocateLockedMemory").m("mlockFailed").d("size", size));
+    }
+    return ptr;
+#endif
+}
+
+void releaseLockedMemory(void* ptr, std::size_t size) noexcept {
+    if (!ptr) {
+        return;
+    }
+    // Write through a volatile pointer, so the compiler cannot drop the stores to memory which is about to be freed.
+    volatile unsigned char* bytes = static_cast<volatile unsigned char*>(ptr);
+    for (std::size_t i = 0; i < size; ++i) {
+        bytes[i] = 0;
+    }
+#ifdef _WIN32
+    ::operator delete(ptr);
+#else
+    auto mappedSize = getMappedSize(size);
+    munlock(ptr, mappedSize);
+    munmap(ptr, mappedSize);
+#endif
+}
+
+DecryptedValueCache::DecryptedValueCache(std::size_t capacity) noexcept :
+        m_capacity{capacity},
+        m_size{0},
+        m_generation{0} {
+}
+
+bool DecryptedValueCache::isEnabled() const noexcept {
+    return m_capacity > 0;
+}
+
+bool DecryptedValueCache::get(const std::string& key, Bytes& value) noexcept {
+    if (!isEnabled()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto it = m_index.find(key);
+    if (m_index.end() == it) {
+        return false;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    value.assign(it->second->value.cbegin(), it->second->value.cend());
+    return true;
+}
+
+std::uint64_t DecryptedValueCache::getGeneration() noexcept {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_generation;
+}
+
+void DecryptedValueCache::put(const std::string& key, const Bytes& value) noexcept {
+    if (!isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{m_mutex};
+    ++m_generation;
+    insertLocked(key, value);
+}
+
+void DecryptedValueCache::putIfUnchanged(const std::string& key, const Bytes& value, std::uint64_t generation) noexcept {
+    if (!isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (generation != m_generation) {
+        ACSDK_DEBUG9(LX("putIfUnchangedSkipped").d("key", key));
+        return;
+    }
+    insertLocked(key, value);
+}
+
+void DecryptedValueCache::remove(const std::string& key) noexcept {
+    if (!isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{m_mutex};
+    ++m_generation;
+    removeLocked(key);
+}
+
+void DecryptedValueCache::clear() noexcept {
+    if (!isEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{m_mutex};
+    ++m_generation;
+    m_index.clear();
+    m_entries.clear();
+    m_size = 0;
+}
+
+std::size_t DecryptedValueCache::getSize() noexcept {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_size;
+}
+
+void DecryptedValueCache::insertLocked(const std::string& key, const Bytes& value) noexcept {
+    removeLocked(key);
+    if (value.size() > m_capacity) {
+        // Values which do not fit are served from storage.
+        return;
+    }
+
+    try {
+        // Assigning from a range allocates the buffer once, so the plaintext is never left behind by a reallocation.
+        Entry entry;
+        entry.key = key;
+        entry.value.assign(value.cbegin(), value.cend());
+        m_entries.push_front(std::move(entry));
+        m_index[key] = m_entries.begin();
+    } catch (const std::bad_alloc&) {
+        ACSDK_ERROR(LX("insertFailed").d("reason", "badAlloc").d("key", key));
+        if (!m_entries.empty() && m_entries.front().key == key && m_index.find(key) == m_index.end()) {
+            m_entries.pop_front();
+        }
+        return;
+    }
+    m_size += value.size();
+
+    while (m_size > m_capacity) {
+        auto& oldest = m_entries.back();
+        m_size -= oldest.value.size();
+        m_index.erase(oldest.key);
+        m_entries.pop_back();
+    }
+}
+
+void DecryptedValueCache::removeLocked(const std::string& key) noexcept {
+    auto it = m_index.find(key);
+    if (m_index.end() == it) {
+        return;
+    }
+    m_size -= it->second->value.size();
+    m_entries.erase(it->second);
+    m_index.erase(it);
+}
+
+}  // namespace acsdkProperties
+}  // namespace alexaClientSDK
@@ -42,9 +42,10 @@ std::shared_ptr<PropertiesInterface> EncryptedProperties::create(
     const std::string& configUri,
     const std::shared_ptr<PropertiesInterface>& innerProperties,
     const std::shared_ptr<CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<KeyStoreInterface>& keyStore) noexcept {
+    const std::shared_ptr<KeyStoreInterface>& keyStore,
+    size_t cacheCapacity) noexcept {
     auto res = std::shared_ptr<EncryptedProperties>(
-        new EncryptedProperties(configUri, innerProperties, cryptoFactory, keyStore));
+        new EncryptedProperties(configUri, innerProperties, cryptoFactory, keyStore, cacheCapacity));
 
     if (res->init()) {
         ACSDK_DEBUG0(LX_CFG("createSuccess", configUri));
@@ -59,11 +60,13 @@ EncryptedProperties::EncryptedProperties(
     const std::string& configUri,
     const std::shared_ptr<PropertiesInterface>& innerProperties,
     const std::shared_ptr<CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<KeyStoreInterface>& keyStore) noexcept :
+    const std::shared_ptr<KeyStoreInterface>& keyStore,
+    size_t cacheCapacity) noexcept :
         m_configUri(configUri),
         m_innerProperties(innerProperties),
         m_cryptoFactory(cryptoFactory),
-        m_keyStore(keyStore) {
+        m_keyStore(keyStore),
+        m_cache(cacheCapacity) {
 }
 
 bool EncryptedProperties::getString(const std::string& key, std::string& value) noexcept {
@@ -110,6 +113,14 @@ bool EncryptedProperties::getBytes(const std::string& key, Bytes& value) noexcep
 }
 
 bool EncryptedProperties::getAndDecryptInternal(const std::string& key, Bytes& plaintext) noexcept {
+    if (m_cache.get(key, plaintext)) {
+        ACSDK_DEBUG9(LX_CFG_KEY("getAndDecryptInternalCacheHit", m_configUri, key));
+        return true;
+    }
+
+    // Capture the generation before loading, so a value loaded before a concurrent update is not cached.
+    const auto generation = m_cache.getGeneration();
+
     // create executor to invoke error callback and limit number of retries
     RetryExecutor executor{OperationType::Get, m_configUri};
 
@@ -138,6 +149,7 @@ bool EncryptedProperties::getAndDecryptInternal(const std::string& key, Bytes& p
         return false;
     } else {
         ACSDK_DEBUG0(LX_CFG_KEY("getAndDecryptInternalSuccess", m_configUri, key));
+        m_cache.putIfUnchanged(key, plaintext, generation);
         return true;
     }
 }
@@ -156,6 +168,56 @@ bool EncryptedProperties::putBytes(const std::string& key, const Bytes& value) n
     }
 }
 
+bool EncryptedProperties::putBytesBatch(const std::unordered_map<std::string, Bytes>& values) noexcept {
+    if (values.find(KEY_PROPERTY_NAME) != values.end()) {
+        ACSDK_ERROR(LX_CFG("putBytesBatchFailed", m_configUri).m("propertyKeyForbidden"));
+        return false;
+    }
+
+    // create executor to invoke error callback and limit number of retries
+    RetryExecutor executor{OperationType::Put, m_configUri};
+
+    // Encrypt every value first, so nothing is stored unless the whole batch can be stored.
+    std::unordered_map<std::string, Bytes> encodedValues;
+    for (const auto& entry : values) {
+        const auto& key = entry.first;
+        const auto& plaintext = entry.second;
+        Bytes encodedCiphertext;
+        auto res = executor.execute(
+            "putBytesBatchEncrypt",
+            [this, &key, &plaintext, &encodedCiphertext]() -> StatusCodeWithRetry {
+                encodedCiphertext.clear();
+                if (!encryptAndEncodePropertyValue(key, plaintext, encodedCiphertext)) {
+                    ACSDK_DEBUG0(LX_CFG_KEY("encryptPropertyFailed", m_configUri, key));
+                    return RetryExecutor::RETRYABLE_CRYPTO_ERROR;
+                }
+                return RetryExecutor::SUCCESS;
+            },
+            Action::FAIL);
+        if (RetryableOperationResult::Success != res) {
+            ACSDK_ERROR(LX_CFG_KEY("putBytesBatchFailed", m_configUri, key).m("encryptFailed"));
+            return false;
+        }
+        encodedValues.emplace(key, std::move(encodedCiphertext));
+    }
+
+    std::lock_guard<std::mutex> lock{m_writeMutex};
+    if (storeValuesWithRetries(executor, encodedValues)) {
+        for (const auto& entry : values) {
+            m_cache.put(entry.first, entry.second);
+        }
+        ACSDK_DEBUG0(LX_CFG("putBytesBatchSuccess", m_configUri).d("count", values.size()));
+        return true;
+    } else {
+        // The batch may be partially stored by a non-transactional storage, so the cached values can't be trusted.
+        for (const auto& entry : values) {
+            m_cache.remove(entry.first);
+        }
+        ACSDK_ERROR(LX_CFG("putBytesBatchFailed", m_configUri).d("count", values.size()));
+        return false;
+    }
+}
+
 bool EncryptedProperties::encryptAndPutInternal(const std::string& key, const Bytes& plaintext) noexcept {
     // create executor to invoke error callback and limit number of retries
     RetryExecutor executor{OperationType::Put, m_configUri};
@@ -176,14 +238,18 @@ bool EncryptedProperties::encryptAndPutInternal(const std::string& key, const By
         },
         Action::FAIL);
     switch (res) {
-        case RetryableOperationResult::Cleanup:
-            if (deleteValueWithRetries(executor, key)) {
+        case RetryableOperationResult::Cleanup: {
+            std::lock_guard<std::mutex> lock{m_writeMutex};
+            auto deleted = deleteValueWithRetries(executor, key);
+            m_cache.remove(key);
+            if (deleted) {
                 ACSDK_DEBUG0(LX_CFG_KEY("encryptAndPutInternalCleanupSuccess", m_configUri, key));
                 return true;
             } else {
                 ACSDK_DEBUG0(LX_CFG_KEY("encryptAndPutInternalCleanupSuccessFailure", m_configUri, key));
                 return false;
             }
+        }
         case RetryableOperationResult::Success:
             break;
         case RetryableOperationResult::Failure:  // fall through
@@ -191,7 +257,20 @@ bool EncryptedProperties::encryptAndPutInternal(const std::string& key, const By
             return false;
     }
 
-    if (storeValueWithRetries(executor, key, encodedCiphertext, true)) {
+    bool success = false;
+    {
+        // Update the cache in the order the storage is written, so the cache ends up with the stored value.
+        std::lock_guard<std::mutex> lock{m_writeMutex};
+        bool stored = false;
+        success = storeValueWithRetries(executor, key, encodedCiphertext, true, &stored);
+        if (stored) {
+            m_cache.put(key, plaintext);
+        } else {
+            m_cache.remove(key);
+        }
+    }
+
+    if (success) {
         ACSDK_DEBUG0(LX_CFG_KEY("encryptAndPutInternalSuccess", m_configUri, key));
         return true;
     } else {
@@ -204,7 +283,11 @@ bool EncryptedProperties::storeValueWithRetries(
     RetryExecutor& executor,
     const std::string& key,
     const Bytes& value,
-    bool canDrop) noexcept {
+    bool canDrop,
+    bool* stored) noexcept {
+    if (stored) {
+        *stored = false;
+    }
     auto result = executor.execute(
         "storeKeyValue",
         [this, &key, &value]() -> StatusCodeWithRetry {
@@ -221,6 +304,9 @@ bool EncryptedProperties::storeValueWithRetries(
 
     if (RetryableOperationResult::Success == result) {
         ACSDK_DEBUG0(LX_CFG_KEY("storeKeyValueSuccess", m_configUri, key));
+        if (stored) {
+            *stored = true;
+        }
         return true;
     } else if (canDrop && RetryableOperationResult::Cleanup == result) {
         if (deleteValueWithRetries(executor, key)) {
@@ -236,6 +322,31 @@ bool EncryptedProperties::storeValueWithRetries(
     }
 }
 
+bool EncryptedProperties::storeValuesWithRetries(
+    RetryExecutor& executor,
+    const std::unordered_map<std::string, Bytes>& values) noexcept {
+    auto result = executor.execute(
+        "storeKeyValues",
+        [this, &values]() -> StatusCodeWithRetry {
+            if (m_innerProperties->putBytesBatch(values)) {
+                ACSDK_DEBUG9(LX_CFG("putBytesBatchSuccess", m_configUri));
+                return RetryExecutor::SUCCESS;
+            } else {
+                ACSDK_DEBUG9(LX_CFG("putBytesBatchRetryableFailure", m_configUri));
+                return RetryExecutor::RETRYABLE_INNER_PROPERTIES_ERROR;
+            }
+        },
+        Action::RETRY);
+
+    if (RetryableOperationResult::Success == result) {
+        ACSDK_DEBUG0(LX_CFG("storeKeyValuesSuccess", m_configUri));
+        return true;
+    } else {
+        ACSDK_ERROR(LX_CFG("storeKeyValuesError", m_configUri));
+        return false;
+    }
+}
+
 bool EncryptedProperties::loadValueWithRetries(RetryExecutor& executor, const std::string& key, Bytes& data) noexcept {
     return executeKeyOperationWithRetries(
         executor, "loadValue", key, [this, &key, &data]() -> bool { return m_innerProperties->getBytes(key, data); });
@@ -295,7 +406,12 @@ bool EncryptedProperties::clear() noexcept {
 }
 
 bool EncryptedProperties::doClear(RetryExecutor& executor) noexcept {
-    auto result = clearAllValuesWithRetries(executor);
+    bool result = false;
+    {
+        std::lock_guard<std::mutex> lock{m_writeMutex};
+        result = clearAllValuesWithRetries(executor);
+        m_cache.clear();
+    }
     if (!result) {
         ACSDK_ERROR(LX_CFG("doClearFailed", m_configUri));
         return false;
@@ -320,7 +436,14 @@ bool EncryptedProperties::remove(const std::string& key) noexcept {
 
     // Remove calls are considered put.
     RetryExecutor executor{OperationType::Put, m_configUri};
-    if (deleteValueWithRetries(executor, key)) {
+    bool deleted = false;
+    {
+        std::lock_guard<std::mutex> lock{m_writeMutex};
+        deleted = deleteValueWithRetries(executor, key);
+        // Drop the cached value after the storage is updated, so a concurrent read can't cache the removed value.
+        m_cache.remove(key);
+    }
+    if (deleted) {
         ACSDK_DEBUG0(LX_CFG_KEY("removeSuccess", m_configUri, key));
         return true;
     } else {
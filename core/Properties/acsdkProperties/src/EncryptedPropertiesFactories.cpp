@@ -30,8 +30,9 @@ static const std::string TAG{"EncryptedPropertiesFactoryApi"};
 std::shared_ptr<PropertiesFactoryInterface> createEncryptedPropertiesFactory(
     const std::shared_ptr<PropertiesFactoryInterface>& innerPropertiesFactory,
     const std::shared_ptr<CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<KeyStoreInterface>& keyStore) noexcept {
-    auto res = EncryptedPropertiesFactory::create(innerPropertiesFactory, cryptoFactory, keyStore);
+    const std::shared_ptr<KeyStoreInterface>& keyStore,
+    std::size_t cacheCapacity) noexcept {
+    auto res = EncryptedPropertiesFactory::create(innerPropertiesFactory, cryptoFactory, keyStore, cacheCapacity);
     if (!res) {
         ACSDK_ERROR(LX("createEncryptedPropertiesFactoryFailed"));
     }
@@ -42,13 +43,14 @@ std::shared_ptr<alexaClientSDK::acsdkPropertiesInterfaces::PropertiesFactoryInte
     const std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::storage::MiscStorageInterface>& innerStorage,
     const std::shared_ptr<MiscStorageUriMapperInterface>& uriMapper,
     const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore) noexcept {
+    const std::shared_ptr<alexaClientSDK::acsdkCryptoInterfaces::KeyStoreInterface>& keyStore,
+    std::size_t cacheCapacity) noexcept {
     auto adapter = createPropertiesFactory(innerStorage, uriMapper);
     if (!adapter) {
         ACSDK_ERROR(LX("createEncryptedPropertiesFactoryFailed").d("reason", "miscStorageAdapterCreateFailed"));
         return nullptr;
     }
-    return createEncryptedPropertiesFactory(adapter, cryptoFactory, keyStore);
+    return createEncryptedPropertiesFactory(adapter, cryptoFactory, keyStore, cacheCapacity);
 }
 
 }  // namespace acsdkProperties
@@ -31,9 +31,10 @@ static const std::string TAG{"EncryptedPropertiesFactory"};
 std::shared_ptr<PropertiesFactoryInterface> EncryptedPropertiesFactory::create(
     const std::shared_ptr<PropertiesFactoryInterface>& innerFactory,
     const std::shared_ptr<CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<KeyStoreInterface>& keyStore) noexcept {
+    const std::shared_ptr<KeyStoreInterface>& keyStore,
+    size_t cacheCapacity) noexcept {
     auto res = std::shared_ptr<EncryptedPropertiesFactory>(
-        new EncryptedPropertiesFactory(innerFactory, cryptoFactory, keyStore));
+        new EncryptedPropertiesFactory(innerFactory, cryptoFactory, keyStore, cacheCapacity));
     if (!res->init()) {
         res.reset();
     }
@@ -43,10 +44,12 @@ std::shared_ptr<PropertiesFactoryInterface> EncryptedPropertiesFactory::create(
 EncryptedPropertiesFactory::EncryptedPropertiesFactory(
     const std::shared_ptr<PropertiesFactoryInterface>& storage,
     const std::shared_ptr<CryptoFactoryInterface>& cryptoFactory,
-    const std::shared_ptr<KeyStoreInterface>& keyStore) noexcept :
+    const std::shared_ptr<KeyStoreInterface>& keyStore,
+    size_t cacheCapacity) noexcept :
         m_storage(storage),
         m_cryptoFactory(cryptoFactory),
-        m_keyStore(keyStore) {
+        m_keyStore(keyStore),
+        m_cacheCapacity(cacheCapacity) {
 }
 
 bool EncryptedPropertiesFactory::init() noexcept {
@@ -65,7 +68,21 @@ bool EncryptedPropertiesFactory::init() noexcept {
 }
 
 std::shared_ptr<PropertiesInterface> EncryptedPropertiesFactory::getProperties(const std::string& configUri) noexcept {
-    return EncryptedProperties::create(configUri, m_storage->getProperties(configUri), m_cryptoFactory, m_keyStore);
+    if (!m_cacheCapacity) {
+        return EncryptedProperties::create(configUri, m_storage->getProperties(configUri), m_cryptoFactory, m_keyStore);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_properties.find(configUri);
+    if (m_properties.end() != it) {
+        return it->second;
+    }
+    auto properties = EncryptedProperties::create(
+        configUri, m_storage->getProperties(configUri), m_cryptoFactory, m_keyStore, m_cacheCapacity);
+    if (properties) {
+        m_properties[configUri] = properties;
+    }
+    return properties;
 }
 
 }  // namespace acsdkProperties
@@ -208,6 +208,42 @@ bool MiscStorageProperties::putBytes(const std::string& key, const Bytes& value)
     }
 }
 
+bool MiscStorageProperties::putBytesBatch(const std::unordered_map<std::string, Bytes>& values) noexcept {
+    // create executor to invoke error callback and limit number of retries
+    RetryExecutor executor{OperationType::Put, m_configUri};
+
+    std::unordered_map<std::string, std::string> base64Values;
+    for (const auto& entry : values) {
+        std::string base64Value;
+        if (!encodeBase64(entry.second, base64Value)) {
+            ACSDK_ERROR(LX_CFG_KEY("putBytesBatchEncodingFailed", m_configUri, entry.first));
+            return false;
+        }
+        base64Values.emplace(entry.first, std::move(base64Value));
+    }
+
+    auto result = executor.execute(
+        "putBytesBatch",
+        [this, &base64Values]() -> StatusCodeWithRetry {
+            if (m_storage->putBatch(m_componentName, m_tableName, base64Values)) {
+                ACSDK_DEBUG9(LX_CFG("putBytesBatchSuccess", m_configUri));
+                return RetryExecutor::SUCCESS;
+            } else {
+                ACSDK_DEBUG9(LX_CFG("putBytesBatchRetryableFailure", m_configUri));
+                return RetryExecutor::RETRYABLE_INNER_PROPERTIES_ERROR;
+            }
+        },
+        Action::FAIL);
+
+    if (RetryableOperationResult::Success == result) {
+        ACSDK_DEBUG0(LX_CFG("putBytesBatchSuccess", m_configUri).d("count", values.size()));
+        return true;
+    } else {
+        ACSDK_ERROR(LX_CFG("putBytesBatchFailed", m_configUri).d("count", values.size()));
+        return false;
+    }
+}
+
 bool MiscStorageProperties::remove(const std::string& key) noexcept {
     RetryExecutor executor{OperationType::Put, m_configUri};
     auto success = executeRetryableKeyAction(
@@ -0,0 +1,157 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fstream>
+#include <string>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <acsdkProperties/private/DecryptedValueCache.h>
+
+namespace alexaClientSDK {
+namespace acsdkProperties {
+namespace test {
+
+/// @private
+typedef DecryptedValueCache::Bytes Bytes;
+
+/// Test that a disabled cache never stores values.
+TEST(DecryptedValueCacheTest, test_disabledCache) {
+    DecryptedValueCache cache{0};
+    ASSERT_FALSE(cache.isEnabled());
+
+    cache.put("key", Bytes{1, 2, 3});
+    Bytes value;
+    ASSERT_FALSE(cache.get("key", value));
+    ASSERT_EQ(0u, cache.getSize());
+}
+
+/// Test that stored values are returned and removed values are not.
+TEST(DecryptedValueCacheTest, test_putGetRemove) {
+    DecryptedValueCache cache{16};
+    cache.put("key", Bytes{1, 2, 3});
+
+    Bytes value;
+    ASSERT_TRUE(cache.get("key", value));
+    ASSERT_EQ((Bytes{1, 2, 3}), value);
+
+    cache.put("key", Bytes{4, 5});
+    ASSERT_TRUE(cache.get("key", value));
+    ASSERT_EQ((Bytes{4, 5}), value);
+    ASSERT_EQ(2u, cache.getSize());
+
+    cache.remove("key");
+    ASSERT_FALSE(cache.get("key", value));
+    ASSERT_EQ(0u, cache.getSize());
+}
+
+/// Test that least recently used values are evicted above the capacity, and oversized values are not cached.
+TEST(DecryptedValueCacheTest, test_evictLeastRecentlyUsed) {
+    DecryptedValueCache cache{8};
+    cache.put("key1", Bytes(4, 1));
+    cache.put("key2", Bytes(4, 2));
+
+    Bytes value;
+    // Touch key1, so key2 becomes the least recently used value.
+    ASSERT_TRUE(cache.get("key1", value));
+    cache.put("key3", Bytes(4, 3));
+
+    ASSERT_TRUE(cache.get("key1", value));
+    ASSERT_FALSE(cache.get("key2", value));
+    ASSERT_TRUE(cache.get("key3", value));
+    ASSERT_EQ(8u, cache.getSize());
+
+    cache.put("key4", Bytes(9, 4));
+    ASSERT_FALSE(cache.get("key4", value));
+    ASSERT_EQ(8u, cache.getSize());
+}
+
+/// Test that a value loaded before a modification is not cached.
+TEST(DecryptedValueCacheTest, test_putIfUnchangedSkipsStaleValue) {
+    DecryptedValueCache cache{16};
+
+    auto generation = cache.getGeneration();
+    cache.put("key", Bytes{2});
+    cache.putIfUnchanged("key", Bytes{1}, generation);
+
+    Bytes value;
+    ASSERT_TRUE(cache.get("key", value));
+    ASSERT_EQ((Bytes{2}), value);
+
+    generation = cache.getGeneration();
+    cache.putIfUnchanged("other", Bytes{3}, generation);
+    ASSERT_TRUE(cache.get("other", value));
+    ASSERT_EQ((Bytes{3}), value);
+
+    generation = cache.getGeneration();
+    cache.clear();
+    cache.putIfUnchanged("key", Bytes{1}, generation);
+    ASSERT_FALSE(cache.get("key", value));
+    ASSERT_EQ(0u, cache.getSize());
+}
+
+#ifdef __linux__
+/**
+ * Read the amount of locked memory of this process.
+ *
+ * @return Locked memory in bytes, or zero if it cannot be read.
+ */
+static std::size_t getLockedMemory() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmLck:") == 0) {
+            return std::stoul(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+/// Test that evicting a value keeps the values which remain cached locked in memory.
+TEST(DecryptedValueCacheTest, test_evictionKeepsOtherValuesLocked) {
+    const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    const auto lockedBefore = getLockedMemory();
+
+    DecryptedValueCache cache{2};
+    cache.put("key1", Bytes{1});
+    if (getLockedMemory() == lockedBefore) {
+        // Locking is best effort, and the limit of this process does not allow it.
+        return;
+    }
+    cache.put("key2", Bytes{2});
+    ASSERT_EQ(lockedBefore + 2 * pageSize, getLockedMemory());
+
+    // Adding key3 evicts key1. Small values allocated from a shared page would all be unlocked by the eviction.
+    cache.put("key3", Bytes{3});
+    Bytes value;
+    ASSERT_FALSE(cache.get("key1", value));
+    ASSERT_TRUE(cache.get("key2", value));
+    ASSERT_EQ((Bytes{2}), value);
+    ASSERT_TRUE(cache.get("key3", value));
+    ASSERT_EQ((Bytes{3}), value);
+    ASSERT_EQ(lockedBefore + 2 * pageSize, getLockedMemory());
+
+    cache.clear();
+    ASSERT_EQ(lockedBefore, getLockedMemory());
+}
+#endif
+
+}  // namespace test
+}  // namespace acsdkProperties
+}  // namespace alexaClientSDK
@@ -150,6 +150,24 @@ TEST(MiscStoragePropertiesTest, testPutBytes) {
     ASSERT_TRUE(props->putBytes("key", MiscStorageProperties::Bytes{0, 1, 2}));
 }
 
+TEST(MiscStoragePropertiesTest, testPutBytesBatch) {
+    auto mockMiscStorage = std::make_shared<MockMiscStorage>();
+
+    EXPECT_CALL(*mockMiscStorage, tableExists(_, _, _))
+        .WillOnce(Invoke([](const std::string&, const std::string&, bool* res) {
+            *res = true;
+            return true;
+        }));
+
+    auto props = MiscStorageProperties::create(mockMiscStorage, "component/namespace", "component", "namespace");
+    ASSERT_NE(nullptr, props);
+
+    EXPECT_CALL(*mockMiscStorage, put(Eq("component"), Eq("namespace"), Eq("key1"), Eq("AAEC"))).WillOnce(Return(true));
+    EXPECT_CALL(*mockMiscStorage, put(Eq("component"), Eq("namespace"), Eq("key2"), Eq("AwQF"))).WillOnce(Return(true));
+    ASSERT_TRUE(props->putBytesBatch(
+        {{"key1", MiscStorageProperties::Bytes{0, 1, 2}}, {"key2", MiscStorageProperties::Bytes{3, 4, 5}}}));
+}
+
 TEST(MiscStoragePropertiesTest, testPutFailed) {
     auto mockMiscStorage = std::make_shared<MockMiscStorage>();
 
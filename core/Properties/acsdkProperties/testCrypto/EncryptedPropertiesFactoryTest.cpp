@@ -54,6 +54,12 @@ static const std::string JSON_TEST_CONFIG = R"(
 /// @private
 static const std::string CONFIG_URI{"component/config"};
 
+/// @private
+static const std::string OTHER_CONFIG_URI{"component/otherConfig"};
+
+/// @private
+static constexpr size_t CACHE_CAPACITY = 1024;
+
 /// @private
 static void initConfig() {
     ConfigurationNode::uninitialize();
@@ -90,6 +96,26 @@ TEST(EncryptedPropertiesFactoryTest, test_getPropertiesEncrypted) {
     ASSERT_TRUE(innerProperties->getBytes("$acsdkEncryption$", value));
 }
 
+/// Test that a factory with a decrypted value cache shares one properties instance per configuration URI.
+TEST(EncryptedPropertiesFactoryTest, test_getPropertiesSharedWithCache) {
+    initConfig();
+
+    auto cryptoFactory = createCryptoFactory();
+    auto keyStore = createKeyStore();
+    auto innerPropertiesFactory = StubPropertiesFactory::create();
+
+    auto factory = EncryptedPropertiesFactory::create(innerPropertiesFactory, cryptoFactory, keyStore, CACHE_CAPACITY);
+    ASSERT_NE(nullptr, factory);
+
+    auto props = factory->getProperties(CONFIG_URI);
+    ASSERT_NE(nullptr, props);
+    ASSERT_EQ(props, factory->getProperties(CONFIG_URI));
+    ASSERT_NE(props, factory->getProperties(OTHER_CONFIG_URI));
+
+    auto uncachedFactory = EncryptedPropertiesFactory::create(innerPropertiesFactory, cryptoFactory, keyStore);
+    ASSERT_NE(uncachedFactory->getProperties(CONFIG_URI), uncachedFactory->getProperties(CONFIG_URI));
+}
+
 TEST(EncryptedPropertiesFactoryTest, test_createNullInnerFactory) {
     auto mockCryptoFactory = std::make_shared<MockCryptoFactory>();
     auto mockKeyStore = std::make_shared<MockKeyStore>();
@@ -14,7 +14,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 #include <acsdkCodecUtils/Hex.h>
 #include <acsdkCrypto/CryptoFactory.h>
@@ -233,6 +238,166 @@ TEST(EncryptedPropertiesTest, test_reopenEncryptedProperties) {
     ASSERT_EQ("some plaintext value", value);
 }
 
+TEST(EncryptedPropertiesTest, test_cachedGetSkipsInnerProperties) {
+    initConfig();
+
+    auto cryptoFactory = createCryptoFactory();
+    ASSERT_NE(nullptr, cryptoFactory);
+    auto keyStore = createKeyStore();
+    ASSERT_NE(nullptr, keyStore);
+
+    auto stubPropsFactory = StubPropertiesFactory::create();
+    auto innerProps = stubPropsFactory->getProperties("test/test");
+
+    auto properties = EncryptedProperties::create(CONFIG_URI, innerProps, cryptoFactory, keyStore, 1024);
+    ASSERT_NE(nullptr, properties);
+    ASSERT_TRUE(properties->putString("property1", "some plaintext value"));
+
+    // Value is served from the cache even when it is gone from the inner properties.
+    ASSERT_TRUE(innerProps->remove("property1"));
+    std::string value;
+    ASSERT_TRUE(properties->getString("property1", value));
+    ASSERT_EQ("some plaintext value", value);
+
+    // Removing the value through encrypted properties drops the cached value.
+    ASSERT_TRUE(properties->remove("property1"));
+    ASSERT_FALSE(properties->getString("property1", value));
+}
+
+TEST(EncryptedPropertiesTest, test_putBytesBatch) {
+    initConfig();
+
+    auto cryptoFactory = createCryptoFactory();
+    ASSERT_NE(nullptr, cryptoFactory);
+    auto keyStore = createKeyStore();
+    ASSERT_NE(nullptr, keyStore);
+
+    auto innerStorage = StubMiscStorage::create();
+    auto innerProperties = MiscStorageProperties::create(innerStorage, CONFIG_URI, COMPONENT_NAME, CONFIG_NAMESPACE);
+    ASSERT_NE(nullptr, innerProperties);
+
+    auto properties = EncryptedProperties::create(CONFIG_URI, innerProperties, cryptoFactory, keyStore);
+    ASSERT_NE(nullptr, properties);
+
+    std::unordered_map<std::string, PropertiesInterface::Bytes> values = {{"property1", {1, 2, 3}},
+                                                                          {"property2", {4, 5, 6}}};
+    ASSERT_TRUE(properties->putBytesBatch(values));
+    ASSERT_FALSE(properties->putBytesBatch({{KEY_PROPERTY_NAME, {1}}}));
+
+    for (const auto& entry : values) {
+        PropertiesInterface::Bytes ciphertext;
+        ASSERT_TRUE(innerProperties->getBytes(entry.first, ciphertext));
+        EXPECT_NE(entry.second, ciphertext);
+
+        PropertiesInterface::Bytes plaintext;
+        ASSERT_TRUE(properties->getBytes(entry.first, plaintext));
+        EXPECT_EQ(entry.second, plaintext);
+    }
+}
+
+TEST(EncryptedPropertiesTest, test_concurrentPutsLeaveCacheConsistentWithStorage) {
+    initConfig();
+
+    auto cryptoFactory = createCryptoFactory();
+    ASSERT_NE(nullptr, cryptoFactory);
+    auto keyStore = createKeyStore();
+    ASSERT_NE(nullptr, keyStore);
+
+    auto innerStorage = StubMiscStorage::create();
+    auto innerProperties = MiscStorageProperties::create(innerStorage, CONFIG_URI, COMPONENT_NAME, CONFIG_NAMESPACE);
+    ASSERT_NE(nullptr, innerProperties);
+
+    // Delegate to the storage, but hold the first write of property1 after it is stored, before the caller can update
+    // its cache, long enough for a second put to run.
+    std::atomic<bool> firstWrite{true};
+    std::promise<void> firstWriteStored;
+    auto mockProperties = std::make_shared<NiceMock<MockProperties>>();
+    ON_CALL(*mockProperties, _getBytes(_, _))
+        .WillByDefault(Invoke([&](const std::string& key, PropertiesInterface::Bytes& value) {
+            return innerProperties->getBytes(key, value);
+        }));
+    ON_CALL(*mockProperties, _putBytes(_, _))
+        .WillByDefault(Invoke([&](const std::string& key, const PropertiesInterface::Bytes& value) {
+            auto result = innerProperties->putBytes(key, value);
+            if ("property1" == key && firstWrite.exchange(false)) {
+                firstWriteStored.set_value();
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            }
+            return result;
+        }));
+    ON_CALL(*mockProperties, _getKeys(_)).WillByDefault(Invoke([&](std::unordered_set<std::string>& keys) {
+        return innerProperties->getKeys(keys);
+    }));
+    ON_CALL(*mockProperties, _remove(_)).WillByDefault(Invoke([&](const std::string& key) {
+        return innerProperties->remove(key);
+    }));
+    ON_CALL(*mockProperties, _clear()).WillByDefault(Invoke([&]() { return innerProperties->clear(); }));
+
+    auto properties = EncryptedProperties::create(CONFIG_URI, mockProperties, cryptoFactory, keyStore, 4096);
+    ASSERT_NE(nullptr, properties);
+
+    const PropertiesInterface::Bytes firstValue{1};
+    const PropertiesInterface::Bytes secondValue{2};
+    std::thread firstPut([&] { EXPECT_TRUE(properties->putBytes("property1", firstValue)); });
+    firstWriteStored.get_future().wait();
+    EXPECT_TRUE(properties->putBytesBatch({{"property1", secondValue}}));
+    firstPut.join();
+
+    // Read the storage through an instance without a cache.
+    auto uncachedProperties = EncryptedProperties::create(CONFIG_URI, innerProperties, cryptoFactory, keyStore);
+    ASSERT_NE(nullptr, uncachedProperties);
+    PropertiesInterface::Bytes stored;
+    ASSERT_TRUE(uncachedProperties->getBytes("property1", stored));
+    EXPECT_EQ(secondValue, stored);
+
+    PropertiesInterface::Bytes cached;
+    ASSERT_TRUE(properties->getBytes("property1", cached));
+    EXPECT_EQ(stored, cached);
+}
+
+TEST(EncryptedPropertiesTest, test_getPutLatencyWithAndWithoutCache) {
+    initConfig();
+
+    auto cryptoFactory = createCryptoFactory();
+    ASSERT_NE(nullptr, cryptoFactory);
+    auto keyStore = createKeyStore();
+    ASSERT_NE(nullptr, keyStore);
+
+    const int iterations = 100;
+    const std::string plaintext(1024, 'x');
+
+    for (size_t cacheCapacity : {size_t{0}, size_t{4096}}) {
+        auto innerStorage = StubMiscStorage::create();
+        auto innerProperties =
+            MiscStorageProperties::create(innerStorage, CONFIG_URI, COMPONENT_NAME, CONFIG_NAMESPACE);
+        ASSERT_NE(nullptr, innerProperties);
+        auto properties =
+            EncryptedProperties::create(CONFIG_URI, innerProperties, cryptoFactory, keyStore, cacheCapacity);
+        ASSERT_NE(nullptr, properties);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            ASSERT_TRUE(properties->putString("property1", plaintext));
+        }
+        auto putDuration = std::chrono::steady_clock::now() - start;
+
+        std::string value;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            ASSERT_TRUE(properties->getString("property1", value));
+        }
+        auto getDuration = std::chrono::steady_clock::now() - start;
+        ASSERT_EQ(plaintext, value);
+
+        ACSDK_INFO(LX("latency")
+                       .d("cacheCapacity", cacheCapacity)
+                       .d("putUs", std::chrono::duration_cast<std::chrono::microseconds>(putDuration).count() /
+                                       iterations)
+                       .d("getUs", std::chrono::duration_cast<std::chrono::microseconds>(getDuration).count() /
+                                       iterations));
+    }
+}
+
 }  // namespace test
 }  // namespace acsdkProperties
 }  // namespace alexaClientSDK
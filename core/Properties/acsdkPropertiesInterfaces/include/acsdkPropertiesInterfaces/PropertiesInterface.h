@@ -17,6 +17,7 @@
 #define ACSDKPROPERTIESINTERFACES_PROPERTIESINTERFACE_H_
 
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -104,6 +105,29 @@ public:
      */
     virtual bool putBytes(const std::string& key, const Bytes& value) noexcept = 0;
 
+    //! Method to store several binary values into configuration.
+    /**
+     * This method stores binary values for several keys. Existing values for the same keys are overwritten.
+     *
+     * Implementations backed by a transactional storage should commit all values at once, so either all or none of
+     * them are stored. The default implementation stores values one by one with #putBytes and stops on the first
+     * error.
+     *
+     * @param[in] values Map of configuration keys to values to store.
+     * @return True if all values have been stored, false otherwise. If this method returns false, any of the values
+     * may stay unchanged, or lost.
+     *
+     * @sa #putBytes
+     */
+    virtual bool putBytesBatch(const std::unordered_map<std::string, Bytes>& values) noexcept {
+        for (const auto& entry : values) {
+            if (!putBytes(entry.first, entry.second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     //! Method to inspect existing properties.
     /**
      * This method provides a set of known property keys from a configuration container.
@@ -0,0 +1,117 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKCODECUTILS_PRIVATE_CODECKERNELS_H_
+#define ACSDKCODECUTILS_PRIVATE_CODECKERNELS_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <acsdkCodecUtils/Types.h>
+
+namespace alexaClientSDK {
+namespace acsdkCodecUtils {
+
+/**
+ * @brief Block kernels for Base64 and hex codecs.
+ *
+ * Kernels work on raw buffers which are sized by the caller, and only handle the bulk of the data: whole Base64 blocks
+ * without padding, and whitespace free hex strings. Padding, whitespace and input validation of the overall shape are
+ * handled by the codec functions.
+ *
+ * Vectorized kernels are selected at runtime from the instruction sets supported by the CPU. Every kernel set produces
+ * exactly the same output as the scalar one.
+ *
+ * @private
+ */
+struct CodecKernels {
+    /**
+     * @brief Encodes whole Base64 blocks.
+     *
+     * @param[in] input Binary data of @a nBlocks * 3 bytes.
+     * @param[in] nBlocks Number of blocks to encode.
+     * @param[out] output Destination for @a nBlocks * 4 characters.
+     */
+    typedef void (*EncodeBase64Function)(const Byte* input, size_t nBlocks, char* output);
+
+    /**
+     * @brief Decodes whole Base64 blocks without padding.
+     *
+     * @param[in] input Base64 characters of @a nBlocks * 4 bytes.
+     * @param[in] nBlocks Number of blocks to decode.
+     * @param[out] output Destination for @a nBlocks * 3 bytes.
+     * @return False if input contains a character which is not one of A-Z,a-z,0-9,'+','/'.
+     */
+    typedef bool (*DecodeBase64Function)(const char* input, size_t nBlocks, Byte* output);
+
+    /**
+     * @brief Encodes binary data into lowercase hex characters.
+     *
+     * @param[in] input Binary data.
+     * @param[in] size Number of bytes to encode.
+     * @param[out] output Destination for @a size * 2 characters.
+     */
+    typedef void (*EncodeHexFunction)(const Byte* input, size_t size, char* output);
+
+    /**
+     * @brief Decodes hex characters into binary data.
+     *
+     * @param[in] input Hex characters of @a size * 2 bytes.
+     * @param[in] size Number of bytes to decode.
+     * @param[out] output Destination for @a size bytes.
+     * @return False if input contains a character which is not one of 0-9,a-f,A-F.
+     */
+    typedef bool (*DecodeHexFunction)(const char* input, size_t size, Byte* output);
+
+    /// Name of the instruction sets used by the kernels, for logging and tests.
+    const char* name;
+
+    /// Base64 encoder.
+    EncodeBase64Function encodeBase64;
+
+    /// Base64 decoder.
+    DecodeBase64Function decodeBase64;
+
+    /// Hex encoder.
+    EncodeHexFunction encodeHex;
+
+    /// Hex decoder.
+    DecodeHexFunction decodeHex;
+};
+
+/**
+ * @brief Returns the fastest kernels supported by the CPU.
+ *
+ * The selection is made on the first call.
+ *
+ * @return Kernel set.
+ * @private
+ */
+const CodecKernels& getCodecKernels() noexcept;
+
+/**
+ * @brief Returns every kernel set supported by the CPU, starting with the scalar one.
+ *
+ * This method is used to compare kernels in tests.
+ *
+ * @return Kernel sets.
+ * @private
+ */
+std::vector<const CodecKernels*> getSupportedCodecKernels() noexcept;
+
+}  // namespace acsdkCodecUtils
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKCODECUTILS_PRIVATE_CODECKERNELS_H_
@@ -13,59 +13,21 @@
  * permissions and limitations under the License.
  */
 
-#include <climits>
+#include <cstring>
 
 #include <acsdkCodecUtils/private/Base64Common.h>
+#include <acsdkCodecUtils/private/CodecKernels.h>
 
 namespace alexaClientSDK {
 namespace acsdkCodecUtils {
 
-/// @brief Number of bits in Base64 byte.
+/// @brief Padding character.
 /// @private
-static constexpr unsigned B64CHAR_BIT = 6;
+static constexpr char PAD_CHAR = '=';
 
-/// @brief Bit mask (maximum value) of Base64 byte.
+/// @brief Character with zero value, which replaces padding before decoding the last block.
 /// @private
-static constexpr unsigned B64CHAR_MAX = 0x3F;
-
-/// @brief Letter count for A-Z or a-z range.
-/// @private
-static constexpr unsigned AZ_LETTER_COUNT = 26;
-
-/// @brief Letter count for 0-9 range.
-/// @private
-static constexpr unsigned DIGITS_COUNT = 10;
-
-/// @brief Binary value for plus character.
-/// @private
-static constexpr unsigned SYM_PLUS_VALUE = 62;
-
-/// @brief Binary value for divide character.
-/// @private
-static constexpr unsigned SYM_DIV_VALUE = 63;
-
-/**
- * @brief Maps binary value into character.
- *
- * Maps 6-bit binary value into ASCII character for Base64 encoding.
- *
- * @param[in] value Binary value to map into character. The value must be in range of 0..63 inclusive.
- * @return ASCII character.
- */
-static char mapValueToChar(uint32_t value) noexcept {
-    if (value < AZ_LETTER_COUNT) {
-        return static_cast<char>(value + 'A');
-    } else if (value < AZ_LETTER_COUNT * 2) {
-        return static_cast<char>(value - AZ_LETTER_COUNT + 'a');
-    } else if (value < AZ_LETTER_COUNT * 2 + DIGITS_COUNT) {
-        return static_cast<char>(value - (AZ_LETTER_COUNT * 2) + '0');
-    } else if (SYM_PLUS_VALUE == value) {
-        return '+';
-    } else {
-        // value must be equal to SYM_DIV_VALUE
-        return '/';
-    }
-}
+static constexpr char ZERO_CHAR = 'A';
 
 bool encodeBase64(const Bytes& binary, std::string& base64String) noexcept {
     if (binary.empty()) {
@@ -79,79 +41,90 @@ bool encodeBase64(const Bytes& binary, std::string& base64String) noexcept {
     if (nTail) {
         outputSize += B64CHAR_BLOCK;
     }
-    base64String.reserve(base64String.size() + outputSize);
+    size_t offset = base64String.size();
+    base64String.resize(offset + outputSize);
+    char* output = &base64String[offset];
 
-    unsigned int accumulator = 0;
-    unsigned int nBits = 0;
-
-    for (Byte b : binary) {
-        accumulator = (accumulator << CHAR_BIT) | static_cast<unsigned int>(b);
-        nBits += CHAR_BIT;
-        if (nBits == B64CHAR_BIT * 2) {
-            nBits = B64CHAR_BIT;
-            base64String.push_back(mapValueToChar((accumulator >> B64CHAR_BIT) & B64CHAR_MAX));
-        }
-        if (nBits >= B64CHAR_BIT) {
-            nBits -= B64CHAR_BIT;
-            base64String.push_back(mapValueToChar((accumulator >> nBits) & B64CHAR_MAX));
-        }
-    }
-    if (nBits > 0) {
-        base64String.push_back(mapValueToChar((accumulator << (B64CHAR_BIT - nBits)) & B64CHAR_MAX));
-    }
+    const CodecKernels& kernels = getCodecKernels();
+    kernels.encodeBase64(binary.data(), nBlocks, output);
 
     if (nTail) {
-        base64String.push_back('=');
-        if (1 == nTail) {
-            base64String.push_back('=');
+        // Encode the last block with zero bits appended, and replace missing characters with padding.
+        Byte block[B64BIN_BLOCK] = {};
+        std::memcpy(block, binary.data() + nBlocks * B64BIN_BLOCK, nTail);
+        output += nBlocks * B64CHAR_BLOCK;
+        kernels.encodeBase64(block, 1, output);
+        for (size_t i = nTail + 1; i < B64CHAR_BLOCK; ++i) {
+            output[i] = PAD_CHAR;
         }
     }
 
     return true;
 }
 
-bool decodeBase64(const std::string& base64String, Bytes& binary) noexcept {
-    Bytes tmp;
-    if (!preprocessBase64(base64String, tmp)) {
+/**
+ * @brief Decodes Base64 data without whitespace.
+ *
+ * @param[in] input Base64 characters.
+ * @param[in] size Number of characters.
+ * @param[in,out] binary Decoded data. The method appends data to the container.
+ * @return True, if operation succeeds. If operation fails, the contents of \a binary is unmodified.
+ * @private
+ */
+static bool decodeStrippedBase64(const char* input, size_t size, Bytes& binary) noexcept {
+    if (!size) {
+        return true;
+    }
+    if (size % B64CHAR_BLOCK) {
         return false;
     }
-    if (tmp.empty()) {
-        return true;
+
+    size_t nPad = 0;
+    while (nPad < B64CHAR_BLOCK && PAD_CHAR == input[size - 1 - nPad]) {
+        ++nPad;
     }
-    if (tmp.size() % B64CHAR_BLOCK) {
+    if (nPad >= B64BIN_BLOCK) {
         return false;
     }
-    size_t expectedLen = tmp.size() / B64CHAR_BLOCK * B64BIN_BLOCK;
-
-    unsigned int accumulator = 0;
-    unsigned int nBits = 0;
-    size_t len = 0;
-    for (unsigned char ch : tmp) {
-        unsigned value;
-        if (ch == '=') {
-            break;
-        } else if (ch >= 'A' && ch <= 'Z') {
-            value = ch - 'A';
-        } else if (ch >= 'a' && ch <= 'z') {
-            value = ch - 'a' + AZ_LETTER_COUNT;
-        } else if (ch >= '0' && ch <= '9') {
-            value = ch - '0' + AZ_LETTER_COUNT * 2;
-        } else if ('+' == ch) {
-            value = SYM_PLUS_VALUE;
-        } else {
-            // ch must be equal to '/'
-            value = SYM_DIV_VALUE;
-        }
-        accumulator = (accumulator << B64CHAR_BIT) | value;
-        nBits += B64CHAR_BIT;
-        if (nBits >= CHAR_BIT) {
-            nBits -= CHAR_BIT;
-            binary.push_back(static_cast<Byte>((accumulator >> nBits) & UCHAR_MAX));
-            len++;
-        }
+
+    size_t nBlocks = size / B64CHAR_BLOCK;
+    if (nPad) {
+        --nBlocks;
+    }
+    size_t offset = binary.size();
+    binary.resize(offset + nBlocks * B64BIN_BLOCK + (nPad ? B64BIN_BLOCK - nPad : 0));
+    Byte* output = binary.data() + offset;
+
+    const CodecKernels& kernels = getCodecKernels();
+    bool result = kernels.decodeBase64(input, nBlocks, output);
+
+    if (result && nPad) {
+        // Decode the last block with padding replaced by zero bits, and drop the bytes which only contain them.
+        char block[B64CHAR_BLOCK];
+        std::memcpy(block, input + nBlocks * B64CHAR_BLOCK, B64CHAR_BLOCK - nPad);
+        std::memset(block + B64CHAR_BLOCK - nPad, ZERO_CHAR, nPad);
+        Byte tail[B64BIN_BLOCK];
+        result = kernels.decodeBase64(block, 1, tail);
+        std::memcpy(output + nBlocks * B64BIN_BLOCK, tail, B64BIN_BLOCK - nPad);
     }
 
-    return len <= expectedLen;
+    if (!result) {
+        binary.resize(offset);
+    }
+    return result;
+}
+
+bool decodeBase64(const std::string& base64String, Bytes& binary) noexcept {
+    // Most inputs have no whitespace and can be decoded in place. Otherwise the input is validated and stripped first.
+    if (decodeStrippedBase64(base64String.data(), base64String.size(), binary)) {
+        return true;
+    }
+
+    Bytes tmp;
+    if (!preprocessBase64(base64String, tmp)) {
+        return false;
+    }
+    return decodeStrippedBase64(reinterpret_cast<const char*>(tmp.data()), tmp.size(), binary);
 }
 
 }  // namespace acsdkCodecUtils
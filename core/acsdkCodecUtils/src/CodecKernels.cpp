@@ -0,0 +1,556 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <acsdkCodecUtils/private/CodecKernels.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define ACSDK_CODEC_KERNELS_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define ACSDK_CODEC_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace alexaClientSDK {
+namespace acsdkCodecUtils {
+
+/// @brief Base64 alphabet indexed by 6 bit value.
+/// @private
+static const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// @brief Hex alphabet indexed by 4 bit value.
+/// @private
+static const char HEX_ALPHABET[] = "0123456789abcdef";
+
+/// @brief Value in decoding tables for characters outside of the alphabet.
+/// @private
+static constexpr uint8_t INVALID_VALUE = 0xFF;
+
+/// @brief Number of entries in a decoding table.
+/// @private
+static constexpr size_t DECODE_TABLE_SIZE = 256;
+
+/**
+ * @brief Decoding tables built from the alphabets.
+ *
+ * @private
+ */
+struct DecodeTables {
+    /// Constructs the tables.
+    DecodeTables() noexcept {
+        for (size_t i = 0; i < DECODE_TABLE_SIZE; ++i) {
+            base64[i] = INVALID_VALUE;
+            hex[i] = INVALID_VALUE;
+        }
+        for (uint8_t i = 0; i < sizeof(BASE64_ALPHABET) - 1; ++i) {
+            base64[static_cast<uint8_t>(BASE64_ALPHABET[i])] = i;
+        }
+        for (uint8_t i = 0; i < sizeof(HEX_ALPHABET) - 1; ++i) {
+            hex[static_cast<uint8_t>(HEX_ALPHABET[i])] = i;
+        }
+        for (char ch = 'A'; ch <= 'F'; ++ch) {
+            hex[static_cast<uint8_t>(ch)] = hex[static_cast<uint8_t>(ch - 'A' + 'a')];
+        }
+    }
+
+    /// Base64 character to 6 bit value.
+    uint8_t base64[DECODE_TABLE_SIZE];
+
+    /// Hex character to 4 bit value. Both cases are accepted.
+    uint8_t hex[DECODE_TABLE_SIZE];
+};
+
+/**
+ * @brief Returns the decoding tables.
+ *
+ * @return Decoding tables.
+ * @private
+ */
+static const DecodeTables& getDecodeTables() noexcept {
+    static const DecodeTables tables;
+    return tables;
+}
+
+/// @private
+static void encodeBase64Scalar(const Byte* input, size_t nBlocks, char* output) {
+    for (size_t i = 0; i < nBlocks; ++i, input += 3, output += 4) {
+        uint32_t value = (uint32_t{input[0]} << 16) | (uint32_t{input[1]} << 8) | input[2];
+        output[0] = BASE64_ALPHABET[(value >> 18) & 0x3F];
+        output[1] = BASE64_ALPHABET[(value >> 12) & 0x3F];
+        output[2] = BASE64_ALPHABET[(value >> 6) & 0x3F];
+        output[3] = BASE64_ALPHABET[value & 0x3F];
+    }
+}
+
+/// @private
+static bool decodeBase64Scalar(const char* input, size_t nBlocks, Byte* output) {
+    const uint8_t* table = getDecodeTables().base64;
+    for (size_t i = 0; i < nBlocks; ++i, input += 4, output += 3) {
+        uint32_t v0 = table[static_cast<uint8_t>(input[0])];
+        uint32_t v1 = table[static_cast<uint8_t>(input[1])];
+        uint32_t v2 = table[static_cast<uint8_t>(input[2])];
+        uint32_t v3 = table[static_cast<uint8_t>(input[3])];
+        if ((v0 | v1 | v2 | v3) & 0xC0) {
+            return false;
+        }
+        uint32_t value = (v0 << 18) | (v1 << 12) | (v2 << 6) | v3;
+        output[0] = static_cast<Byte>(value >> 16);
+        output[1] = static_cast<Byte>(value >> 8);
+        output[2] = static_cast<Byte>(value);
+    }
+    return true;
+}
+
+/// @private
+static void encodeHexScalar(const Byte* input, size_t size, char* output) {
+    for (size_t i = 0; i < size; ++i) {
+        output[i * 2] = HEX_ALPHABET[input[i] >> 4];
+        output[i * 2 + 1] = HEX_ALPHABET[input[i] & 0x0F];
+    }
+}
+
+/// @private
+static bool decodeHexScalar(const char* input, size_t size, Byte* output) {
+    const uint8_t* table = getDecodeTables().hex;
+    for (size_t i = 0; i < size; ++i) {
+        uint32_t hi = table[static_cast<uint8_t>(input[i * 2])];
+        uint32_t lo = table[static_cast<uint8_t>(input[i * 2 + 1])];
+        if ((hi | lo) & 0xF0) {
+            return false;
+        }
+        output[i] = static_cast<Byte>((hi << 4) | lo);
+    }
+    return true;
+}
+
+/// @brief Kernels without vector instructions.
+/// @private
+static const CodecKernels SCALAR_KERNELS{"scalar",
+                                         encodeBase64Scalar,
+                                         decodeBase64Scalar,
+                                         encodeHexScalar,
+                                         decodeHexScalar};
+
+#ifdef ACSDK_CODEC_KERNELS_X86
+
+/// @private
+static void encodeHexSse2(const Byte* input, size_t size, char* output) {
+    const __m128i lowNibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i digitBase = _mm_set1_epi8('0');
+    const __m128i letterOffset = _mm_set1_epi8('a' - '0' - 10);
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibbleMask);
+        __m128i lo = _mm_and_si128(bytes, lowNibbleMask);
+        hi = _mm_add_epi8(_mm_add_epi8(hi, digitBase), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), letterOffset));
+        lo = _mm_add_epi8(_mm_add_epi8(lo, digitBase), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), letterOffset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * 2), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    encodeHexScalar(input + i, size - i, output + i * 2);
+}
+
+/**
+ * @brief Converts 16 hex characters into their 4 bit values.
+ *
+ * @param chars Hex characters.
+ * @param[out] valid Set to 0xFF for valid characters and to zero for others.
+ * @return Values of the characters.
+ * @private
+ */
+static inline __m128i hexCharsToValuesSse2(__m128i chars, __m128i& valid) {
+    // Characters above 0x7F are negative, and fail both range checks.
+    const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i isDigit =
+        _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    const __m128i isLetter =
+        _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    valid = _mm_or_si128(isDigit, isLetter);
+    return _mm_or_si128(
+        _mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+        _mm_and_si128(isLetter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+/// @private
+static bool decodeHexSse2(const char* input, size_t size, Byte* output) {
+    const __m128i lowByteMask = _mm_set1_epi16(0xFF);
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i valid0, valid1;
+        __m128i values0 =
+            hexCharsToValuesSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 2)), valid0);
+        __m128i values1 =
+            hexCharsToValuesSse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 2 + 16)), valid1);
+        if (_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF) {
+            return false;
+        }
+        // Each 16 bit lane holds the high nibble in its low byte and the low nibble in its high byte.
+        __m128i bytes0 =
+            _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values0, lowByteMask), 4), _mm_srli_epi16(values0, 8));
+        __m128i bytes1 =
+            _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values1, lowByteMask), 4), _mm_srli_epi16(values1, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(bytes0, bytes1));
+    }
+    return decodeHexScalar(input + i * 2, size - i, output + i);
+}
+
+/**
+ * @brief Converts 6 bit values into Base64 characters.
+ *
+ * Values 0-25 map to 'A', 26-51 to 'a', 52-61 to '0', 62 to '+', and 63 to '/'. The range of each value is reduced to a
+ * small index, and the index selects the offset which is added to the value.
+ *
+ * @param values Bytes with values in range 0-63.
+ * @return Base64 characters.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline __m128i base64ValuesToCharsSsse3(__m128i values) {
+    const __m128i offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '+' - 62, '/' - 63, 'A', 0, 0);
+    __m128i index = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+    index = _mm_or_si128(index, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+    return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, index));
+}
+
+/**
+ * @brief Splits 12 bytes into 16 6-bit values.
+ *
+ * @param input Bytes to split in the low 12 bytes.
+ * @return 6 bit values.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline __m128i base64SplitSsse3(__m128i input) {
+    // Each 32 bit lane receives bytes b, a, c, b of one 3 byte block.
+    input = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    // Shift the first and third values of each lane into place with a high multiply, the others with a low one.
+    __m128i first = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    __m128i second = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(first, second);
+}
+
+/**
+ * @brief Converts 16 Base64 characters into their 6 bit values.
+ *
+ * @param chars Base64 characters.
+ * @param[out] valid False if any character is outside of the alphabet.
+ * @return 6 bit values.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline __m128i base64CharsToValuesSsse3(__m128i chars, bool& valid) {
+    // Each character is classified by its nibbles: a character is valid when the bit sets of its high and low nibble do
+    // not intersect.
+    const __m128i lowNibbleClasses = _mm_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i highNibbleClasses = _mm_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i offsets = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i slash = _mm_set1_epi8('/');
+
+    __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), slash);
+    __m128i lowNibbles = _mm_and_si128(chars, slash);
+    __m128i classes = _mm_and_si128(
+        _mm_shuffle_epi8(lowNibbleClasses, lowNibbles), _mm_shuffle_epi8(highNibbleClasses, highNibbles));
+    valid = _mm_movemask_epi8(_mm_cmpeq_epi8(classes, _mm_setzero_si128())) == 0xFFFF;
+    // '/' shares its high nibble with '+', so it uses the previous offset.
+    __m128i index = _mm_add_epi8(_mm_cmpeq_epi8(chars, slash), highNibbles);
+    return _mm_add_epi8(chars, _mm_shuffle_epi8(offsets, index));
+}
+
+/**
+ * @brief Joins 16 6-bit values into 12 bytes.
+ *
+ * @param values 6 bit values.
+ * @return Bytes in the low 12 bytes.
+ * @private
+ */
+__attribute__((target("ssse3"))) static inline __m128i base64JoinSsse3(__m128i values) {
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i blocks = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(blocks, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+/// @private
+__attribute__((target("ssse3"))) static void encodeBase64Ssse3(const Byte* input, size_t nBlocks, char* output) {
+    // Each step loads 16 bytes and consumes 12, so 2 more blocks must follow.
+    while (nBlocks >= 6) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), base64ValuesToCharsSsse3(base64SplitSsse3(bytes)));
+        input += 12;
+        output += 16;
+        nBlocks -= 4;
+    }
+    encodeBase64Scalar(input, nBlocks, output);
+}
+
+/// @private
+__attribute__((target("ssse3"))) static bool decodeBase64Ssse3(const char* input, size_t nBlocks, Byte* output) {
+    // Each step stores 16 bytes and produces 12, so 2 more blocks must follow.
+    while (nBlocks >= 6) {
+        bool valid;
+        __m128i values =
+            base64CharsToValuesSsse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)), valid);
+        if (!valid) {
+            return false;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), base64JoinSsse3(values));
+        input += 16;
+        output += 12;
+        nBlocks -= 4;
+    }
+    return decodeBase64Scalar(input, nBlocks, output);
+}
+
+/// @private
+__attribute__((target("avx2"))) static void encodeBase64Avx2(const Byte* input, size_t nBlocks, char* output) {
+    const __m256i split = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '+' - 62, '/' - 63, 'A', 0, 0, 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    // Each step loads 28 bytes and consumes 24, so 2 more blocks must follow.
+    while (nBlocks >= 10) {
+        __m256i bytes = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 12)),
+            1);
+        bytes = _mm256_shuffle_epi8(bytes, split);
+        __m256i first =
+            _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        __m256i second =
+            _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        __m256i values = _mm256_or_si256(first, second);
+
+        __m256i index = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+        index = _mm256_or_si256(index, _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output), _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, index)));
+        input += 24;
+        output += 32;
+        nBlocks -= 8;
+    }
+    encodeBase64Ssse3(input, nBlocks, output);
+}
+
+/// @private
+__attribute__((target("avx2"))) static bool decodeBase64Avx2(const char* input, size_t nBlocks, Byte* output) {
+    const __m256i lowNibbleClasses = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i highNibbleClasses = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i offsets = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i join = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i slash = _mm256_set1_epi8('/');
+
+    // Each step stores 32 bytes and produces 24, so 3 more blocks must follow.
+    while (nBlocks >= 11) {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+        __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), slash);
+        __m256i lowNibbles = _mm256_and_si256(chars, slash);
+        __m256i classes = _mm256_and_si256(
+            _mm256_shuffle_epi8(lowNibbleClasses, lowNibbles), _mm256_shuffle_epi8(highNibbleClasses, highNibbles));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(classes, _mm256_setzero_si256())) != -1) {
+            return false;
+        }
+        __m256i index = _mm256_add_epi8(_mm256_cmpeq_epi8(chars, slash), highNibbles);
+        __m256i values = _mm256_add_epi8(chars, _mm256_shuffle_epi8(offsets, index));
+
+        __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i blocks = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        blocks = _mm256_shuffle_epi8(blocks, join);
+        // Move the 12 bytes of the upper lane next to the 12 bytes of the lower one.
+        blocks = _mm256_permutevar8x32_epi32(blocks, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), blocks);
+        input += 32;
+        output += 24;
+        nBlocks -= 8;
+    }
+    return decodeBase64Ssse3(input, nBlocks, output);
+}
+
+/// @brief Kernels for CPUs with SSE2.
+/// @private
+static const CodecKernels SSE2_KERNELS{"sse2", encodeBase64Scalar, decodeBase64Scalar, encodeHexSse2, decodeHexSse2};
+
+/// @brief Kernels for CPUs with SSSE3.
+/// @private
+static const CodecKernels SSSE3_KERNELS{"ssse3", encodeBase64Ssse3, decodeBase64Ssse3, encodeHexSse2, decodeHexSse2};
+
+/// @brief Kernels for CPUs with AVX2.
+/// @private
+static const CodecKernels AVX2_KERNELS{"avx2", encodeBase64Avx2, decodeBase64Avx2, encodeHexSse2, decodeHexSse2};
+
+std::vector<const CodecKernels*> getSupportedCodecKernels() noexcept {
+    std::vector<const CodecKernels*> kernels{&SCALAR_KERNELS, &SSE2_KERNELS};
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("ssse3")) {
+        kernels.push_back(&SSSE3_KERNELS);
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        kernels.push_back(&AVX2_KERNELS);
+    }
+    return kernels;
+}
+
+#elif defined(ACSDK_CODEC_KERNELS_NEON)
+
+/// @private
+static void encodeBase64Neon(const Byte* input, size_t nBlocks, char* output) {
+    const uint8x16x4_t alphabet = {{vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET)),
+                                    vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET) + 16),
+                                    vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET) + 32),
+                                    vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET) + 48)}};
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+    while (nBlocks >= 16) {
+        uint8x16x3_t bytes = vld3q_u8(input);
+        uint8x16x4_t chars;
+        chars.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        chars.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask);
+        chars.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask);
+        chars.val[3] = vandq_u8(bytes.val[2], mask);
+        for (int i = 0; i < 4; ++i) {
+            chars.val[i] = vqtbl4q_u8(alphabet, chars.val[i]);
+        }
+        vst4q_u8(reinterpret_cast<uint8_t*>(output), chars);
+        input += 48;
+        output += 64;
+        nBlocks -= 16;
+    }
+    encodeBase64Scalar(input, nBlocks, output);
+}
+
+/// @private
+static bool decodeBase64Neon(const char* input, size_t nBlocks, Byte* output) {
+    const uint8_t* table = getDecodeTables().base64;
+    const uint8x16x4_t lowTable = {{vld1q_u8(table), vld1q_u8(table + 16), vld1q_u8(table + 32), vld1q_u8(table + 48)}};
+    const uint8x16x4_t highTable = {
+        {vld1q_u8(table + 64), vld1q_u8(table + 80), vld1q_u8(table + 96), vld1q_u8(table + 112)}};
+    const uint8x16_t sixtyFour = vdupq_n_u8(64);
+    const uint8x16_t asciiMax = vdupq_n_u8(0x7F);
+
+    while (nBlocks >= 16) {
+        uint8x16x4_t values = vld4q_u8(reinterpret_cast<const uint8_t*>(input));
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (int i = 0; i < 4; ++i) {
+            uint8x16_t chars = values.val[i];
+            // Indices out of range leave the result of the first lookup, characters above 0x7F are marked explicitly.
+            uint8x16_t value = vqtbx4q_u8(vqtbl4q_u8(lowTable, chars), highTable, vsubq_u8(chars, sixtyFour));
+            invalid = vorrq_u8(invalid, vorrq_u8(value, vcgtq_u8(chars, asciiMax)));
+            values.val[i] = value;
+        }
+        if (vmaxvq_u8(invalid) > 0x3F) {
+            return false;
+        }
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+        vst3q_u8(output, bytes);
+        input += 64;
+        output += 48;
+        nBlocks -= 16;
+    }
+    return decodeBase64Scalar(input, nBlocks, output);
+}
+
+/// @private
+static void encodeHexNeon(const Byte* input, size_t size, char* output) {
+    const uint8x16_t alphabet = vld1q_u8(reinterpret_cast<const uint8_t*>(HEX_ALPHABET));
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t bytes = vld1q_u8(input + i);
+        uint8x16x2_t chars;
+        chars.val[0] = vqtbl1q_u8(alphabet, vshrq_n_u8(bytes, 4));
+        chars.val[1] = vqtbl1q_u8(alphabet, vandq_u8(bytes, mask));
+        vst2q_u8(reinterpret_cast<uint8_t*>(output + i * 2), chars);
+    }
+    encodeHexScalar(input + i, size - i, output + i * 2);
+}
+
+/**
+ * @brief Converts 16 hex characters into their 4 bit values.
+ *
+ * @param chars Hex characters.
+ * @param[out] valid Set to 0xFF for valid characters and to zero for others.
+ * @return Values of the characters.
+ * @private
+ */
+static inline uint8x16_t hexCharsToValuesNeon(uint8x16_t chars, uint8x16_t& valid) {
+    uint8x16_t digits = vsubq_u8(chars, vdupq_n_u8('0'));
+    uint8x16_t letters = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t isDigit = vcltq_u8(digits, vdupq_n_u8(10));
+    uint8x16_t isLetter = vcltq_u8(letters, vdupq_n_u8(6));
+    valid = vorrq_u8(isDigit, isLetter);
+    return vbslq_u8(isDigit, digits, vaddq_u8(letters, vdupq_n_u8(10)));
+}
+
+/// @private
+static bool decodeHexNeon(const char* input, size_t size, Byte* output) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        uint8x16x2_t chars = vld2q_u8(reinterpret_cast<const uint8_t*>(input + i * 2));
+        uint8x16_t validHigh, validLow;
+        uint8x16_t high = hexCharsToValuesNeon(chars.val[0], validHigh);
+        uint8x16_t low = hexCharsToValuesNeon(chars.val[1], validLow);
+        if (vminvq_u8(vandq_u8(validHigh, validLow)) != 0xFF) {
+            return false;
+        }
+        vst1q_u8(output + i, vorrq_u8(vshlq_n_u8(high, 4), low));
+    }
+    return decodeHexScalar(input + i * 2, size - i, output + i);
+}
+
+/// @brief Kernels for AArch64 CPUs.
+/// @private
+static const CodecKernels NEON_KERNELS{"neon", encodeBase64Neon, decodeBase64Neon, encodeHexNeon, decodeHexNeon};
+
+std::vector<const CodecKernels*> getSupportedCodecKernels() noexcept {
+    // Advanced SIMD is mandatory on AArch64.
+    return {&SCALAR_KERNELS, &NEON_KERNELS};
+}
+
+#else
+
+std::vector<const CodecKernels*> getSupportedCodecKernels() noexcept {
+    return {&SCALAR_KERNELS};
+}
+
+#endif
+
+const CodecKernels& getCodecKernels() noexcept {
+    static const CodecKernels* kernels = getSupportedCodecKernels().back();
+    return *kernels;
+}
+
+}  // namespace acsdkCodecUtils
+}  // namespace alexaClientSDK
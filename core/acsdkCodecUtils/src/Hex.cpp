@@ -14,26 +14,19 @@
  */
 
 #include <acsdkCodecUtils/Hex.h>
+#include <acsdkCodecUtils/private/CodecKernels.h>
 #include <acsdkCodecUtils/private/CodecsCommon.h>
 
 namespace alexaClientSDK {
 namespace acsdkCodecUtils {
 
-/**
- * @brief Static table to convert binary code into ASCII character.
- *
- * This array maps values 0-15 into one of the 0-9,a-f characters.
- * @private
- */
-static const char BINARY_TO_HEX[] = "0123456789abcdef";
-
 bool encodeHex(const Bytes& binary, std::string& hexString) noexcept {
-    hexString.reserve(hexString.size() + binary.size() * 2);
-
-    for (Byte b : binary) {
-        hexString.push_back(BINARY_TO_HEX[b >> 4]);
-        hexString.push_back(BINARY_TO_HEX[b & 15u]);
+    if (binary.empty()) {
+        return true;
     }
+    size_t offset = hexString.size();
+    hexString.resize(offset + binary.size() * 2);
+    getCodecKernels().encodeHex(binary.data(), binary.size(), &hexString[offset]);
 
     return true;
 }
@@ -71,6 +64,16 @@ static bool isValidHexChar(char ch) {
 }
 
 bool decodeHex(const std::string& hexString, Bytes& binary) noexcept {
+    // Most inputs have no whitespace and can be decoded in a single pass. Otherwise the input is validated first.
+    if (!hexString.empty() && !(hexString.size() % 2)) {
+        size_t offset = binary.size();
+        binary.resize(offset + hexString.size() / 2);
+        if (getCodecKernels().decodeHex(hexString.data(), hexString.size() / 2, binary.data() + offset)) {
+            return true;
+        }
+        binary.resize(offset);
+    }
+
     binary.reserve(hexString.size() / 2 + binary.size());
 
     int b0 = 0;
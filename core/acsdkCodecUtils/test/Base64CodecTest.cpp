@@ -13,8 +13,6 @@
  * permissions and limitations under the License.
  */
 
-#ifdef CRYPTO_FOUND
-
 #include <gtest/gtest.h>
 
 #include <acsdkCodecUtils/Base64.h>
@@ -109,5 +107,3 @@ TEST(Base64CodecTest, test_base64DecodeErrorEarlyEnd) {
 }  // namespace test
 }  // namespace acsdkCodecUtils
 }  // namespace alexaClientSDK
-
-#endif  // ifdef CRYPTO_FOUND
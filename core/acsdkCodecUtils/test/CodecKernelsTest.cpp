@@ -0,0 +1,235 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <acsdkCodecUtils/Base64.h>
+#include <acsdkCodecUtils/Hex.h>
+#include <acsdkCodecUtils/private/CodecKernels.h>
+
+namespace alexaClientSDK {
+namespace acsdkCodecUtils {
+namespace test {
+
+using namespace ::testing;
+
+/// Maximum number of Base64 blocks in generated inputs. Covers several iterations of every vector loop.
+static constexpr size_t MAX_TEST_BLOCKS = 100;
+
+/// Characters which are valid in Base64 input.
+static const std::string BASE64_CHARS{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+
+/// Characters which are valid in hex input.
+static const std::string HEX_CHARS{"0123456789abcdefABCDEF"};
+
+/**
+ * Generates random bytes.
+ *
+ * @param size Number of bytes.
+ * @param generator Random generator.
+ * @return Random bytes.
+ */
+static Bytes generateBytes(size_t size, std::mt19937& generator) {
+    std::uniform_int_distribution<int> distribution{0, 255};
+    Bytes bytes(size);
+    for (auto& b : bytes) {
+        b = static_cast<Byte>(distribution(generator));
+    }
+    return bytes;
+}
+
+/**
+ * Generates random characters from an alphabet.
+ *
+ * @param size Number of characters.
+ * @param alphabet Characters to use.
+ * @param generator Random generator.
+ * @return Random string.
+ */
+static std::string generateChars(size_t size, const std::string& alphabet, std::mt19937& generator) {
+    std::uniform_int_distribution<size_t> distribution{0, alphabet.size() - 1};
+    std::string chars(size, ' ');
+    for (auto& ch : chars) {
+        ch = alphabet[distribution(generator)];
+    }
+    return chars;
+}
+
+/// Verify that every supported kernel set produces the same output as the scalar kernels.
+TEST(CodecKernelsTest, test_kernelsMatchScalar) {
+    auto kernels = getSupportedCodecKernels();
+    ASSERT_FALSE(kernels.empty());
+    const CodecKernels& scalar = *kernels.front();
+    std::mt19937 generator{1};
+
+    for (size_t nBlocks = 0; nBlocks <= MAX_TEST_BLOCKS; ++nBlocks) {
+        Bytes binary = generateBytes(nBlocks * 3, generator);
+        std::string base64 = generateChars(nBlocks * 4, BASE64_CHARS, generator);
+        std::string hex = generateChars(nBlocks * 6, HEX_CHARS, generator);
+
+        std::string expectedBase64(nBlocks * 4, ' ');
+        Bytes expectedBase64Binary(nBlocks * 3);
+        std::string expectedHex(nBlocks * 6, ' ');
+        Bytes expectedHexBinary(nBlocks * 3);
+        scalar.encodeBase64(binary.data(), nBlocks, &expectedBase64[0]);
+        ASSERT_TRUE(scalar.decodeBase64(base64.data(), nBlocks, expectedBase64Binary.data()));
+        scalar.encodeHex(binary.data(), binary.size(), &expectedHex[0]);
+        ASSERT_TRUE(scalar.decodeHex(hex.data(), binary.size(), expectedHexBinary.data()));
+
+        for (auto kernel : kernels) {
+            SCOPED_TRACE(kernel->name);
+            std::string encoded(nBlocks * 4, ' ');
+            kernel->encodeBase64(binary.data(), nBlocks, &encoded[0]);
+            ASSERT_EQ(expectedBase64, encoded);
+
+            Bytes decoded(nBlocks * 3);
+            ASSERT_TRUE(kernel->decodeBase64(base64.data(), nBlocks, decoded.data()));
+            ASSERT_EQ(expectedBase64Binary, decoded);
+
+            encoded.assign(nBlocks * 6, ' ');
+            kernel->encodeHex(binary.data(), binary.size(), &encoded[0]);
+            ASSERT_EQ(expectedHex, encoded);
+
+            ASSERT_TRUE(kernel->decodeHex(hex.data(), binary.size(), decoded.data()));
+            ASSERT_EQ(expectedHexBinary, decoded);
+        }
+    }
+}
+
+/// Verify that every supported kernel set rejects an invalid character at any position.
+TEST(CodecKernelsTest, test_kernelsRejectInvalidCharacters) {
+    std::mt19937 generator{2};
+    const size_t nBlocks = 24;
+    const std::string base64 = generateChars(nBlocks * 4, BASE64_CHARS, generator);
+    const std::string hex = generateChars(nBlocks * 4, HEX_CHARS, generator);
+    Bytes decoded(nBlocks * 3);
+
+    for (auto kernel : getSupportedCodecKernels()) {
+        SCOPED_TRACE(kernel->name);
+        for (int ch = 0; ch < 256; ++ch) {
+            for (size_t position = 0; position < base64.size(); ++position) {
+                if (BASE64_CHARS.find(static_cast<char>(ch)) == std::string::npos) {
+                    std::string input = base64;
+                    input[position] = static_cast<char>(ch);
+                    ASSERT_FALSE(kernel->decodeBase64(input.data(), nBlocks, decoded.data())) << ch << "@" << position;
+                }
+                if (HEX_CHARS.find(static_cast<char>(ch)) == std::string::npos) {
+                    std::string input = hex;
+                    input[position] = static_cast<char>(ch);
+                    ASSERT_FALSE(kernel->decodeHex(input.data(), nBlocks * 2, decoded.data())) << ch << "@" << position;
+                }
+            }
+        }
+    }
+}
+
+/// Verify that codecs round trip inputs of every length, including padded and whitespace separated Base64.
+TEST(CodecKernelsTest, test_codecsRoundTrip) {
+    std::mt19937 generator{3};
+
+    for (size_t size = 0; size <= MAX_TEST_BLOCKS * 3; ++size) {
+        Bytes binary = generateBytes(size, generator);
+
+        std::string base64;
+        ASSERT_TRUE(encodeBase64(binary, base64));
+        Bytes decoded{0x42};
+        ASSERT_TRUE(decodeBase64(base64, decoded));
+        ASSERT_EQ(size + 1, decoded.size());
+        ASSERT_EQ(binary, Bytes(decoded.begin() + 1, decoded.end()));
+
+        std::string wrapped;
+        for (size_t i = 0; i < base64.size(); i += 16) {
+            wrapped += base64.substr(i, 16) + "\r\n";
+        }
+        decoded.clear();
+        ASSERT_TRUE(decodeBase64(wrapped, decoded));
+        ASSERT_EQ(binary, decoded);
+
+        std::string hex;
+        ASSERT_TRUE(encodeHex(binary, hex));
+        decoded.clear();
+        ASSERT_TRUE(decodeHex(hex, decoded));
+        ASSERT_EQ(binary, decoded);
+    }
+}
+
+/// Verify that failed decoding leaves the output unmodified.
+TEST(CodecKernelsTest, test_decodeErrorKeepsOutput) {
+    std::mt19937 generator{4};
+    const std::string base64 = generateChars(64, BASE64_CHARS, generator);
+    const std::string hex = generateChars(64, HEX_CHARS, generator);
+    const Bytes initial{1, 2, 3};
+
+    Bytes decoded = initial;
+    ASSERT_FALSE(decodeBase64(base64 + "!" + base64.substr(1), decoded));
+    ASSERT_EQ(initial, decoded);
+    ASSERT_FALSE(decodeBase64(base64.substr(0, 62) + "=A", decoded));
+    ASSERT_EQ(initial, decoded);
+    ASSERT_FALSE(decodeHex(hex.substr(0, 63) + "g", decoded));
+    ASSERT_EQ(initial, decoded);
+}
+
+/**
+ * Measure throughput of every supported kernel set for inputs from 64 bytes to 1 MiB. The results are recorded as test
+ * properties. This is a benchmark rather than a check, so it only runs when disabled tests are requested.
+ */
+TEST(CodecKernelsTest, DISABLED_test_kernelThroughput) {
+    // Each measurement processes roughly this many bytes, so the test stays fast on small devices.
+    const size_t bytesPerMeasurement = 4 * 1024 * 1024;
+    std::mt19937 generator{5};
+
+    for (size_t minSize : {64, 1024, 16 * 1024, 256 * 1024, 1024 * 1024}) {
+        // Round up to whole Base64 blocks.
+        const size_t nBlocks = (minSize + 2) / 3;
+        const size_t size = nBlocks * 3;
+        const size_t iterations = bytesPerMeasurement / size + 1;
+        Bytes binary = generateBytes(size, generator);
+        std::string base64(nBlocks * 4, ' ');
+        std::string hex(size * 2, ' ');
+        Bytes decoded(size);
+
+        for (auto kernel : getSupportedCodecKernels()) {
+            auto measure = [iterations, size](const std::function<void()>& operation) {
+                auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < iterations; ++i) {
+                    operation();
+                }
+                auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                return static_cast<long>(iterations * size / (elapsed > 0 ? elapsed : 1e-9) / (1024 * 1024));
+            };
+
+            auto base64Encode = measure([&] { kernel->encodeBase64(binary.data(), nBlocks, &base64[0]); });
+            auto base64Decode = measure([&] { kernel->decodeBase64(base64.data(), nBlocks, decoded.data()); });
+            auto hexEncode = measure([&] { kernel->encodeHex(binary.data(), size, &hex[0]); });
+            auto hexDecode = measure([&] { kernel->decodeHex(hex.data(), size, decoded.data()); });
+            ASSERT_EQ(binary, decoded);
+
+            std::string key = std::string(kernel->name) + "_" + std::to_string(size) + "B_MiBps";
+            RecordProperty(key + "_base64Encode", std::to_string(base64Encode));
+            RecordProperty(key + "_base64Decode", std::to_string(base64Decode));
+            RecordProperty(key + "_hexEncode", std::to_string(hexEncode));
+            RecordProperty(key + "_hexDecode", std::to_string(hexDecode));
+        }
+    }
+}
+
+}  // namespace test
+}  // namespace acsdkCodecUtils
+}  // namespace alexaClientSDK
@@ -0,0 +1,290 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKKWDIMPLEMENTATIONS_AUDIOFRONTEND_H_
+#define ACSDKKWDIMPLEMENTATIONS_AUDIOFRONTEND_H_
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <acsdkKWDInterfaces/AudioFrame.h>
+#include <acsdkKWDInterfaces/AudioFrameConsumerInterface.h>
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/SDKInterfaces/KeyWordDetectorStateObserverInterface.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+
+namespace alexaClientSDK {
+namespace acsdkKWDImplementations {
+
+/**
+ * A front-end stage which reads an @c AudioInputStream once on behalf of any number of keyword detectors.
+ *
+ * The front-end splits the stream into fixed size frames, converts them to platform endianness, and annotates each
+ * one with its energy and a voice activity decision.  Frames are then shared, without copying, with every registered
+ * @c AudioFrameConsumerInterface.
+ *
+ * Voice activity is detected by comparing the energy of a frame with a slowly rising estimate of the noise floor.
+ * Frames that are more than @c Config::hangoverFrames after the last voiced frame are considered silent, and by
+ * default are not delivered at all.  The @c Config::preRollFrames silent frames before voice activity are held back
+ * and delivered when it starts, so that detectors still see the onset of a keyword.  Because skipped frames leave
+ * gaps in the stream, each frame carries both its index in the stream and its index among the delivered frames, and
+ * @c getStreamIndex() maps the latter back to the former.
+ *
+ * Only mono 16 bit LPCM audio is supported.
+ */
+class AudioFrontEnd {
+public:
+    /// Settings for the frame size and the voice activity gate.
+    struct Config {
+        /**
+         * Constructor.  The defaults use 10 ms frames and deliver only voiced frames, the 200 ms before them and the
+         * 500 ms after them.
+         */
+        Config();
+
+        /// The duration of each frame.
+        std::chrono::milliseconds frameDuration;
+
+        /// How far, in dB, the energy of a frame must be above the noise floor for it to count as voice activity.
+        float vadThresholdDb;
+
+        /// The minimum energy, in dB relative to full scale, for a frame to count as voice activity.
+        float minVoiceEnergyDb;
+
+        /// The number of silent frames before voice activity which are delivered when it starts.
+        size_t preRollFrames;
+
+        /// The number of frames after the last voiced frame which are still delivered.
+        size_t hangoverFrames;
+
+        /**
+         * Down-clocking of silent frames.  When zero, silent frames are not delivered.  Otherwise every
+         * @c silentFrameStride th silent frame is delivered, so a value of one disables gating.
+         */
+        size_t silentFrameStride;
+    };
+
+    /**
+     * Create an @c AudioFrontEnd and start reading from the stream.
+     *
+     * @param stream The stream of audio data.
+     * @param audioFormat The format of the audio data in the stream.  This must be mono 16 bit LPCM.
+     * @param config The frame size and voice activity gate settings.
+     * @return A new @c AudioFrontEnd, or @c nullptr if the operation failed.
+     */
+    static std::shared_ptr<AudioFrontEnd> create(
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        const avsCommon::utils::AudioFormat& audioFormat,
+        const Config& config = Config());
+
+    /**
+     * Destructor.  Stops reading from the stream.
+     */
+    ~AudioFrontEnd();
+
+    /**
+     * Add a consumer of the frames.  The consumer receives frames read after this call.
+     *
+     * @note This must not be called from a method of an @c AudioFrameConsumerInterface.
+     *
+     * @param consumer The consumer to add.
+     * @return Whether the consumer was added.
+     */
+    bool addConsumer(std::shared_ptr<acsdkKWDInterfaces::AudioFrameConsumerInterface> consumer);
+
+    /**
+     * Remove a consumer of the frames.  Once this returns, the consumer is not called again.
+     *
+     * @note This must not be called from a method of an @c AudioFrameConsumerInterface.
+     *
+     * @param consumer The consumer to remove.
+     * @return Whether the consumer was found and removed.
+     */
+    bool removeConsumer(std::shared_ptr<acsdkKWDInterfaces::AudioFrameConsumerInterface> consumer);
+
+    /**
+     * Map an index among the delivered samples back to the stream.  Recent indices can always be mapped, but the
+     * mapping of samples delivered before the last @c MAX_INDEX_SEGMENTS gaps in the delivered audio is forgotten.
+     *
+     * @param deliveredIndex The index among the delivered samples, as counted from @c AudioFrame::deliveredIndex.
+     * @param[out] streamIndex The index of the same sample in the stream.
+     * @return Whether the index could be mapped.
+     */
+    bool getStreamIndex(
+        avsCommon::avs::AudioInputStream::Index deliveredIndex,
+        avsCommon::avs::AudioInputStream::Index* streamIndex) const;
+
+    /**
+     * Get the stream the front-end reads from.
+     *
+     * @return The stream.
+     */
+    std::shared_ptr<avsCommon::avs::AudioInputStream> getStream() const;
+
+    /**
+     * Get the format of the delivered frames, which is that of the stream in platform endianness.
+     *
+     * @return The format of the delivered frames.
+     */
+    avsCommon::utils::AudioFormat getAudioFormat() const;
+
+    /// The maximum number of gaps in the delivered audio for which @c getStreamIndex() keeps a mapping.
+    static constexpr size_t MAX_INDEX_SEGMENTS = 128;
+
+private:
+    /// A run of delivered samples which are contiguous in the stream.
+    struct IndexSegment {
+        /// The index among the delivered samples of the first sample of the run.
+        avsCommon::avs::AudioInputStream::Index deliveredIndex;
+        /// The index in the stream of the first sample of the run.
+        avsCommon::avs::AudioInputStream::Index streamIndex;
+    };
+
+    /// The list of consumers, which is replaced rather than modified so that it can be used without a lock.
+    using ConsumerList = std::vector<std::shared_ptr<acsdkKWDInterfaces::AudioFrameConsumerInterface>>;
+
+    /**
+     * Constructor.
+     *
+     * @param stream The stream of audio data.
+     * @param audioFormat The format of the delivered frames.
+     * @param config The frame size and voice activity gate settings.
+     * @param frameSamples The number of samples in each frame.
+     * @param byteswap Whether the samples in the stream need to be byteswapped to platform endianness.
+     */
+    AudioFrontEnd(
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        const avsCommon::utils::AudioFormat& audioFormat,
+        const Config& config,
+        size_t frameSamples,
+        bool byteswap);
+
+    /**
+     * Create the stream reader and start the thread which reads from it.
+     *
+     * @return Whether the operation succeeded.
+     */
+    bool init();
+
+    /// The main function of the thread which reads from the stream.
+    void readLoop();
+
+    /**
+     * Get a frame to read into, reusing one that is no longer referenced by any consumer if possible.
+     *
+     * @return A frame of @c m_frameSamples samples.
+     */
+    std::shared_ptr<acsdkKWDInterfaces::AudioFrame> acquireFrame();
+
+    /**
+     * Annotate a complete frame, and deliver it, hold it back as pre-roll, or drop it according to the gate.
+     *
+     * @param frame The frame.
+     */
+    void processFrame(std::shared_ptr<acsdkKWDInterfaces::AudioFrame> frame);
+
+    /**
+     * Deliver a frame to all consumers.
+     *
+     * @param frame The frame.
+     */
+    void deliverFrame(std::shared_ptr<acsdkKWDInterfaces::AudioFrame> frame);
+
+    /**
+     * Tell all consumers that the front-end stopped reading.
+     *
+     * @param state Why the front-end stopped.
+     */
+    void notifyStopped(avsCommon::sdkInterfaces::KeyWordDetectorStateObserverInterface::KeyWordDetectorState state);
+
+    /// The stream of audio data.
+    const std::shared_ptr<avsCommon::avs::AudioInputStream> m_stream;
+
+    /// The format of the delivered frames.
+    const avsCommon::utils::AudioFormat m_audioFormat;
+
+    /// The frame size and voice activity gate settings.
+    const Config m_config;
+
+    /// The number of samples in each frame.
+    const size_t m_frameSamples;
+
+    /// Whether the samples in the stream need to be byteswapped to platform endianness.
+    const bool m_byteswap;
+
+    /// The amount the noise floor estimate may rise with each frame, in dB.
+    const float m_noiseFloorRiseDb;
+
+    /// The reader used to read from the stream.
+    std::unique_ptr<avsCommon::avs::AudioInputStream::Reader> m_reader;
+
+    /// Indicates whether the read loop should stop.
+    std::atomic<bool> m_isShuttingDown;
+
+    /// Serializes access to @c m_consumers.
+    std::mutex m_consumersMutex;
+
+    /// The current list of consumers.
+    std::shared_ptr<const ConsumerList> m_consumers;
+
+    /// Held while frames are delivered, so that @c removeConsumer() can wait for deliveries in progress.
+    std::mutex m_deliveryMutex;
+
+    /// Serializes access to @c m_indexSegments and @c m_nextDeliveredIndex.
+    mutable std::mutex m_indexMutex;
+
+    /// The most recent runs of contiguous delivered samples, oldest first.
+    std::deque<IndexSegment> m_indexSegments;
+
+    /// The index among the delivered samples of the next sample to be delivered.
+    avsCommon::avs::AudioInputStream::Index m_nextDeliveredIndex;
+
+    /// @name Read loop state
+    /// These are only accessed on @c m_readThread.
+    /// @{
+
+    /// Frames that may be reused once no consumer references them.
+    std::vector<std::shared_ptr<acsdkKWDInterfaces::AudioFrame>> m_framePool;
+
+    /// Silent frames held back to be delivered when voice activity starts, oldest first.
+    std::deque<std::shared_ptr<acsdkKWDInterfaces::AudioFrame>> m_preRoll;
+
+    /// Whether @c m_noiseFloorDb has been initialized from the first frame.
+    bool m_hasNoiseFloor;
+
+    /// The current estimate of the noise floor, in dB relative to full scale.
+    float m_noiseFloorDb;
+
+    /// The number of frames still to be delivered after the last voiced frame.
+    size_t m_hangoverRemaining;
+
+    /// The number of silent frames seen since the last voiced frame, used for down-clocking.
+    size_t m_silentFrameCount;
+
+    /// @}
+
+    /// The thread which reads from the stream.
+    std::thread m_readThread;
+};
+
+}  // namespace acsdkKWDImplementations
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKKWDIMPLEMENTATIONS_AUDIOFRONTEND_H_
@@ -0,0 +1,415 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "acsdkKWDImplementations/AudioFrontEnd.h"
+
+namespace alexaClientSDK {
+namespace acsdkKWDImplementations {
+
+using namespace acsdkKWDInterfaces;
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AudioFrontEnd");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The timeout for read calls, which bounds how long the destructor waits for the read loop to stop.
+static const std::chrono::milliseconds READ_TIMEOUT(100);
+
+/// The number of milliseconds per second.
+static const size_t MILLISECONDS_PER_SECOND = 1000;
+
+/// The energy reported for digital silence, in dB relative to full scale.
+static const float MIN_ENERGY_DB = -120.0f;
+
+/// The full scale amplitude of a 16 bit sample.
+static const double FULL_SCALE = 32768.0;
+
+/// How fast the noise floor estimate may rise, in dB per second.  It falls immediately.
+static const float NOISE_FLOOR_RISE_DB_PER_SECOND = 2.0f;
+
+/// The number of frames kept for reuse in addition to the pre-roll frames.
+static const size_t FRAME_POOL_SLACK = 8;
+
+/// Default frame duration.
+static const std::chrono::milliseconds DEFAULT_FRAME_DURATION(10);
+
+/// Default voice activity threshold above the noise floor, in dB.
+static const float DEFAULT_VAD_THRESHOLD_DB = 9.0f;
+
+/// Default minimum voice energy, in dB relative to full scale.
+static const float DEFAULT_MIN_VOICE_ENERGY_DB = -60.0f;
+
+/// Default number of pre-roll frames.
+static const size_t DEFAULT_PRE_ROLL_FRAMES = 20;
+
+/// Default number of hangover frames.
+static const size_t DEFAULT_HANGOVER_FRAMES = 50;
+
+constexpr size_t AudioFrontEnd::MAX_INDEX_SEGMENTS;
+
+/**
+ * Get the endianness of the platform.
+ *
+ * @return The endianness of the platform.
+ */
+static AudioFormat::Endianness getPlatformEndianness() {
+    int num = 1;
+    char* firstBytePtr = reinterpret_cast<char*>(&num);
+    return (*firstBytePtr == 1) ? AudioFormat::Endianness::LITTLE : AudioFormat::Endianness::BIG;
+}
+
+/**
+ * Compute the energy of some samples.
+ *
+ * @param samples The samples.
+ * @param count The number of samples.
+ * @return The mean square energy of the samples, in dB relative to full scale.
+ */
+static float computeEnergyDb(const int16_t* samples, size_t count) {
+    int64_t sumOfSquares = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sumOfSquares += static_cast<int32_t>(samples[i]) * samples[i];
+    }
+    auto meanSquare = static_cast<double>(sumOfSquares) / count / (FULL_SCALE * FULL_SCALE);
+    if (meanSquare <= 0) {
+        return MIN_ENERGY_DB;
+    }
+    return std::max(MIN_ENERGY_DB, static_cast<float>(10.0 * std::log10(meanSquare)));
+}
+
+AudioFrontEnd::Config::Config() :
+        frameDuration{DEFAULT_FRAME_DURATION},
+        vadThresholdDb{DEFAULT_VAD_THRESHOLD_DB},
+        minVoiceEnergyDb{DEFAULT_MIN_VOICE_ENERGY_DB},
+        preRollFrames{DEFAULT_PRE_ROLL_FRAMES},
+        hangoverFrames{DEFAULT_HANGOVER_FRAMES},
+        silentFrameStride{0} {
+}
+
+std::shared_ptr<AudioFrontEnd> AudioFrontEnd::create(
+    std::shared_ptr<AudioInputStream> stream,
+    const AudioFormat& audioFormat,
+    const Config& config) {
+    if (!stream) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullStream"));
+        return nullptr;
+    }
+    if (audioFormat.encoding != AudioFormat::Encoding::LPCM || audioFormat.sampleSizeInBits != 16 ||
+        audioFormat.numChannels != 1 || stream->getWordSize() != sizeof(int16_t)) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "unsupportedFormat")
+                        .d("encoding", audioFormat.encoding)
+                        .d("sampleSizeInBits", audioFormat.sampleSizeInBits)
+                        .d("numChannels", audioFormat.numChannels)
+                        .d("wordSize", stream->getWordSize()));
+        return nullptr;
+    }
+    size_t frameSamples = audioFormat.sampleRateHz * config.frameDuration.count() / MILLISECONDS_PER_SECOND;
+    if (config.frameDuration.count() <= 0 || 0 == frameSamples) {
+        ACSDK_ERROR(LX("createFailed")
+                        .d("reason", "invalidFrameDuration")
+                        .d("frameDurationMs", config.frameDuration.count())
+                        .d("sampleRate", audioFormat.sampleRateHz));
+        return nullptr;
+    }
+
+    auto frameFormat = audioFormat;
+    frameFormat.endianness = getPlatformEndianness();
+    bool byteswap = frameFormat.endianness != audioFormat.endianness;
+
+    std::shared_ptr<AudioFrontEnd> frontEnd(new AudioFrontEnd(stream, frameFormat, config, frameSamples, byteswap));
+    if (!frontEnd->init()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "initFailed"));
+        return nullptr;
+    }
+    return frontEnd;
+}
+
+AudioFrontEnd::AudioFrontEnd(
+    std::shared_ptr<AudioInputStream> stream,
+    const AudioFormat& audioFormat,
+    const Config& config,
+    size_t frameSamples,
+    bool byteswap) :
+        m_stream{stream},
+        m_audioFormat(audioFormat),
+        m_config(config),
+        m_frameSamples{frameSamples},
+        m_byteswap{byteswap},
+        m_noiseFloorRiseDb{NOISE_FLOOR_RISE_DB_PER_SECOND * config.frameDuration.count() / MILLISECONDS_PER_SECOND},
+        m_isShuttingDown{false},
+        m_consumers{std::make_shared<ConsumerList>()},
+        m_nextDeliveredIndex{0},
+        m_hasNoiseFloor{false},
+        m_noiseFloorDb{MIN_ENERGY_DB},
+        m_hangoverRemaining{0},
+        m_silentFrameCount{0} {
+}
+
+AudioFrontEnd::~AudioFrontEnd() {
+    m_isShuttingDown = true;
+    if (m_readThread.joinable()) {
+        m_readThread.join();
+    }
+}
+
+bool AudioFrontEnd::init() {
+    m_reader = m_stream->createReader(AudioInputStream::Reader::Policy::BLOCKING);
+    if (!m_reader) {
+        ACSDK_ERROR(LX("initFailed").d("reason", "createStreamReaderFailed"));
+        return false;
+    }
+    m_readThread = std::thread(&AudioFrontEnd::readLoop, this);
+    return true;
+}
+
+bool AudioFrontEnd::addConsumer(std::shared_ptr<AudioFrameConsumerInterface> consumer) {
+    if (!consumer) {
+        ACSDK_ERROR(LX("addConsumerFailed").d("reason", "nullConsumer"));
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_consumersMutex);
+    if (std::find(m_consumers->begin(), m_consumers->end(), consumer) != m_consumers->end()) {
+        ACSDK_WARN(LX("addConsumerFailed").d("reason", "alreadyAdded"));
+        return false;
+    }
+    auto consumers = std::make_shared<ConsumerList>(*m_consumers);
+    consumers->push_back(consumer);
+    m_consumers = consumers;
+    return true;
+}
+
+bool AudioFrontEnd::removeConsumer(std::shared_ptr<AudioFrameConsumerInterface> consumer) {
+    {
+        std::lock_guard<std::mutex> lock(m_consumersMutex);
+        auto it = std::find(m_consumers->begin(), m_consumers->end(), consumer);
+        if (it == m_consumers->end()) {
+            ACSDK_WARN(LX("removeConsumerFailed").d("reason", "notFound"));
+            return false;
+        }
+        auto consumers = std::make_shared<ConsumerList>(*m_consumers);
+        consumers->erase(consumers->begin() + (it - m_consumers->begin()));
+        m_consumers = consumers;
+    }
+    // Wait for any delivery which started with the old list of consumers.
+    std::lock_guard<std::mutex> lock(m_deliveryMutex);
+    return true;
+}
+
+bool AudioFrontEnd::getStreamIndex(AudioInputStream::Index deliveredIndex, AudioInputStream::Index* streamIndex) const {
+    if (!streamIndex) {
+        ACSDK_ERROR(LX("getStreamIndexFailed").d("reason", "nullStreamIndex"));
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_indexMutex);
+    if (deliveredIndex > m_nextDeliveredIndex) {
+        ACSDK_ERROR(LX("getStreamIndexFailed").d("reason", "notDeliveredYet").d("deliveredIndex", deliveredIndex));
+        return false;
+    }
+    for (auto it = m_indexSegments.rbegin(); it != m_indexSegments.rend(); ++it) {
+        if (it->deliveredIndex <= deliveredIndex) {
+            *streamIndex = it->streamIndex + (deliveredIndex - it->deliveredIndex);
+            return true;
+        }
+    }
+    ACSDK_ERROR(LX("getStreamIndexFailed").d("reason", "mappingForgotten").d("deliveredIndex", deliveredIndex));
+    return false;
+}
+
+std::shared_ptr<AudioInputStream> AudioFrontEnd::getStream() const {
+    return m_stream;
+}
+
+AudioFormat AudioFrontEnd::getAudioFormat() const {
+    return m_audioFormat;
+}
+
+void AudioFrontEnd::readLoop() {
+    auto frame = acquireFrame();
+    size_t samplesInFrame = 0;
+    bool stoppedByStream = false;
+    auto stoppedState = KeyWordDetectorStateObserverInterface::KeyWordDetectorState::STREAM_CLOSED;
+    while (!m_isShuttingDown && !stoppedByStream) {
+        if (0 == samplesInFrame) {
+            frame->streamIndex = m_reader->tell();
+        }
+        auto wordsRead =
+            m_reader->read(frame->samples.data() + samplesInFrame, m_frameSamples - samplesInFrame, READ_TIMEOUT);
+        if (wordsRead > 0) {
+            samplesInFrame += wordsRead;
+            if (samplesInFrame == m_frameSamples) {
+                processFrame(frame);
+                frame = acquireFrame();
+                samplesInFrame = 0;
+            }
+            continue;
+        }
+        switch (wordsRead) {
+            case AudioInputStream::Reader::Error::CLOSED:
+                ACSDK_DEBUG(LX("readLoop").d("event", "streamClosed"));
+                stoppedByStream = true;
+                break;
+            case AudioInputStream::Reader::Error::OVERRUN:
+                ACSDK_ERROR(LX("readLoopFailed")
+                                .d("reason", "streamOverrun")
+                                .d("numWordsOverrun",
+                                   m_reader->tell(AudioInputStream::Reader::Reference::BEFORE_WRITER) -
+                                       m_stream->getDataSize()));
+                m_reader->seek(0, AudioInputStream::Reader::Reference::BEFORE_WRITER);
+                // The partial frame and the pre-roll are no longer contiguous with what will be read next.
+                samplesInFrame = 0;
+                m_preRoll.clear();
+                break;
+            case AudioInputStream::Reader::Error::TIMEDOUT:
+                break;
+            default:
+                ACSDK_ERROR(LX("readLoopFailed").d("reason", "unexpectedError").d("error", wordsRead));
+                stoppedState = KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ERROR;
+                stoppedByStream = true;
+                break;
+        }
+    }
+    m_reader->close();
+    if (stoppedByStream) {
+        notifyStopped(stoppedState);
+    }
+}
+
+std::shared_ptr<AudioFrame> AudioFrontEnd::acquireFrame() {
+    for (auto& frame : m_framePool) {
+        if (frame.use_count() == 1) {
+            return frame;
+        }
+    }
+    auto frame = std::make_shared<AudioFrame>();
+    frame->samples.resize(m_frameSamples);
+    if (m_framePool.size() < m_config.preRollFrames + FRAME_POOL_SLACK) {
+        m_framePool.push_back(frame);
+    }
+    return frame;
+}
+
+void AudioFrontEnd::processFrame(std::shared_ptr<AudioFrame> frame) {
+    if (m_byteswap) {
+        for (auto& sample : frame->samples) {
+            auto value = static_cast<uint16_t>(sample);
+            sample = static_cast<int16_t>((value << 8) | (value >> 8));
+        }
+    }
+
+    frame->energyDb = computeEnergyDb(frame->samples.data(), frame->samples.size());
+    if (!m_hasNoiseFloor) {
+        m_noiseFloorDb = frame->energyDb;
+        m_hasNoiseFloor = true;
+    }
+    frame->isVoiceActive =
+        frame->energyDb >= m_config.minVoiceEnergyDb && frame->energyDb >= m_noiseFloorDb + m_config.vadThresholdDb;
+    m_noiseFloorDb = std::min(frame->energyDb, m_noiseFloorDb + m_noiseFloorRiseDb);
+
+    if (frame->isVoiceActive) {
+        m_hangoverRemaining = m_config.hangoverFrames;
+        frame->isGateOpen = true;
+    } else if (m_hangoverRemaining > 0) {
+        --m_hangoverRemaining;
+        frame->isGateOpen = true;
+    } else {
+        frame->isGateOpen = false;
+    }
+
+    if (frame->isGateOpen) {
+        m_silentFrameCount = 0;
+        while (!m_preRoll.empty()) {
+            auto preRollFrame = m_preRoll.front();
+            m_preRoll.pop_front();
+            preRollFrame->isGateOpen = true;
+            deliverFrame(preRollFrame);
+        }
+        deliverFrame(frame);
+        return;
+    }
+
+    ++m_silentFrameCount;
+    if (m_config.silentFrameStride > 0 && 0 == m_silentFrameCount % m_config.silentFrameStride) {
+        // Frames held back are older than this one, so they can no longer be delivered in order.
+        m_preRoll.clear();
+        deliverFrame(frame);
+        return;
+    }
+    if (m_config.preRollFrames > 0) {
+        if (m_preRoll.size() == m_config.preRollFrames) {
+            m_preRoll.pop_front();
+        }
+        m_preRoll.push_back(frame);
+    }
+}
+
+void AudioFrontEnd::deliverFrame(std::shared_ptr<AudioFrame> frame) {
+    {
+        std::lock_guard<std::mutex> lock(m_indexMutex);
+        frame->deliveredIndex = m_nextDeliveredIndex;
+        m_nextDeliveredIndex += frame->samples.size();
+        bool isContiguous = false;
+        if (!m_indexSegments.empty()) {
+            auto& last = m_indexSegments.back();
+            isContiguous = last.streamIndex + (frame->deliveredIndex - last.deliveredIndex) == frame->streamIndex;
+        }
+        if (!isContiguous) {
+            if (m_indexSegments.size() == MAX_INDEX_SEGMENTS) {
+                m_indexSegments.pop_front();
+            }
+            m_indexSegments.push_back({frame->deliveredIndex, frame->streamIndex});
+        }
+    }
+
+    std::shared_ptr<const AudioFrame> sharedFrame = frame;
+    std::lock_guard<std::mutex> deliveryLock(m_deliveryMutex);
+    std::shared_ptr<const ConsumerList> consumers;
+    {
+        std::lock_guard<std::mutex> lock(m_consumersMutex);
+        consumers = m_consumers;
+    }
+    for (auto& consumer : *consumers) {
+        consumer->onAudioFrame(sharedFrame);
+    }
+}
+
+void AudioFrontEnd::notifyStopped(KeyWordDetectorStateObserverInterface::KeyWordDetectorState state) {
+    std::lock_guard<std::mutex> deliveryLock(m_deliveryMutex);
+    std::shared_ptr<const ConsumerList> consumers;
+    {
+        std::lock_guard<std::mutex> lock(m_consumersMutex);
+        consumers = m_consumers;
+    }
+    for (auto& consumer : *consumers) {
+        consumer->onFrontEndStopped(state);
+    }
+}
+
+}  // namespace acsdkKWDImplementations
+}  // namespace alexaClientSDK
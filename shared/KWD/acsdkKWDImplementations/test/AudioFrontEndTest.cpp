@@ -0,0 +1,313 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <acsdkKWDInterfaces/AudioFrameConsumerInterface.h>
+#include <AVSCommon/AVS/AudioInputStream.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+
+#include "acsdkKWDImplementations/AudioFrontEnd.h"
+
+namespace alexaClientSDK {
+namespace acsdkKWDImplementations {
+namespace test {
+
+using namespace acsdkKWDInterfaces;
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils;
+
+/// The sample rate of the test audio.
+static const unsigned int SAMPLE_RATE_HZ = 16000;
+
+/// The number of samples in a 10 ms frame at @c SAMPLE_RATE_HZ.
+static const size_t FRAME_SAMPLES = 160;
+
+/// The number of words the test stream can hold, which is enough that the front-end never overruns.
+static const size_t STREAM_WORDS = FRAME_SAMPLES * 200;
+
+/// Amplitude of the background noise, which is about -70 dBFS.
+static const int16_t NOISE_AMPLITUDE = 10;
+
+/// Amplitude of the speech, which is about -10 dBFS.
+static const int16_t SPEECH_AMPLITUDE = 10000;
+
+/// How long to wait for the front-end to process the audio written so far.
+static const std::chrono::seconds TIMEOUT(5);
+
+/// A consumer which records what it receives.
+class TestConsumer : public AudioFrameConsumerInterface {
+public:
+    /**
+     * Constructor.
+     */
+    TestConsumer() :
+            m_isStopped{false},
+            m_stoppedState{KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE} {
+    }
+
+    void onAudioFrame(const std::shared_ptr<const AudioFrame>& frame) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_frames.push_back(frame);
+    }
+
+    void onFrontEndStopped(KeyWordDetectorStateObserverInterface::KeyWordDetectorState state) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopped = true;
+        m_stoppedState = state;
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Wait for the front-end to stop.
+     *
+     * @return Whether the front-end stopped before the timeout.
+     */
+    bool waitForStopped() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, TIMEOUT, [this] { return m_isStopped; });
+    }
+
+    /// The frames received so far.
+    std::vector<std::shared_ptr<const AudioFrame>> getFrames() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_frames;
+    }
+
+    /// Why the front-end stopped.
+    KeyWordDetectorStateObserverInterface::KeyWordDetectorState getStoppedState() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stoppedState;
+    }
+
+private:
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when the front-end stops.
+    std::condition_variable m_wakeTrigger;
+
+    /// The frames received so far.
+    std::vector<std::shared_ptr<const AudioFrame>> m_frames;
+
+    /// Whether the front-end has stopped.
+    bool m_isStopped;
+
+    /// Why the front-end stopped.
+    KeyWordDetectorStateObserverInterface::KeyWordDetectorState m_stoppedState;
+};
+
+/// Test fixture for @c AudioFrontEnd.
+class AudioFrontEndTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto bufferSize = AudioInputStream::calculateBufferSize(STREAM_WORDS, sizeof(int16_t), 1);
+        m_stream = AudioInputStream::create(std::make_shared<AudioInputStream::Buffer>(bufferSize), sizeof(int16_t), 1);
+        ASSERT_TRUE(m_stream);
+        m_writer = m_stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+        ASSERT_TRUE(m_writer);
+
+        m_format.encoding = AudioFormat::Encoding::LPCM;
+        m_format.endianness = AudioFormat::Endianness::LITTLE;
+        m_format.sampleRateHz = SAMPLE_RATE_HZ;
+        m_format.sampleSizeInBits = 16;
+        m_format.numChannels = 1;
+        m_format.dataSigned = true;
+        m_format.layout = AudioFormat::Layout::INTERLEAVED;
+
+        m_config.frameDuration = std::chrono::milliseconds(10);
+    }
+
+    /**
+     * Write frames of a square wave to the stream.
+     *
+     * @param amplitude The amplitude of the wave.
+     * @param frames The number of frames to write.
+     */
+    void writeFrames(int16_t amplitude, size_t frames) {
+        std::vector<int16_t> samples(FRAME_SAMPLES * frames);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = (i % 2) ? amplitude : -amplitude;
+        }
+        ASSERT_EQ(static_cast<ssize_t>(samples.size()), m_writer->write(samples.data(), samples.size()));
+    }
+
+    /// The stream of test audio.
+    std::shared_ptr<AudioInputStream> m_stream;
+
+    /// The writer of test audio.
+    std::unique_ptr<AudioInputStream::Writer> m_writer;
+
+    /// The format of the test audio.
+    AudioFormat m_format;
+
+    /// The front-end settings under test.
+    AudioFrontEnd::Config m_config;
+};
+
+/// Tests that @c create() rejects a null stream, unsupported formats and an empty frame.
+TEST_F(AudioFrontEndTest, test_createWithInvalidArguments) {
+    EXPECT_FALSE(AudioFrontEnd::create(nullptr, m_format, m_config));
+
+    auto stereo = m_format;
+    stereo.numChannels = 2;
+    EXPECT_FALSE(AudioFrontEnd::create(m_stream, stereo, m_config));
+
+    auto opus = m_format;
+    opus.encoding = AudioFormat::Encoding::OPUS;
+    EXPECT_FALSE(AudioFrontEnd::create(m_stream, opus, m_config));
+
+    auto emptyFrame = m_config;
+    emptyFrame.frameDuration = std::chrono::milliseconds(0);
+    EXPECT_FALSE(AudioFrontEnd::create(m_stream, m_format, emptyFrame));
+}
+
+/// Tests that silence is not delivered, and that speech is delivered with the configured pre-roll and hangover.
+TEST_F(AudioFrontEndTest, test_speechIsDeliveredWithPreRollAndHangover) {
+    m_config.preRollFrames = 3;
+    m_config.hangoverFrames = 2;
+    auto frontEnd = AudioFrontEnd::create(m_stream, m_format, m_config);
+    ASSERT_TRUE(frontEnd);
+    auto consumer = std::make_shared<TestConsumer>();
+    ASSERT_TRUE(frontEnd->addConsumer(consumer));
+
+    writeFrames(NOISE_AMPLITUDE, 10);
+    writeFrames(SPEECH_AMPLITUDE, 2);
+    writeFrames(NOISE_AMPLITUDE, 10);
+    m_writer->close();
+    ASSERT_TRUE(consumer->waitForStopped());
+    EXPECT_EQ(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::STREAM_CLOSED, consumer->getStoppedState());
+
+    auto frames = consumer->getFrames();
+    ASSERT_EQ(7u, frames.size());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        EXPECT_EQ((7 + i) * FRAME_SAMPLES, frames[i]->streamIndex);
+        EXPECT_EQ(i * FRAME_SAMPLES, frames[i]->deliveredIndex);
+        EXPECT_TRUE(frames[i]->isGateOpen);
+        bool isSpeech = (i == 3 || i == 4);
+        EXPECT_EQ(isSpeech, frames[i]->isVoiceActive);
+        EXPECT_EQ(isSpeech, frames[i]->energyDb > -20.0f);
+    }
+}
+
+/// Tests that indices among the delivered samples are mapped back to the stream across skipped silence.
+TEST_F(AudioFrontEndTest, test_getStreamIndexAcrossSkippedSilence) {
+    m_config.preRollFrames = 0;
+    m_config.hangoverFrames = 0;
+    auto frontEnd = AudioFrontEnd::create(m_stream, m_format, m_config);
+    ASSERT_TRUE(frontEnd);
+    auto consumer = std::make_shared<TestConsumer>();
+    ASSERT_TRUE(frontEnd->addConsumer(consumer));
+
+    writeFrames(NOISE_AMPLITUDE, 5);
+    writeFrames(SPEECH_AMPLITUDE, 1);
+    writeFrames(NOISE_AMPLITUDE, 10);
+    writeFrames(SPEECH_AMPLITUDE, 1);
+    m_writer->close();
+    ASSERT_TRUE(consumer->waitForStopped());
+    ASSERT_EQ(2u, consumer->getFrames().size());
+
+    AudioInputStream::Index streamIndex = 0;
+    ASSERT_TRUE(frontEnd->getStreamIndex(5, &streamIndex));
+    EXPECT_EQ(5 * FRAME_SAMPLES + 5, streamIndex);
+    ASSERT_TRUE(frontEnd->getStreamIndex(FRAME_SAMPLES + 5, &streamIndex));
+    EXPECT_EQ(16 * FRAME_SAMPLES + 5, streamIndex);
+    ASSERT_TRUE(frontEnd->getStreamIndex(2 * FRAME_SAMPLES, &streamIndex));
+    EXPECT_EQ(17 * FRAME_SAMPLES, streamIndex);
+    EXPECT_FALSE(frontEnd->getStreamIndex(2 * FRAME_SAMPLES + 1, &streamIndex));
+}
+
+/// Tests that consumers share frames, and that a silent frame stride down-clocks silence.
+TEST_F(AudioFrontEndTest, test_consumersShareDownClockedSilentFrames) {
+    m_config.preRollFrames = 0;
+    m_config.silentFrameStride = 3;
+    auto frontEnd = AudioFrontEnd::create(m_stream, m_format, m_config);
+    ASSERT_TRUE(frontEnd);
+    auto consumer = std::make_shared<TestConsumer>();
+    auto anotherConsumer = std::make_shared<TestConsumer>();
+    ASSERT_TRUE(frontEnd->addConsumer(consumer));
+    ASSERT_TRUE(frontEnd->addConsumer(anotherConsumer));
+    EXPECT_FALSE(frontEnd->addConsumer(consumer));
+
+    writeFrames(NOISE_AMPLITUDE, 9);
+    m_writer->close();
+    ASSERT_TRUE(consumer->waitForStopped());
+    ASSERT_TRUE(anotherConsumer->waitForStopped());
+
+    auto frames = consumer->getFrames();
+    ASSERT_EQ(3u, frames.size());
+    EXPECT_EQ(frames, anotherConsumer->getFrames());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        EXPECT_EQ((2 + 3 * i) * FRAME_SAMPLES, frames[i]->streamIndex);
+        EXPECT_FALSE(frames[i]->isGateOpen);
+    }
+}
+
+/// Tests that a removed consumer receives nothing further.
+TEST_F(AudioFrontEndTest, test_removedConsumerIsNotCalled) {
+    m_config.silentFrameStride = 1;
+    auto frontEnd = AudioFrontEnd::create(m_stream, m_format, m_config);
+    ASSERT_TRUE(frontEnd);
+    auto consumer = std::make_shared<TestConsumer>();
+    auto removedConsumer = std::make_shared<TestConsumer>();
+    ASSERT_TRUE(frontEnd->addConsumer(consumer));
+    ASSERT_TRUE(frontEnd->addConsumer(removedConsumer));
+    ASSERT_TRUE(frontEnd->removeConsumer(removedConsumer));
+    EXPECT_FALSE(frontEnd->removeConsumer(removedConsumer));
+
+    writeFrames(NOISE_AMPLITUDE, 4);
+    m_writer->close();
+    ASSERT_TRUE(consumer->waitForStopped());
+    EXPECT_EQ(4u, consumer->getFrames().size());
+    EXPECT_TRUE(removedConsumer->getFrames().empty());
+}
+
+/// Tests that audio in the opposite endianness is delivered in platform endianness.
+TEST_F(AudioFrontEndTest, test_framesAreInPlatformEndianness) {
+    int num = 1;
+    bool isPlatformLittleEndian = (*reinterpret_cast<char*>(&num) == 1);
+    m_format.endianness = isPlatformLittleEndian ? AudioFormat::Endianness::BIG : AudioFormat::Endianness::LITTLE;
+    m_config.silentFrameStride = 1;
+    auto frontEnd = AudioFrontEnd::create(m_stream, m_format, m_config);
+    ASSERT_TRUE(frontEnd);
+    EXPECT_NE(m_format.endianness, frontEnd->getAudioFormat().endianness);
+    auto consumer = std::make_shared<TestConsumer>();
+    ASSERT_TRUE(frontEnd->addConsumer(consumer));
+
+    std::vector<int16_t> swapped(FRAME_SAMPLES);
+    for (size_t i = 0; i < swapped.size(); ++i) {
+        auto value = static_cast<uint16_t>(i);
+        swapped[i] = static_cast<int16_t>((value << 8) | (value >> 8));
+    }
+    ASSERT_EQ(static_cast<ssize_t>(swapped.size()), m_writer->write(swapped.data(), swapped.size()));
+    m_writer->close();
+    ASSERT_TRUE(consumer->waitForStopped());
+
+    auto frames = consumer->getFrames();
+    ASSERT_EQ(1u, frames.size());
+    for (size_t i = 0; i < FRAME_SAMPLES; ++i) {
+        ASSERT_EQ(static_cast<int16_t>(i), frames[0]->samples[i]);
+    }
+}
+
+}  // namespace test
+}  // namespace acsdkKWDImplementations
+}  // namespace alexaClientSDK
@@ -0,0 +1,73 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKKWDINTERFACES_AUDIOFRAME_H_
+#define ACSDKKWDINTERFACES_AUDIOFRAME_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <AVSCommon/AVS/AudioInputStream.h>
+
+namespace alexaClientSDK {
+namespace acsdkKWDInterfaces {
+
+/**
+ * A frame of 16 bit LPCM audio read from an @c AudioInputStream by an audio front-end, together with the annotations
+ * the front-end computed for it.  Frames are shared between all consumers of the front-end and must not be modified.
+ */
+struct AudioFrame {
+    /**
+     * Constructor.
+     */
+    AudioFrame();
+
+    /// The samples of the frame, in platform endianness.
+    std::vector<int16_t> samples;
+
+    /// The index in the @c AudioInputStream of the first sample of the frame.
+    avsCommon::avs::AudioInputStream::Index streamIndex;
+
+    /**
+     * The number of samples delivered to consumers before this frame.  Unlike @c streamIndex, this index has no gaps
+     * where silent frames were skipped, so it matches the sample count of an engine fed every frame it receives.
+     */
+    avsCommon::avs::AudioInputStream::Index deliveredIndex;
+
+    /// The energy of the frame in dB relative to full scale.
+    float energyDb;
+
+    /// Whether voice activity was detected in this frame.
+    bool isVoiceActive;
+
+    /**
+     * Whether the frame is part of a voiced region, which includes the frames immediately before and after voice
+     * activity.  Consumers which receive frames outside of a voiced region may run a cheaper inference on them.
+     */
+    bool isGateOpen;
+};
+
+inline AudioFrame::AudioFrame() :
+        streamIndex{0},
+        deliveredIndex{0},
+        energyDb{0.0f},
+        isVoiceActive{false},
+        isGateOpen{false} {
+}
+
+}  // namespace acsdkKWDInterfaces
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKKWDINTERFACES_AUDIOFRAME_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKKWDINTERFACES_AUDIOFRAMECONSUMERINTERFACE_H_
+#define ACSDKKWDINTERFACES_AUDIOFRAMECONSUMERINTERFACE_H_
+
+#include <memory>
+
+#include <AVSCommon/SDKInterfaces/KeyWordDetectorStateObserverInterface.h>
+
+#include "acsdkKWDInterfaces/AudioFrame.h"
+
+namespace alexaClientSDK {
+namespace acsdkKWDInterfaces {
+
+/**
+ * Interface for consumers, typically keyword detectors, of the frames produced by an audio front-end.
+ *
+ * All methods are called on the front-end's thread, so implementations should return quickly.
+ */
+class AudioFrameConsumerInterface {
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~AudioFrameConsumerInterface() = default;
+
+    /**
+     * Called with each frame delivered to consumers, in stream order.
+     *
+     * @param frame The frame.  The consumer may keep a reference to it.
+     */
+    virtual void onAudioFrame(const std::shared_ptr<const AudioFrame>& frame) = 0;
+
+    /**
+     * Called once when the front-end stops reading from its stream.  No frames are delivered after this call.
+     *
+     * @param state Why the front-end stopped, either @c STREAM_CLOSED or @c ERROR.
+     */
+    virtual void onFrontEndStopped(
+        avsCommon::sdkInterfaces::KeyWordDetectorStateObserverInterface::KeyWordDetectorState state) = 0;
+};
+
+}  // namespace acsdkKWDInterfaces
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKKWDINTERFACES_AUDIOFRAMECONSUMERINTERFACE_H_
@@ -0,0 +1,56 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ACSDKMANUFACTORY_CONSTRUCTIONOPTIONS_H_
+#define ACSDKMANUFACTORY_CONSTRUCTIONOPTIONS_H_
+
+#include <cstddef>
+#include <memory>
+
+#include <AVSCommon/Utils/Timing/StartupTrace.h>
+
+namespace alexaClientSDK {
+namespace acsdkManufactory {
+
+/**
+ * Options controlling how a @c Manufactory instantiates its primary and required types.
+ */
+struct ConstructionOptions {
+    /**
+     * Constructor.  The default options instantiate types one at a time on the calling thread, without a trace.
+     */
+    ConstructionOptions();
+
+    /**
+     * Maximum number of threads used to instantiate primary and required types, including the calling thread.
+     *
+     * With a value greater than one, types whose dependencies have all been instantiated are instantiated
+     * concurrently.  Primary types (and their dependencies) are still all instantiated before any other type.  This
+     * is only safe if factories do not rely on being called in any order other than the one implied by their
+     * dependencies.
+     */
+    size_t maxThreads;
+
+    /// If not null, the time taken to instantiate each type is recorded in this trace with the category "construct".
+    std::shared_ptr<avsCommon::utils::timing::StartupTrace> trace;
+};
+
+inline ConstructionOptions::ConstructionOptions() : maxThreads{1} {
+}
+
+}  // namespace acsdkManufactory
+}  // namespace alexaClientSDK
+
+#endif  // ACSDKMANUFACTORY_CONSTRUCTIONOPTIONS_H_
@@ -314,6 +314,21 @@ public:
      */
     bool doRequiredGets(RuntimeManufactory& runtimeManufactory);
 
+    /**
+     * Instantiate the primary and required types registered with this CookBook (and their dependencies) on up to
+     * @c maxThreads threads, including the calling thread.  A type is instantiated once all of its dependencies
+     * have been, so independent types are instantiated concurrently.  All primary types are instantiated before any
+     * other type.
+     *
+     * Types with a @c UNIQUE or @c UNLOADABLE lifecycle are not cached, so they are left to be created by the types
+     * which depend on them.  This does not report failures; @c doRequiredGets() should be called afterwards to
+     * check that all the instances were created.
+     *
+     * @param runtimeManufactory The @c RuntimeManufactory in which to instantiate the types.
+     * @param maxThreads The maximum number of threads to use.
+     */
+    void instantiateConcurrently(RuntimeManufactory& runtimeManufactory, size_t maxThreads);
+
     /**
      * Create a new instance @c Type and return it via @c std::unique_ptr<>.
      *
@@ -333,6 +348,14 @@ public:
     template <typename Type>
     std::unique_ptr<AbstractPointerCache> createPointerCache();
 
+    /**
+     * Create a @c PointerCache<Type> for the specified type.
+     *
+     * @param type The @c TypeIndex of the type of object to be cached.
+     * @return A new @c PointerCache<Type> instance, or nullptr if there is no recipe for @c type.
+     */
+    std::unique_ptr<AbstractPointerCache> createPointerCache(TypeIndex type);
+
 private:
     /**
      * A recipe that wraps a function pointer to a factory that can create new instances of a type.
@@ -781,6 +804,13 @@ private:
          */
         ConstGetWrapperIterator end() const;
 
+        /**
+         * Get the types of the @c GetWrappers in this collection.
+         *
+         * @return The types, in the same order as the @c GetWrappers.
+         */
+        std::vector<TypeIndex> getTypes() const;
+
     private:
         /// Map of TypeIndex to the index of the GetWrapper in m_orderedGetWrappers.
         std::unordered_map<TypeIndex, std::size_t> m_types;
@@ -813,6 +843,21 @@ private:
      */
     bool addRecipe(TypeIndex type, const std::shared_ptr<AbstractRecipe>& newRecipe);
 
+    /**
+     * Instantiate a set of types and their dependencies concurrently.  See @c instantiateConcurrently().
+     *
+     * @param runtimeManufactory The @c RuntimeManufactory in which to instantiate the types.
+     * @param maxThreads The maximum number of threads to use.
+     * @param types The types to instantiate.
+     * @param[in,out] instantiated Types which have already been instantiated.  Types instantiated by this call are
+     * added to it.
+     */
+    void instantiateConcurrently(
+        RuntimeManufactory& runtimeManufactory,
+        size_t maxThreads,
+        const std::vector<TypeIndex>& types,
+        std::unordered_set<TypeIndex>* instantiated);
+
     /**
      * Check this cookbook for cyclic dependency relationships.
      *
@@ -666,27 +666,7 @@ inline std::unique_ptr<Type> CookBook::createUniquePointer(RuntimeManufactory& r
 
 template <typename Type>
 inline std::unique_ptr<AbstractPointerCache> CookBook::createPointerCache() {
-    if (!checkIsValid(__func__)) {
-        return std::unique_ptr<SharedPointerCache>();
-    }
-
-    auto type = getTypeIndex<Type>();
-    auto it = m_recipes.find(type);
-    if (it != m_recipes.end()) {
-        if (it->second) {
-            auto recipe = it->second;
-            if (AbstractRecipe::CachedInstanceLifecycle::UNLOADABLE == recipe->getLifecycle()) {
-                return std::unique_ptr<WeakPointerCache>(new WeakPointerCache(recipe));
-            }
-            return std::unique_ptr<SharedPointerCache>(new SharedPointerCache(recipe));
-        } else {
-            markInvalid("createPointerCacheFailed", "null Recipe for type: ", type.getName());
-            return std::unique_ptr<SharedPointerCache>();
-        }
-    }
-
-    markInvalid("createPointerCacheFailed", "no Recipe for type", type.getName());
-    return std::unique_ptr<SharedPointerCache>();
+    return createPointerCache(getTypeIndex<Type>());
 }
 
 inline CookBook::CookBook() :
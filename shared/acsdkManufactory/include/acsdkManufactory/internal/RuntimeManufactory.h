@@ -17,11 +17,15 @@
 #define ACSDKMANUFACTORY_INTERNAL_RUNTIMEMANUFACTORY_H_
 
 #include <memory>
+#include <mutex>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
 
+#include <AVSCommon/Utils/Timing/StartupTrace.h>
+
 #include "acsdkManufactory/Annotated.h"
+#include "acsdkManufactory/ConstructionOptions.h"
 #include "acsdkManufactory/internal/AbstractPointerCache.h"
 #include "acsdkManufactory/internal/TypeIndex.h"
 
@@ -34,6 +38,9 @@ class CookBook;
 /**
  * @c RuntimeManufactory provides instances of interfaces supported by a @c CookBook, automatically
  * creating instances of other interfaces that the requested instance depends upon.
+ *
+ * This class is thread safe.  Concurrent requests for the same cached type are serialized, so only one
+ * instance is created.
  */
 class RuntimeManufactory {
 public:
@@ -41,8 +48,9 @@ public:
      * Constructor.
      *
      * @param cookBook The @c CookBook that specifies the recipes for the instances to be provided.
+     * @param options How to instantiate the primary and required types of @c cookBook.
      */
-    RuntimeManufactory(const CookBook& cookBook);
+    RuntimeManufactory(const CookBook& cookBook, const ConstructionOptions& options = ConstructionOptions());
 
     /**
      * Get an instance of the specified @c Type.
@@ -53,7 +61,55 @@ public:
     template <typename Type>
     Type get();
 
+    /**
+     * Instantiate the cached value of a type, if it has not been instantiated already.  This is used by @c CookBook
+     * to instantiate types without knowing their C++ type.
+     *
+     * @param type The @c TypeIndex of the type to instantiate.  Its recipe must have a lifecycle which keeps the
+     * instance cached for the lifetime of this @c RuntimeManufactory.
+     */
+    void instantiate(TypeIndex type);
+
 private:
+    /// A cache of the instance of one type.
+    struct CacheEntry {
+        /**
+         * Constructor.
+         *
+         * @param cache The cache of the instance.
+         */
+        CacheEntry(std::unique_ptr<AbstractPointerCache> cache);
+
+        /// Serializes getting the instance from @c cache.  Held while the instance is created, so that a concurrent
+        /// request for the same type waits for it.
+        std::mutex mutex;
+
+        /// The cache of the instance.
+        std::unique_ptr<AbstractPointerCache> cache;
+
+        /// Whether the first get() from @c cache has been made (and traced).
+        bool isInitialized;
+    };
+
+    /**
+     * Get the @c CacheEntry for a type, creating it if needed.
+     *
+     * @param type The @c TypeIndex of the type.
+     * @return The @c CacheEntry, or nullptr if there is no recipe for @c type.
+     */
+    std::shared_ptr<CacheEntry> getCacheEntry(TypeIndex type);
+
+    /**
+     * Get the instance from a @c CacheEntry, recording the time taken to create it in @c m_trace the first time.
+     *
+     * @note @c entry.mutex must be held.
+     *
+     * @param type The @c TypeIndex of the type cached by @c entry.
+     * @param entry The @c CacheEntry from which to get the instance.
+     * @return A void* to the cached value. See @c AbstractPointerCache::get().
+     */
+    void* getInstanceLocked(TypeIndex type, CacheEntry& entry);
+
     /**
      * Get a std::unique_ptr<Type>
      *
@@ -85,8 +141,14 @@ private:
     /// The @c CookBook to use to create instances of requested interfaces.
     std::unique_ptr<CookBook> m_cookBook;
 
+    /// Trace in which to record the time taken to create instances, or nullptr.
+    std::shared_ptr<avsCommon::utils::timing::StartupTrace> m_trace;
+
+    /// Serializes access to @c m_values.
+    std::mutex m_valuesMutex;
+
     /// Map from interface types to cached values.
-    std::unordered_map<TypeIndex, std::shared_ptr<AbstractPointerCache>> m_values;
+    std::unordered_map<TypeIndex, std::shared_ptr<CacheEntry>> m_values;
 };
 
 }  // namespace internal
@@ -25,8 +25,18 @@ namespace alexaClientSDK {
 namespace acsdkManufactory {
 namespace internal {
 
-inline RuntimeManufactory::RuntimeManufactory(const CookBook& cookBook) : m_cookBook{new CookBook{cookBook}} {
+inline RuntimeManufactory::RuntimeManufactory(const CookBook& cookBook, const ConstructionOptions& options) :
+        m_cookBook{new CookBook{cookBook}},
+        m_trace{options.trace} {
+    auto start = avsCommon::utils::timing::StartupTrace::Clock::now();
+    if (options.maxThreads > 1) {
+        m_cookBook->instantiateConcurrently(*this, options.maxThreads);
+    }
     m_cookBook->doRequiredGets(*this);
+    if (m_trace) {
+        m_trace->addSpan(
+            "construct", "RuntimeManufactory", start, avsCommon::utils::timing::StartupTrace::Clock::now());
+    }
 }
 
 template <typename Type>
@@ -46,17 +56,11 @@ inline std::shared_ptr<Type> RuntimeManufactory::innerGet(std::shared_ptr<Type>*
     ResultType ret;
 
     auto resultTypeIndex = getTypeIndex<ResultType>();
-
-    auto it = m_values.find(resultTypeIndex);
-    if (m_values.end() == it || !it->second) {
-        std::shared_ptr<AbstractPointerCache> cache(std::move(m_cookBook->createPointerCache<ResultType>()));
-        m_values[resultTypeIndex] = cache;
-        ret = *static_cast<ResultType*>(cache->get(*this));
-        cache->cleanup();
-    } else {
-        auto cache = static_cast<AbstractPointerCache*>(it->second.get());
-        ret = *static_cast<ResultType*>(cache->get(*this));
-        cache->cleanup();
+    auto entry = getCacheEntry(resultTypeIndex);
+    if (entry) {
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        ret = *static_cast<ResultType*>(getInstanceLocked(resultTypeIndex, *entry));
+        entry->cache->cleanup();
     }
 
     return ret;
@@ -68,17 +72,11 @@ inline Annotated<Annotation, Type> RuntimeManufactory::innerGet(Annotated<Annota
     ResultType ret;
 
     auto resultTypeIndex = getTypeIndex<ResultType>();
-
-    auto it = m_values.find(resultTypeIndex);
-    if (m_values.end() == it || !it->second) {
-        std::shared_ptr<AbstractPointerCache> cache(std::move(m_cookBook->createPointerCache<ResultType>()));
-        m_values[resultTypeIndex] = cache;
-        ret = *static_cast<std::shared_ptr<Type>*>(cache->get(*this));
-        cache->cleanup();
-    } else {
-        auto cache = static_cast<AbstractPointerCache*>(it->second.get());
-        ret = *static_cast<std::shared_ptr<Type>*>(cache->get(*this));
-        cache->cleanup();
+    auto entry = getCacheEntry(resultTypeIndex);
+    if (entry) {
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        ret = *static_cast<std::shared_ptr<Type>*>(getInstanceLocked(resultTypeIndex, *entry));
+        entry->cache->cleanup();
     }
 
     return ret;
@@ -13,6 +13,12 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include "acsdkManufactory/internal/CookBook.h"
@@ -95,6 +101,119 @@ bool CookBook::checkForCyclicDependencies() {
     return true;
 }
 
+void CookBook::instantiateConcurrently(RuntimeManufactory& runtimeManufactory, size_t maxThreads) {
+    if (!checkIsValid(__func__)) {
+        return;
+    }
+
+    std::unordered_set<TypeIndex> instantiated;
+    instantiateConcurrently(runtimeManufactory, maxThreads, m_primaryGets->getTypes(), &instantiated);
+    instantiateConcurrently(runtimeManufactory, maxThreads, m_requiredGets->getTypes(), &instantiated);
+}
+
+void CookBook::instantiateConcurrently(
+    RuntimeManufactory& runtimeManufactory,
+    size_t maxThreads,
+    const std::vector<TypeIndex>& types,
+    std::unordered_set<TypeIndex>* instantiated) {
+    // A type in the dependency graph, with the number of its dependencies which have yet to be instantiated, and the
+    // types which depend upon it.
+    struct Node {
+        bool isCached;
+        size_t pendingDependencies;
+        std::vector<TypeIndex> dependents;
+    };
+
+    // Build the graph of the types to instantiate and all of their dependencies which have not been instantiated.
+    std::unordered_map<TypeIndex, Node> nodes;
+    std::stack<TypeIndex> toVisit;
+    for (auto type : types) {
+        toVisit.push(type);
+    }
+    while (!toVisit.empty()) {
+        auto type = toVisit.top();
+        toVisit.pop();
+        if (instantiated->count(type) || nodes.count(type)) {
+            continue;
+        }
+        auto recipeIt = m_recipes.find(type);
+        if (m_recipes.end() == recipeIt || !recipeIt->second) {
+            ACSDK_ERROR(LX("instantiateConcurrentlyFailed").d("reason", "noRecipe").d("type", type.getName()));
+            return;
+        }
+        auto& recipe = recipeIt->second;
+        auto lifecycle = recipe->getLifecycle();
+        auto& node = nodes[type];
+        node.isCached = AbstractRecipe::CachedInstanceLifecycle::UNIQUE != lifecycle &&
+                        AbstractRecipe::CachedInstanceLifecycle::UNLOADABLE != lifecycle;
+        node.pendingDependencies = 0;
+        std::unordered_set<TypeIndex> dependencies{recipe->begin(), recipe->end()};
+        for (auto dependency : dependencies) {
+            if (!instantiated->count(dependency)) {
+                node.pendingDependencies++;
+                toVisit.push(dependency);
+            }
+        }
+    }
+    for (auto& item : nodes) {
+        std::unordered_set<TypeIndex> dependencies{m_recipes[item.first]->begin(), m_recipes[item.first]->end()};
+        for (auto dependency : dependencies) {
+            auto dependencyIt = nodes.find(dependency);
+            if (nodes.end() != dependencyIt) {
+                dependencyIt->second.dependents.push_back(item.first);
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable wakeTrigger;
+    std::deque<TypeIndex> ready;
+    size_t remaining = nodes.size();
+    for (auto& item : nodes) {
+        if (0 == item.second.pendingDependencies) {
+            ready.push_back(item.first);
+        }
+    }
+
+    // Each worker instantiates ready types until every type has been instantiated.  The CookBook has been checked for
+    // cyclic dependencies, so some type is always ready or being instantiated until then.
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            wakeTrigger.wait(lock, [&] { return !ready.empty() || 0 == remaining; });
+            if (ready.empty()) {
+                return;
+            }
+            auto type = ready.front();
+            ready.pop_front();
+            auto& node = nodes[type];
+            if (node.isCached) {
+                lock.unlock();
+                runtimeManufactory.instantiate(type);
+                lock.lock();
+            }
+            instantiated->insert(type);
+            remaining--;
+            for (auto dependent : node.dependents) {
+                if (0 == --nodes[dependent].pendingDependencies) {
+                    ready.push_back(dependent);
+                }
+            }
+            wakeTrigger.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    auto threadCount = std::min(maxThreads, nodes.size());
+    for (size_t i = 1; i < threadCount; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
 void CookBook::logDependencies() const {
     ACSDK_INFO(LX(__func__));
     for (const auto& item : m_recipes) {
@@ -137,6 +256,29 @@ void CookBook::deleteFunctionForInstanceRecipe(void* cachedValue) {
     delete objectToDelete;
 }
 
+std::unique_ptr<AbstractPointerCache> CookBook::createPointerCache(TypeIndex type) {
+    if (!checkIsValid(__func__)) {
+        return nullptr;
+    }
+
+    auto it = m_recipes.find(type);
+    if (it != m_recipes.end()) {
+        if (it->second) {
+            auto recipe = it->second;
+            if (AbstractRecipe::CachedInstanceLifecycle::UNLOADABLE == recipe->getLifecycle()) {
+                return std::unique_ptr<WeakPointerCache>(new WeakPointerCache(recipe));
+            }
+            return std::unique_ptr<SharedPointerCache>(new SharedPointerCache(recipe));
+        } else {
+            markInvalid("createPointerCacheFailed", "null Recipe for type: ", type.getName());
+            return nullptr;
+        }
+    }
+
+    markInvalid("createPointerCacheFailed", "no Recipe for type", type.getName());
+    return nullptr;
+}
+
 ////////// CookBook::FactoryRecipe
 
 CookBook::FactoryRecipe::FactoryRecipe(
@@ -258,6 +400,14 @@ CookBook::GetWrapperCollection::ConstGetWrapperIterator CookBook::GetWrapperColl
     return m_orderedGetWrappers.end();
 }
 
+std::vector<TypeIndex> CookBook::GetWrapperCollection::getTypes() const {
+    std::vector<TypeIndex> types(m_orderedGetWrappers.size(), getTypeIndex<CookBook>());
+    for (const auto& item : m_types) {
+        types[item.second] = item.first;
+    }
+    return types;
+}
+
 }  // namespace internal
 }  // namespace acsdkManufactory
 }  // namespace alexaClientSDK
@@ -0,0 +1,65 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "acsdkManufactory/internal/RuntimeManufactory.h"
+
+namespace alexaClientSDK {
+namespace acsdkManufactory {
+namespace internal {
+
+RuntimeManufactory::CacheEntry::CacheEntry(std::unique_ptr<AbstractPointerCache> cache) :
+        cache{std::move(cache)},
+        isInitialized{false} {
+}
+
+void RuntimeManufactory::instantiate(TypeIndex type) {
+    auto entry = getCacheEntry(type);
+    if (entry) {
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        getInstanceLocked(type, *entry);
+        entry->cache->cleanup();
+    }
+}
+
+std::shared_ptr<RuntimeManufactory::CacheEntry> RuntimeManufactory::getCacheEntry(TypeIndex type) {
+    std::lock_guard<std::mutex> lock(m_valuesMutex);
+    auto& entry = m_values[type];
+    if (!entry) {
+        auto cache = m_cookBook->createPointerCache(type);
+        if (!cache) {
+            m_values.erase(type);
+            return nullptr;
+        }
+        entry = std::make_shared<CacheEntry>(std::move(cache));
+    }
+    return entry;
+}
+
+void* RuntimeManufactory::getInstanceLocked(TypeIndex type, CacheEntry& entry) {
+    if (entry.isInitialized || !m_trace) {
+        entry.isInitialized = true;
+        return entry.cache->get(*this);
+    }
+
+    auto start = avsCommon::utils::timing::StartupTrace::Clock::now();
+    auto instance = entry.cache->get(*this);
+    m_trace->addSpan("construct", type.getName(), start, avsCommon::utils::timing::StartupTrace::Clock::now());
+    entry.isInitialized = true;
+    return instance;
+}
+
+}  // namespace internal
+}  // namespace acsdkManufactory
+}  // namespace alexaClientSDK
@@ -15,13 +15,17 @@
 
 /// @file ManufactoryTest.cpp
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "acsdkManufactory/Component.h"
 #include "acsdkManufactory/ComponentAccumulator.h"
+#include "acsdkManufactory/ConstructionOptions.h"
 #include "acsdkManufactory/Manufactory.h"
 #include "acsdkManufactory/OptionalImport.h"
 
@@ -727,6 +731,123 @@ TEST_F(ManufactoryTest, test_withOptionalImportUsesProvidedImplementation) {
     EXPECT_EQ(manufactory->get<shared_ptr<Type1>>()->m_dependency, myDependency);
 }
 
+// ----- test_concurrentManufacture -----
+
+/// Time taken by each slow factory.
+static const std::chrono::milliseconds SLOW_FACTORY_DURATION{100};
+
+/// Number of slow factories currently running.
+static std::atomic<int> g_runningSlowFactories{0};
+
+/// The largest number of slow factories seen running at the same time.
+static std::atomic<int> g_maxRunningSlowFactories{0};
+
+/// The construction order of the next instance of @c Ordered.
+static std::atomic<int> g_nextConstructionOrder{0};
+
+/**
+ * Template class recording the order in which its instances are constructed.
+ *
+ * @tparam X Number used to differentiate types.
+ */
+template <int X>
+class Ordered {
+public:
+    /**
+     * Constructor.
+     */
+    Ordered() : order{g_nextConstructionOrder++} {
+    }
+
+    /// The construction order of this instance.
+    const int order;
+};
+
+/**
+ * Factory which takes @c SLOW_FACTORY_DURATION to create an instance, tracking how many run at the same time.
+ *
+ * @tparam X Number used to differentiate types.
+ * @return A new instance of Ordered<X>.
+ */
+template <int X>
+static shared_ptr<Ordered<X>> createSlowOrdered() {
+    auto running = ++g_runningSlowFactories;
+    auto maxRunning = g_maxRunningSlowFactories.load();
+    while (running > maxRunning && !g_maxRunningSlowFactories.compare_exchange_weak(maxRunning, running)) {
+    }
+    this_thread::sleep_for(SLOW_FACTORY_DURATION);
+    --g_runningSlowFactories;
+    return make_shared<Ordered<X>>();
+}
+
+/**
+ * Factory for a type depending on the two slow types.
+ *
+ * @param first The first slow dependency.
+ * @param second The second slow dependency.
+ * @return A new instance of Ordered<3>, or nullptr if a dependency is missing.
+ */
+static shared_ptr<Ordered<3>> createDependentOrdered(shared_ptr<Ordered<1>> first, shared_ptr<Ordered<2>> second) {
+    if (!first || !second) {
+        return nullptr;
+    }
+    return make_shared<Ordered<3>>();
+}
+
+/**
+ * Factory for a primary type.
+ *
+ * @return A new instance of Ordered<0>.
+ */
+static shared_ptr<Ordered<0>> createPrimaryOrdered() {
+    return make_shared<Ordered<0>>();
+}
+
+/// Alias for the Manufactory used by test_concurrentManufacture.
+using ConcurrentTestManufactory =
+    Manufactory<shared_ptr<Ordered<0>>, shared_ptr<Ordered<1>>, shared_ptr<Ordered<2>>, shared_ptr<Ordered<3>>>;
+
+/**
+ * Definition of a component with a required type that depends on two independent slow types, and a primary type.
+ *
+ * @return The component.
+ */
+Component<shared_ptr<Ordered<0>>, shared_ptr<Ordered<1>>, shared_ptr<Ordered<2>>, shared_ptr<Ordered<3>>>
+getConcurrentTestComponent() {
+    return ComponentAccumulator<>()
+        .addRequiredFactory(createDependentOrdered)
+        .addRetainedFactory(createSlowOrdered<1>)
+        .addRetainedFactory(createSlowOrdered<2>)
+        .addPrimaryFactory(createPrimaryOrdered);
+}
+
+/**
+ * Verify that independent types are instantiated concurrently, after primary types and before the types which depend
+ * on them, and that their construction is traced.
+ */
+TEST_F(ManufactoryTest, test_concurrentManufacture) {
+    ConstructionOptions options;
+    options.maxThreads = 4;
+    options.trace = avsCommon::utils::timing::StartupTrace::create();
+    auto manufactory = ConcurrentTestManufactory::create(getConcurrentTestComponent(), options);
+    ASSERT_TRUE(manufactory);
+
+    EXPECT_EQ(g_maxRunningSlowFactories, 2);
+
+    auto v0 = manufactory->get<shared_ptr<Ordered<0>>>();
+    auto v1 = manufactory->get<shared_ptr<Ordered<1>>>();
+    auto v2 = manufactory->get<shared_ptr<Ordered<2>>>();
+    auto v3 = manufactory->get<shared_ptr<Ordered<3>>>();
+    ASSERT_TRUE(v0 && v1 && v2 && v3);
+    EXPECT_LT(v0->order, v1->order);
+    EXPECT_LT(v0->order, v2->order);
+    EXPECT_GT(v3->order, v1->order);
+    EXPECT_GT(v3->order, v2->order);
+
+    // One span for each type, and one for the whole construction.
+    EXPECT_EQ(options.trace->getSpanCount(), 5u);
+}
+
 }  // namespace test
 }  // namespace acsdkManufactory
 }  // namespace alexaClientSDK
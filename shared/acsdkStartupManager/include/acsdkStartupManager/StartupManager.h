@@ -40,6 +40,7 @@ public:
     /// @name StartupManagerInterface methods.
     /// @{
     bool startup() override;
+    bool startup(const std::shared_ptr<avsCommon::utils::timing::StartupTrace>& trace) override;
     /// @}
 
 private:
@@ -13,7 +13,12 @@
  * permissions and limitations under the License.
  */
 
+#ifdef ACSDK_USE_RTTI
+#include <typeinfo>
+#endif
+
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Timing/StartupTrace.h>
 
 #include "acsdkStartupManager/StartupManager.h"
 
@@ -59,6 +64,22 @@ static void notifyObserverOfStartup(bool* result, std::shared_ptr<RequiresStartu
     }
 }
 
+/**
+ * Get the name used to trace the startup of an observer.
+ *
+ * @param observer The observer.
+ * @param index The position of the observer in the startup sequence.
+ * @return The name of the observer.
+ */
+static std::string getObserverName(const std::shared_ptr<RequiresStartupInterface>& observer, size_t index) {
+#ifdef ACSDK_USE_RTTI
+    auto& instance = *observer;
+    return typeid(instance).name();
+#else
+    return "RequiresStartupInterface#" + std::to_string(index);
+#endif
+}
+
 std::shared_ptr<StartupManagerInterface> StartupManager::createStartupManagerInterface(
     const std::shared_ptr<StartupNotifierInterface>& notifier) {
     if (!notifier) {
@@ -70,13 +91,29 @@ std::shared_ptr<StartupManagerInterface> StartupManager::createStartupManagerInt
 }
 
 bool StartupManager::startup() {
+    return startup(nullptr);
+}
+
+bool StartupManager::startup(const std::shared_ptr<avsCommon::utils::timing::StartupTrace>& trace) {
     if (!m_notifier) {
         ACSDK_ERROR(LX("startupAlreadyCalled"));
         return false;
     }
     bool result = true;
-    m_notifier->notifyObservers(
-        [&result](std::shared_ptr<RequiresStartupInterface> observer) { notifyObserverOfStartup(&result, observer); });
+    size_t index = 0;
+    m_notifier->notifyObservers([&result, &trace, &index](std::shared_ptr<RequiresStartupInterface> observer) {
+        if (!trace) {
+            notifyObserverOfStartup(&result, observer);
+            return;
+        }
+        auto start = avsCommon::utils::timing::StartupTrace::Clock::now();
+        notifyObserverOfStartup(&result, observer);
+        trace->addSpan(
+            "startup",
+            getObserverName(observer, index++),
+            start,
+            avsCommon::utils::timing::StartupTrace::Clock::now());
+    });
     m_notifier.reset();
     return result;
 }
@@ -20,6 +20,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <AVSCommon/Utils/Timing/StartupTrace.h>
+
 #include "acsdkStartupManager/StartupManager.h"
 #include "acsdkStartupManager/StartupNotifier.h"
 
@@ -128,6 +130,24 @@ TEST_F(StartupManagerTest, test_complexFailureCase) {
     ASSERT_FALSE(startupManager->startup());
 }
 
+/**
+ * Verify that the startup of each observer is recorded in a trace.
+ */
+TEST_F(StartupManagerTest, test_startupWithTrace) {
+    auto startupNotifier = std::make_shared<StartupNotifier>();
+    auto startupManager = StartupManager::createStartupManagerInterface(startupNotifier);
+    auto requiresStartup0 = std::make_shared<MockRequiresStartup>();
+    auto requiresStartup1 = std::make_shared<MockRequiresStartup>();
+    auto trace = avsCommon::utils::timing::StartupTrace::create();
+
+    EXPECT_CALL(*requiresStartup0, startup()).WillOnce(Invoke(returnTrue));
+    EXPECT_CALL(*requiresStartup1, startup()).WillOnce(Invoke(returnTrue));
+    startupNotifier->addObserver(requiresStartup0);
+    startupNotifier->addObserver(requiresStartup1);
+    ASSERT_TRUE(startupManager->startup(trace));
+    ASSERT_EQ(trace->getSpanCount(), 2u);
+}
+
 }  // namespace test
 }  // namespace acsdkStartupManager
 }  // namespace alexaClientSDK
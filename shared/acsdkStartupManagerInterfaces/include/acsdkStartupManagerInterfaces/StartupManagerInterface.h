@@ -16,7 +16,19 @@
 #ifndef ACSDKSTARTUPMANAGERINTERFACES_STARTUPMANAGERINTERFACE_H_
 #define ACSDKSTARTUPMANAGERINTERFACES_STARTUPMANAGERINTERFACE_H_
 
+#include <memory>
+
 namespace alexaClientSDK {
+
+namespace avsCommon {
+namespace utils {
+namespace timing {
+/// Forward declaration.
+class StartupTrace;
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+
 namespace acsdkStartupManagerInterfaces {
 
 /**
@@ -39,8 +51,20 @@ public:
      * @return Whether the startup sequence ran to completion.
      */
     virtual bool startup() = 0;
+
+    /**
+     * Trigger the startup sequence, recording the time each observer takes to start up.
+     *
+     * @param trace The trace in which to record the startup of each observer, with the category "startup".
+     * @return Whether the startup sequence ran to completion.
+     */
+    virtual bool startup(const std::shared_ptr<avsCommon::utils::timing::StartupTrace>& trace);
 };
 
+inline bool StartupManagerInterface::startup(const std::shared_ptr<avsCommon::utils::timing::StartupTrace>& trace) {
+    return startup();
+}
+
 }  // namespace acsdkStartupManagerInterfaces
 }  // namespace alexaClientSDK
 